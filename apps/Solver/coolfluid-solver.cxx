@@ -4,20 +4,24 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <set>
 
 #include "boost/filesystem/operations.hpp" // includes boost/filesystem/path.hpp
 #include "boost/filesystem/fstream.hpp"    
 #include "boost/regex.hpp"                 
 
+#include "Common/BenchmarkTimers.hh"
 #include "Common/Exception.hh"
 #include "Common/OSystem.hh"
 #include "Common/ProcessInfo.hh"
 #include "Common/PE.hh"
 #include "Common/StringOps.hh"
 #include "Common/BadValueException.hh"
+#include "Common/Stopwatch.hh"
 
 #include "Config/ConfigObject.hh"
 #include "Config/ConfigFileReader.hh"
@@ -42,6 +46,10 @@
 #include "PluginsRegister.hh"
 #endif
 
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -71,6 +79,8 @@ class AppOptions : public Config::ConfigObject {
       options.addConfigOption< std::string > ("conf",    "Path to solver environment conf file");
       options.addConfigOption< std::string > ("bdir",    "Path of base dir to preced all file and dir paths.");
       options.addConfigOption< std::vector<std::string> >("ldir", "The list of dir paths where to search for module plug-in libraries. Paths are fully qualified and not preceeded with base dir.");
+      options.addConfigOption< std::string > ("benchmark", "Path of the JSON file where to write the timings of the main phases of the simulation.");
+      options.addConfigOption< CFuint >   ("nbsteps", "Run exactly this number of steps, overriding the stop condition of the CFcase.");
     }
 
     /// Constructor
@@ -85,7 +95,9 @@ class AppOptions : public Config::ConfigObject {
       scase_file(""),
       conf_file("coolfluid-solver.xml"),
       base_dir(""),
-      libDir(0)
+      libDir(0),
+      benchmark_file(""),
+      nb_steps(0)
     {
       addConfigOptionsTo(this);
       setParameter( "wait",   &wait        );
@@ -99,6 +111,8 @@ class AppOptions : public Config::ConfigObject {
       setParameter( "conf",   &conf_file );
       setParameter( "bdir",   &base_dir     );
       setParameter( "ldir",   &libDir)     ;
+      setParameter( "benchmark", &benchmark_file );
+      setParameter( "nbsteps", &nb_steps );
     }
 
     /// Checks the validity of the command line options
@@ -144,12 +158,116 @@ class AppOptions : public Config::ConfigObject {
       std::string conf_file;
       std::string base_dir;
       std::vector<std::string> libDir;
+      std::string benchmark_file;
+      CFuint nb_steps;
       /// where to put the configuration options
       ConfigArgs solver_conf;
 };
 
 //////////////////////////////////////////////////////////////////////////////
 
+/// Writes the timings of a benchmark run in JSON format.
+/// The times and the memory are the maximum over the processors.
+void writeBenchmarkFile(const AppOptions& options, const CFreal totalTime)
+{
+  BenchmarkTimers& timers = BenchmarkTimers::getInstance();
+  const std::vector<std::string>& localNames = timers.getNames();
+  const CFuint nbProcs = PE::GetPE().GetProcessorCount("Default");
+  
+  // a processor can skip a phase (or enter the phases in another order):
+  // the phases are matched by name over the union of all the processors
+  std::set<std::string> nameSet(localNames.begin(), localNames.end());
+#ifdef CF_HAVE_MPI
+  MPI_Comm comm = PE::GetPE().GetCommunicator("Default");
+  std::vector<char> localList;
+  for (CFuint i = 0; i < localNames.size(); ++i) {
+    localList.insert(localList.end(), localNames[i].begin(), localNames[i].end());
+    localList.push_back('\n');
+  }
+  int localSize = localList.size();
+  std::vector<int> listSizes(nbProcs, 0);
+  std::vector<int> listDispls(nbProcs, 0);
+  MPI_Allgather(&localSize, 1, MPI_INT, &listSizes[0], 1, MPI_INT, comm);
+  for (CFuint iProc = 1; iProc < nbProcs; ++iProc) {
+    listDispls[iProc] = listDispls[iProc-1] + listSizes[iProc-1];
+  }
+  
+  // one more entry avoids taking the address of an empty vector
+  std::vector<char> allLists(listDispls[nbProcs-1] + listSizes[nbProcs-1] + 1);
+  localList.push_back('\n');
+  MPI_Allgatherv(&localList[0], localSize, MPI_CHAR,
+		 &allLists[0], &listSizes[0], &listDispls[0], MPI_CHAR, comm);
+  
+  std::string name = "";
+  for (CFuint i = 0; i + 1 < allLists.size(); ++i) {
+    if (allLists[i] == '\n') {
+      nameSet.insert(name);
+      name.clear();
+    }
+    else {
+      name += allLists[i];
+    }
+  }
+#endif
+  const std::vector<std::string> names(nameSet.begin(), nameSet.end());
+  const CFuint nbPhases = names.size();
+  
+  // time, calls and, if tracked, memory high-water mark and allocations
+  // of each phase, followed by the total time and the peak memory
+  const CFuint nbValues = (timers.isMemoryTracked()) ? 4 : 2;
+  std::vector<CFreal> values(nbPhases*nbValues + 2, 0.);
+  for (CFuint i = 0; i < localNames.size(); ++i) {
+    const CFuint id = std::lower_bound(names.begin(), names.end(), localNames[i]) - names.begin();
+    values[id*nbValues]   = timers.getTimes()[i];
+    values[id*nbValues+1] = timers.getNbCalls()[i];
+    if (timers.isMemoryTracked()) {
+      values[id*nbValues+2] = timers.getMaxMemory()[i];
+      values[id*nbValues+3] = timers.getNbPhaseAllocs()[i];
+    }
+  }
+  values[nbPhases*nbValues]   = totalTime;
+  values[nbPhases*nbValues+1] = OSystem::getInstance().getProcessInfo()->peakMemoryUsageBytes();
+  
+#ifdef CF_HAVE_MPI
+  std::vector<CFreal> localValues = values;
+  MPI_Allreduce(&localValues[0], &values[0], (int)values.size(),
+		MPIStructDef::getMPIType(&localValues[0]), MPI_MAX, comm);
+#endif
+  
+  if (PE::GetPE().GetRank("Default") > 0) return;
+  
+  ofstream fout(options.benchmark_file.c_str());
+  if (!fout) {
+    throw Common::BadValueException
+      (FromHere(), "Cannot open benchmark file " + options.benchmark_file);
+  }
+  
+  fout.precision(8);
+  fout << "{\n"
+       << "  \"case\": \"" << options.scase_file << "\",\n"
+       << "  \"nbProcs\": " << nbProcs << ",\n"
+       << "  \"nbSteps\": " << options.nb_steps << ",\n"
+       << "  \"totalTime\": " << values[nbPhases*nbValues] << ",\n"
+       << "  \"peakMemoryBytes\": " << values[nbPhases*nbValues+1] << ",\n"
+       << "  \"residual\": " << SimulationStatus::getInstance().getLastResidual() << ",\n"
+       << "  \"phases\": {";
+  for (CFuint i = 0; i < nbPhases; ++i) {
+    fout << ((i > 0) ? ",\n" : "\n")
+	 << "    \"" << names[i] << "\": {\"time\": " << values[i*nbValues]
+	 << ", \"calls\": " << values[i*nbValues+1];
+    if (timers.isMemoryTracked()) {
+      fout << ", \"maxMemoryBytes\": " << values[i*nbValues+2]
+	   << ", \"allocs\": " << values[i*nbValues+3];
+    }
+    fout << "}";
+  }
+  fout << "\n  }\n}\n";
+  
+  CFLog(INFO, "Benchmark timings written in " << options.benchmark_file << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 int main(int argc, char** argv)
 {
   using namespace boost;
@@ -320,6 +438,13 @@ int main(int argc, char** argv)
     // create the simulator
     SharedPtr < Simulator > sim ( new Simulator("Simulator") );
     sim->setFactoryRegistry(fRegistry);
+    if (options.nb_steps > 0) {
+      ConfigArgs overriding_args;
+      overriding_args["Simulator.SubSystem.StopCondition"] = "MaxNumberSteps";
+      overriding_args["Simulator.SubSystem.MaxNumberSteps.nbSteps"] = 
+	StringOps::to_str(options.nb_steps);
+      sim->setOverridingArgs(overriding_args);
+    }
     // give him the file to configure from
     sim->openCaseFile(casefile.string());
     
@@ -349,8 +474,19 @@ int main(int argc, char** argv)
     }
 
     // maestro takes control of simulation
+    Stopwatch<WallTime> benchTimer;
+    if (options.benchmark_file != "") {
+      BenchmarkTimers::getInstance().enable();
+      benchTimer.start();
+    }
+    
     maestro->call_signal ( "control", msg );
     
+    if (options.benchmark_file != "") {
+      benchTimer.stop();
+      writeBenchmarkFile(options, benchTimer.read());
+    }
+    
     // if a target residual has been set in the CFcase file, run the following test
     if ( options.residual != MathConsts::CFrealMax()) {
       const CFreal totalResidual = SimulationStatus::getInstance().getLastResidual();
@@ -19,6 +19,11 @@ IF( CF_ENABLE_LLONG )
 ELSE ()
   OPTION(CF_HAVE_LLONG   "CFuint is not set to long long int" OFF )
 ENDIF() 
+IF( CF_ENABLE_LONG_GLOBAL_IDS )
+  OPTION(CF_HAVE_LONG_GLOBAL_IDS   "CFgid (global indices in the parallel communication) is set to long long unsigned int" ON )
+ELSE ()
+  OPTION(CF_HAVE_LONG_GLOBAL_IDS   "CFgid (global indices) is set to CFuint" OFF )
+ENDIF() 
 
 # precision real numbers
 IF ( NOT CF_PRECISION_SINGLE )
@@ -71,11 +76,17 @@ OPTION ( CF_ENABLE_INTERNAL_DEPS      "Enable internal dependencies between libr
 OPTION ( CF_ENABLE_AUTOMATIC_UPDATE_MODULES  "Enable automatic subversion update of the plugins" OFF  )
 OPTION ( CF_ENABLE_TESTCASES          "Enable checking testcases from CMake system" ON )
 OPTION ( CF_ENABLE_UNITTESTS          "Enable creation of unit tests"            OFF )
+OPTION ( CF_ENABLE_BENCHMARKS         "Enable creation of benchmarks (make benchmark)" OFF )
 OPTION ( CF_ENABLE_WARNINGS           "Enable lots of warnings while compiling"  ON )
 OPTION ( CF_ENABLE_STDASSERT          "Enable standard assert() functions "  ON )
 
 OPTION ( CF_ENABLE_PARALLEL_VERBOSE   "Enable extra output in the parallel interface" OFF  )
 OPTION ( CF_ENABLE_PARALLEL_DEBUG     "Enable debug code on the parallel interface"  OFF  )
+OPTION ( CF_ENABLE_ARRAY_ALLOC_COUNT  "Enable counting the allocations of RealVector and RealMatrix" OFF  )
+OPTION ( CF_ENABLE_SMALL_ARRAYS       "Enable the inline storage of small RealVector and RealMatrix" OFF  )
+
+SET    ( CF_SMALLVEC_SIZE "4" CACHE STRING "Max size of the RealVector's stored without heap allocation" )
+SET    ( CF_SMALLMAT_SIZE "9" CACHE STRING "Max number of entries of the RealMatrix's stored without heap allocation" )
 
 OPTION ( CF_CMAKE_LIST_PLUGINS             "CMake lists the plugins"                 OFF  )
 
@@ -36,3 +36,4 @@ INCLUDE(macros/CFWarnOrphanFiles)
 INCLUDE(macros/CFCheckFileLength)
 INCLUDE(macros/CFAddCompilationFlags)
 INCLUDE(macros/CFAddTestCase)
+INCLUDE(macros/CFAddBenchmark)
@@ -0,0 +1,119 @@
+# Function to add a benchmark.
+#
+# Mandatory keywords (one of):
+# - MICRO
+#      name of a micro-benchmark executable, built from the sources given in CPP
+#      and linked to LIBS, which takes as only argument the JSON file to write
+# - BCASE
+#      relative_to_source dir/name of a CFcase to run with coolfluid-solver
+#      for NBSTEPS steps (default 10), in the directory CASEDIR, copying the
+#      files CASEFILES in the build tree (the benchmark is skipped with a
+#      warning if one of them is missing)
+#
+# Optional keywords:
+# - MPI
+#      number of processors to use for call with mpirun (default: serial run)
+#
+# The master switch is CF_ENABLE_BENCHMARKS.
+#
+# Each benchmark writes the timings of its phases in
+# ${CMAKE_BINARY_DIR}/benchmarks/<name>_<serial|Nprocs>.json, so that the same
+# case can be registered with different numbers of processors, and has the
+# ctest label "benchmark",
+# so that all of them are run by "make benchmark" (or "ctest -L benchmark").
+# The JSON files can be compared to a baseline with tools/scripts/compare-benchmarks.py
+
+function( cf_add_benchmark )
+
+  if( NOT CF_ENABLE_BENCHMARKS )
+    return()
+  endif()
+
+  set( single_value_args MICRO BCASE CASEDIR NBSTEPS MPI )
+  set( multi_value_args  CPP LIBS CASEFILES )
+
+  # parse and complain if stg wrong with the arguments
+  cmake_parse_arguments(_PAR "" "${single_value_args}" "${multi_value_args}" ${ARGN})
+  if(_PAR_UNPARSED_ARGUMENTS)
+    message(FATAL_ERROR "Unknown keywords given to cf_add_benchmark(): \"${_PAR_UNPARSED_ARGUMENTS}\"")
+  endif()
+  if( (NOT _PAR_MICRO) AND (NOT _PAR_BCASE) )
+    message(FATAL_ERROR "The call to cf_add_benchmark() doesn't set the required \"MICRO/BCASE\" argument.")
+  endif()
+
+  if( _PAR_MPI AND (NOT CF_HAVE_MPI) )
+    return()
+  endif()
+  if( _PAR_MPI )
+    set( _BENCH_RUN "${_PAR_MPI}procs" )
+  else()
+    set( _BENCH_RUN "serial" )
+  endif()
+
+  set( _BENCH_DIR ${CMAKE_BINARY_DIR}/benchmarks )
+  file( MAKE_DIRECTORY ${_BENCH_DIR} )
+
+  if(_PAR_MICRO)
+
+    set( _BENCH_NAME "bench-${_PAR_MICRO}" )
+    add_executable( ${_BENCH_NAME} ${_PAR_CPP} )
+    if( DEFINED _PAR_LIBS )
+      target_link_libraries( ${_BENCH_NAME} ${_PAR_LIBS} )
+    endif()
+    set( _BENCH_COMMAND ${_BENCH_NAME} ${_BENCH_DIR}/${_BENCH_NAME}_${_BENCH_RUN}.json )
+
+  else()
+
+    set( _BENCH_CASE ${CMAKE_CURRENT_SOURCE_DIR}/${_PAR_CASEDIR}/${_PAR_BCASE} )
+    string( REPLACE "${CMAKE_SOURCE_DIR}/" "" _BENCH_CASE_SHORT ${_BENCH_CASE} )
+    string( REPLACE ".CFcase" "" _BENCH_NAME ${_BENCH_CASE_SHORT} )
+    string( REPLACE "/" "-" _BENCH_NAME ${_BENCH_NAME} )
+    set( _BENCH_NAME "bench-${_BENCH_NAME}" )
+
+    if( NOT _PAR_NBSTEPS )
+      set( _PAR_NBSTEPS 10 )
+    endif()
+
+    # the files of the case may not be distributed with the sources
+    foreach( ACFG ${_PAR_CASEFILES} )
+      if( NOT EXISTS ${CMAKE_CURRENT_SOURCE_DIR}/${_PAR_CASEDIR}/${ACFG} )
+        message( WARNING "Benchmark ${_BENCH_NAME} is turned off because ${_PAR_CASEDIR}/${ACFG} is missing" )
+        return()
+      endif()
+    endforeach()
+
+    # copy the CFcase and the files it needs into the build tree
+    CONFIGURE_FILE ( ${_BENCH_CASE} ${CMAKE_BINARY_DIR}/${_BENCH_CASE_SHORT} @ONLY )
+    foreach( ACFG ${_PAR_CASEFILES} )
+      file( COPY ${CMAKE_CURRENT_SOURCE_DIR}/${_PAR_CASEDIR}/${ACFG}
+            DESTINATION ${CMAKE_CURRENT_BINARY_DIR}/${_PAR_CASEDIR} )
+    endforeach()
+
+    # create the working directory of the case
+    file( STRINGS ${_BENCH_CASE} _BENCH_WDIR REGEX "^[ \t]*Simulator.Paths.WorkingDir[ \t]*=" )
+    if( _BENCH_WDIR )
+      string( REGEX REPLACE ".*=[ \t]*([^ \t#]*).*" "\\1" _BENCH_WDIR "${_BENCH_WDIR}" )
+      file( MAKE_DIRECTORY "${CMAKE_BINARY_DIR}/${_BENCH_WDIR}" )
+    endif()
+
+    set( _BENCH_COMMAND "${coolfluid_solver_exe}"
+         "--scase" "${CMAKE_BINARY_DIR}/${_BENCH_CASE_SHORT}"
+         "--bdir"  "${COOLFluiD_SOURCE_DIR}"
+         "--ldir"  "${COOLFluiD_BINARY_DIR}/dso"
+         "--nbsteps" "${_PAR_NBSTEPS}"
+         "--benchmark" "${_BENCH_DIR}/${_BENCH_NAME}_${_BENCH_RUN}.json" )
+
+  endif()
+
+  if( _PAR_MPI )
+    add_test( NAME ${_BENCH_NAME}_${_BENCH_RUN} COMMAND ${CF_MPIRUN_PROGRAM} -np ${_PAR_MPI} ${_BENCH_COMMAND} )
+  else()
+    add_test( NAME ${_BENCH_NAME}_${_BENCH_RUN} COMMAND ${_BENCH_COMMAND} )
+  endif()
+  set_tests_properties( ${_BENCH_NAME}_${_BENCH_RUN} PROPERTIES LABELS benchmark )
+
+  set( CF_ENABLED_BENCHMARKS ${CF_ENABLED_BENCHMARKS} ${_BENCH_NAME}_${_BENCH_RUN} CACHE INTERNAL "" )
+
+endfunction( )
+
+##############################################################################
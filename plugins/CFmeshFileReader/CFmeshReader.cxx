@@ -101,11 +101,12 @@ void CFmeshReader::generateMeshDataImpl()
   CFAUTOTRACE;
 
   // convert only if m_converterStr != "CFmesh", which assumes
-  // that you create the mesh from CFmesh format
+  // that you create the mesh from CFmesh format, and if the
+  // CFmesh content is not given in memory
   
   CFLog(VERBOSE, "CFmeshReader::generateMeshDataImpl() => start\n"); 
   
-  if (m_converterStr != "CFmesh")
+  if (m_converterStr != "CFmesh" && m_data->getMeshBuffer().isNull())
   {
     convertFormat();
     CFLog(VERBOSE,"CFmeshReader : finished converting\n");
@@ -234,6 +235,13 @@ void CFmeshReader::modifyFileName(const std::string filename)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void CFmeshReader::setMeshBuffer(Common::SafePtr<const std::string> buffer)
+{
+  m_data->setMeshBuffer(buffer);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void CFmeshReader::configure ( Config::ConfigArgs& args )
 {
   CFAUTOTRACE;
@@ -52,6 +52,10 @@ public: // functions
   /// Modify the filename of the Mesh
   virtual void modifyFileName(const std::string filename);
 
+  /// Set a buffer in memory holding the CFmesh content to read instead of
+  /// the file, or CFNULL to read the file again
+  virtual void setMeshBuffer(Common::SafePtr<const std::string> buffer);
+
 protected: // abstract interface implementations
 
   /// Gets the Data aggregator of this method
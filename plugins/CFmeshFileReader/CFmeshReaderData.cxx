@@ -70,7 +70,8 @@ void CFmeshReaderData::defineConfigOptions(Config::OptionList& options)
 //////////////////////////////////////////////////////////////////////////////
 
 CFmeshReaderData::CFmeshReaderData(Common::SafePtr<Framework::Method> owner)
-  : MeshCreatorData(owner)
+  : MeshCreatorData(owner),
+    m_meshBuffer(CFNULL)
 {
   addConfigOptionsTo(this);
 
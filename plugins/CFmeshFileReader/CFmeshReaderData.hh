@@ -59,6 +59,19 @@ public: // functions
   {
    return m_solutionFile;
   } 
+
+  /// Sets the buffer in memory holding the CFmesh content to read
+  /// instead of the file (CFNULL to read the file)
+  void setMeshBuffer(Common::SafePtr<const std::string> buffer)
+  {
+    m_meshBuffer = buffer;
+  }
+
+  /// Gets the buffer in memory holding the CFmesh content to read
+  Common::SafePtr<const std::string> getMeshBuffer() const
+  {
+    return m_meshBuffer;
+  }
  
   /// Gets the flag if the mesh has to be translated
   bool isTranslated()
@@ -243,6 +256,9 @@ private: // data
   /// array driving a switch in node coordinates: e.g. [0,2,1] means to read [X,Y,Z] as [X,Z,Y]
   std::vector<CFuint> m_nodeSwitchIDs; 
 
+  /// buffer in memory holding the CFmesh content to read instead of the file
+  Common::SafePtr<const std::string> m_meshBuffer;
+
 }; // end of class CFmeshReaderData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@
 #include "Common/SwapEmpty.hh"
 #include "Common/BadValueException.hh"
 #include "Common/MPI/MPIIOFunctions.hh"
+#include "Common/ShuffleCompressor.hh"
 
 #include "Environment/FileHandlerInput.hh"
 #include "Environment/SingleBehaviorFactory.hh"
@@ -47,7 +48,8 @@ ParCFmeshBinaryFileReader::ParCFmeshBinaryFileReader() :
   ParCFmeshFileReader(), // here you have to pass the name of this object to configure
   m_mapString2ReaderFun(),
   m_fh(),
-  m_status()
+  m_status(),
+  m_isCompressedList(false)
 {
   addConfigOptionsTo(this);
   
@@ -108,6 +110,8 @@ void ParCFmeshBinaryFileReader::setMapString2Readers()
   m_mapString2ReaderFun["!SOL_POLYORDER"]      = &ParCFmeshBinaryFileReader::readSolutionPolyOrder;
   m_mapString2ReaderFun["!LIST_NODE"]          = &ParCFmeshBinaryFileReader::readNodeList;
   m_mapString2ReaderFun["!LIST_STATE"]         = &ParCFmeshBinaryFileReader::readStateList;
+  m_mapString2ReaderFun["!LIST_NODE_Z"]        = &ParCFmeshBinaryFileReader::readCompressedNodeList;
+  m_mapString2ReaderFun["!LIST_STATE_Z"]       = &ParCFmeshBinaryFileReader::readCompressedStateList;
   m_mapString2ReaderFun["!NB_TRSs"]            = &ParCFmeshBinaryFileReader::readNbTRSs;
   m_mapString2ReaderFun["!TRS_NAME"]           = &ParCFmeshBinaryFileReader::readTRSName;
   m_mapString2ReaderFun["!NB_TRs"]             = &ParCFmeshBinaryFileReader::readNbTRs;
@@ -1597,13 +1601,19 @@ void ParCFmeshBinaryFileReader::readNodeList(MPI_File* fh)
   MPI_Offset startPos = startListOffset + nbNodesUpToRank*nodeSize*sizeof(CFreal);
   const CFuint sizeRead = nbNodesPerProc[m_myRank]*nodeSize;
   vector<CFreal> buf(nbNodesPerProc[0]*nodeSize); // buffer is oversized 
+  MPI_Offset endPos = startListOffset + m_totNbNodes*nodeSize*sizeof(CFreal);
   
-  // each processor reads the portion of nodes that is associated to its rank
-  CFLog(VERBOSE, "ParCFmeshBinaryFileReader::readNodeList() => nodes read in position [" << startPos << 
-	", " << startPos + sizeRead*sizeof(CFreal) << "]\n");
-  
-  MPIIOFunctions::readAll("ParCFmeshBinaryFileReader::readNodeList()", fh, startPos, &buf[0], 
-			  (CFuint)sizeRead, m_maxBuffSize, m_comm, m_myRank);
+  if (m_isCompressedList) {
+    endPos = readCompressedList(fh, ranges[m_myRank], nodeSize, buf);
+  }
+  else {
+    // each processor reads the portion of nodes that is associated to its rank
+    CFLog(VERBOSE, "ParCFmeshBinaryFileReader::readNodeList() => nodes read in position [" << startPos << 
+	  ", " << startPos + sizeRead*sizeof(CFreal) << "]\n");
+    
+    MPIIOFunctions::readAll("ParCFmeshBinaryFileReader::readNodeList()", fh, startPos, &buf[0], 
+			    (CFuint)sizeRead, m_maxBuffSize, m_comm, m_myRank);
+  }
   
   vector<CFreal> localNodesData(m_localNodeIDs.size()*nodeSize);
   getLocalData(buf, ranges, m_localNodeIDs, nodeSize, localNodesData);
@@ -1617,7 +1627,6 @@ void ParCFmeshBinaryFileReader::readNodeList(MPI_File* fh)
   createNodesAll(localNodesData, ghostNodesData, nodes);
   
   MPI_Barrier(m_comm);
-  MPI_Offset endPos = startListOffset + m_totNbNodes*nodeSize*sizeof(CFreal);
   MPI_File_seek(*fh, endPos, MPI_SEEK_SET);
   
   CFLogDebugMin("m_localNodeIDs.size() = " << m_localNodeIDs.size() << "\n");
@@ -1648,7 +1657,7 @@ void ParCFmeshBinaryFileReader::createNodesAll(const vector<CFreal>& localNodesD
   }
   
   // create a sorted single list of all global IDs locally present 
-  vector<CFuint> globalIDs; globalIDs.reserve(nbLocalNodes);
+  vector<CFgid> globalIDs; globalIDs.reserve(nbLocalNodes);
   for (CFuint i = 0; i < m_localNodeIDs.size(); ++i) {
     globalIDs.push_back(m_localNodeIDs[i]);
   }
@@ -1666,7 +1675,7 @@ void ParCFmeshBinaryFileReader::createNodesAll(const vector<CFreal>& localNodesD
     CFuint localID = 0;
     bool isGhost = false;
     bool isFound = false;
-    const CFuint globalID = globalIDs[iNode];
+    const CFgid globalID = globalIDs[iNode];
     const vector<CFreal>* nodesData = NULL;
     CFuint* countBuf = NULL; 
     if (hasEntry(m_localNodeIDs, globalID)) {
@@ -1755,7 +1764,7 @@ void ParCFmeshBinaryFileReader::createStatesAll(const vector<CFreal>& localState
   }
   
   // create a sorted single list of all global IDs locally present 
-  vector<CFuint> globalIDs; globalIDs.reserve(nbLocalStates);
+  vector<CFgid> globalIDs; globalIDs.reserve(nbLocalStates);
   for (CFuint i = 0; i < m_localStateIDs.size(); ++i) {
     globalIDs.push_back(m_localStateIDs[i]);
   }
@@ -1776,7 +1785,7 @@ void ParCFmeshBinaryFileReader::createStatesAll(const vector<CFreal>& localState
     CFuint localID = 0;
     bool isGhost = false;
     bool isFound = false;
-    const CFuint globalID = globalIDs[iState];
+    const CFgid globalID = globalIDs[iState];
     const vector<CFreal>* statesData = NULL;
     CFuint* countBuf = NULL; 
     if (hasEntry(m_localStateIDs, globalID)) {
@@ -1947,7 +1956,7 @@ void ParCFmeshBinaryFileReader::setRecvDispl(const std::vector<int>& recvCount,
 
 void ParCFmeshBinaryFileReader::getLocalData(const vector<CFreal>& buf, 
 					     const vector<pair<CFuint, CFuint> > ranges,
-					     const vector<CFuint>& listIDs, 
+					     const vector<CFgid>& listIDs, 
 					     const CFuint nodeSize, 
 					     vector<CFreal>& recvBuf)
 {
@@ -2227,6 +2236,7 @@ void ParCFmeshBinaryFileReader::readStateList(MPI_File* fh)
     ghostStatesData.resize(m_ghostStateIDs.size()*stateSize);
   }
   
+  MPI_Offset endPos = startListOffset + m_totNbStates*stateSize*sizeof(CFreal);
   if (isWithSolution)  { 
     // set the number of states to read in each processor
     vector<CFuint> nbStatesPerProc(m_nbProc);
@@ -2240,12 +2250,17 @@ void ParCFmeshBinaryFileReader::readStateList(MPI_File* fh)
     const CFuint sizeRead = nbStatesPerProc[m_myRank]*stateSize;
     vector<CFreal> buf(nbStatesPerProc[0]*stateSize); // buffer is oversized 
     
-    // each processor reads the portion of nodes that is associated to its rank
-    CFLog(VERBOSE, "ParCFmeshBinaryFileReader::readStateList() => states read in position [" << startPos << 
-	  ", " << startPos + sizeRead*sizeof(CFreal) << "]\n");
-    
-    MPIIOFunctions::readAll("ParCFmeshBinaryFileReader::readStateList()", fh, startPos, &buf[0], 
-			    (CFuint)sizeRead, m_maxBuffSize, m_comm, m_myRank);
+    if (m_isCompressedList) {
+      endPos = readCompressedList(fh, ranges[m_myRank], stateSize, buf);
+    }
+    else {
+      // each processor reads the portion of nodes that is associated to its rank
+      CFLog(VERBOSE, "ParCFmeshBinaryFileReader::readStateList() => states read in position [" << startPos << 
+	    ", " << startPos + sizeRead*sizeof(CFreal) << "]\n");
+      
+      MPIIOFunctions::readAll("ParCFmeshBinaryFileReader::readStateList()", fh, startPos, &buf[0], 
+			      (CFuint)sizeRead, m_maxBuffSize, m_comm, m_myRank);
+    }
     getLocalData(buf, ranges, m_localStateIDs, stateSize, localStatesData);
     
     if (m_ghostStateIDs.size() > 0) {
@@ -2257,7 +2272,6 @@ void ParCFmeshBinaryFileReader::readStateList(MPI_File* fh)
   
   if (isWithSolution)  { 
     MPI_Barrier(m_comm);
-    MPI_Offset endPos = startListOffset + m_totNbStates*stateSize*sizeof(CFreal);
     MPI_File_seek(*fh, endPos, MPI_SEEK_SET);
   }
   
@@ -2266,6 +2280,82 @@ void ParCFmeshBinaryFileReader::readStateList(MPI_File* fh)
   
   CFLogDebugMin( "ParCFmeshBinaryFileReader::readStateList() end\n");
 }
+
+//////////////////////////////////////////////////////////////////////
+
+void ParCFmeshBinaryFileReader::readCompressedNodeList(MPI_File* fh)
+{
+  m_isCompressedList = true;
+  readNodeList(fh);
+  m_isCompressedList = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ParCFmeshBinaryFileReader::readCompressedStateList(MPI_File* fh)
+{
+  m_isCompressedList = true;
+  readStateList(fh);
+  m_isCompressedList = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+MPI_Offset ParCFmeshBinaryFileReader::readCompressedList
+(MPI_File* fh, const pair<CFuint, CFuint>& range, const CFuint stride, vector<CFreal>& buf)
+{
+  CFLogDebugMin( "ParCFmeshBinaryFileReader::readCompressedList() start\n");
+  
+  // read the chunk table
+  CFuint nbChunks = 0;
+  MPIIOFunctions::readScalar(fh, nbChunks);
+  vector<CFuint> firstIDs(nbChunks+1);
+  MPIIOFunctions::readArray(fh, &firstIDs[0], nbChunks+1);
+  vector<MPI_Offset> starts(nbChunks+1);
+  MPI_File_read_all(*fh, &starts[0], (int)(nbChunks+1), MPIStructDef::getMPIOffsetType(), &m_status);
+  
+  MPI_Offset dataStart;
+  MPI_File_get_position(*fh, &dataStart);
+  
+  if (nbChunks == 0 || firstIDs[0] != 0 || firstIDs[nbChunks] <= range.second) {
+    throw BadFormatException
+      (FromHere(), "ParCFmeshBinaryFileReader::readCompressedList() => invalid chunk table");
+  }
+  
+  // find the chunks overlapping the range of this rank
+  const CFuint first = (upper_bound(firstIDs.begin(), firstIDs.begin() + nbChunks, range.first) - 
+			firstIDs.begin()) - 1;
+  CFuint last = first + 1;
+  while (last < nbChunks && firstIDs[last] <= range.second) {++last;}
+  
+  // read them all at once
+  const CFuint readSize = starts[last] - starts[first];
+  vector<char> bytes(readSize);
+  CFLog(VERBOSE, "ParCFmeshBinaryFileReader::readCompressedList() => chunks [" << first << ", " << last 
+	<< ") read in position [" << dataStart + starts[first] << ", " << dataStart + starts[last] << "]\n");
+  MPIIOFunctions::readAll("ParCFmeshBinaryFileReader::readCompressedList()", fh, dataStart + starts[first], 
+			  &bytes[0], readSize, m_maxBuffSize, m_comm, m_myRank);
+  
+  // decompress them and keep the entities of the range
+  ShuffleCompressor compressor;
+  vector<CFreal> chunk;
+  for (CFuint c = first; c < last; ++c) {
+    chunk.resize((firstIDs[c+1] - firstIDs[c])*stride);
+    compressor.decompress(&bytes[starts[c] - starts[first]], (CFuint)(starts[c+1] - starts[c]), 
+			  &chunk[0], chunk.size());
+    
+    const CFuint from = std::max(firstIDs[c], range.first);
+    const CFuint to   = std::min(firstIDs[c+1] - 1, range.second);
+    cf_assert((to + 1 - range.first)*stride <= buf.size());
+    std::copy(chunk.begin() + (from - firstIDs[c])*stride, 
+	      chunk.begin() + (to + 1 - firstIDs[c])*stride, 
+	      buf.begin() + (from - range.first)*stride);
+  }
+  
+  CFLogDebugMin( "ParCFmeshBinaryFileReader::readCompressedList() end\n");
+  
+  return dataStart + starts[nbChunks];
+}
       
 //////////////////////////////////////////////////////////////////////
 
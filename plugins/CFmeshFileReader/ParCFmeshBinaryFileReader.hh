@@ -9,6 +9,7 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include "Common/NotImplementedException.hh"
 #include "CFmeshFileReader/ParCFmeshFileReader.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -39,6 +40,12 @@ public: // member functions
   /// @throw Common::FilesystemException
   virtual void readFromFile(const boost::filesystem::path& filepath);
   
+  /// Reading from a buffer in memory is not supported by this reader
+  virtual void readFromBuffer(const std::string& buffer)
+  {
+    throw Common::NotImplementedException (FromHere(), "ParCFmeshBinaryFileReader::readFromBuffer()");
+  }
+  
   /// Sets up private data
   virtual void setup();
   
@@ -173,6 +180,23 @@ private: // member functions
 
   /// Reads the list of state tensors and initialize the dofs
   void readStateList(MPI_File* fh);
+  
+  /// Reads the compressed list of nodes
+  void readCompressedNodeList(MPI_File* fh);
+  
+  /// Reads the compressed list of state tensors and initialize the dofs
+  void readCompressedStateList(MPI_File* fh);
+  
+  /// Reads and decompresses the chunks of a compressed node or state list
+  /// which overlap the given range of entities
+  /// @param range   first and last entity to read
+  /// @param stride  number of values per entity
+  /// @param buf     where to put the values of the entities of the range
+  /// @return the end of the list in the file
+  MPI_Offset readCompressedList(MPI_File* fh, 
+				const std::pair<CFuint, CFuint>& range,
+				const CFuint stride, 
+				std::vector<CFreal>& buf);
 
   /// Reads the data concerning the elements
   void readElementList(MPI_File* fh);
@@ -231,7 +255,7 @@ private: // member functions
   
   /// Set the donor rank and local ID corresponding to the given ID
   void setRankLocalID(const std::vector<std::pair<CFuint, CFuint> >& ranges, 
-		      const CFuint globalID, CFuint& donorRank, CFuint& donorLocalID) const
+		      const CFgid globalID, CFuint& donorRank, CFuint& donorLocalID) const
   {
     for (CFuint i = 0; i < ranges.size(); ++i) {
       if (globalID >= ranges[i].first && globalID <= ranges[i].second) {
@@ -255,7 +279,7 @@ private: // member functions
   /// Get the local (nodes or states) data
   void getLocalData(const std::vector<CFreal>& buf,
 		    const std::vector<std::pair<CFuint, CFuint> > ranges,
-		    const std::vector<CFuint>& listIDs,
+		    const std::vector<CFgid>& listIDs,
 		    const CFuint nodeSize, 
 		    std::vector<CFreal>& recvBuf);
   
@@ -289,6 +313,9 @@ private: // member functions
   /// maximu size of the buffer to write with MPI I/O
   int m_maxBuffSize;
   
+  /// flag telling if the list being read is compressed
+  bool m_isCompressedList;
+  
 }; // class ParCFmeshBinaryFileReader
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4,6 +4,7 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <limits>
 #include <numeric>
 
 #include <boost/progress.hpp>
@@ -254,7 +255,7 @@ void ParCFmeshFileReader::setMapString2Readers()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readCFVersion(ifstream& fin)
+void ParCFmeshFileReader::readCFVersion(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readCFVersion() start\n");
 
@@ -267,7 +268,7 @@ void ParCFmeshFileReader::readCFVersion(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readSvnVersion(ifstream& fin)
+void ParCFmeshFileReader::readSvnVersion(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readSvnVersion() start\n");
 
@@ -280,7 +281,7 @@ void ParCFmeshFileReader::readSvnVersion(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readCFmeshVersion(ifstream& fin)
+void ParCFmeshFileReader::readCFmeshVersion(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readCFmeshVersion() start\n");
 
@@ -293,7 +294,7 @@ void ParCFmeshFileReader::readCFmeshVersion(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readDimension(ifstream& fin)
+void ParCFmeshFileReader::readDimension(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readDimension() start\n");
 
@@ -314,7 +315,7 @@ void ParCFmeshFileReader::readDimension(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbEquations(ifstream& fin)
+void ParCFmeshFileReader::readNbEquations(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbEquations() start\n");
 
@@ -362,12 +363,13 @@ void ParCFmeshFileReader::readNbEquations(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbNodes(ifstream& fin)
+void ParCFmeshFileReader::readNbNodes(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbNodes() start\n");
 
   CFint nbNonUpdatableNodes = 0;
-  fin >> m_totNbNodes >> nbNonUpdatableNodes;
+  m_totNbNodes = readGlobalCount(fin, "nodes");
+  fin >> nbNonUpdatableNodes;
 
   // set the total number of nodes in the MeshData
   MeshDataStack::getActive()->setTotalNodeCount(m_totNbNodes);
@@ -391,12 +393,13 @@ void ParCFmeshFileReader::readNbNodes(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbStates(ifstream& fin)
+void ParCFmeshFileReader::readNbStates(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbStates() start\n");
 
   CFint nbNonUpdatableStates = 0;
-  fin >> m_totNbStates >> nbNonUpdatableStates;
+  m_totNbStates = readGlobalCount(fin, "states");
+  fin >> nbNonUpdatableStates;
 
   // set the total number of states in the MeshData
   MeshDataStack::getActive()->setTotalStateCount(m_totNbStates);
@@ -420,7 +423,7 @@ void ParCFmeshFileReader::readNbStates(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readStorePastStates(ifstream& fin)
+void ParCFmeshFileReader::readStorePastStates(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readStorePastStates() start\n");
 
@@ -438,7 +441,7 @@ void ParCFmeshFileReader::readStorePastStates(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readStorePastNodes(ifstream& fin)
+void ParCFmeshFileReader::readStorePastNodes(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readStorePastNodes() start\n");
 
@@ -456,7 +459,7 @@ void ParCFmeshFileReader::readStorePastNodes(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readStoreInterStates(ifstream& fin)
+void ParCFmeshFileReader::readStoreInterStates(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readStoreInterStates() start\n");
 
@@ -474,7 +477,7 @@ void ParCFmeshFileReader::readStoreInterStates(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readStoreInterNodes(ifstream& fin)
+void ParCFmeshFileReader::readStoreInterNodes(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readStoreInterNodes() start\n");
 
@@ -492,13 +495,29 @@ void ParCFmeshFileReader::readStoreInterNodes(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbElements(ifstream& fin)
+CFuint ParCFmeshFileReader::readGlobalCount(istream& fin, const std::string& what)
+{
+  // the count is read with the width of the global IDs, so that it is not
+  // silently truncated if it does not fit in the connectivity arrays
+  CFgid count = 0;
+  fin >> count;
+  if (!fin || count > static_cast<CFgid>(std::numeric_limits<CFuint>::max())) {
+    throw BadFormatException
+      (FromHere(), "Number of " + what + " in CFmesh not readable or too large for CFuint: "
+       "configure with CF_ENABLE_LONG or CF_ENABLE_LLONG");
+  }
+  return static_cast<CFuint>(count);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParCFmeshFileReader::readNbElements(istream& fin)
 {
   CFLog(NOTICE,"Memory Usage before assembling connectivity: " << Common::OSystem::getInstance().getProcessInfo()->memoryUsage() << "\n");
 
   CFLogDebugMin( "ParCFmeshFileReader::readNbElements() start\n");
 
-  fin >> m_totNbElem;
+  m_totNbElem = readGlobalCount(fin, "elements");
 
   getReadData().setNbElements(m_totNbElem);
 
@@ -511,7 +530,7 @@ void ParCFmeshFileReader::readNbElements(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbElementTypes(ifstream& fin)
+void ParCFmeshFileReader::readNbElementTypes(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbElementTypes() start\n");
 
@@ -537,7 +556,7 @@ void ParCFmeshFileReader::readNbElementTypes(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGeometricPolyOrder(ifstream& fin)
+void ParCFmeshFileReader::readGeometricPolyOrder(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGeometricPolyOrder() start\n");
 
@@ -555,7 +574,7 @@ void ParCFmeshFileReader::readGeometricPolyOrder(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readSolutionPolyOrder(ifstream& fin)
+void ParCFmeshFileReader::readSolutionPolyOrder(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readSolutionPolyOrder() start\n");
 
@@ -573,7 +592,7 @@ void ParCFmeshFileReader::readSolutionPolyOrder(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGeometricPolyType(ifstream& fin)
+void ParCFmeshFileReader::readGeometricPolyType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGeometricPolyType() start\n");
 
@@ -587,7 +606,7 @@ void ParCFmeshFileReader::readGeometricPolyType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readSolutionPolyType(ifstream& fin)
+void ParCFmeshFileReader::readSolutionPolyType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readSolutionPolyType() start\n");
 
@@ -601,7 +620,7 @@ void ParCFmeshFileReader::readSolutionPolyType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readElementTypes(ifstream& fin)
+void ParCFmeshFileReader::readElementTypes(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readElementTypes() start\n");
   const CFuint nbElementTypes = getReadData().getNbElementTypes();
@@ -625,7 +644,7 @@ void ParCFmeshFileReader::readElementTypes(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbElementsPerType(ifstream& fin)
+void ParCFmeshFileReader::readNbElementsPerType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readElementTypes() start\n");
 
@@ -660,7 +679,7 @@ void ParCFmeshFileReader::readNbElementsPerType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbNodesPerType(ifstream& fin)
+void ParCFmeshFileReader::readNbNodesPerType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbNodesPerType() start\n");
 
@@ -725,7 +744,7 @@ void ParCFmeshFileReader::readNbNodesPerType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbStatesPerType(ifstream& fin)
+void ParCFmeshFileReader::readNbStatesPerType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbStatesPerType() start\n");
 
@@ -755,7 +774,7 @@ void ParCFmeshFileReader::readNbStatesPerType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNodeList(ifstream& fin)
+void ParCFmeshFileReader::readNodeList(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNodeList() start\n");
 
@@ -812,7 +831,7 @@ void ParCFmeshFileReader::readNodeList(ifstream& fin)
   getReadData().prepareNodalExtraVars();
 
   CFuint countLocals = 0;
-  for (CFuint iNode = 0; iNode < m_totNbNodes; ++iNode) {
+  for (CFgid iNode = 0; iNode < m_totNbNodes; ++iNode) {
 
     // read the node
     fin >> tmpNode;
@@ -877,7 +896,7 @@ void ParCFmeshFileReader::readNodeList(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::emptyNodeListRead(ifstream& fin)
+void ParCFmeshFileReader::emptyNodeListRead(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::emptyNodeListRead() start" << "\n");
 
@@ -939,7 +958,7 @@ void ParCFmeshFileReader::emptyNodeListRead(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readStateList(ifstream& fin)
+void ParCFmeshFileReader::readStateList(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readStateList() start\n");
   
@@ -1057,7 +1076,7 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
   }
   
   CFuint countLocals = 0;
-  for (CFuint iState = 0; iState < m_totNbStates; ++iState)
+  for (CFgid iState = 0; iState < m_totNbStates; ++iState)
   {
     // read the state
     if (isWithSolution) 
@@ -1195,7 +1214,7 @@ void ParCFmeshFileReader::readStateList(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::emptyStateListRead(ifstream& fin)
+void ParCFmeshFileReader::emptyStateListRead(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::emptyStateListRead() start\n");
 
@@ -1289,7 +1308,7 @@ void ParCFmeshFileReader::emptyStateListRead(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readElementList(ifstream& fin)
+void ParCFmeshFileReader::readElementList(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readElementList() start\n");
 
@@ -1367,7 +1386,7 @@ void ParCFmeshFileReader::readElementList(ifstream& fin)
 //////////////////////////////////////////////////////////////////////////////
 
 void ParCFmeshFileReader::readElemListRank(PartitionerData& pdata,
-					   ifstream& fin)
+					   istream& fin)
 {
   CFuint start = 0;
   for (CFuint rank = 0; rank < m_myRank; ++rank) {
@@ -1441,7 +1460,7 @@ void ParCFmeshFileReader::readElemListRank(PartitionerData& pdata,
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbTRSs(ifstream& fin)
+void ParCFmeshFileReader::readNbTRSs(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbTRSs() start\n");
 
@@ -1480,7 +1499,7 @@ void ParCFmeshFileReader::readNbTRSs(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readTRSName(ifstream& fin)
+void ParCFmeshFileReader::readTRSName(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readTRSName() start\n");
 
@@ -1533,7 +1552,7 @@ void ParCFmeshFileReader::readTRSName(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbTRs(ifstream& fin)
+void ParCFmeshFileReader::readNbTRs(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbTRs() start\n");
 
@@ -1555,7 +1574,7 @@ void ParCFmeshFileReader::readNbTRs(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbGeomEnts(ifstream& fin)
+void ParCFmeshFileReader::readNbGeomEnts(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbGeomEnts() start\n");
 
@@ -1575,7 +1594,7 @@ void ParCFmeshFileReader::readNbGeomEnts(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGeomType(ifstream& fin)
+void ParCFmeshFileReader::readGeomType(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGeomType() start\n");
 
@@ -1605,7 +1624,7 @@ void ParCFmeshFileReader::readGeomType(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGeomEntList(ifstream& fin)
+void ParCFmeshFileReader::readGeomEntList(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGeomEntList() start\n");
 
@@ -1747,7 +1766,7 @@ void ParCFmeshFileReader::readGeomEntList(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-bool ParCFmeshFileReader::readString(ifstream& file)
+bool ParCFmeshFileReader::readString(istream& file)
 {
   std::string key = "";
   file >> key;
@@ -2160,10 +2179,10 @@ void ParCFmeshFileReader::moveElementData(ElementDataArray<0>& localElem,
   CFLog(INFO, "ParCFmeshFileReader::moveElementData() => end memory usage: "<<
 	Common::OSystem::getInstance().getProcessInfo()->memoryUsage() << "\n");
   
-  CFLogDebugMax(CFPrintContainer<vector<CFuint> >("localNodeIDs  = ", &m_localNodeIDs));
-  CFLogDebugMax(CFPrintContainer<vector<CFuint> >("localStateIDs = ", &m_localStateIDs));
-  CFLogDebugMax(CFPrintContainer<vector<CFuint> >("ghostNodeIDs  = ", &m_ghostNodeIDs));
-  CFLogDebugMax(CFPrintContainer<vector<CFuint> >("ghostStateIDs = ", &m_ghostStateIDs));
+  CFLogDebugMax(CFPrintContainer<vector<CFgid> >("localNodeIDs  = ", &m_localNodeIDs));
+  CFLogDebugMax(CFPrintContainer<vector<CFgid> >("localStateIDs = ", &m_localStateIDs));
+  CFLogDebugMax(CFPrintContainer<vector<CFgid> >("ghostNodeIDs  = ", &m_ghostNodeIDs));
+  CFLogDebugMax(CFPrintContainer<vector<CFgid> >("ghostStateIDs = ", &m_ghostStateIDs));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2213,9 +2232,9 @@ void ParCFmeshFileReader::buildOverlapLayers(Framework::ElementDataArray<0>& loc
   // maxNbLocalNodeStateIDs are reasonable max sizes for the following maps
   // in case number ghosts > number locals, size will be doubled on-the-fly (this 
   // could happen not so unfrequently since ghosts can be duplicated)
-  m_gNodeID2DonorRank.reset(new CFMultiMap<CFuint, CFuint>
+  m_gNodeID2DonorRank.reset(new CFMultiMap<CFgid, CFuint>
 			    (getReadData().getDimension()*localNodeIDs.size()));
-  m_gStateID2DonorRank.reset(new CFMultiMap<CFuint, CFuint>
+  m_gStateID2DonorRank.reset(new CFMultiMap<CFgid, CFuint>
 			     (getReadData().getDimension()*localStateIDs.size()));
   
   ElementDataArray<0> tmpElem;
@@ -2343,8 +2362,8 @@ void ParCFmeshFileReader::updateLocalDofList
  std::vector<CFuint>& localDofIDsToRemove, 
  std::vector<CFuint>& localDofIDs, 
  std::set<CFuint>& isLocalDof,
- std::vector<CFuint>& mghostDofIDs, 
- std::vector<CFuint>& mlocalDofIDs)
+ std::vector<CFgid>& mghostDofIDs, 
+ std::vector<CFgid>& mlocalDofIDs)
 {
   // remove duplicated ghost dofs
   sort(ghostDofIDs.begin(), ghostDofIDs.end());
@@ -2488,8 +2507,8 @@ void ParCFmeshFileReader::updateIsLocalNodeState
  set<CFuint>& isLocalState,
  vector<CFuint>& ghostNodeIDs,
  vector<CFuint>& ghostStateIDs,
- CFMultiMap<CFuint, CFuint>& gNodeID2DonorRank,
- CFMultiMap<CFuint, CFuint>& gStateID2DonorRank,
+ CFMultiMap<CFgid, CFuint>& gNodeID2DonorRank,
+ CFMultiMap<CFgid, CFuint>& gStateID2DonorRank,
  vector<CFuint>& newLocalNodeIDs,
  vector<CFuint>& newLocalStateIDs,
  vector<CFuint>& localNodeIDsToRemove,
@@ -2805,21 +2824,21 @@ void ParCFmeshFileReader::setElements(ElementDataArray<0>& localElem)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::setMapGlobalToLocalID(const vector<CFuint>& localIDs,
-						const vector<CFuint>& ghostIDs,
-						CFMap<CFuint,CFuint>& m)
+void ParCFmeshFileReader::setMapGlobalToLocalID(const vector<CFgid>& localIDs,
+						const vector<CFgid>& ghostIDs,
+						CFMap<CFgid,CFuint>& m)
 {
   const CFuint totCount = localIDs.size() + ghostIDs.size();
-  vector<CFuint> allIDs;
+  vector<CFgid> allIDs;
   allIDs.reserve(totCount);
 
   // sort the full list of IDs
-  vector<CFuint>::const_iterator it;
+  vector<CFgid>::const_iterator it;
   for (it = localIDs.begin(); it != localIDs.end(); ++it) {
     allIDs.push_back(*it);
   }
 
-  vector<CFuint>::const_iterator itg;
+  vector<CFgid>::const_iterator itg;
   for (itg = ghostIDs.begin(); itg != ghostIDs.end(); ++itg) {
     allIDs.push_back(*itg);
   }
@@ -2908,7 +2927,7 @@ void ParCFmeshFileReader::finish()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbExtraVars(ifstream& fin)
+void ParCFmeshFileReader::readNbExtraVars(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbExtraVars() start\n");
   
@@ -2928,7 +2947,7 @@ void ParCFmeshFileReader::readNbExtraVars(ifstream& fin)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbExtraNodalVars(ifstream& fin)
+void ParCFmeshFileReader::readNbExtraNodalVars(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbExtraNodalVars() start\n");
 
@@ -2947,7 +2966,7 @@ void ParCFmeshFileReader::readNbExtraNodalVars(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbExtraStateVars(ifstream& fin)
+void ParCFmeshFileReader::readNbExtraStateVars(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbExtraStateVars() start\n");
 
@@ -2966,7 +2985,7 @@ void ParCFmeshFileReader::readNbExtraStateVars(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraVarNames(ifstream& fin)
+void ParCFmeshFileReader::readExtraVarNames(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraVarNames() start\n");
   
@@ -2985,7 +3004,7 @@ void ParCFmeshFileReader::readExtraVarNames(ifstream& fin)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraStateVarNames(ifstream& fin)
+void ParCFmeshFileReader::readExtraStateVarNames(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraStateVarNames() start\n");
 
@@ -3004,7 +3023,7 @@ void ParCFmeshFileReader::readExtraStateVarNames(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraNodalVarNames(ifstream& fin)
+void ParCFmeshFileReader::readExtraNodalVarNames(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraNodalVarNames() start\n");
 
@@ -3023,7 +3042,7 @@ void ParCFmeshFileReader::readExtraNodalVarNames(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraVarStrides(ifstream& fin)
+void ParCFmeshFileReader::readExtraVarStrides(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraVarStrides() start\n");
   
@@ -3041,7 +3060,7 @@ void ParCFmeshFileReader::readExtraVarStrides(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraStateVarStrides(ifstream& fin)
+void ParCFmeshFileReader::readExtraStateVarStrides(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraStateVarStrides() start\n");
 
@@ -3059,7 +3078,7 @@ void ParCFmeshFileReader::readExtraStateVarStrides(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraNodalVarStrides(ifstream& fin)
+void ParCFmeshFileReader::readExtraNodalVarStrides(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraNodalVarStrides() start\n");
 
@@ -3077,7 +3096,7 @@ void ParCFmeshFileReader::readExtraNodalVarStrides(ifstream& fin)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readExtraVars(ifstream& fin)
+void ParCFmeshFileReader::readExtraVars(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readExtraVars() start\n");
   getReadData().resizeExtraVars();
@@ -3107,7 +3126,7 @@ void ParCFmeshFileReader::readExtraVars(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readNbGroups(ifstream& fin)
+void ParCFmeshFileReader::readNbGroups(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readNbGroups() start\n");
 
@@ -3126,7 +3145,7 @@ void ParCFmeshFileReader::readNbGroups(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGroupName(ifstream& fin)
+void ParCFmeshFileReader::readGroupName(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGroupName() start\n");
 
@@ -3150,7 +3169,7 @@ void ParCFmeshFileReader::readGroupName(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGroupElementNb(ifstream& fin)
+void ParCFmeshFileReader::readGroupElementNb(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGroupElementNb() start\n");
 
@@ -3166,7 +3185,7 @@ void ParCFmeshFileReader::readGroupElementNb(ifstream& fin)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParCFmeshFileReader::readGroupElementList(ifstream& fin)
+void ParCFmeshFileReader::readGroupElementList(istream& fin)
 {
   CFLogDebugMin( "ParCFmeshFileReader::readGroupElementList() start\n");
 
@@ -108,7 +108,7 @@ protected: // functions
   virtual void finish();
 
   /// Read an entry in the .CFmesh file
-  virtual bool readString(std::ifstream& file);
+  virtual bool readString(std::istream& file);
 
   /// Get the file extension
   virtual const std::string getReaderTerminator() const
@@ -128,7 +128,7 @@ private: // typedefs
   typedef std::vector<Framework::ElementTypeData> ElemTypeArray;
 
   /// pointer to ReaderFunction
-  typedef void (ParCFmeshFileReader::*ReaderFunction)(std::ifstream& fin);
+  typedef void (ParCFmeshFileReader::*ReaderFunction)(std::istream& fin);
 
   /// type that maps a string read in the File with a ReaderFunction
   typedef std::map<std::string,
@@ -176,106 +176,106 @@ protected: // member functions
   virtual void setMapString2Readers();
   
   /// Reads the space dimension
-  void readCFVersion(std::ifstream& fin);
+  void readCFVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readSvnVersion(std::ifstream& fin);
+  void readSvnVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readCFmeshVersion(std::ifstream& fin);
+  void readCFmeshVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readDimension(std::ifstream& fin);
+  void readDimension(std::istream& fin);
 
   /// Reads the number of equations
-  void readNbEquations(std::ifstream& fin);
+  void readNbEquations(std::istream& fin);
 
   /// Reads the number of nodes
-  void readNbNodes(std::ifstream& fin);
+  void readNbNodes(std::istream& fin);
 
   /// Reads the nb of dofs state tensors and initialize with them the dofs
-  void readNbStates(std::ifstream& fin);
+  void readNbStates(std::istream& fin);
 
   /// Reads if the past states are present in the file
-  void readStorePastStates(std::ifstream& fin);
+  void readStorePastStates(std::istream& fin);
 
   /// Reads if the past nodes are present in the file
-  void readStorePastNodes(std::ifstream& fin);
+  void readStorePastNodes(std::istream& fin);
 
   /// Reads if the past states are present in the file
-  void readStoreInterStates(std::ifstream& fin);
+  void readStoreInterStates(std::istream& fin);
 
   /// Reads if the past nodes are present in the file
-  void readStoreInterNodes(std::ifstream& fin);
+  void readStoreInterNodes(std::istream& fin);
 
   /// Reads the nb of extra variables associated with nodes
-  void readNbExtraNodalVars(std::ifstream& fin);
+  void readNbExtraNodalVars(std::istream& fin);
 
   /// Reads the nb of extra variables associated with states
-  void readNbExtraStateVars(std::ifstream& fin);
+  void readNbExtraStateVars(std::istream& fin);
 
   /// Reads the nb of extra variables
-  void readNbExtraVars(std::ifstream& fin);
+  void readNbExtraVars(std::istream& fin);
   
   /// Reads the names of the extra variables associated with nodes
-  void readExtraNodalVarNames(std::ifstream& fin);
+  void readExtraNodalVarNames(std::istream& fin);
 
   /// Reads the names of the extra variables associated with states
-  void readExtraStateVarNames(std::ifstream& fin);
+  void readExtraStateVarNames(std::istream& fin);
 
   /// Reads the names of the extra variables
-  void readExtraVarNames(std::ifstream& fin);
+  void readExtraVarNames(std::istream& fin);
 
   /// Reads the strides of the extra variables associated with nodes
-  void readExtraNodalVarStrides(std::ifstream& fin);
+  void readExtraNodalVarStrides(std::istream& fin);
 
   /// Reads the strides of the extra variables associated with states
-  void readExtraStateVarStrides(std::ifstream& fin);
+  void readExtraStateVarStrides(std::istream& fin);
 
   /// Reads the strides of the extra variables
-  void readExtraVarStrides(std::ifstream& fin);
+  void readExtraVarStrides(std::istream& fin);
   
   /// Reads the extra variables associated with states
-  void readExtraVars(std::ifstream& fin);
+  void readExtraVars(std::istream& fin);
 
   /// Reads the nb of elements
-  void readNbElements(std::ifstream& fin);
+  void readNbElements(std::istream& fin);
 
   /// Reads the nb of element types
-  void readNbElementTypes(std::ifstream& fin);
+  void readNbElementTypes(std::istream& fin);
 
   /// Reads the order of the polynomial representation of the geometry
-  void readGeometricPolyOrder(std::ifstream& fin);
+  void readGeometricPolyOrder(std::istream& fin);
 
   /// Reads the order of the polynomial representation of the solution
-  void readSolutionPolyOrder(std::ifstream& fin);
+  void readSolutionPolyOrder(std::istream& fin);
 
   /// Reads the Type of the polynomial representation of the geometry
-  void readGeometricPolyType(std::ifstream& fin);
+  void readGeometricPolyType(std::istream& fin);
 
   /// Reads the Type of the polynomial representation of the solution
-  void readSolutionPolyType(std::ifstream& fin);
+  void readSolutionPolyType(std::istream& fin);
 
   /// Reads the element types (CFGeoShape::Type)
-  void readElementTypes(std::ifstream& fin);
+  void readElementTypes(std::istream& fin);
 
   /// Reads the nb of elements per type
-  void readNbElementsPerType(std::ifstream& fin);
+  void readNbElementsPerType(std::istream& fin);
 
   /// Reads the nb of nodes per type
-  void readNbNodesPerType(std::ifstream& fin);
+  void readNbNodesPerType(std::istream& fin);
 
   /// Reads the nb of dofs per type
-  void readNbStatesPerType(std::ifstream& fin);
+  void readNbStatesPerType(std::istream& fin);
 
   /// Reads the list of nodes
-  void readNodeList(std::ifstream& fin);
+  void readNodeList(std::istream& fin);
 
   /// Reads the list of state tensors and initialize the dofs
-  void readStateList(std::ifstream& fin);
+  void readStateList(std::istream& fin);
 
   /// Reads the data concerning the elements
-  void readElementList(std::ifstream& fin);
+  void readElementList(std::istream& fin);
 
   /// Reads the number of topological region sets and initialize the vector
   /// that will contain the all the topological region sets
@@ -283,57 +283,57 @@ protected: // member functions
   /// @pre Connection has been already been and set
   /// @pre some topological region sets have been already constructed
   ///      (INNER_CELLS and, in FVM, INNER_FACES)
-  void readNbTRSs(std::ifstream& fin);
+  void readNbTRSs(std::istream& fin);
 
   /// Reads the name of the current topological region sets
-  void readTRSName(std::ifstream& fin);
+  void readTRSName(std::istream& fin);
 
   /// Reads the number of topological regions in the current
   /// topological region  set
-  void readNbTRs(std::ifstream& fin);
+  void readNbTRs(std::istream& fin);
 
   /// Reads the number of geometric entities in each topological
   /// region of the current topological region set
-  void readNbGeomEnts(std::ifstream& fin);
+  void readNbGeomEnts(std::istream& fin);
 
   /// Reads the type of geometric entity in the current topological
   /// region set
   /// @pre  the read string must be "Face", "Cell" (or "Edge" in the future)
   /// @post the read string is converted in the corresponding CFGeoEnt::Type
   ///       by the method m_getCFGeoEnt::Type()
-  void readGeomType(std::ifstream& fin);
+  void readGeomType(std::istream& fin);
 
   /// Reads all the lists of geometric entities, using them to build the
   /// corresponding topological region.
   /// Once that all the topological regions belonging to the current topological
   /// region set have been built, the topological region set itself is built.
-  void readGeomEntList(std::ifstream& fin);
+  void readGeomEntList(std::istream& fin);
 
   /// Reads the data for one Topological Region Set
   void readTRSData(Common::CFMultiMap<CFuint,CFuint>& mapNodeElemID,
     CFuint iTRS,
-    std::ifstream& fin);
+    std::istream& fin);
 
   /// Reads the element list corresponding for the current rank
-  void readElemListRank( Framework::PartitionerData& pdata, std::ifstream& fin);
+  void readElemListRank( Framework::PartitionerData& pdata, std::istream& fin);
 
   /// Reads the number of groups in the mesh
-  void readNbGroups(std::ifstream& fin);
+  void readNbGroups(std::istream& fin);
 
   /// Reads the name of the current group
-  void readGroupName(std::ifstream& fin);
+  void readGroupName(std::istream& fin);
 
   /// Reads the number of elements in the current group
-  void readGroupElementNb(std::ifstream& fin);
+  void readGroupElementNb(std::istream& fin);
 
   /// Reads the elements belonging to the current group in the mesh
-  void readGroupElementList(std::ifstream& fin);
+  void readGroupElementList(std::istream& fin);
 
   /// Ineffective reading of the node list
-  void emptyNodeListRead(std::ifstream& fin);
+  void emptyNodeListRead(std::istream& fin);
 
   /// Ineffective reading of the state list
-  void emptyStateListRead(std::ifstream& fin);
+  void emptyStateListRead(std::istream& fin);
 
  protected:
   
@@ -376,8 +376,8 @@ protected: // member functions
 			      std::set<CFuint>& isLocalState,
 			      std::vector<CFuint>& ghostNodeIDs,
 			      std::vector<CFuint>& ghostStateIDs,
-			      Common::CFMultiMap<CFuint, CFuint>& gNodeID2DonorRank,
-			      Common::CFMultiMap<CFuint, CFuint>& gStateID2DonorRank,
+			      Common::CFMultiMap<CFgid, CFuint>& gNodeID2DonorRank,
+			      Common::CFMultiMap<CFgid, CFuint>& gStateID2DonorRank,
 			      std::vector<CFuint>& newLocalNodeIDs,
 			      std::vector<CFuint>& newLocalStateIDs,
 			      std::vector<CFuint>& localNodeIDsToRemove,
@@ -402,13 +402,17 @@ protected: // member functions
 			  std::vector<CFuint>& localDofIDsToRemove, 
 			  std::vector<CFuint>& localDofIDs, 
 			  std::set<CFuint>& isLocalDof,
-			  std::vector<CFuint>& mghostDofIDs, 
-			  std::vector<CFuint>& mlocalDofIDs);
+			  std::vector<CFgid>& mghostDofIDs, 
+			  std::vector<CFgid>& mlocalDofIDs);
   
   /// Set the mapping between the global and the local node (or state) ID
-  void setMapGlobalToLocalID(const std::vector<CFuint>& localIDs,
-			     const std::vector<CFuint>& ghostIDs,
-			     Common::CFMap<CFuint,CFuint>& m);
+  void setMapGlobalToLocalID(const std::vector<CFgid>& localIDs,
+			     const std::vector<CFgid>& ghostIDs,
+			     Common::CFMap<CFgid,CFuint>& m);
+  
+  /// Read a global count (of nodes, states or elements) from the CFmesh,
+  /// checking that it can be stored in the connectivity arrays (CFuint)
+  CFuint readGlobalCount(std::istream& fin, const std::string& what);
   
   /// Set the mapping between the global nodeID and the local elementID
   void setMapNodeElemID(Framework::ElementDataArray<0>& localElem);
@@ -505,28 +509,28 @@ protected: // member functions
   std::vector<Framework::PartitionerData::IndexT> m_partitionerOutData;
   
   /// local node IDs
-  std::vector<CFuint> m_localNodeIDs;
+  std::vector<CFgid> m_localNodeIDs;
 
   /// local state IDs
-  std::vector<CFuint> m_localStateIDs;
+  std::vector<CFgid> m_localStateIDs;
 
   /// ghost node IDs
-  std::vector<CFuint> m_ghostNodeIDs;
+  std::vector<CFgid> m_ghostNodeIDs;
   
   /// ghost state IDs
-  std::vector<CFuint> m_ghostStateIDs;
+  std::vector<CFgid> m_ghostStateIDs;
   
   /// mapping ghost node global IDs to donor rank  of the owning process
-  Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> > m_gNodeID2DonorRank;
+  Common::SharedPtr<Common::CFMultiMap<CFgid, CFuint> > m_gNodeID2DonorRank;
   
   /// mapping ghost state global IDs to donor rank  of the owning process
-  Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> > m_gStateID2DonorRank;
+  Common::SharedPtr<Common::CFMultiMap<CFgid, CFuint> > m_gStateID2DonorRank;
   
   /// map global node ID to local node ID
-  Common::CFMap<CFuint,CFuint> m_mapGlobToLocNodeID;
+  Common::CFMap<CFgid,CFuint> m_mapGlobToLocNodeID;
 
   /// map global state ID to local state ID
-  Common::CFMap<CFuint,CFuint> m_mapGlobToLocStateID;
+  Common::CFMap<CFgid,CFuint> m_mapGlobToLocStateID;
 
   /// map nodeID to local element ID
   Common::CFMultiMap<CFuint,CFuint> m_mapNodeElemID;
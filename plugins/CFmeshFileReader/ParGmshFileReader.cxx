@@ -0,0 +1,1756 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cstring>
+#include <sstream>
+
+#include "Common/PE.hh"
+#include "Common/CFPrintContainer.hh"
+#include "Common/StringOps.hh"
+#include "Common/SwapEmpty.hh"
+#include "Common/BadValueException.hh"
+
+#include "Environment/FileHandlerInput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+
+#include "Framework/MeshData.hh"
+#include "Framework/MapGeoEnt.hh"
+#include "Framework/MeshPartitioner.hh"
+#include "Framework/PhysicalModel.hh"
+
+#include "CFmeshFileReader/ParGmshFileReader.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+    namespace CFmeshFileReader {
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParGmshFileReader::ParGmshFileReader() :
+  ParCFmeshFileReader(),
+  m_nodesPerType(31),
+  m_orderPerType(31),
+  m_dimPerType(31),
+  m_mapNodeIdx(31),
+  m_dim(0),
+  m_version(2),
+  m_isBinary(false),
+  m_nodeListStart(0),
+  m_nbNodeBlocks(0),
+  m_physNames(),
+  m_physDims(),
+  m_entityPhysTags(),
+  m_nodeRanges(),
+  m_nodeTags(),
+  m_nodeCoords(),
+  m_cellTypes(),
+  m_cellPtr(),
+  m_cellNodes(),
+  m_faceTags(),
+  m_facePtr(),
+  m_faceNodes(),
+  m_typeIDs(),
+  m_elemRanges()
+{
+  addConfigOptionsTo(this);
+
+  m_isDiscontinuous = false;
+  setParameter("Discontinuous",&m_isDiscontinuous);
+
+  // element types as in Gmsh2CFmeshConverter
+  const CFuint nbNodes[31] = {2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14, 1, 8,
+			      20, 15, 13, 9, 10, 12, 15, 15, 21, 4, 5, 6, 20, 35, 56};
+  const CFuint order[31]   = {1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+			      2, 2, 2, 3, 3, 4, 4, 5, 5, 3, 4, 5, 3, 4, 5};
+  const CFuint dim[31]     = {1, 2, 2, 3, 3, 3, 3, 1, 2, 2, 3, 3, 3, 3, 0, 2,
+			      3, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 3, 3, 3};
+
+  for (CFuint iType = 0; iType < m_nodesPerType.size(); ++iType) {
+    m_nodesPerType[iType] = nbNodes[iType];
+    m_orderPerType[iType] = order[iType];
+    m_dimPerType[iType]   = dim[iType];
+    m_mapNodeIdx[iType].resize(nbNodes[iType]);
+    for (CFuint iNode = 0; iNode < nbNodes[iType]; ++iNode) {
+      m_mapNodeIdx[iType][iNode] = iNode;
+    }
+  }
+
+  // quadratic tetrahedron
+  m_mapNodeIdx[10][7] = 9;
+  m_mapNodeIdx[10][9] = 7;
+
+  // quadratic hexahedron
+  const CFuint hexa27[19] = {8, 11, 13, 9, 20, 10, 21, 12, 23, 14, 24, 15, 22, 26, 16, 18, 19, 17, 25};
+  for (CFuint iNode = 8; iNode < 27; ++iNode) {
+    m_mapNodeIdx[11][iNode] = hexa27[iNode-8];
+  }
+
+  // incomplete quadratic hexahedron
+  const CFuint hexa20[12] = {8, 11, 13, 9, 10, 12, 14, 15, 16, 18, 19, 17};
+  for (CFuint iNode = 8; iNode < 20; ++iNode) {
+    m_mapNodeIdx[16][iNode] = hexa20[iNode-8];
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParGmshFileReader::~ParGmshFileReader()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >("Discontinuous","Is the solution space discontinuous (one state per cell)?");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readFromFile(const boost::filesystem::path& filepath)
+{
+  CFAUTOTRACE;
+
+  m_dim = PhysicalModelStack::getActive()->getDim();
+
+  SelfRegistPtr<Environment::FileHandlerInput>* fhandle =
+    Environment::SingleBehaviorFactory<Environment::FileHandlerInput>::getInstance().createPtr();
+  ifstream& fin = (*fhandle)->open(filepath, ios_base::in | ios_base::binary);
+
+  readHeader(fin);
+
+  if (m_isBinary && m_version == 4) {
+    readBinaryBlocks(fin);
+  }
+  else if (m_isBinary) {
+    readBinaryLists(fin);
+  }
+  else {
+    readAsciiLists(fin);
+  }
+
+  (*fhandle)->close();
+  delete fhandle;
+
+  setGlobalNodeIDs();
+  setElementTypes();
+  distributeElements();
+  createNodes();
+  createStates();
+  setTRSData();
+
+  finish();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readHeader(ifstream& fin)
+{
+  CFLogDebugMin( "ParGmshFileReader::readHeader() start\n");
+
+  std::string line = "";
+  getline(fin, line);
+  if (line.compare(0, 11, "$MeshFormat") != 0) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => $MeshFormat missing");
+  }
+
+  getline(fin, line);
+  std::string version = "";
+  CFuint fileType = 0;
+  CFuint dataSize = 0;
+  istringstream format(line);
+  format >> version >> fileType >> dataSize;
+
+  // MSH 4.0 has a different layout of the entities and of the nodes
+  if (version.empty() || (version[0] != '2' && version.compare(0, 3, "4.1") != 0)) {
+    throw BadFormatException
+      (FromHere(),"ParGmshFileReader => MSH version " + version +
+       " not supported, save the mesh in MSH 4.1 or MSH 2 format");
+  }
+
+  m_version = (version[0] == '4') ? 4 : 2;
+  m_isBinary = (fileType == 1);
+
+  if (m_isBinary) {
+    // the data size is the one of the doubles (MSH 2) or of the sizes (MSH 4)
+    if (dataSize != sizeof(double) || dataSize != sizeof(MshSize)) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => binary file with data size != 8");
+    }
+
+    // the integer 1 is written to check the endianness
+    int one = 0;
+    fin.read(reinterpret_cast<char*>(&one), sizeof(int));
+    if (one != 1) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => binary file with different endianness");
+    }
+    getline(fin, line);
+  }
+
+  // skip the other sections up to the node list, reading the physical names
+  // and the physical groups of the entities
+  while (line.compare(0, 6, "$Nodes") != 0) {
+    if (!getline(fin, line)) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => $Nodes missing");
+    }
+
+    if (line.compare(0, 14, "$PhysicalNames") == 0) {
+      getline(fin, line);
+      CFuint nbNames = 0;
+      istringstream nb(line);
+      nb >> nbNames;
+
+      for (CFuint i = 0; i < nbNames; ++i) {
+	getline(fin, line);
+	CFuint dim = 0;
+	CFuint tag = 0;
+	istringstream name(line);
+	name >> dim >> tag;
+
+	const size_t first = line.find('"');
+	const size_t last  = line.rfind('"');
+	if (first == std::string::npos || last <= first) {
+	  throw BadFormatException (FromHere(),"ParGmshFileReader => bad physical name: " + line);
+	}
+	m_physDims[tag]  = dim;
+	m_physNames[tag] = line.substr(first+1, last-first-1);
+      }
+    }
+
+    if (m_version == 4 && line.compare(0, 9, "$Entities") == 0) {
+      if (m_isBinary) {
+	readBinaryEntities(fin);
+      }
+      else {
+	readEntities(fin);
+      }
+    }
+  }
+
+  // MSH 4 starts with the number of node blocks
+  if (m_version == 4 && m_isBinary) {
+    // number of blocks and of nodes, minimum and maximum node tag
+    MshSize counts[4];
+    fin.read(reinterpret_cast<char*>(counts), 4*sizeof(MshSize));
+    m_nbNodeBlocks = counts[0];
+    m_totNbNodes = counts[1];
+  }
+  else {
+    getline(fin, line);
+    istringstream nb(line);
+    if (m_version == 4) {
+      nb >> m_nbNodeBlocks;
+    }
+    nb >> m_totNbNodes;
+  }
+  m_nodeListStart = fin.tellg();
+
+  if (m_totNbNodes < 1) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => number of nodes < 1");
+  }
+
+  CFLog(INFO, "ParGmshFileReader => MSH " << version << (m_isBinary ? " binary" : " ASCII")
+	<< ", " << m_totNbNodes << " nodes, " << m_physNames.size() << " physical names\n");
+
+  CFLogDebugMin( "ParGmshFileReader::readHeader() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readEntities(ifstream& fin)
+{
+  std::string line = "";
+  getline(fin, line);
+  CFuint nbEntities[4] = {0, 0, 0, 0};
+  istringstream nb(line);
+  nb >> nbEntities[0] >> nbEntities[1] >> nbEntities[2] >> nbEntities[3];
+
+  // each entity is a line with its tag, its coordinates (points) or its
+  // bounding box, its physical tags and its bounding entities
+  m_entityPhysTags.assign(4, map<CFuint, CFuint>());
+  for (CFuint dim = 0; dim < 4; ++dim) {
+    const CFuint nbCoords = (dim == 0) ? 3 : 6;
+    for (CFuint i = 0; i < nbEntities[dim]; ++i) {
+      getline(fin, line);
+      istringstream entity(line);
+      CFuint tag = 0;
+      CFreal x = 0.;
+      CFuint nbPhysTags = 0;
+      entity >> tag;
+      for (CFuint c = 0; c < nbCoords; ++c) {
+	entity >> x;
+      }
+      entity >> nbPhysTags;
+
+      // the elements of an entity belong to its first physical group
+      if (nbPhysTags > 0) {
+	int physTag = 0;
+	entity >> physTag;
+	m_entityPhysTags[dim][tag] = std::abs(physTag);
+      }
+
+      if (!entity) {
+	throw BadFormatException (FromHere(),"ParGmshFileReader => bad entity: " + line);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readBinaryEntities(ifstream& fin)
+{
+  MshSize nbEntities[4] = {0, 0, 0, 0};
+  fin.read(reinterpret_cast<char*>(nbEntities), 4*sizeof(MshSize));
+
+  // each entity is made of its tag (int), its coordinates (points) or its
+  // bounding box (double), its physical tags and, except for the points,
+  // its bounding entities (number as size, tags as int)
+  m_entityPhysTags.assign(4, map<CFuint, CFuint>());
+  for (CFuint dim = 0; dim < 4; ++dim) {
+    const CFuint nbCoords = (dim == 0) ? 3 : 6;
+    for (MshSize i = 0; i < nbEntities[dim]; ++i) {
+      int tag = 0;
+      fin.read(reinterpret_cast<char*>(&tag), sizeof(int));
+      fin.seekg(nbCoords*sizeof(double), ios_base::cur);
+
+      MshSize nbPhysTags = 0;
+      fin.read(reinterpret_cast<char*>(&nbPhysTags), sizeof(MshSize));
+      vector<int> physTags(nbPhysTags);
+      if (nbPhysTags > 0) {
+	fin.read(reinterpret_cast<char*>(&physTags[0]), nbPhysTags*sizeof(int));
+
+	// the elements of an entity belong to its first physical group
+	m_entityPhysTags[dim][tag] = std::abs(physTags[0]);
+      }
+
+      if (dim > 0) {
+	MshSize nbBounding = 0;
+	fin.read(reinterpret_cast<char*>(&nbBounding), sizeof(MshSize));
+	fin.seekg(nbBounding*sizeof(int), ios_base::cur);
+      }
+
+      if (!fin) {
+	throw BadFormatException (FromHere(),"ParGmshFileReader => bad entity in binary file");
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readAsciiLists(ifstream& fin)
+{
+  CFLogDebugMin( "ParGmshFileReader::readAsciiLists() start\n");
+
+  // each processor reads a chunk of the file, from the first node to the
+  // end, and parses the lines starting in that chunk
+  fin.seekg(0, ios_base::end);
+  const streamoff fileSize = fin.tellg();
+  const streamoff chunkSize = (fileSize - m_nodeListStart)/m_nbProc;
+  const streamoff begin = m_nodeListStart + chunkSize*m_myRank;
+  const streamoff end = (m_myRank == m_nbProc-1) ? fileSize : begin + chunkSize;
+  const streamoff from = (m_myRank > 0) ? begin - 1 : begin;
+
+  std::string buf(end - from, ' ');
+  fin.clear();
+  fin.seekg(from);
+  if (!buf.empty()) {
+    fin.read(&buf[0], buf.size());
+  }
+
+  // complete the last line, which ends in the chunk of the next processor
+  if (end < fileSize && !buf.empty() && buf[buf.size()-1] != '\n') {
+    std::string rest = "";
+    getline(fin, rest);
+    buf += rest;
+  }
+  if (buf.empty() || buf[buf.size()-1] != '\n') {
+    buf += '\n';
+  }
+
+  // the line starting before the chunk belongs to the previous processor
+  size_t pos = 0;
+  if (m_myRank > 0) {
+    pos = buf.find('\n');
+    pos = (pos == std::string::npos) ? buf.size() : pos + 1;
+  }
+
+  vector<size_t> lineStarts;
+  while (pos < buf.size()) {
+    lineStarts.push_back(pos);
+    pos = buf.find('\n', pos) + 1;
+  }
+
+  // local lines closing the node list, opening and closing the element list
+  const char* keys[3] = {"$EndNodes", "$Elements", "$EndElements"};
+  vector<CFint> markers(3, -1);
+  for (CFuint i = 0; i < lineStarts.size(); ++i) {
+    const char* line = &buf[lineStarts[i]];
+    if (*line == '$') {
+      for (CFuint k = 0; k < 3; ++k) {
+	if (markers[k] < 0 && strncmp(line, keys[k], strlen(keys[k])) == 0) {
+	  markers[k] = i;
+	}
+      }
+    }
+  }
+
+  CFuint nbLines = lineStarts.size();
+  vector<CFuint> nbLinesPerProc(m_nbProc, 0);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "ParGmshFileReader::readAsciiLists()",
+     MPI_Allgather(&nbLines, 1, MPIStructDef::getMPIType(&nbLines),
+		   &nbLinesPerProc[0], 1, MPIStructDef::getMPIType(&nbLines), m_comm));
+
+  vector<CFint> allMarkers(3*m_nbProc, -1);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "ParGmshFileReader::readAsciiLists()",
+     MPI_Allgather(&markers[0], 3, MPIStructDef::getMPIType(&markers[0]),
+		   &allMarkers[0], 3, MPIStructDef::getMPIType(&markers[0]), m_comm));
+
+  // first line of each processor, counting from the first node
+  vector<CFuint> firstLine(m_nbProc+1, 0);
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    firstLine[r+1] = firstLine[r] + nbLinesPerProc[r];
+  }
+
+  vector<CFuint> markerLines(3, 0);
+  for (CFuint k = 0; k < 3; ++k) {
+    bool found = false;
+    for (CFuint r = 0; r < m_nbProc && !found; ++r) {
+      if (allMarkers[3*r+k] >= 0) {
+	markerLines[k] = firstLine[r] + allMarkers[3*r+k];
+	found = true;
+      }
+    }
+    if (!found) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => " + std::string(keys[k]) + " missing");
+    }
+  }
+
+  m_cellPtr.assign(1, 0);
+  m_facePtr.assign(1, 0);
+
+  if (m_version == 4) {
+    readAsciiBlocks(buf, lineStarts, firstLine, markerLines);
+  }
+  else {
+    readAsciiEntries(buf, lineStarts, firstLine, markerLines);
+  }
+
+  CFLog(VERBOSE, "ParGmshFileReader::readAsciiLists() => " << m_nodeTags.size() << " nodes, "
+	<< m_cellTypes.size() << " cells, " << m_faceTags.size() << " faces read\n");
+
+  CFLogDebugMin( "ParGmshFileReader::readAsciiLists() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readAsciiEntries(std::string& buf,
+					 const vector<size_t>& lineStarts,
+					 const vector<CFuint>& firstLine,
+					 const vector<CFuint>& markerLines)
+{
+  if (markerLines[0] != m_totNbNodes) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => number of nodes differs from $Nodes list");
+  }
+
+  // the line after $Elements is the number of elements
+  const CFuint elemBegin = markerLines[1] + 2;
+  const CFuint elemEnd   = markerLines[2];
+
+  m_nodeRanges.resize(m_nbProc+1);
+  for (CFuint r = 0; r <= m_nbProc; ++r) {
+    m_nodeRanges[r] = std::min(firstLine[r], m_totNbNodes);
+  }
+
+  const CFuint nbLocalNodes = m_nodeRanges[m_myRank+1] - m_nodeRanges[m_myRank];
+  m_nodeTags.reserve(nbLocalNodes);
+  m_nodeCoords.reserve(nbLocalNodes*m_dim);
+
+  vector<CFuint> nodeTags;
+  for (CFuint i = 0; i < lineStarts.size(); ++i) {
+    const CFuint lineID = firstLine[m_myRank] + i;
+    char* ptr = &buf[lineStarts[i]];
+
+    if (lineID < m_totNbNodes) {
+      m_nodeTags.push_back(readUInt(ptr));
+      for (CFuint d = 0; d < 3; ++d) {
+	const CFreal x = readReal(ptr);
+	if (d < m_dim) {m_nodeCoords.push_back(x);}
+      }
+    }
+    else if (lineID >= elemBegin && lineID < elemEnd) {
+      readUInt(ptr);
+      const CFuint gmshType = readUInt(ptr) - 1;
+      const CFuint nbTags = readUInt(ptr);
+      if (gmshType >= m_nodesPerType.size()) {
+	throw BadFormatException (FromHere(),"ParGmshFileReader => unsupported element type " +
+				  StringOps::to_str(gmshType+1));
+      }
+
+      CFuint physTag = 0;
+      for (CFuint t = 0; t < nbTags; ++t) {
+	const CFuint tag = readUInt(ptr);
+	if (t == 0) {physTag = tag;}
+      }
+
+      nodeTags.resize(m_nodesPerType[gmshType]);
+      for (CFuint n = 0; n < nodeTags.size(); ++n) {
+	nodeTags[n] = readUInt(ptr);
+      }
+      storeElement(gmshType, physTag, nodeTags);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readAsciiBlocks(std::string& buf,
+					const vector<size_t>& lineStarts,
+					const vector<CFuint>& firstLine,
+					const vector<CFuint>& markerLines)
+{
+  const CFuint lineBegin = firstLine[m_myRank];
+  const CFuint lineEnd   = firstLine[m_myRank+1];
+
+  // the entries of a node block are the lines with the tags followed by the
+  // lines with the coordinates
+  vector<CFuint> nodeBlocks;
+  const CFuint nodeEnd = readBlockHeaders(buf, lineStarts, firstLine, 0, m_nbNodeBlocks, 2, nodeBlocks);
+  if (nodeEnd != markerLines[0]) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => node blocks differ from $Nodes list");
+  }
+
+  // the line after $Elements is the number of blocks and of elements
+  const CFuint countLine = markerLines[1] + 1;
+  const CFuint countOwner = getOwnerRank(firstLine, countLine);
+  CFuint elemCounts[2] = {0, 0};
+  if (countOwner == m_myRank) {
+    char* ptr = &buf[lineStarts[countLine - lineBegin]];
+    elemCounts[0] = readUInt(ptr);
+    elemCounts[1] = readUInt(ptr);
+  }
+  MPIError::getInstance().check
+    ("MPI_Bcast", "ParGmshFileReader::readAsciiBlocks()",
+     MPI_Bcast(elemCounts, 2, MPIStructDef::getMPIType(&elemCounts[0]), countOwner, m_comm));
+
+  vector<CFuint> elemBlocks;
+  const CFuint elemEnd = readBlockHeaders(buf, lineStarts, firstLine, countLine + 1, elemCounts[0], 1, elemBlocks);
+  if (elemEnd != markerLines[2]) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => element blocks differ from $Elements list");
+  }
+
+  // the nodes are split evenly in the order of the file, each processor
+  // sending the tags and the coordinates in its lines to their owner
+  m_nodeRanges.resize(m_nbProc+1);
+  for (CFuint r = 0; r <= m_nbProc; ++r) {
+    m_nodeRanges[r] = static_cast<CFuint>((static_cast<CFdouble>(m_totNbNodes)*r)/m_nbProc);
+  }
+  m_nodeRanges[m_nbProc] = m_totNbNodes;
+
+  const CFuint nbLocalNodes = m_nodeRanges[m_myRank+1] - m_nodeRanges[m_myRank];
+  m_nodeTags.assign(nbLocalNodes, 0);
+  m_nodeCoords.assign(nbLocalNodes*m_dim, 0.);
+
+  vector<vector<CFuint> > sendTags(m_nbProc);
+  vector<vector<CFuint> > sendNodeIDs(m_nbProc);
+  vector<vector<CFreal> > sendCoords(m_nbProc);
+  CFuint nbNodes = 0;
+  for (CFuint b = 0; b < m_nbNodeBlocks; ++b) {
+    const CFuint header = nodeBlocks[5*b];
+    const CFuint nbBlockNodes = nodeBlocks[5*b+4];
+    const CFuint start = std::max(lineBegin, header + 1);
+    const CFuint stop  = std::min(lineEnd, header + 1 + 2*nbBlockNodes);
+
+    for (CFuint lineID = start; lineID < stop; ++lineID) {
+      char* ptr = &buf[lineStarts[lineID - lineBegin]];
+      const CFuint entry = lineID - header - 1;
+      if (entry < nbBlockNodes) {
+	const CFuint nodeID = nbNodes + entry;
+	const CFuint owner = getOwnerRank(m_nodeRanges, nodeID);
+	sendTags[owner].push_back(nodeID);
+	sendTags[owner].push_back(readUInt(ptr));
+      }
+      else {
+	// parametric coordinates, if any, follow x y z on the same line
+	const CFuint nodeID = nbNodes + entry - nbBlockNodes;
+	const CFuint owner = getOwnerRank(m_nodeRanges, nodeID);
+	sendNodeIDs[owner].push_back(nodeID);
+	for (CFuint d = 0; d < 3; ++d) {
+	  const CFreal x = readReal(ptr);
+	  if (d < m_dim) {sendCoords[owner].push_back(x);}
+	}
+      }
+    }
+    nbNodes += nbBlockNodes;
+  }
+
+  if (nbNodes != m_totNbNodes) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => number of nodes differs from $Nodes blocks");
+  }
+
+  vector<CFuint> recvBuf;
+  vector<int> recvCount;
+  exchangeLists(sendTags, recvBuf, recvCount);
+  for (CFuint i = 0; i < recvBuf.size(); i += 2) {
+    m_nodeTags[recvBuf[i] - m_nodeRanges[m_myRank]] = recvBuf[i+1];
+  }
+
+  // the coordinates are received in the order of the node IDs
+  vector<CFreal> recvCoords;
+  exchangeLists(sendNodeIDs, recvBuf, recvCount);
+  exchangeLists(sendCoords, recvCoords, recvCount);
+  cf_assert(recvCoords.size() == recvBuf.size()*m_dim);
+  for (CFuint i = 0; i < recvBuf.size(); ++i) {
+    const CFuint localID = recvBuf[i] - m_nodeRanges[m_myRank];
+    for (CFuint d = 0; d < m_dim; ++d) {
+      m_nodeCoords[localID*m_dim+d] = recvCoords[i*m_dim+d];
+    }
+  }
+
+  // the elements have no tags, their physical group is the one of the entity
+  vector<CFuint> nodeTags;
+  for (CFuint b = 0; b < elemCounts[0]; ++b) {
+    const CFuint header = elemBlocks[5*b];
+    const CFuint entityDim = elemBlocks[5*b+1];
+    const CFuint entityTag = elemBlocks[5*b+2];
+    const CFuint gmshType = elemBlocks[5*b+3] - 1;
+    const CFuint nbBlockElems = elemBlocks[5*b+4];
+    if (gmshType >= m_nodesPerType.size()) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => unsupported element type " +
+				StringOps::to_str(gmshType+1));
+    }
+
+    CFuint physTag = 0;
+    if (entityDim < m_entityPhysTags.size()) {
+      map<CFuint, CFuint>::const_iterator it = m_entityPhysTags[entityDim].find(entityTag);
+      if (it != m_entityPhysTags[entityDim].end()) {physTag = it->second;}
+    }
+
+    const CFuint start = std::max(lineBegin, header + 1);
+    const CFuint stop  = std::min(lineEnd, header + 1 + nbBlockElems);
+    nodeTags.resize(m_nodesPerType[gmshType]);
+    for (CFuint lineID = start; lineID < stop; ++lineID) {
+      char* ptr = &buf[lineStarts[lineID - lineBegin]];
+      readUInt(ptr);
+      for (CFuint n = 0; n < nodeTags.size(); ++n) {
+	nodeTags[n] = readUInt(ptr);
+      }
+      storeElement(gmshType, physTag, nodeTags);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint ParGmshFileReader::readBlockHeaders(std::string& buf,
+					   const vector<size_t>& lineStarts,
+					   const vector<CFuint>& firstLine,
+					   const CFuint first,
+					   const CFuint nbBlocks,
+					   const CFuint linesPerEntry,
+					   vector<CFuint>& blocks)
+{
+  // each header gives the position of the next one, so that the processor
+  // having the line of a header broadcasts it to the others
+  blocks.resize(5*nbBlocks);
+  CFuint line = first;
+  for (CFuint b = 0; b < nbBlocks; ++b) {
+    if (line >= firstLine[m_nbProc]) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => block header beyond the end of the file");
+    }
+
+    CFuint* header = &blocks[5*b];
+    header[0] = line;
+    const CFuint owner = getOwnerRank(firstLine, line);
+    if (owner == m_myRank) {
+      char* ptr = &buf[lineStarts[line - firstLine[m_myRank]]];
+      for (CFuint k = 1; k < 5; ++k) {
+	header[k] = readUInt(ptr);
+      }
+    }
+
+    MPIError::getInstance().check
+      ("MPI_Bcast", "ParGmshFileReader::readBlockHeaders()",
+       MPI_Bcast(&header[1], 4, MPIStructDef::getMPIType(&header[1]), owner, m_comm));
+
+    line += 1 + linesPerEntry*header[4];
+  }
+  return line;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readBinaryLists(ifstream& fin)
+{
+  CFLogDebugMin( "ParGmshFileReader::readBinaryLists() start\n");
+
+  // each node is made of the tag (int) and of the coordinates (3 double)
+  const CFuint nodeSize = sizeof(int) + 3*sizeof(double);
+
+  m_nodeRanges.resize(m_nbProc+1);
+  for (CFuint r = 0; r <= m_nbProc; ++r) {
+    m_nodeRanges[r] = static_cast<CFuint>((static_cast<CFdouble>(m_totNbNodes)*r)/m_nbProc);
+  }
+  m_nodeRanges[m_nbProc] = m_totNbNodes;
+
+  const CFuint nbLocalNodes = m_nodeRanges[m_myRank+1] - m_nodeRanges[m_myRank];
+  vector<char> nodeBuf(nbLocalNodes*nodeSize);
+  fin.seekg(m_nodeListStart + static_cast<streamoff>(m_nodeRanges[m_myRank])*nodeSize);
+  if (nbLocalNodes > 0) {
+    fin.read(&nodeBuf[0], nodeBuf.size());
+  }
+
+  m_nodeTags.resize(nbLocalNodes);
+  m_nodeCoords.resize(nbLocalNodes*m_dim);
+  for (CFuint i = 0; i < nbLocalNodes; ++i) {
+    const char* node = &nodeBuf[i*nodeSize];
+    int tag = 0;
+    double xyz[3];
+    memcpy(&tag, node, sizeof(int));
+    memcpy(xyz, node + sizeof(int), 3*sizeof(double));
+    m_nodeTags[i] = tag;
+    for (CFuint d = 0; d < m_dim; ++d) {
+      m_nodeCoords[i*m_dim+d] = xyz[d];
+    }
+  }
+  SwapEmpty(nodeBuf);
+
+  fin.seekg(m_nodeListStart + static_cast<streamoff>(m_totNbNodes)*nodeSize);
+  std::string line = "";
+  while (line.compare(0, 9, "$Elements") != 0) {
+    if (!getline(fin, line)) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => $Elements missing");
+    }
+  }
+  getline(fin, line);
+  CFuint nbElems = 0;
+  istringstream nb(line);
+  nb >> nbElems;
+
+  // the elements are written in blocks made of a header (type, number of
+  // elements, number of tags) and of the elements (number, tags, nodes)
+  vector<streamoff> blockStart;
+  vector<CFuint> blockFirst;
+  vector<CFuint> blockType;
+  vector<CFuint> blockNbTags;
+  CFuint count = 0;
+  while (count < nbElems) {
+    int header[3];
+    fin.read(reinterpret_cast<char*>(header), 3*sizeof(int));
+    if (!fin || header[0] < 1 || header[0] > static_cast<int>(m_nodesPerType.size())) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => bad element block in binary file");
+    }
+
+    const CFuint gmshType = header[0] - 1;
+    blockStart.push_back(fin.tellg());
+    blockFirst.push_back(count);
+    blockType.push_back(gmshType);
+    blockNbTags.push_back(header[2]);
+
+    count += header[1];
+    const CFuint elemSize = 1 + header[2] + m_nodesPerType[gmshType];
+    fin.seekg(static_cast<streamoff>(header[1])*elemSize*sizeof(int), ios_base::cur);
+  }
+  blockFirst.push_back(count);
+
+  // elements read by this processor
+  const CFuint first = static_cast<CFuint>((static_cast<CFdouble>(nbElems)*m_myRank)/m_nbProc);
+  const CFuint last  = (m_myRank == m_nbProc-1) ? nbElems :
+    static_cast<CFuint>((static_cast<CFdouble>(nbElems)*(m_myRank+1))/m_nbProc);
+
+  m_cellPtr.assign(1, 0);
+  m_facePtr.assign(1, 0);
+
+  vector<int> elemBuf;
+  vector<CFuint> nodeTags;
+  for (CFuint b = 0; b < blockStart.size(); ++b) {
+    const CFuint start = std::max(first, blockFirst[b]);
+    const CFuint stop  = std::min(last, blockFirst[b+1]);
+    if (start >= stop) continue;
+
+    const CFuint gmshType = blockType[b];
+    const CFuint nbTags = blockNbTags[b];
+    const CFuint elemSize = 1 + nbTags + m_nodesPerType[gmshType];
+    elemBuf.resize((stop - start)*elemSize);
+    fin.seekg(blockStart[b] + static_cast<streamoff>(start - blockFirst[b])*elemSize*sizeof(int));
+    fin.read(reinterpret_cast<char*>(&elemBuf[0]), elemBuf.size()*sizeof(int));
+
+    nodeTags.resize(m_nodesPerType[gmshType]);
+    for (CFuint e = 0; e < stop - start; ++e) {
+      const int* elem = &elemBuf[e*elemSize];
+      const CFuint physTag = (nbTags > 0) ? elem[1] : 0;
+      for (CFuint n = 0; n < nodeTags.size(); ++n) {
+	nodeTags[n] = elem[1 + nbTags + n];
+      }
+      storeElement(gmshType, physTag, nodeTags);
+    }
+  }
+
+  CFLog(VERBOSE, "ParGmshFileReader::readBinaryLists() => " << m_nodeTags.size() << " nodes, "
+	<< m_cellTypes.size() << " cells, " << m_faceTags.size() << " faces read\n");
+
+  CFLogDebugMin( "ParGmshFileReader::readBinaryLists() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::readBinaryBlocks(ifstream& fin)
+{
+  CFLogDebugMin( "ParGmshFileReader::readBinaryBlocks() start\n");
+
+  // each node block is made of a header (entity dimension, entity tag,
+  // parametric flag, number of nodes), of the node tags (size) and of the
+  // coordinates (3 double, plus the parametric ones, if any)
+  vector<streamoff> blockStart;
+  vector<CFuint> blockFirst;
+  vector<CFuint> blockNbCoords;
+  fin.seekg(m_nodeListStart);
+  CFuint count = 0;
+  for (CFuint b = 0; b < m_nbNodeBlocks; ++b) {
+    int header[3];
+    MshSize nbBlockNodes = 0;
+    fin.read(reinterpret_cast<char*>(header), 3*sizeof(int));
+    fin.read(reinterpret_cast<char*>(&nbBlockNodes), sizeof(MshSize));
+    if (!fin) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => bad node block in binary file");
+    }
+
+    const CFuint nbCoords = (header[2] != 0) ? 3 + header[0] : 3;
+    blockStart.push_back(fin.tellg());
+    blockFirst.push_back(count);
+    blockNbCoords.push_back(nbCoords);
+
+    count += nbBlockNodes;
+    fin.seekg(static_cast<streamoff>(nbBlockNodes)*(sizeof(MshSize) + nbCoords*sizeof(double)),
+	      ios_base::cur);
+  }
+  blockFirst.push_back(count);
+  const streamoff nodeListEnd = fin.tellg();
+
+  if (count != m_totNbNodes) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => number of nodes differs from $Nodes blocks");
+  }
+
+  // the nodes are split evenly in the order of the file and each processor
+  // reads its range directly
+  m_nodeRanges.resize(m_nbProc+1);
+  for (CFuint r = 0; r <= m_nbProc; ++r) {
+    m_nodeRanges[r] = static_cast<CFuint>((static_cast<CFdouble>(m_totNbNodes)*r)/m_nbProc);
+  }
+  m_nodeRanges[m_nbProc] = m_totNbNodes;
+
+  const CFuint firstNode = m_nodeRanges[m_myRank];
+  const CFuint lastNode  = m_nodeRanges[m_myRank+1];
+  m_nodeTags.reserve(lastNode - firstNode);
+  m_nodeCoords.reserve((lastNode - firstNode)*m_dim);
+
+  vector<MshSize> tagBuf;
+  vector<double> coordBuf;
+  for (CFuint b = 0; b < m_nbNodeBlocks; ++b) {
+    const CFuint start = std::max(firstNode, blockFirst[b]);
+    const CFuint stop  = std::min(lastNode, blockFirst[b+1]);
+    if (start >= stop) continue;
+
+    const CFuint nbBlockNodes = blockFirst[b+1] - blockFirst[b];
+    const CFuint nbCoords = blockNbCoords[b];
+    const streamoff offset = start - blockFirst[b];
+    tagBuf.resize(stop - start);
+    fin.seekg(blockStart[b] + offset*sizeof(MshSize));
+    fin.read(reinterpret_cast<char*>(&tagBuf[0]), tagBuf.size()*sizeof(MshSize));
+
+    coordBuf.resize((stop - start)*nbCoords);
+    fin.seekg(blockStart[b] + static_cast<streamoff>(nbBlockNodes)*sizeof(MshSize) +
+	      offset*nbCoords*sizeof(double));
+    fin.read(reinterpret_cast<char*>(&coordBuf[0]), coordBuf.size()*sizeof(double));
+
+    for (CFuint i = 0; i < stop - start; ++i) {
+      m_nodeTags.push_back(static_cast<CFuint>(tagBuf[i]));
+      for (CFuint d = 0; d < m_dim; ++d) {
+	m_nodeCoords.push_back(coordBuf[i*nbCoords+d]);
+      }
+    }
+  }
+  SwapEmpty(coordBuf);
+
+  fin.seekg(nodeListEnd);
+  std::string line = "";
+  while (line.compare(0, 9, "$Elements") != 0) {
+    if (!getline(fin, line)) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => $Elements missing");
+    }
+  }
+
+  // number of blocks and of elements, minimum and maximum element tag
+  MshSize elemCounts[4];
+  fin.read(reinterpret_cast<char*>(elemCounts), 4*sizeof(MshSize));
+  const CFuint nbElems = elemCounts[1];
+
+  // each element block is made of a header (entity dimension, entity tag,
+  // element type, number of elements) and of the elements (tag and node
+  // tags, as size)
+  blockStart.clear();
+  blockFirst.clear();
+  vector<CFuint> blockType;
+  vector<CFuint> blockPhysTag;
+  count = 0;
+  for (MshSize b = 0; b < elemCounts[0]; ++b) {
+    int header[3];
+    MshSize nbBlockElems = 0;
+    fin.read(reinterpret_cast<char*>(header), 3*sizeof(int));
+    fin.read(reinterpret_cast<char*>(&nbBlockElems), sizeof(MshSize));
+    if (!fin || header[2] < 1 || header[2] > static_cast<int>(m_nodesPerType.size())) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => bad element block in binary file");
+    }
+
+    // the elements have no tags, their physical group is the one of the entity
+    CFuint physTag = 0;
+    if (header[0] >= 0 && header[0] < static_cast<int>(m_entityPhysTags.size())) {
+      map<CFuint, CFuint>::const_iterator it = m_entityPhysTags[header[0]].find(header[1]);
+      if (it != m_entityPhysTags[header[0]].end()) {physTag = it->second;}
+    }
+
+    const CFuint gmshType = header[2] - 1;
+    blockStart.push_back(fin.tellg());
+    blockFirst.push_back(count);
+    blockType.push_back(gmshType);
+    blockPhysTag.push_back(physTag);
+
+    count += nbBlockElems;
+    const CFuint elemSize = 1 + m_nodesPerType[gmshType];
+    fin.seekg(static_cast<streamoff>(nbBlockElems)*elemSize*sizeof(MshSize), ios_base::cur);
+  }
+  blockFirst.push_back(count);
+
+  if (count != nbElems) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => element blocks differ from $Elements list");
+  }
+
+  // elements read by this processor
+  const CFuint first = static_cast<CFuint>((static_cast<CFdouble>(nbElems)*m_myRank)/m_nbProc);
+  const CFuint last  = (m_myRank == m_nbProc-1) ? nbElems :
+    static_cast<CFuint>((static_cast<CFdouble>(nbElems)*(m_myRank+1))/m_nbProc);
+
+  m_cellPtr.assign(1, 0);
+  m_facePtr.assign(1, 0);
+
+  vector<MshSize> elemBuf;
+  vector<CFuint> nodeTags;
+  for (CFuint b = 0; b < blockStart.size(); ++b) {
+    const CFuint start = std::max(first, blockFirst[b]);
+    const CFuint stop  = std::min(last, blockFirst[b+1]);
+    if (start >= stop) continue;
+
+    const CFuint gmshType = blockType[b];
+    const CFuint elemSize = 1 + m_nodesPerType[gmshType];
+    elemBuf.resize((stop - start)*elemSize);
+    fin.seekg(blockStart[b] + static_cast<streamoff>(start - blockFirst[b])*elemSize*sizeof(MshSize));
+    fin.read(reinterpret_cast<char*>(&elemBuf[0]), elemBuf.size()*sizeof(MshSize));
+
+    nodeTags.resize(m_nodesPerType[gmshType]);
+    for (CFuint e = 0; e < stop - start; ++e) {
+      const MshSize* elem = &elemBuf[e*elemSize];
+      for (CFuint n = 0; n < nodeTags.size(); ++n) {
+	nodeTags[n] = static_cast<CFuint>(elem[1 + n]);
+      }
+      storeElement(gmshType, blockPhysTag[b], nodeTags);
+    }
+  }
+
+  if (!fin) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => binary file ended while reading the lists");
+  }
+
+  CFLog(VERBOSE, "ParGmshFileReader::readBinaryBlocks() => " << m_nodeTags.size() << " nodes, "
+	<< m_cellTypes.size() << " cells, " << m_faceTags.size() << " faces read\n");
+
+  CFLogDebugMin( "ParGmshFileReader::readBinaryBlocks() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::storeElement(const CFuint gmshType,
+				     const CFuint physTag,
+				     const vector<CFuint>& nodeTags)
+{
+  const CFuint nbNodes = m_nodesPerType[gmshType];
+
+  if (m_dimPerType[gmshType] == m_dim) {
+    m_cellTypes.push_back(gmshType);
+    for (CFuint n = 0; n < nbNodes; ++n) {
+      m_cellNodes.push_back(nodeTags[m_mapNodeIdx[gmshType][n]]);
+    }
+    m_cellPtr.push_back(m_cellNodes.size());
+  }
+  else if (m_dimPerType[gmshType] + 1 == m_dim) {
+    m_faceTags.push_back(physTag);
+    for (CFuint n = 0; n < nbNodes; ++n) {
+      m_faceNodes.push_back(nodeTags[n]);
+    }
+    m_facePtr.push_back(m_faceNodes.size());
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void ParGmshFileReader::exchangeLists(const vector<vector<T> >& sendLists,
+				      vector<T>& recvBuf,
+				      vector<int>& recvCount)
+{
+  vector<int> sendCount(m_nbProc, 0);
+  vector<int> sendDispl(m_nbProc, 0);
+  vector<int> recvDispl(m_nbProc, 0);
+  recvCount.assign(m_nbProc, 0);
+
+  CFuint sendSize = 0;
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    sendCount[r] = sendLists[r].size();
+    sendDispl[r] = sendSize;
+    sendSize += sendLists[r].size();
+  }
+
+  vector<T> sendBuf;
+  sendBuf.reserve(sendSize);
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    sendBuf.insert(sendBuf.end(), sendLists[r].begin(), sendLists[r].end());
+  }
+
+  MPIError::getInstance().check
+    ("MPI_Alltoall", "ParGmshFileReader::exchangeLists()",
+     MPI_Alltoall(&sendCount[0], 1, MPIStructDef::getMPIType(&sendCount[0]),
+		  &recvCount[0], 1, MPIStructDef::getMPIType(&recvCount[0]), m_comm));
+
+  CFuint recvSize = 0;
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    recvDispl[r] = recvSize;
+    recvSize += recvCount[r];
+  }
+  recvBuf.resize(recvSize);
+
+  // empty buffers still need a valid address
+  T dummy = T();
+  T* sendPtr = (sendSize > 0) ? &sendBuf[0] : &dummy;
+  T* recvPtr = (recvSize > 0) ? &recvBuf[0] : &dummy;
+
+  MPIError::getInstance().check
+    ("MPI_Alltoallv", "ParGmshFileReader::exchangeLists()",
+     MPI_Alltoallv(sendPtr, &sendCount[0], &sendDispl[0], MPIStructDef::getMPIType(&dummy),
+		   recvPtr, &recvCount[0], &recvDispl[0], MPIStructDef::getMPIType(&dummy), m_comm));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::setGlobalNodeIDs()
+{
+  CFLogDebugMin( "ParGmshFileReader::setGlobalNodeIDs() start\n");
+
+  // usually the Gmsh tags are the positions in the node list plus one
+  int isContiguous = 1;
+  for (CFuint i = 0; i < m_nodeTags.size(); ++i) {
+    if (m_nodeTags[i] != m_nodeRanges[m_myRank] + i + 1) {
+      isContiguous = 0;
+      break;
+    }
+  }
+
+  int allContiguous = 0;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "ParGmshFileReader::setGlobalNodeIDs()",
+     MPI_Allreduce(&isContiguous, &allContiguous, 1, MPI_INT, MPI_MIN, m_comm));
+
+  if (allContiguous == 1) {
+    for (CFuint i = 0; i < m_cellNodes.size(); ++i) {
+      cf_assert(m_cellNodes[i] > 0 && m_cellNodes[i] <= m_totNbNodes);
+      m_cellNodes[i] -= 1;
+    }
+    for (CFuint i = 0; i < m_faceNodes.size(); ++i) {
+      cf_assert(m_faceNodes[i] > 0 && m_faceNodes[i] <= m_totNbNodes);
+      m_faceNodes[i] -= 1;
+    }
+  }
+  else {
+    CFLog(INFO, "ParGmshFileReader => non contiguous node tags, renumbering nodes\n");
+
+    // the processor (tag % nbProc) stores the position of the node with that tag
+    vector<vector<CFuint> > sendLists(m_nbProc);
+    for (CFuint i = 0; i < m_nodeTags.size(); ++i) {
+      const CFuint tag = m_nodeTags[i];
+      sendLists[tag % m_nbProc].push_back(tag);
+      sendLists[tag % m_nbProc].push_back(m_nodeRanges[m_myRank] + i);
+    }
+
+    vector<CFuint> recvBuf;
+    vector<int> recvCount;
+    exchangeLists(sendLists, recvBuf, recvCount);
+
+    CFMap<CFuint, CFuint> directory(recvBuf.size()/2);
+    for (CFuint i = 0; i < recvBuf.size(); i += 2) {
+      directory.insert(recvBuf[i], recvBuf[i+1]);
+    }
+    directory.sortKeys();
+
+    // ask the positions of the nodes referenced by the local elements
+    vector<CFuint> tags(m_cellNodes);
+    tags.insert(tags.end(), m_faceNodes.begin(), m_faceNodes.end());
+    sort(tags.begin(), tags.end());
+    tags.erase(unique(tags.begin(), tags.end()), tags.end());
+
+    for (CFuint r = 0; r < m_nbProc; ++r) {
+      sendLists[r].clear();
+    }
+    for (CFuint i = 0; i < tags.size(); ++i) {
+      sendLists[tags[i] % m_nbProc].push_back(tags[i]);
+    }
+    exchangeLists(sendLists, recvBuf, recvCount);
+
+    // answer in the order of the requests
+    vector<vector<CFuint> > replies(m_nbProc);
+    CFuint idx = 0;
+    for (CFuint r = 0; r < m_nbProc; ++r) {
+      for (int i = 0; i < recvCount[r]; ++i, ++idx) {
+	bool found = false;
+	const CFuint nodeID = directory.find(recvBuf[idx], found);
+	if (!found) {
+	  throw BadFormatException (FromHere(),"ParGmshFileReader => element with unknown node " +
+				    StringOps::to_str(recvBuf[idx]));
+	}
+	replies[r].push_back(nodeID);
+      }
+    }
+    directory.clear();
+
+    exchangeLists(replies, recvBuf, recvCount);
+
+    CFMap<CFuint, CFuint> tagToNodeID(tags.size());
+    idx = 0;
+    for (CFuint r = 0; r < m_nbProc; ++r) {
+      for (CFuint i = 0; i < sendLists[r].size(); ++i, ++idx) {
+	tagToNodeID.insert(sendLists[r][i], recvBuf[idx]);
+      }
+    }
+    tagToNodeID.sortKeys();
+
+    for (CFuint i = 0; i < m_cellNodes.size(); ++i) {
+      m_cellNodes[i] = tagToNodeID.find(m_cellNodes[i]);
+    }
+    for (CFuint i = 0; i < m_faceNodes.size(); ++i) {
+      m_faceNodes[i] = tagToNodeID.find(m_faceNodes[i]);
+    }
+  }
+
+  SwapEmpty(m_nodeTags);
+
+  CFLogDebugMin( "ParGmshFileReader::setGlobalNodeIDs() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::setElementTypes()
+{
+  CFLogDebugMin( "ParGmshFileReader::setElementTypes() start\n");
+
+  const CFuint nbGmshTypes = m_nodesPerType.size();
+  vector<CFuint> localCount(nbGmshTypes, 0);
+  for (CFuint i = 0; i < m_cellTypes.size(); ++i) {
+    localCount[m_cellTypes[i]]++;
+  }
+
+  vector<CFuint> totalCount(nbGmshTypes, 0);
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "ParGmshFileReader::setElementTypes()",
+     MPI_Allreduce(&localCount[0], &totalCount[0], nbGmshTypes,
+		   MPIStructDef::getMPIType(&localCount[0]), MPI_SUM, m_comm));
+
+  // element types are ordered as the Gmsh types
+  m_typeIDs.clear();
+  m_totNbElem = 0;
+  CFuint order = 0;
+  for (CFuint iType = 0; iType < nbGmshTypes; ++iType) {
+    if (totalCount[iType] > 0) {
+      m_typeIDs.push_back(iType);
+      m_totNbElem += totalCount[iType];
+      order = std::max(order, m_orderPerType[iType]);
+    }
+  }
+  m_totNbElemTypes = m_typeIDs.size();
+
+  if (m_totNbElem < 1) {
+    throw BadFormatException (FromHere(),"ParGmshFileReader => no element of dimension " +
+			      StringOps::to_str(m_dim));
+  }
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  m_originalNbEqs = nbEqs;
+  getReadData().setDimension(m_dim);
+  getReadData().setNbEquations(nbEqs);
+  getReadData().setNbElements(m_totNbElem);
+  getReadData().setNbElementTypes(m_totNbElemTypes);
+  getReadData().setGeometricPolyOrder(static_cast<CFPolyOrder::Type>(order));
+  getReadData().setSolutionPolyOrder
+    (m_isDiscontinuous ? CFPolyOrder::ORDER0 : static_cast<CFPolyOrder::Type>(order));
+
+  SafePtr< vector<ElementTypeData> > elementType = getReadData().getElementTypeData();
+  elementType->resize(m_totNbElemTypes);
+  for (CFuint i = 0; i < m_totNbElemTypes; ++i) {
+    const CFuint gmshType = m_typeIDs[i];
+    const std::string shape = MapGeoEnt::identifyGeoEnt
+      (m_nodesPerType[gmshType], m_orderPerType[gmshType], m_dim);
+    (*elementType)[i].setShape(shape);
+    (*elementType)[i].setGeoShape(CFGeoShape::Convert::to_enum(shape));
+    (*elementType)[i].setNbElems(totalCount[gmshType]);
+    (*elementType)[i].setNbNodes(m_nodesPerType[gmshType]);
+    (*elementType)[i].setNbStates(m_isDiscontinuous ? 1 : m_nodesPerType[gmshType]);
+  }
+
+  m_totNbStates = (m_isDiscontinuous) ? m_totNbElem : m_totNbNodes;
+
+  MeshDataStack::getActive()->setTotalNodeCount(m_totNbNodes);
+  MeshDataStack::getActive()->setTotalStateCount(m_totNbStates);
+  getReadData().setNbUpdatableNodes(m_totNbNodes);
+  getReadData().setNbNonUpdatableNodes(0);
+  getReadData().setNbUpdatableStates(m_totNbStates);
+  getReadData().setNbNonUpdatableStates(0);
+
+  CFLog(INFO, "ParGmshFileReader => " << m_totNbElem << " elements of " << m_totNbElemTypes
+	<< " types, " << m_totNbNodes << " nodes, " << m_totNbStates << " states\n");
+
+  CFLogDebugMin( "ParGmshFileReader::setElementTypes() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::distributeElements()
+{
+  CFLogDebugMin( "ParGmshFileReader::distributeElements() start\n");
+
+  // the cells are numbered by type, then by processor, then as in the file
+  vector<CFuint> typeIdx(m_nodesPerType.size(), 0);
+  for (CFuint iType = 0; iType < m_totNbElemTypes; ++iType) {
+    typeIdx[m_typeIDs[iType]] = iType;
+  }
+
+  vector<CFuint> localCount(m_totNbElemTypes, 0);
+  for (CFuint i = 0; i < m_cellTypes.size(); ++i) {
+    localCount[typeIdx[m_cellTypes[i]]]++;
+  }
+
+  vector<CFuint> allCounts(m_totNbElemTypes*m_nbProc, 0);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "ParGmshFileReader::distributeElements()",
+     MPI_Allgather(&localCount[0], m_totNbElemTypes, MPIStructDef::getMPIType(&localCount[0]),
+		   &allCounts[0], m_totNbElemTypes, MPIStructDef::getMPIType(&localCount[0]), m_comm));
+
+  vector<CFuint> nextID(m_totNbElemTypes, 0);
+  CFuint typeStart = 0;
+  for (CFuint iType = 0; iType < m_totNbElemTypes; ++iType) {
+    nextID[iType] = typeStart;
+    for (CFuint r = 0; r < m_nbProc; ++r) {
+      if (r < m_myRank) {nextID[iType] += allCounts[r*m_totNbElemTypes + iType];}
+      typeStart += allCounts[r*m_totNbElemTypes + iType];
+    }
+  }
+
+  // allocate the partitioner data
+  PartitionerData pdata;
+
+  // set the local coloring array data inside the partitioner data
+  // for later usage
+  pdata.part = &m_partitionerOutData;
+
+  // set the element distribution array
+  setElmDistArray(pdata.elmdist);
+  setSizeElemVec(pdata.sizeElemNodeVec, pdata.sizeElemStateVec);
+  m_elemRanges.assign(pdata.elmdist.begin(), pdata.elmdist.end());
+
+  // send each cell (global ID, nb nodes, nodes) to the processor owning it
+  vector<vector<CFuint> > sendLists(m_nbProc);
+  for (CFuint i = 0; i < m_cellTypes.size(); ++i) {
+    const CFuint globalID = nextID[typeIdx[m_cellTypes[i]]]++;
+    const CFuint rank = getOwnerRank(m_elemRanges, globalID);
+    sendLists[rank].push_back(globalID);
+    sendLists[rank].push_back(m_cellPtr[i+1] - m_cellPtr[i]);
+    sendLists[rank].insert(sendLists[rank].end(),
+			   m_cellNodes.begin() + m_cellPtr[i],
+			   m_cellNodes.begin() + m_cellPtr[i+1]);
+  }
+  SwapEmpty(m_cellTypes);
+  SwapEmpty(m_cellPtr);
+  SwapEmpty(m_cellNodes);
+
+  vector<CFuint> recvBuf;
+  vector<int> recvCount;
+  exchangeLists(sendLists, recvBuf, recvCount);
+  SwapEmpty(sendLists);
+
+  const CFuint firstID = m_elemRanges[m_myRank];
+  const CFuint nbElems = m_nbElemPerProc[m_myRank];
+  vector<CFuint> cellStart(nbElems, 0);
+  for (CFuint i = 0; i < recvBuf.size(); i += 2 + recvBuf[i+1]) {
+    cf_assert(recvBuf[i] - firstID < nbElems);
+    cellStart[recvBuf[i] - firstID] = i;
+  }
+
+  pdata.elemNode.resize(pdata.sizeElemNodeVec[m_myRank]);
+  pdata.elemState.resize(pdata.sizeElemStateVec[m_myRank]);
+  pdata.eptrn.resize(nbElems + 1);
+  pdata.eptrs.resize(nbElems + 1);
+
+  CFuint ncount = 0;
+  CFuint scount = 0;
+  for (CFuint iElem = 0; iElem < nbElems; ++iElem) {
+    pdata.eptrn[iElem] = ncount;
+    pdata.eptrs[iElem] = scount;
+
+    const CFuint start = cellStart[iElem];
+    const CFuint nbNodesInElem = recvBuf[start+1];
+    for (CFuint n = 0; n < nbNodesInElem; ++n, ++ncount) {
+      pdata.elemNode[ncount] = recvBuf[start+2+n];
+    }
+
+    if (m_isDiscontinuous) {
+      pdata.elemState[scount++] = firstID + iElem;
+    }
+    else {
+      for (CFuint n = 0; n < nbNodesInElem; ++n, ++scount) {
+	pdata.elemState[scount] = recvBuf[start+2+n];
+      }
+    }
+  }
+  pdata.eptrn[nbElems] = ncount;
+  pdata.eptrs[nbElems] = scount;
+  cf_assert(ncount == pdata.elemNode.size());
+  cf_assert(scount == pdata.elemState.size());
+  SwapEmpty(recvBuf);
+
+  pdata.ndim = (CFint)m_dim;
+
+  // do the partitioning of the mesh
+  // global element IDs local to each processor after the partitioning
+  // will be placed in pdata.part
+  cf_assert(m_partitioner.isNotNull());
+
+  // avoid mesh partitioning if you have just one processor
+  if (m_nbProc > 1)
+  {
+    if (m_dim > DIM_1D) {
+      m_partitioner->SetCommunicator(m_comm);
+      CFLog(NOTICE, "Calling mesh partitioner\n");
+      CFLog(NOTICE, "+++\n");
+      m_partitioner->doPartition(pdata);
+      CFLog(NOTICE, "+++\n");
+    }
+    else {
+      pdata.part->resize(m_nbElemPerProc[m_myRank], m_myRank);
+    }
+  }
+  else
+  {
+    cf_assert(m_myRank == 0);
+    pdata.part->resize(m_nbElemPerProc[m_myRank], 0);
+  }
+
+  // move the elements data to the right processor
+  // and build info about the overlap region
+  m_local_elem = new ElementDataArray<0>;
+  moveElementData(*m_local_elem, pdata);
+
+  cf_assert(m_localNodeIDs.size() > 0);
+  cf_assert(m_localStateIDs.size() > 0);
+
+  // set mapping between global and local node/state IDs
+  setMapGlobalToLocalID(m_localNodeIDs, m_ghostNodeIDs, m_mapGlobToLocNodeID);
+  setMapGlobalToLocalID(m_localStateIDs, m_ghostStateIDs, m_mapGlobToLocStateID);
+
+  // set the elements in the readData
+  setElements(*m_local_elem);
+
+  setMapNodeElemID(*m_local_elem);
+
+  CFLogDebugMin( "ParGmshFileReader::distributeElements() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::createNodes()
+{
+  CFLogDebugMin( "ParGmshFileReader::createNodes() start\n");
+
+  if (getReadData().storePastNodes() || getReadData().storeInterNodes()) {
+    throw BadFormatException
+      (FromHere(), "ParGmshFileReader => past or intermediate nodes are asked but not present in Gmsh file");
+  }
+
+  const CFuint nbLocalNodes = m_localNodeIDs.size() + m_ghostNodeIDs.size();
+  const std::string nsp = MeshDataStack::getActive()->getPrimaryNamespace();
+  const std::string parNodeVecName = nsp + "_nodes";
+
+  DataHandle<Node*,GLOBAL> nodes = MeshDataStack::getActive()->getDataStorage()->
+    getGlobalData<Node*>(parNodeVecName);
+
+  cf_assert(nbLocalNodes > 0);
+  nodes.reserve(nbLocalNodes, m_dim*sizeof(CFreal), nsp);
+  getReadData().resizeNodes(nbLocalNodes);
+
+  sort(m_localNodeIDs.begin(), m_localNodeIDs.end());
+  sort(m_ghostNodeIDs.begin(), m_ghostNodeIDs.end());
+
+  nodes.setMapGhost2DonorRanks(m_gNodeID2DonorRank);
+
+  getReadData().prepareNodalExtraVars();
+
+  // create a sorted single list of all global IDs locally present
+  vector<CFgid> globalIDs(m_localNodeIDs);
+  globalIDs.insert(globalIDs.end(), m_ghostNodeIDs.begin(), m_ghostNodeIDs.end());
+  sort(globalIDs.begin(), globalIDs.end());
+
+  // ask the coordinates to the processors which have read the nodes:
+  // since the IDs are sorted, the answers come in the same order
+  vector<vector<CFuint> > sendLists(m_nbProc);
+  for (CFuint i = 0; i < nbLocalNodes; ++i) {
+    const CFuint rank = getOwnerRank(m_nodeRanges, globalIDs[i]);
+    sendLists[rank].push_back(globalIDs[i] - m_nodeRanges[rank]);
+  }
+
+  vector<CFuint> requests;
+  vector<int> recvCount;
+  exchangeLists(sendLists, requests, recvCount);
+  SwapEmpty(sendLists);
+
+  vector<vector<CFreal> > replies(m_nbProc);
+  CFuint idx = 0;
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    replies[r].reserve(recvCount[r]*m_dim);
+    for (int i = 0; i < recvCount[r]; ++i, ++idx) {
+      const CFuint start = requests[idx]*m_dim;
+      cf_assert(start < m_nodeCoords.size());
+      replies[r].insert(replies[r].end(), m_nodeCoords.begin() + start,
+			m_nodeCoords.begin() + start + m_dim);
+    }
+  }
+  SwapEmpty(requests);
+  SwapEmpty(m_nodeCoords);
+
+  vector<CFreal> coords;
+  exchangeLists(replies, coords, recvCount);
+  cf_assert(coords.size() == nbLocalNodes*m_dim);
+
+  RealVector tmpNode(0.0, m_dim);
+  for (CFuint i = 0; i < nbLocalNodes; ++i) {
+    const CFgid globalID = globalIDs[i];
+    const bool isGhost = !hasEntry(m_localNodeIDs, globalID);
+    const CFuint localID = (isGhost) ?
+      nodes.addGhostPoint(globalID) : nodes.addLocalPoint(globalID);
+    cf_assert(localID < nbLocalNodes);
+
+    for (CFuint d = 0; d < m_dim; ++d) {
+      tmpNode[d] = coords[i*m_dim + d];
+    }
+
+    Node* newNode = getReadData().createNode
+      (localID, nodes.getGlobalData(localID), tmpNode, !isGhost);
+    newNode->setGlobalID(globalID);
+  }
+
+  CFLogDebugMin( "ParGmshFileReader::createNodes() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::createStates()
+{
+  CFLogDebugMin( "ParGmshFileReader::createStates() start\n");
+
+  if (getReadData().storePastStates() || getReadData().storeInterStates()) {
+    throw BadFormatException
+      (FromHere(), "ParGmshFileReader => past or intermediate states are asked but not present in Gmsh file");
+  }
+
+  // the states are initialized afterwards
+  getReadData().setWithSolution(false);
+
+  const CFuint nbLocalStates = m_localStateIDs.size() + m_ghostStateIDs.size();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const std::string nsp = MeshDataStack::getActive()->getPrimaryNamespace();
+  const std::string parStateVecName = nsp + "_states";
+
+  DataHandle<State*,GLOBAL> states = MeshDataStack::getActive()->getDataStorage()->
+    getGlobalData<State*>(parStateVecName);
+
+  cf_assert(nbLocalStates > 0);
+  states.reserve(nbLocalStates, nbEqs*sizeof(CFreal), nsp);
+  getReadData().resizeStates(nbLocalStates);
+
+  sort(m_localStateIDs.begin(), m_localStateIDs.end());
+  sort(m_ghostStateIDs.begin(), m_ghostStateIDs.end());
+
+  states.setMapGhost2DonorRanks(m_gStateID2DonorRank);
+
+  getReadData().prepareStateExtraVars();
+
+  vector<CFgid> globalIDs(m_localStateIDs);
+  globalIDs.insert(globalIDs.end(), m_ghostStateIDs.begin(), m_ghostStateIDs.end());
+  sort(globalIDs.begin(), globalIDs.end());
+
+  State tmpState;
+  for (CFuint i = 0; i < nbLocalStates; ++i) {
+    const CFgid globalID = globalIDs[i];
+    const bool isGhost = !hasEntry(m_localStateIDs, globalID);
+    const CFuint localID = (isGhost) ?
+      states.addGhostPoint(globalID) : states.addLocalPoint(globalID);
+    cf_assert(localID < nbLocalStates);
+
+    State* newState = getReadData().createState
+      (localID, states.getGlobalData(localID), tmpState, !isGhost);
+    newState->setGlobalID(globalID);
+  }
+
+  CFLogDebugMin( "ParGmshFileReader::createStates() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::setTRSData()
+{
+  CFLogDebugMin( "ParGmshFileReader::setTRSData() start\n");
+
+  // candidate TRSs are the physical groups of dimension dim-1
+  map<CFuint, CFuint> tagToGroup;
+  vector<CFuint> groupTags;
+  for (map<CFuint, CFuint>::const_iterator it = m_physDims.begin(); it != m_physDims.end(); ++it) {
+    if (it->second + 1 == m_dim) {
+      tagToGroup[it->first] = groupTags.size();
+      groupTags.push_back(it->first);
+    }
+  }
+
+  const CFuint nbGroups = groupTags.size();
+  const CFuint nbFaces = m_faceTags.size();
+  vector<CFuint> localCount(nbGroups + 1, 0);
+  for (CFuint i = 0; i < nbFaces; ++i) {
+    if (tagToGroup.find(m_faceTags[i]) == tagToGroup.end()) {
+      throw BadFormatException (FromHere(),"ParGmshFileReader => boundary face in physical group " +
+				StringOps::to_str(m_faceTags[i]) + " without physical name");
+    }
+    localCount[tagToGroup[m_faceTags[i]]]++;
+  }
+
+  // the count array is never empty, to have valid addresses
+  vector<CFuint> allCounts((nbGroups + 1)*m_nbProc, 0);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "ParGmshFileReader::setTRSData()",
+     MPI_Allgather(&localCount[0], nbGroups + 1, MPIStructDef::getMPIType(&localCount[0]),
+		   &allCounts[0], nbGroups + 1, MPIStructDef::getMPIType(&localCount[0]), m_comm));
+
+  // TRSs are the groups with faces, with one TR each, and the faces are
+  // numbered inside each TRS by processor, then as in the file
+  vector<CFint> groupToTRS(nbGroups, -1);
+  vector<CFuint> nextGeo(nbGroups, 0);
+  vector<CFuint> nbGeosInTRS;
+  for (CFuint g = 0; g < nbGroups; ++g) {
+    CFuint total = 0;
+    for (CFuint r = 0; r < m_nbProc; ++r) {
+      if (r < m_myRank) {nextGeo[g] += allCounts[r*(nbGroups + 1) + g];}
+      total += allCounts[r*(nbGroups + 1) + g];
+    }
+    if (total > 0) {
+      groupToTRS[g] = nbGeosInTRS.size();
+      nbGeosInTRS.push_back(total);
+    }
+  }
+
+  const CFuint nbTRSs = nbGeosInTRS.size();
+  getReadData().setNbTRSs(nbTRSs);
+  getReadData().resizeGeoConn(nbTRSs);
+  getReadData().getNbGeomEntsPerTR()->resize(nbTRSs);
+  getReadData().getNbTRs()->resize(nbTRSs);
+
+  // Set some global info
+  SwapEmpty(MeshDataStack::getActive()->getTotalTRSInfo());
+  SwapEmpty(MeshDataStack::getActive()->getTotalTRSNames ());
+  SwapEmpty(*MeshDataStack::getActive()->getGlobalTRSGeoIDs());
+
+  MeshDataStack::getActive()->getTotalTRSInfo().resize(nbTRSs);
+  MeshDataStack::getActive()->getTotalTRSNames().resize(nbTRSs);
+  MeshDataStack::getActive()->getGlobalTRSGeoIDs()->resize(nbTRSs);
+
+  SafePtr<vector<vector<vector<CFuint> > > > trsGlobalIDs =
+    MeshDataStack::getActive()->getGlobalTRSGeoIDs();
+  SafePtr< vector<vector<CFuint> > > nbGeomEntsPerTR =
+    getReadData().getNbGeomEntsPerTR();
+
+  for (CFuint g = 0; g < nbGroups; ++g) {
+    if (groupToTRS[g] >= 0) {
+      const CFuint iTRS = groupToTRS[g];
+      const std::string name = m_physNames[groupTags[g]];
+      CFLog(VERBOSE, "ParGmshFileReader => TRS " << name << " with " << nbGeosInTRS[iTRS] << " faces\n");
+
+      getReadData().getNameTRS()->push_back(name);
+      getReadData().getGeomType()->push_back(CFGeoEnt::FACE);
+      (*getReadData().getNbTRs())[iTRS] = 1;
+      (*nbGeomEntsPerTR)[iTRS].push_back(0);
+      getReadData().resizeGeoConn(iTRS, 1);
+      MeshDataStack::getActive()->getTotalTRSNames()[iTRS] = name;
+      MeshDataStack::getActive()->getTotalTRSInfo()[iTRS].push_back(nbGeosInTRS[iTRS]);
+      (*trsGlobalIDs)[iTRS].resize(1);
+    }
+  }
+
+  // the processor (nodeID % nbProc) knows which processors have each node
+  vector<vector<CFuint> > sendLists(m_nbProc);
+  for (CFuint i = 0; i < m_localNodeIDs.size(); ++i) {
+    sendLists[m_localNodeIDs[i] % m_nbProc].push_back(m_localNodeIDs[i]);
+  }
+  for (CFuint i = 0; i < m_ghostNodeIDs.size(); ++i) {
+    sendLists[m_ghostNodeIDs[i] % m_nbProc].push_back(m_ghostNodeIDs[i]);
+  }
+
+  vector<CFuint> recvBuf;
+  vector<int> recvCount;
+  exchangeLists(sendLists, recvBuf, recvCount);
+
+  CFMultiMap<CFuint, CFuint> nodeToRank(recvBuf.size());
+  CFuint idx = 0;
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    for (int i = 0; i < recvCount[r]; ++i, ++idx) {
+      nodeToRank.insert(recvBuf[idx], r);
+    }
+  }
+  nodeToRank.sortKeys();
+
+  // send each face (TRS, global ID in TRS, nb nodes, nodes) to the processor
+  // knowing its first node, which forwards it to the processors having it
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    sendLists[r].clear();
+  }
+  for (CFuint i = 0; i < nbFaces; ++i) {
+    const CFuint g = tagToGroup[m_faceTags[i]];
+    const CFuint rank = m_faceNodes[m_facePtr[i]] % m_nbProc;
+    sendLists[rank].push_back(groupToTRS[g]);
+    sendLists[rank].push_back(nextGeo[g]++);
+    sendLists[rank].push_back(m_facePtr[i+1] - m_facePtr[i]);
+    sendLists[rank].insert(sendLists[rank].end(),
+			   m_faceNodes.begin() + m_facePtr[i],
+			   m_faceNodes.begin() + m_facePtr[i+1]);
+  }
+  SwapEmpty(m_faceTags);
+  SwapEmpty(m_facePtr);
+  SwapEmpty(m_faceNodes);
+
+  exchangeLists(sendLists, recvBuf, recvCount);
+
+  typedef CFMultiMap<CFuint,CFuint>::MapIterator MapItr;
+
+  for (CFuint r = 0; r < m_nbProc; ++r) {
+    sendLists[r].clear();
+  }
+  for (CFuint i = 0; i < recvBuf.size(); i += 3 + recvBuf[i+2]) {
+    bool found = false;
+    pair<MapItr, MapItr> ranks = nodeToRank.find(recvBuf[i+3], found);
+    cf_assert(found);
+    for (MapItr it = ranks.first; found && it != ranks.second; ++it) {
+      sendLists[it->second].insert(sendLists[it->second].end(),
+				   recvBuf.begin() + i, recvBuf.begin() + i + 3 + recvBuf[i+2]);
+    }
+  }
+  nodeToRank.clear();
+
+  exchangeLists(sendLists, recvBuf, recvCount);
+  SwapEmpty(sendLists);
+
+  // keep the faces in the order of their global IDs
+  vector<pair<pair<CFuint, CFuint>, CFuint> > faceOrder;
+  for (CFuint i = 0; i < recvBuf.size(); i += 3 + recvBuf[i+2]) {
+    faceOrder.push_back(make_pair(make_pair(recvBuf[i], recvBuf[i+1]), i));
+  }
+  sort(faceOrder.begin(), faceOrder.end());
+
+  pair<std::valarray<CFuint>, std::valarray<CFuint> > geoConLocal;
+  for (CFuint f = 0; f < faceOrder.size(); ++f) {
+    const CFuint start = faceOrder[f].second;
+    const CFuint iTRS = recvBuf[start];
+    const CFuint iGeo = recvBuf[start+1];
+    const CFuint nbNodesInGeo = recvBuf[start+2];
+    const CFuint* geoNodes = &recvBuf[start+3];
+
+    // the face is local if all its nodes are nodes of one local element
+    bool nodeFound = false;
+    pair<MapItr, MapItr> etr = m_mapNodeElemID.find(geoNodes[0], nodeFound);
+    for (MapItr etm = etr.first; nodeFound && etm != etr.second; ++etm) {
+      const CFuint localElemID = etm->second;
+      const CFuint nbENodes = getReadData().getNbNodesInElement(localElemID);
+      CFuint counter = 0;
+      for (CFuint in = 0; in < nbNodesInGeo; ++in) {
+	bool hasLocalID = false;
+	const CFuint localNodeID = m_mapGlobToLocNodeID.find(geoNodes[in], hasLocalID);
+	if (!hasLocalID) break;
+
+	for (CFuint jn = 0; jn < nbENodes; ++jn) {
+	  if (getReadData().getElementNode(localElemID, jn) == localNodeID) {
+	    counter++;
+	    break;
+	  }
+	}
+      }
+
+      if (counter == nbNodesInGeo) {
+	geoConLocal.first.resize(nbNodesInGeo);
+	for (CFuint n = 0; n < nbNodesInGeo; ++n) {
+	  geoConLocal.first[n] = m_mapGlobToLocNodeID.find(geoNodes[n]);
+	}
+
+	// in the cell centered case the state is the one of the neighbor cell
+	if (m_isDiscontinuous) {
+	  geoConLocal.second.resize(1);
+	  geoConLocal.second[0] = getReadData().getElementState(localElemID, 0);
+	}
+	else {
+	  geoConLocal.second.resize(nbNodesInGeo);
+	  for (CFuint s = 0; s < nbNodesInGeo; ++s) {
+	    geoConLocal.second[s] = m_mapGlobToLocStateID.find(geoNodes[s]);
+	  }
+	}
+
+	getReadData().addGeoConn(iTRS, 0, geoConLocal);
+	(*trsGlobalIDs)[iTRS][0].push_back(iGeo);
+	(*nbGeomEntsPerTR)[iTRS][0]++;
+	break;
+      }
+    }
+  }
+
+  CFLogDebugMin( "ParGmshFileReader::setTRSData() end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParGmshFileReader::finish()
+{
+  SwapEmpty(m_nodeRanges);
+  SwapEmpty(m_elemRanges);
+  m_physNames.clear();
+  m_physDims.clear();
+  SwapEmpty(m_entityPhysTags);
+
+  ParCFmeshFileReader::finish();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace CFmeshFileReader
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
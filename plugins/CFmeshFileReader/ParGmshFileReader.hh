@@ -0,0 +1,283 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_CFmeshFileReader_ParGmshFileReader_hh
+#define COOLFluiD_CFmeshFileReader_ParGmshFileReader_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "Common/NotImplementedException.hh"
+#include "CFmeshFileReader/ParCFmeshFileReader.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace CFmeshFileReader {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class represents a parallel reader of Gmsh meshes (MSH 2 and MSH 4.1
+/// formats, ASCII or binary), which builds the mesh data directly, without
+/// converting the file to CFmesh first. MSH 4.0 is not supported (its
+/// entities and nodes have another layout): such meshes must be saved again
+/// in MSH 4.1 or MSH 2 format. The binary files must have the endianness of
+/// the machine and 8 byte sizes.
+/// Each processor reads a contiguous slice of the node list and of the
+/// element list. In MSH 4.1 the physical group of the elements is the first
+/// physical group of their entity. The cells (elements of the dimension of the mesh) are
+/// numbered by type and sent to the processors owning the corresponding
+/// slice of the global element list, then the mesh is partitioned and
+/// distributed as by the parallel CFmesh reader.
+/// The boundary TRSs are the physical groups of dimension dim-1 (one TR per
+/// TRS) and their faces are sent only to the processors having their nodes.
+/// The states are the cells (Discontinuous = true, cell centered FVM) or the
+/// nodes and the mesh is read without solution.
+class CFmeshFileReader_API ParGmshFileReader : public ParCFmeshFileReader {
+
+public: // member functions
+
+  /// Constructor.
+  ParGmshFileReader();
+
+  /// Destructor.
+  virtual ~ParGmshFileReader();
+
+  /// Defines the Config Option's of this class
+  /// @param options a OptionList where to add the Option's
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /// Read the given file. This is a template method
+  /// @throw Common::FilesystemException
+  virtual void readFromFile(const boost::filesystem::path& filepath);
+
+  /// Reading from a buffer in memory is not supported by this reader
+  virtual void readFromBuffer(const std::string& buffer)
+  {
+    throw Common::NotImplementedException (FromHere(), "ParGmshFileReader::readFromBuffer()");
+  }
+
+  /// Get the file extension
+  virtual const std::string getReaderFileExtension() const
+  {
+    static const std::string ext = ".msh";
+    return ext;
+  }
+
+protected: // functions
+
+  /// Implementation of the hook method for finishing the reading.
+  /// Deallocates temporary data.
+  virtual void finish();
+
+  /// Get the name of the reader
+  virtual const std::string getReaderName() const
+  {
+    return "ParGmshFileReader";
+  }
+
+private: // member functions
+
+  /// Reads the mesh format and the physical names, up to the node list
+  void readHeader(std::ifstream& fin);
+
+  /// Reads the physical groups of the entities of a MSH 4 file
+  void readEntities(std::ifstream& fin);
+
+  /// Reads the physical groups of the entities of a binary MSH 4 file
+  void readBinaryEntities(std::ifstream& fin);
+
+  /// Reads the nodes and the elements of this processor from an ASCII file
+  void readAsciiLists(std::ifstream& fin);
+
+  /// Parses the lines of this processor in a MSH 2 file (one entry per line)
+  /// @param buf          chunk of the file read by this processor
+  /// @param lineStarts   start of each line of this processor in the chunk
+  /// @param firstLine    first line of each processor, plus the number of lines
+  /// @param markerLines  lines of $EndNodes, $Elements and $EndElements
+  void readAsciiEntries(std::string& buf,
+			const std::vector<size_t>& lineStarts,
+			const std::vector<CFuint>& firstLine,
+			const std::vector<CFuint>& markerLines);
+
+  /// Parses the lines of this processor in a MSH 4.1 file (lists in blocks
+  /// of entities), sending the nodes to their owner
+  /// @see readAsciiEntries()
+  void readAsciiBlocks(std::string& buf,
+		       const std::vector<size_t>& lineStarts,
+		       const std::vector<CFuint>& firstLine,
+		       const std::vector<CFuint>& markerLines);
+
+  /// Reads the headers of the blocks of a MSH 4.1 list
+  /// @param first          line of the first header
+  /// @param nbBlocks       number of blocks
+  /// @param linesPerEntry  number of lines of each entry of a block
+  /// @param blocks         line, entity dimension, entity tag, type and
+  ///                       number of entries of each block
+  /// @return the line following the last block
+  CFuint readBlockHeaders(std::string& buf,
+			  const std::vector<size_t>& lineStarts,
+			  const std::vector<CFuint>& firstLine,
+			  const CFuint first,
+			  const CFuint nbBlocks,
+			  const CFuint linesPerEntry,
+			  std::vector<CFuint>& blocks);
+
+  /// Reads the nodes and the elements of this processor from a binary file
+  void readBinaryLists(std::ifstream& fin);
+
+  /// Reads the nodes and the elements of this processor from a binary
+  /// MSH 4.1 file (lists in blocks of entities)
+  void readBinaryBlocks(std::ifstream& fin);
+
+  /// Stores an element read from the file as cell or as boundary face
+  /// @param gmshType  Gmsh element type (starting from 0)
+  /// @param physTag   physical tag of the element
+  /// @param nodeTags  Gmsh tags of the nodes of the element
+  void storeElement(const CFuint gmshType, const CFuint physTag,
+		    const std::vector<CFuint>& nodeTags);
+
+  /// Replaces the Gmsh node tags in the cells and in the faces with the
+  /// global node IDs, i.e. the positions in the node list
+  void setGlobalNodeIDs();
+
+  /// Sets the element types and the global number of elements, nodes and states
+  void setElementTypes();
+
+  /// Sends the cells, numbered by type, to the processors owning the
+  /// corresponding slice of the element list, partitions the mesh and
+  /// builds the local elements
+  void distributeElements();
+
+  /// Creates the local and ghost nodes
+  void createNodes();
+
+  /// Creates the local and ghost states
+  void createStates();
+
+  /// Builds the boundary TRSs from the faces of the physical groups
+  void setTRSData();
+
+  /// Exchanges lists of values between all the processors
+  /// @param sendLists  values to send to each processor
+  /// @param recvBuf    received values, ordered by sending processor
+  /// @param recvCount  number of values received from each processor
+  template <typename T>
+  void exchangeLists(const std::vector<std::vector<T> >& sendLists,
+		     std::vector<T>& recvBuf,
+		     std::vector<int>& recvCount);
+
+  /// Get the processor holding the given entry of a list distributed
+  /// in contiguous ranges
+  /// @param ranges  first entry of each processor, plus the list size
+  CFuint getOwnerRank(const std::vector<CFuint>& ranges, const CFuint id) const
+  {
+    return std::upper_bound(ranges.begin(), ranges.end(), id) - ranges.begin() - 1;
+  }
+
+  /// Reads an unsigned integer from a line of an ASCII file
+  CFuint readUInt(char*& ptr) const
+  {
+    return static_cast<CFuint>(std::strtoul(ptr, &ptr, 10));
+  }
+
+  /// Reads a real from a line of an ASCII file
+  CFreal readReal(char*& ptr) const
+  {
+    return static_cast<CFreal>(std::strtod(ptr, &ptr));
+  }
+
+private: // data
+
+  /// type of the sizes (size_t) written in the binary MSH 4 files
+  typedef long long unsigned int MshSize;
+
+  /// number of nodes of each Gmsh element type
+  std::vector<CFuint> m_nodesPerType;
+
+  /// geometric order of each Gmsh element type
+  std::vector<CFuint> m_orderPerType;
+
+  /// dimension of each Gmsh element type
+  std::vector<CFuint> m_dimPerType;
+
+  /// position in the Gmsh element of each COOLFluiD element node
+  std::vector<std::vector<CFuint> > m_mapNodeIdx;
+
+  /// dimension of the mesh
+  CFuint m_dim;
+
+  /// major version of the MSH format (2 or 4)
+  CFuint m_version;
+
+  /// flag telling if the file is binary
+  bool m_isBinary;
+
+  /// position in the file of the first node
+  std::streamoff m_nodeListStart;
+
+  /// number of node blocks (MSH 4)
+  CFuint m_nbNodeBlocks;
+
+  /// name of each physical group
+  std::map<CFuint, std::string> m_physNames;
+
+  /// dimension of each physical group
+  std::map<CFuint, CFuint> m_physDims;
+
+  /// physical tag of the entities of each dimension (MSH 4)
+  std::vector<std::map<CFuint, CFuint> > m_entityPhysTags;
+
+  /// first node read by each processor, plus the total number of nodes
+  std::vector<CFuint> m_nodeRanges;
+
+  /// Gmsh tags of the nodes read by this processor
+  std::vector<CFuint> m_nodeTags;
+
+  /// coordinates of the nodes read by this processor
+  std::vector<CFreal> m_nodeCoords;
+
+  /// Gmsh type of the cells read by this processor
+  std::vector<CFuint> m_cellTypes;
+
+  /// start of the nodes of each cell read by this processor
+  std::vector<CFuint> m_cellPtr;
+
+  /// nodes of the cells read by this processor
+  std::vector<CFuint> m_cellNodes;
+
+  /// physical tag of the faces read by this processor
+  std::vector<CFuint> m_faceTags;
+
+  /// start of the nodes of each face read by this processor
+  std::vector<CFuint> m_facePtr;
+
+  /// nodes of the faces read by this processor
+  std::vector<CFuint> m_faceNodes;
+
+  /// Gmsh type of each element type
+  std::vector<CFuint> m_typeIDs;
+
+  /// first element of each processor, plus the total number of elements
+  std::vector<CFuint> m_elemRanges;
+
+  /// flag telling if the solution is discontinuous (one state per cell)
+  bool m_isDiscontinuous;
+
+}; // class ParGmshFileReader
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace CFmeshFileReader
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_CFmeshFileReader_ParGmshFileReader_hh
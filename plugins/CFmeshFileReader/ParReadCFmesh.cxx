@@ -10,6 +10,7 @@
 #include "CFmeshFileReader/ParReadCFmesh.hh"
 #include "CFmeshFileReader/ParCFmeshFileReader.hh"
 #include "CFmeshFileReader/ParCFmeshBinaryFileReader.hh"
+#include "CFmeshFileReader/ParGmshFileReader.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -35,6 +36,11 @@ MethodCommandProvider<ParReadCFmesh<ParCFmeshBinaryFileReader>,
 		      CFmeshFileReaderPlugin>
 stdParReadCFmeshBinaryProvider("ParReadCFmeshBinary");
 
+MethodCommandProvider<ParReadCFmesh<ParGmshFileReader>, 
+		      CFmeshReaderData, 
+		      CFmeshFileReaderPlugin>
+stdParReadGmshProvider("ParReadGmsh");
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace CFmeshFileReader
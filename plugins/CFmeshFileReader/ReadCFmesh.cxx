@@ -86,8 +86,14 @@ void ReadCFmesh::execute()
 
   try
   {
-    m_reader.readFromFile(Environment::DirPaths::getInstance().getWorkingDir()
-      / getMethodData().getFileName());
+    // the CFmesh content can be given in memory, e.g. by a mesh adapter
+    if (getMethodData().getMeshBuffer().isNotNull()) {
+      m_reader.readFromBuffer(*getMethodData().getMeshBuffer());
+    }
+    else {
+      m_reader.readFromFile(Environment::DirPaths::getInstance().getWorkingDir()
+        / getMethodData().getFileName());
+    }
   }
   catch (Common::Exception& e)
   {
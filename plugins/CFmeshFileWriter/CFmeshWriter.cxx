@@ -118,7 +118,7 @@ void CFmeshWriter::configure ( Config::ConfigArgs& args )
 void CFmeshWriter::openImpl()
 {
   computeFullOutputName();
-  _data->setFilename(m_fullOutputName);
+  _data->setFilename(getWritePath());
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,8 @@
 #include "Common/CFMultiMap.hh"
 #include "Common/CFPrintContainer.hh"
 #include "Common/MPI/MPIIOFunctions.hh"
+#include "Common/ShuffleCompressor.hh"
+#include "Common/BadValueException.hh"
 
 #include "Environment/SingleBehaviorFactory.hh"
 
@@ -69,6 +71,15 @@ ParCFmeshBinaryFileWriter::ParCFmeshBinaryFileWriter() :
   
   _maxBuffSize = 2147479200; // (CFuint) std::numeric_limits<int>::max();
   setParameter("MaxBuffSize",&_maxBuffSize);
+  
+  _compress = false;
+  setParameter("Compress",&_compress);
+  
+  _chunkSize = 4096;
+  setParameter("CompressionChunkSize",&_chunkSize);
+  
+  _compressionLevel = 1;
+  setParameter("CompressionLevel",&_compressionLevel);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -84,6 +95,9 @@ void ParCFmeshBinaryFileWriter::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< CFuint >("NbWriters", "Number of writers");
   options.addConfigOption< CFuint >("NbWritersPerNode", "Number of writers per node");
   options.addConfigOption< int >("MaxBuffSize", "Maximum buffer size for MPI I/O");
+  options.addConfigOption< bool >("Compress", "Compress the node and state lists (needs zlib)");
+  options.addConfigOption< CFuint >("CompressionChunkSize", "Number of nodes or states per compressed chunk");
+  options.addConfigOption< CFuint >("CompressionLevel", "Compression level, from 1 (fastest) to 9 (smallest)");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -92,6 +106,15 @@ void ParCFmeshBinaryFileWriter::setup()
 {
   ParFileWriter::setWriterGroup();
   _offset.resize(1);
+  
+  if (_compress && !ShuffleCompressor::isAvailable()) {
+    throw BadValueException
+      (FromHere(), "ParCFmeshBinaryFileWriter::setup() => Compress needs COOLFluiD built with zlib");
+  }
+  if (_chunkSize == 0) {
+    throw BadValueException
+      (FromHere(), "ParCFmeshBinaryFileWriter::setup() => CompressionChunkSize must be positive");
+  }
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -717,7 +740,7 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
   }
   
   if (_myRank == _ioRank) {
-    MPIIOFunctions::MPIIOFunctions::writeKeyValue<char>(fh, "\n!LIST_NODE");
+    MPIIOFunctions::MPIIOFunctions::writeKeyValue<char>(fh, (_compress) ? "\n!LIST_NODE_Z" : "\n!LIST_NODE");
     MPIIOFunctions::MPIIOFunctions::writeKeyValue<char>(fh, "\n");
   }
   
@@ -789,8 +812,9 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
   
   CFint wRank = -1; 
   CFuint wSendSize = 0;
+  CFuint wFirstElem = 0;
   CFuint rangeID = 0;
-  CFuint countElem = 0;
+  CFgid countElem = 0;
   for (CFuint is = 0; is < nSend; ++is, ++rangeID) {
     bool isRangeFound = false;
     WriteListMap::List elist = elementList.find(rangeID, isRangeFound);
@@ -799,7 +823,7 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
       CFuint eSize = 0;
       for (WriteListMap::ListIterator it = elist.first; it != elist.second; ++it, ++eSize) {
 	const CFuint localElemID = it->second;
-	const CFuint globalElemID = nodes[localElemID]->getGlobalID();
+	const CFgid globalElemID = nodes[localElemID]->getGlobalID();
 	const CFuint sendElemID = globalElemID - countElem;
 
 	if (nodes[localElemID]->isParUpdatable()) {
@@ -843,6 +867,7 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
     if (_isWriterRank && wg.globalRanks[is] == _myRank) {
       wSendSize = sendSize; // this should be the total sendsize in the range
       wRank = is;
+      wFirstElem = countElem;
     }
     
     MPI_Op myMpiOp;
@@ -880,8 +905,14 @@ void ParCFmeshBinaryFileWriter::writeNodeList(MPI_File* fh)
     // MPI_File_write_at_all(*fh, wOffset[wRank], &elementToPrint[0], (int)wSendSize, 
     // MPIStructDef::getMPIType(&elementToPrint[0]), &_status); 
     
-    MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeNodeList()", fh, wOffset[wRank], &elementToPrint[0], 
-			     wSendSize, _maxBuffSize, _myRank, wg);
+    if (_compress) {
+      _offset[0].nodes.second = writeCompressedList
+	(fh, offset, &elementToPrint[0], wSendSize, wFirstElem, nodesStride, wRank, wg);
+    }
+    else {
+      MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeNodeList()", fh, wOffset[wRank], &elementToPrint[0], 
+			       wSendSize, _maxBuffSize, _myRank, wg);
+    }
   }
   
   //reset the all sendElement list to 0
@@ -912,7 +943,8 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
   }
   
   if (_myRank == _ioRank) {
-    MPIIOFunctions::MPIIOFunctions::writeKeyValue<CFuint>(fh, "\n!LIST_STATE ", false, getWriteData().isWithSolution());
+    MPIIOFunctions::MPIIOFunctions::writeKeyValue<CFuint>
+      (fh, (_compress) ? "\n!LIST_STATE_Z " : "\n!LIST_STATE ", false, getWriteData().isWithSolution());
     MPIIOFunctions::MPIIOFunctions::writeKeyValue<char>(fh, "\n");
   }
   
@@ -986,8 +1018,9 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
      
     CFint wRank = -1; 
     CFuint wSendSize = 0;
+    CFuint wFirstElem = 0;
     CFuint rangeID = 0;
-    CFuint countElem = 0;
+    CFgid countElem = 0;
     for (CFuint is = 0; is < nSend; ++is, ++rangeID) {
       bool isRangeFound = false;
       WriteListMap::List elist = elementList.find(rangeID, isRangeFound);
@@ -996,7 +1029,7 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
 	CFuint eSize = 0;
 	for (WriteListMap::ListIterator it = elist.first; it != elist.second; ++it, ++eSize) {
 	  const CFuint localElemID = it->second;
-	  const CFuint globalElemID = states[localElemID]->getGlobalID();
+	  const CFgid globalElemID = states[localElemID]->getGlobalID();
 	  const CFuint sendElemID = globalElemID - countElem;
 	  
 	  if (states[localElemID]->isParUpdatable()) {
@@ -1049,6 +1082,7 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
       if (_isWriterRank && wg.globalRanks[is] == _myRank) {
 	wSendSize = sendSize; // this should be the total sendsize in the range
 	wRank = is;
+	wFirstElem = countElem;
       }
       
       MPI_Op myMpiOp;
@@ -1086,8 +1120,14 @@ void ParCFmeshBinaryFileWriter::writeStateList(MPI_File* fh)
       // MPI_File_write_at_all(*fh, wOffset[wRank], &elementToPrint[0], (int)wSendSize,
       // MPIStructDef::getMPIType(&elementToPrint[0]), &_status); 
       
-      MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeStateList()", fh, wOffset[wRank], &elementToPrint[0], 
-			       wSendSize, _maxBuffSize, _myRank, wg);
+      if (_compress) {
+	_offset[0].states.second = writeCompressedList
+	  (fh, offset, &elementToPrint[0], wSendSize, wFirstElem, statesStride, wRank, wg);
+      }
+      else {
+	MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeStateList()", fh, wOffset[wRank], &elementToPrint[0], 
+				 wSendSize, _maxBuffSize, _myRank, wg);
+      }
     }
     
     //reset the all sendElement list to 0
@@ -1407,6 +1447,102 @@ void ParCFmeshBinaryFileWriter::writeEndFile(MPI_File* fh)
   CFLog(VERBOSE, "ParCFmeshBinaryFileWriter::writeEndFile() end\n");
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+MPI_Offset ParCFmeshBinaryFileWriter::writeCompressedList
+(MPI_File* fh, const MPI_Offset offset, const CFreal* data, const CFuint dataSize,
+ const CFuint firstEntity, const CFuint stride, const CFuint wRank, const Group& wg)
+{
+  CFLog(VERBOSE, "ParCFmeshBinaryFileWriter::writeCompressedList() start\n");
+  
+  // compress the chunks of this writer one after the other: a writer
+  // without entities has no chunks but takes part in the collective calls
+  const CFuint chunkValues = _chunkSize*stride;
+  const CFuint nbChunks = (dataSize + chunkValues - 1)/chunkValues;
+  vector<CFuint> chunkFirstIDs(nbChunks);
+  vector<MPI_Offset> chunkStarts(nbChunks);
+  vector<char> blob;
+  vector<char> chunk;
+  ShuffleCompressor compressor(_compressionLevel);
+  for (CFuint c = 0; c < nbChunks; ++c) {
+    const CFuint start = c*chunkValues;
+    compressor.compress(&data[start], std::min(chunkValues, dataSize - start), chunk);
+    chunkFirstIDs[c] = firstEntity + c*_chunkSize;
+    chunkStarts[c] = blob.size();
+    blob.insert(blob.end(), chunk.begin(), chunk.end());
+  }
+  
+  // each writer needs the number of chunks and bytes of the previous ones
+  MPI_Offset localInfo[3];
+  localInfo[0] = wRank;
+  localInfo[1] = nbChunks;
+  localInfo[2] = blob.size();
+  vector<MPI_Offset> info(3*wg.globalRanks.size());
+  MPI_Allgather(localInfo, 3, MPIStructDef::getMPIOffsetType(), 
+		&info[0], 3, MPIStructDef::getMPIOffsetType(), wg.comm);
+  
+  MPI_Offset nbTotChunks = 0;
+  MPI_Offset totBytes = 0;
+  MPI_Offset chunksBefore = 0;
+  MPI_Offset bytesBefore = 0;
+  for (CFuint iw = 0; iw < wg.globalRanks.size(); ++iw) {
+    nbTotChunks += info[3*iw+1];
+    totBytes    += info[3*iw+2];
+    if (info[3*iw] < (MPI_Offset)wRank) {
+      chunksBefore += info[3*iw+1];
+      bytesBefore  += info[3*iw+2];
+    }
+  }
+  
+  // layout: number of chunks, first entity of each chunk (+ total number of
+  // entities), start of each chunk in the data (+ size of the data), data 
+  const CFuint nbTot = nbTotChunks;
+  const MPI_Offset idsStart = offset + sizeof(CFuint);
+  const MPI_Offset startsStart = idsStart + (nbTot+1)*sizeof(CFuint);
+  const MPI_Offset dataStart = startsStart + (nbTot+1)*sizeof(MPI_Offset);
+  for (CFuint c = 0; c < nbChunks; ++c) {
+    chunkStarts[c] += bytesBefore;
+  }
+  
+  MPI_Status status;
+  if (_myRank == _ioRank) {
+    CFuint nbChunksInFile = nbTot;
+    MPI_File_write_at(*fh, offset, &nbChunksInFile, 1, 
+		      MPIStructDef::getMPIType(&nbChunksInFile), &status);
+  }
+  if (nbChunks > 0) {
+    MPI_File_write_at(*fh, idsStart + chunksBefore*sizeof(CFuint), &chunkFirstIDs[0], 
+		      (int)nbChunks, MPIStructDef::getMPIType(&chunkFirstIDs[0]), &status);
+    MPI_File_write_at(*fh, startsStart + chunksBefore*sizeof(MPI_Offset), &chunkStarts[0], 
+		      (int)nbChunks, MPIStructDef::getMPIOffsetType(), &status);
+  }
+  
+  // the writer with the last chunk closes the table (the I/O rank if the
+  // list is empty)
+  const bool hasLastChunk = (nbChunks > 0 && chunksBefore + nbChunks == nbTotChunks);
+  if (hasLastChunk || (nbTotChunks == 0 && _myRank == _ioRank)) {
+    CFuint nbEntities = (hasLastChunk) ? firstEntity + dataSize/stride : 0;
+    MPI_File_write_at(*fh, idsStart + nbTot*sizeof(CFuint), &nbEntities, 1, 
+		      MPIStructDef::getMPIType(&nbEntities), &status);
+    MPI_File_write_at(*fh, startsStart + nbTot*sizeof(MPI_Offset), &totBytes, 1, 
+		      MPIStructDef::getMPIOffsetType(), &status);
+  }
+  
+  // one more byte gives a valid address to the writers without data
+  const CFuint blobSize = blob.size();
+  blob.push_back(0);
+  MPIIOFunctions::writeAll("ParCFmeshBinaryFileWriter::writeCompressedList()", fh, 
+			   dataStart + bytesBefore, &blob[0], blobSize, 
+			   _maxBuffSize, _myRank, wg);
+  
+  CFLog(VERBOSE, "ParCFmeshBinaryFileWriter::writeCompressedList() => " << dataSize*sizeof(CFreal) 
+	<< " bytes compressed to " << blobSize << " bytes\n");
+  
+  CFLog(VERBOSE, "ParCFmeshBinaryFileWriter::writeCompressedList() end\n");
+  
+  return dataStart + totBytes;
+}
+
 //////////////////////////////////////////////////////////////////////////////
  
     } // namespace CFmeshFileWriter
@@ -25,6 +25,10 @@ namespace COOLFluiD {
 //////////////////////////////////////////////////////////////////////////////
 
 /// This class represents a CFmesh binary format writer.
+/// With the option Compress, the node and state lists are written as
+/// independently compressed chunks of CompressionChunkSize entities,
+/// preceded by a table with the first entity and the offset of each chunk,
+/// so that each reader only decompresses the chunks of its own range.
 /// @author Andrea Lani
 class CFmeshFileWriter_API ParCFmeshBinaryFileWriter : 
 	public Framework::ParFileWriter, public Config::ConfigObject {
@@ -118,11 +122,34 @@ protected: // helper functions
   /// Writes the end of the file
   void writeEndFile(MPI_File* fh);
   
+  /// Writes the given list data of this writer as compressed chunks, with
+  /// the chunk table (to be called by all the writers)
+  /// @param offset       start of the list in the file
+  /// @param data         data of the entities gathered by this writer
+  /// @param dataSize     number of values in data
+  /// @param firstEntity  global ID of the first entity in data
+  /// @param stride       number of values per entity
+  /// @param wRank        index of this writer
+  /// @return the end of the list in the file
+  MPI_Offset writeCompressedList(MPI_File* fh, const MPI_Offset offset,
+				 const CFreal* data, const CFuint dataSize,
+				 const CFuint firstEntity, const CFuint stride,
+				 const CFuint wRank, const Common::Group& wg);
+  
 protected: // data
   
   /// acquaintance of the data present in the CFmesh file
   Common::SafePtr<Framework::CFmeshWriterSource> _writeData;
   
+  /// flag telling to compress the node and state lists
+  bool _compress;
+  
+  /// number of entities per compressed chunk
+  CFuint _chunkSize;
+  
+  /// compression level (1 to 9)
+  CFuint _compressionLevel;
+  
 }; // class ParCFmeshBinaryFileWriter
 
 //////////////////////////////////////////////////////////////////////////////
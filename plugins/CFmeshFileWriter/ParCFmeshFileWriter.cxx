@@ -688,7 +688,7 @@ void ParCFmeshFileWriter::writeNodeList(std::ofstream *const fout)
   vector<CFreal> elementToPrint(maxElemSendSize, 0);
 
   CFuint rangeID = 0;
-  CFuint countElem = 0;
+  CFgid countElem = 0;
   for (CFuint is = 0; is < nSend; ++is, ++rangeID) {
     bool isRangeFound = false;
     WriteListMap::List elist = elementList.find(rangeID, isRangeFound);
@@ -698,7 +698,7 @@ void ParCFmeshFileWriter::writeNodeList(std::ofstream *const fout)
       CFuint eSize = 0;
       for (WriteListMap::ListIterator it = elist.first; it != elist.second; ++it, ++eSize) {
 	const CFuint localElemID = it->second;
-	const CFuint globalElemID = nodes[localElemID]->getGlobalID();
+	const CFgid globalElemID = nodes[localElemID]->getGlobalID();
 	const CFuint sendElemID = globalElemID - countElem;
 	
 	// only if the node is parallel updatable nmust be written
@@ -873,7 +873,7 @@ void ParCFmeshFileWriter::writeStateList(std::ofstream *const fout)
     vector<CFreal> elementToPrint(maxElemSendSize, 0);
 
     CFuint rangeID = 0;
-    CFuint countElem = 0;
+    CFgid countElem = 0;
     for (CFuint is = 0; is < nSend; ++is, ++rangeID) {
       bool isRangeFound = false;
       WriteListMap::List elist = elementList.find(rangeID, isRangeFound);
@@ -883,7 +883,7 @@ void ParCFmeshFileWriter::writeStateList(std::ofstream *const fout)
 	CFuint eSize = 0;
 	for (WriteListMap::ListIterator it = elist.first; it != elist.second; ++it, ++eSize) {
 	  const CFuint localElemID = it->second;
-	  const CFuint globalElemID = states[localElemID]->getGlobalID();
+	  const CFgid globalElemID = states[localElemID]->getGlobalID();
 	  const CFuint sendElemID = globalElemID - countElem;
 	  
 	  // only if the state is parallel updatable must be written
@@ -102,7 +102,7 @@ void WriteSolutionDG::execute()
   CFAUTOTRACE;
 
   // Write the File
-  m_writer.writeToFile(getMethodData().getFilename());
+  getMethodData().writeOutput(m_writer, getMethodData().getFilename());
   
   CFLog(INFO, "Writing solution to: " << getMethodData().getFilename().string() << "\n");
 }
@@ -111,7 +111,7 @@ void WriteSolutionFluctSplitP2P1::execute()
   CFAUTOTRACE;
 
   // Write the File
-  m_writer.writeToFile(getMethodData().getFilename());
+  getMethodData().writeOutput(m_writer, getMethodData().getFilename());
   
   CFLog(INFO, "Writing solution to: " << getMethodData().getFilename().string() << "\n");
 }
@@ -457,7 +457,7 @@ void CGNS2CFmeshConverter::writeTHOR(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void CGNS2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -520,7 +520,7 @@ void CGNS2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void CGNS2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -679,7 +679,7 @@ void CGNS2CFmeshConverter::adjustToCGNSNodeNumbering()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void CGNS2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -749,7 +749,7 @@ void CGNS2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void CGNS2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -782,7 +782,7 @@ void CGNS2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeNodes(ofstream& fout)
+void CGNS2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -801,7 +801,7 @@ void CGNS2CFmeshConverter::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void CGNS2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -930,7 +930,7 @@ CFuint CGNS2CFmeshConverter::getNbStatesInType(const CFuint& typeID)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void CGNS2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void CGNS2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
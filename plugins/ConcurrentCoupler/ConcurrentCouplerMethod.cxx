@@ -57,6 +57,7 @@ void ConcurrentCouplerMethod::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< vector<CFuint> >("TransferRates","Transfer data every X iterations for each namespace.");
   options.addConfigOption<bool>("SkipFirstCouplingIter","Skip the coupling during the first iteration.");
   options.addConfigOption<bool>("ImposeSynchronization","Impose the synchronization when coupling.");
+  options.addConfigOption<bool>("AsyncTransfer","Execute the interfaces every TransferRates iterations of each namespace, without synchronizing the coupled namespaces (the interface commands must be asynchronous).");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -99,6 +100,9 @@ ConcurrentCouplerMethod::ConcurrentCouplerMethod(const string& name) :
   
   m_imposeSynchronization = false;
   setParameter("ImposeSynchronization",&m_imposeSynchronization);
+  
+  m_asyncTransfer = false;
+  setParameter("AsyncTransfer",&m_asyncTransfer);
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -495,7 +499,15 @@ void ConcurrentCouplerMethod::dataTransferReadImpl()
   cf_assert(isSetup());
   cf_assert(isConfigured());
   
-  if (m_interfacesRead.size() > 0) {
+  if (m_asyncTransfer) {
+    if (isAsyncTransferIter()) {
+      for(CFuint i = 0; i < m_interfacesRead.size(); ++i) {
+	cf_assert(m_interfacesRead[i].isNotNull());
+	m_interfacesRead[i]->execute();
+      }
+    }
+  }
+  else if (m_interfacesRead.size() > 0) {
     // AL: this needs to be tested DEEPLY
     // bool doCoupling = false;
     // if (m_imposeSynchronization) {
@@ -545,7 +557,15 @@ void ConcurrentCouplerMethod::dataTransferWriteImpl()
   cf_assert(isSetup());
   cf_assert(isConfigured());
   
-  if (m_interfacesWrite.size() > 0) {
+  if (m_asyncTransfer) {
+    if (isAsyncTransferIter()) {
+      for(CFuint i = 0; i < m_interfacesWrite.size(); ++i) {
+	cf_assert(m_interfacesWrite[i].isNotNull());
+	m_interfacesWrite[i]->execute();
+      }
+    }
+  }
+  else if (m_interfacesWrite.size() > 0) {
     // AL: this needs to be tested DEEPLY
     bool doCoupling = false;
     if (m_imposeSynchronization) {
@@ -758,6 +778,27 @@ bool ConcurrentCouplerMethod::isCouplingIter(pair<ifstream*, ofstream*>& file,
   return doCoupling;
 }
       
+//////////////////////////////////////////////////////////////////////////////
+
+bool ConcurrentCouplerMethod::isAsyncTransferIter() const
+{
+  cf_assert(m_transferRates.size() == m_coupledNamespacesStr.size());
+  
+  // each rank only looks at the iterations of its own coupled namespace
+  const int rank  = PE::GetPE().GetRank("Default");     // rank in default group
+  for (CFuint i = 0; i < m_coupledNamespacesStr.size(); ++i) {
+    if (PE::GetPE().isRankInGroup(rank, m_coupledNamespacesStr[i])) { 
+      SafePtr<Namespace> nsp = NamespaceSwitcher::getInstance
+	(SubSystemStatusStack::getCurrentName()).getNamespace(m_coupledNamespacesStr[i]);
+      SafePtr<SubSystemStatus> subSysStatus = SubSystemStatusStack::getInstance().getEntryByNamespace(nsp);
+      return (subSysStatus->getNbIter()%m_transferRates[i] == 0);
+    }
+  }
+  
+  cf_assert(false);
+  return false;
+}
+
 //////////////////////////////////////////////////////////////////////////////
       
 void ConcurrentCouplerMethod::finalizeImpl() 
@@ -165,6 +165,9 @@ private: // helper methods
   /// Tell if a coupling step has to be accomplished
   bool isCouplingIter(std::pair<std::ifstream*, std::ofstream*>& file, 
 		      TypeIO tio);
+  
+  /// Tell if an asynchronous transfer has to be accomplished by the current rank
+  bool isAsyncTransferIter() const;
     
   /// Reset given status file to 0 
   /// @param fout  file handle
@@ -234,6 +237,9 @@ private: // member data
   ///Flag telling to impose synchronization when coupling
   bool m_imposeSynchronization;
   
+  ///Flag telling to execute the interfaces without synchronizing the coupled namespaces
+  bool m_asyncTransfer;
+  
 }; // end of class ConcurrentCouplerMethod
 
 //////////////////////////////////////////////////////////////////////////////
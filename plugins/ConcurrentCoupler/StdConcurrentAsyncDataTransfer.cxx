@@ -0,0 +1,416 @@
+#include "Common/NotImplementedException.hh"
+
+#include "Framework/DataHandle.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/MethodCommand.hh"
+#include "Framework/SubSystemStatus.hh"
+#include "Framework/NamespaceSwitcher.hh"
+#include "Framework/VarSetTransformer.hh"
+
+#include "ConcurrentCoupler/ConcurrentCouplerData.hh"
+#include "ConcurrentCoupler/ConcurrentCoupler.hh"
+#include "ConcurrentCoupler/StdConcurrentAsyncDataTransfer.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace ConcurrentCoupler {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdConcurrentAsyncDataTransfer,
+		      ConcurrentCouplerData,
+		      ConcurrentCouplerModule>
+stdConcurrentAsyncDataTransferProvider("StdConcurrentAsyncDataTransfer");
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// tag of the messages with the global IDs of the dofs
+static const int idsTag = 0;
+
+/// tag of the messages with the snapshots
+static const int valuesTag = 1;
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >
+    ("DropBusySnapshots","Drop the snapshots while the analysis rank is still busy with the previous one (otherwise wait for it).");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdConcurrentAsyncDataTransfer::StdConcurrentAsyncDataTransfer(const std::string& name) :
+  StdConcurrentDataTransfer(name),
+  m_root(),
+  m_sendIDs(),
+  m_sendLocalIDs(),
+  m_sendBuf(),
+  m_requests(),
+  m_recvIDs(),
+  m_recvBuf(),
+  m_isFirstSnapshot(),
+  m_isEnded(),
+  m_nbDropped(0)
+{
+  addConfigOptionsTo(this);
+
+  m_dropBusySnapshots = true;
+  setParameter("DropBusySnapshots",&m_dropBusySnapshots);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdConcurrentAsyncDataTransfer::~StdConcurrentAsyncDataTransfer()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::setup()
+{
+  StdConcurrentDataTransfer::setup();
+  ConcurrentCouplerCom::setup();
+
+  const CFuint nbTransfers = _socketsSendRecv.size();
+  m_root.resize(nbTransfers, -1);
+  m_sendIDs.resize(nbTransfers);
+  m_sendLocalIDs.resize(nbTransfers);
+  m_sendBuf.resize(nbTransfers);
+  m_requests.resize(nbTransfers, vector<MPI_Request>(2, MPI_REQUEST_NULL));
+  m_recvIDs.resize(nbTransfers);
+  m_isFirstSnapshot.resize(nbTransfers, true);
+  m_isEnded.resize(nbTransfers, false);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::unsetup()
+{
+  // the groups are created during the first execution
+  if (!_createGroup) {
+    const int rank = PE::GetPE().GetRank("Default"); // rank in MPI_COMM_WORLD
+    for (CFuint i = 0; i < _socketsSendRecv.size(); ++i) {
+      if (getMethodData().isActiveRank(_isTransferRank[i])) {
+	SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[i]);
+	cf_assert(dtt.isNotNull());
+	if (PE::GetPE().isRankInGroup(rank, dtt->nspSend)) {
+	  sendEnd(i);
+	}
+	else {
+	  // drain the snapshots sent after the end of the analysis
+	  while (!m_isEnded[i]) {recvSnapshot(i, false);}
+	}
+      }
+    }
+  }
+
+  if (m_nbDropped > 0) {
+    CFLog(INFO, "StdConcurrentAsyncDataTransfer::unsetup() => " << m_nbDropped
+	  << " snapshots dropped while the analysis rank was busy\n");
+  }
+
+  ConcurrentCouplerCom::unsetup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::execute()
+{
+  CFAUTOTRACE;
+
+  CFLog(VERBOSE, "StdConcurrentAsyncDataTransfer::execute() => start\n");
+
+  // this is the only blocking step, involving all the ranks of the coupling namespace
+  if (_createGroup) {
+    for (CFuint i = 0; i < _socketsSendRecv.size(); ++i) {
+      createTransferGroup(i);
+      if (getMethodData().isActiveRank(_isTransferRank[i])) {
+	addDataToTransfer(i);
+
+	SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[i]);
+	cf_assert(dtt.isNotNull());
+	const CFuint nbRanks = PE::GetPE().getGroup(dtt->groupName).globalRanks.size();
+	if (dtt->nbRanksRecv != 1 || nbRanks != dtt->nbRanksSend + 1) {
+	  throw NotImplementedException
+	    (FromHere(), "StdConcurrentAsyncDataTransfer::execute() => only one receiving rank, not belonging to the sending namespace, is supported");
+	}
+
+	m_root[i] = getRootProcess(dtt->nspRecv, dtt->groupName);
+	m_recvIDs[i].resize(nbRanks);
+      }
+    }
+    _createGroup = false;
+  }
+
+  const int rank = PE::GetPE().GetRank("Default"); // rank in MPI_COMM_WORLD
+  for (CFuint i = 0; i < _socketsSendRecv.size(); ++i) {
+    if (getMethodData().isActiveRank(_isTransferRank[i])) {
+      SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[i]);
+      cf_assert(dtt.isNotNull());
+      if (PE::GetPE().isRankInGroup(rank, dtt->nspSend)) {
+	sendSnapshot(i);
+      }
+      else if (!m_isEnded[i]) {
+	recvSnapshot(i, true);
+      }
+    }
+  }
+
+  CFLog(VERBOSE, "StdConcurrentAsyncDataTransfer::execute() => end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::sendSnapshot(const CFuint idx)
+{
+  SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[idx]);
+
+  SafePtr<Namespace> nsp = NamespaceSwitcher::getInstance
+    (SubSystemStatusStack::getCurrentName()).getNamespace(dtt->nspSend);
+  SafePtr<SubSystemStatus> subSysStatus =
+    SubSystemStatusStack::getInstance().getEntryByNamespace(nsp);
+
+  // the initial solution is not sent
+  const CFuint iter = subSysStatus->getNbIter();
+  if (iter == 0) return;
+
+  // the previous snapshot is complete when the analysis rank has started to receive it
+  vector<MPI_Request>& requests = m_requests[idx];
+  if (m_dropBusySnapshots) {
+    int isDone = 0;
+    MPIError::getInstance().check
+      ("MPI_Testall", "StdConcurrentAsyncDataTransfer::sendSnapshot()",
+       MPI_Testall(requests.size(), &requests[0], &isDone, MPI_STATUSES_IGNORE));
+
+    int allDone = 0;
+    MPIError::getInstance().check
+      ("MPI_Allreduce", "StdConcurrentAsyncDataTransfer::sendSnapshot()",
+       MPI_Allreduce(&isDone, &allDone, 1, MPI_INT, MPI_MIN,
+		     PE::GetPE().getGroup(dtt->nspSend).comm));
+
+    if (allDone == 0) {
+      CFLog(VERBOSE, "StdConcurrentAsyncDataTransfer::sendSnapshot() => analysis busy, snapshot at iteration "
+	    << iter << " dropped\n");
+      ++m_nbDropped;
+      return;
+    }
+  }
+  else {
+    MPIError::getInstance().check
+      ("MPI_Waitall", "StdConcurrentAsyncDataTransfer::sendSnapshot()",
+       MPI_Waitall(requests.size(), &requests[0], MPI_STATUSES_IGNORE));
+  }
+
+  Group& group = PE::GetPE().getGroup(dtt->groupName);
+  const CFuint sendStride = dtt->sendStride;
+  const CFuint recvStride = dtt->recvStride;
+  vector<CFuint>& sendIDs = m_sendIDs[idx];
+  vector<CFreal>& sendbuf = m_sendBuf[idx];
+
+  // the global IDs are sent only once, with the first snapshot
+  if (m_isFirstSnapshot[idx]) {
+    SafePtr<DataStorage> ds = getMethodData().getDataStorage(dtt->nspSend);
+    if (_socketsConnType[idx] == "State") {
+      fillSendIDs<State*>(dtt, ds, sendIDs, m_sendLocalIDs[idx]);
+    }
+    if (_socketsConnType[idx] == "Node") {
+      fillSendIDs<Node*>(dtt, ds, sendIDs, m_sendLocalIDs[idx]);
+    }
+    sendbuf.resize(2 + sendIDs.size()*recvStride);
+
+    CFuint dummy = 0;
+    CFuint *const ids = (sendIDs.size() > 0) ? &sendIDs[0] : &dummy;
+    MPIError::getInstance().check
+      ("MPI_Issend", "StdConcurrentAsyncDataTransfer::sendSnapshot()",
+       MPI_Issend(ids, sendIDs.size(), MPIStructDef::getMPIType(ids),
+		  m_root[idx], idsTag, group.comm, &requests[0]));
+    m_isFirstSnapshot[idx] = false;
+  }
+
+  cf_assert(idx < _sendToRecvVecTrans.size());
+  SafePtr<VarSetTransformer> sendToRecvTrans = _sendToRecvVecTrans[idx].getPtr();
+  cf_assert(sendToRecvTrans.isNotNull());
+
+  sendbuf[0] = iter;
+  sendbuf[1] = subSysStatus->getCurrentTime();
+
+  RealVector tState(recvStride, static_cast<CFreal*>(NULL));
+  RealVector state(sendStride, static_cast<CFreal*>(NULL));
+  const vector<CFuint>& localIDs = m_sendLocalIDs[idx];
+  for (CFuint i = 0; i < localIDs.size(); ++i) {
+    cf_assert((localIDs[i]+1)*sendStride <= dtt->arraySize);
+    state.wrap(sendStride, &dtt->array[localIDs[i]*sendStride]);
+    tState.wrap(recvStride, &sendbuf[2 + i*recvStride]);
+    sendToRecvTrans->transform((const RealVector&)state, (RealVector&)tState);
+  }
+
+  MPIError::getInstance().check
+    ("MPI_Issend", "StdConcurrentAsyncDataTransfer::sendSnapshot()",
+     MPI_Issend(&sendbuf[0], sendbuf.size(), MPIStructDef::getMPIType(&sendbuf[0]),
+		m_root[idx], valuesTag, group.comm, &requests[1]));
+
+  CFLog(VERBOSE, "StdConcurrentAsyncDataTransfer::sendSnapshot() => snapshot at iteration "
+	<< iter << " sent to namespace [" << dtt->nspRecv << "]\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::recvSnapshot(const CFuint idx, const bool update)
+{
+  SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[idx]);
+
+  Group& group = PE::GetPE().getGroup(dtt->groupName);
+  const int nbRanks = group.globalRanks.size();
+  const CFuint recvStride = dtt->recvStride;
+  CFreal *const sarray = dtt->array;
+
+  bool isEnd = false;
+  CFuint iter = 0;
+  CFreal time = 0.;
+
+  // the snapshots are received rank by rank, since each solver rank can
+  // already have sent the next one
+  for (int r = 0; r < nbRanks; ++r) {
+    if (r == m_root[idx]) continue;
+
+    MPI_Status status;
+    int count = 0;
+    MPIError::getInstance().check
+      ("MPI_Probe", "StdConcurrentAsyncDataTransfer::recvSnapshot()",
+       MPI_Probe(r, valuesTag, group.comm, &status));
+    MPI_Get_count(&status, MPIStructDef::getMPIType(&time), &count);
+    cf_assert(count >= 2);
+    m_recvBuf.resize(count);
+    MPIError::getInstance().check
+      ("MPI_Recv", "StdConcurrentAsyncDataTransfer::recvSnapshot()",
+       MPI_Recv(&m_recvBuf[0], count, MPIStructDef::getMPIType(&m_recvBuf[0]),
+		r, valuesTag, group.comm, &status));
+
+    // the final snapshot has a negative iteration
+    if (m_recvBuf[0] < 0.) {
+      isEnd = true;
+      continue;
+    }
+
+    vector<CFuint>& recvIDs = m_recvIDs[idx][r];
+    if (m_isFirstSnapshot[idx]) {
+      int nbIDs = 0;
+      MPIError::getInstance().check
+	("MPI_Probe", "StdConcurrentAsyncDataTransfer::recvSnapshot()",
+	 MPI_Probe(r, idsTag, group.comm, &status));
+      CFuint dummy = 0;
+      MPI_Get_count(&status, MPIStructDef::getMPIType(&dummy), &nbIDs);
+      recvIDs.resize(nbIDs);
+      CFuint *const ids = (nbIDs > 0) ? &recvIDs[0] : &dummy;
+      MPIError::getInstance().check
+	("MPI_Recv", "StdConcurrentAsyncDataTransfer::recvSnapshot()",
+	 MPI_Recv(ids, nbIDs, MPIStructDef::getMPIType(ids),
+		  r, idsTag, group.comm, &status));
+    }
+    cf_assert(m_recvBuf.size() == 2 + recvIDs.size()*recvStride);
+
+    iter = static_cast<CFuint>(m_recvBuf[0]);
+    time = m_recvBuf[1];
+
+    if (update) {
+      for (CFuint i = 0; i < recvIDs.size(); ++i) {
+	const CFuint start = recvIDs[i]*recvStride;
+	cf_assert(start + recvStride <= dtt->arraySize);
+	for (CFuint s = 0; s < recvStride; ++s) {
+	  sarray[start + s] = m_recvBuf[2 + i*recvStride + s];
+	}
+      }
+    }
+  }
+
+  SafePtr<Namespace> nsp = NamespaceSwitcher::getInstance
+    (SubSystemStatusStack::getCurrentName()).getNamespace(dtt->nspRecv);
+  SafePtr<SubSystemStatus> subSysStatus =
+    SubSystemStatusStack::getInstance().getEntryByNamespace(nsp);
+
+  if (isEnd) {
+    m_isEnded[idx] = true;
+    if (update) {
+      CFLog(INFO, "StdConcurrentAsyncDataTransfer::recvSnapshot() => namespace ["
+	    << dtt->nspSend << "] has ended, stopping namespace [" << dtt->nspRecv << "]\n");
+      subSysStatus->setStopSimulation(true);
+    }
+    return;
+  }
+
+  m_isFirstSnapshot[idx] = false;
+
+  if (update) {
+    cf_assert(iter > 0);
+    // the convergence method of the analysis namespace increments the iteration
+    subSysStatus->setNbIter(iter - 1);
+    subSysStatus->setCurrentTime(time);
+
+    CFLog(VERBOSE, "StdConcurrentAsyncDataTransfer::recvSnapshot() => snapshot at iteration "
+	  << iter << " received from namespace [" << dtt->nspSend << "]\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdConcurrentAsyncDataTransfer::sendEnd(const CFuint idx)
+{
+  SafePtr<DataToTrasfer> dtt = _socketName2data.find(_socketsSendRecv[idx]);
+  Group& group = PE::GetPE().getGroup(dtt->groupName);
+
+  // the last snapshot must be complete before reusing its buffer
+  vector<MPI_Request>& requests = m_requests[idx];
+  MPIError::getInstance().check
+    ("MPI_Waitall", "StdConcurrentAsyncDataTransfer::sendEnd()",
+     MPI_Waitall(requests.size(), &requests[0], MPI_STATUSES_IGNORE));
+
+  vector<CFreal>& sendbuf = m_sendBuf[idx];
+  sendbuf.assign(2, -1.);
+  MPIError::getInstance().check
+    ("MPI_Send", "StdConcurrentAsyncDataTransfer::sendEnd()",
+     MPI_Send(&sendbuf[0], sendbuf.size(), MPIStructDef::getMPIType(&sendbuf[0]),
+	      m_root[idx], valuesTag, group.comm));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void StdConcurrentAsyncDataTransfer::fillSendIDs
+(Common::SafePtr<DataToTrasfer> dtt,
+ Common::SafePtr<Framework::DataStorage> ds,
+ std::vector<CFuint>& sendIDs,
+ std::vector<CFuint>& sendLocalIDs)
+{
+  DataHandle<T, GLOBAL> dofs = ds->getGlobalData<T>(dtt->dofsName);
+  sendIDs.clear();
+  sendLocalIDs.clear();
+  sendIDs.reserve(dofs.getLocalSize());
+  sendLocalIDs.reserve(dofs.getLocalSize());
+
+  // only parallel updatable data are communicated
+  for (CFuint i = 0; i < dofs.size(); ++i) {
+    if (dofs[i]->isParUpdatable()) {
+      sendIDs.push_back(dofs[i]->getGlobalID());
+      sendLocalIDs.push_back(i);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace ConcurrentCoupler
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
@@ -0,0 +1,142 @@
+#ifndef COOLFluiD_Numerics_ConcurrentCoupler_StdConcurrentAsyncDataTransfer_hh
+#define COOLFluiD_Numerics_ConcurrentCoupler_StdConcurrentAsyncDataTransfer_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "ConcurrentCoupler/StdConcurrentDataTransfer.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace ConcurrentCoupler {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class ships snapshots of the solution from the ranks of a solver
+ * namespace to the single rank of an analysis namespace, which runs the
+ * DataProcessing chain (statistics, extracts, output) on its own copy of
+ * the mesh, without stalling the solver ranks.
+ * Each solver rank sends its own states with MPI_Issend and goes on: the
+ * snapshot is complete only when the analysis rank has started to receive
+ * it, so that, if the analysis rank is still busy with the previous
+ * snapshot, the new one is dropped (or waited for, if DropBusySnapshots
+ * is false). The decision is taken by all the solver ranks together.
+ * The analysis rank receives one snapshot per execution, copies it in its
+ * states and sets the iteration and the time of its namespace from it
+ * (the iteration minus one, since the analysis convergence method, e.g.
+ * EmptyIterator, increments it afterwards).
+ * When the solver ranks are unset, they send a final empty snapshot that
+ * stops the analysis namespace.
+ * This command must be used with ConcurrentCoupler.AsyncTransfer = true
+ * and it is executed, as read or write interface, every TransferRates
+ * iterations of each namespace (1 for the analysis namespace).
+ */
+class StdConcurrentAsyncDataTransfer : public StdConcurrentDataTransfer {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  explicit StdConcurrentAsyncDataTransfer(const std::string& name);
+
+  /**
+   * Destructor.
+   */
+  virtual ~StdConcurrentAsyncDataTransfer();
+
+  /**
+   * Setup private data
+   */
+  virtual void setup();
+
+  /**
+   * Unsetup private data, ending the transfers
+   */
+  virtual void unsetup();
+
+  /**
+   * Execute Processing actions
+   */
+  virtual void execute();
+
+private: // functions
+
+  /// send a snapshot from a rank of the solver namespace
+  /// @param idx  index of the data transfer
+  void sendSnapshot(const CFuint idx);
+
+  /// receive a snapshot from all the ranks of the solver namespace
+  /// @param idx     index of the data transfer
+  /// @param update  copy the snapshot in the local states
+  void recvSnapshot(const CFuint idx, const bool update);
+
+  /// send the final empty snapshot
+  /// @param idx  index of the data transfer
+  void sendEnd(const CFuint idx);
+
+  /// fill the global IDs and the positions in the local array of the
+  /// parallel updatable dofs to send
+  template <typename T>
+  void fillSendIDs(Common::SafePtr<DataToTrasfer> dtt,
+		   Common::SafePtr<Framework::DataStorage> ds,
+		   std::vector<CFuint>& sendIDs,
+		   std::vector<CFuint>& sendLocalIDs);
+
+private: // data
+
+  /// rank of the analysis process in each transfer group
+  std::vector<int> m_root;
+
+  /// global IDs of the sent dofs for each transfer
+  std::vector<std::vector<CFuint> > m_sendIDs;
+
+  /// local IDs of the sent dofs for each transfer
+  std::vector<std::vector<CFuint> > m_sendLocalIDs;
+
+  /// send buffer (iteration, time and values) for each transfer
+  std::vector<std::vector<CFreal> > m_sendBuf;
+
+  /// pending requests (IDs and values) for each transfer
+  std::vector<std::vector<MPI_Request> > m_requests;
+
+  /// global IDs received from each solver rank for each transfer
+  std::vector<std::vector<std::vector<CFuint> > > m_recvIDs;
+
+  /// receive buffer
+  std::vector<CFreal> m_recvBuf;
+
+  /// flags telling if no snapshot has been transferred yet
+  std::vector<bool> m_isFirstSnapshot;
+
+  /// flags telling if the final snapshot has been transferred
+  std::vector<bool> m_isEnded;
+
+  /// number of dropped snapshots
+  CFuint m_nbDropped;
+
+  /// drop the snapshots while the analysis rank is busy
+  bool m_dropBusySnapshots;
+
+}; // class StdConcurrentAsyncDataTransfer
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace ConcurrentCoupler
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_ConcurrentCoupler_StdConcurrentAsyncDataTransfer_hh
@@ -399,7 +399,7 @@ void Dpl2CFmeshConverter::readSPFile(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void Dpl2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -471,7 +471,7 @@ void Dpl2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void Dpl2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -485,7 +485,7 @@ void Dpl2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeNodes(ofstream& fout)
+void Dpl2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -502,7 +502,7 @@ void Dpl2CFmeshConverter::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void Dpl2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -575,7 +575,7 @@ void Dpl2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void Dpl2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   fout << "!LIST_STATE " << _isWithSolution << "\n";
 
@@ -611,7 +611,7 @@ void Dpl2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void Dpl2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -671,7 +671,7 @@ void Dpl2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Dpl2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void Dpl2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
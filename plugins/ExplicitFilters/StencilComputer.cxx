@@ -508,7 +508,7 @@ void StencilComputer::outputStencil()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void StencilComputer::writeToFileStream(std::ofstream& fout)
+void StencilComputer::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
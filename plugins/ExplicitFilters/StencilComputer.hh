@@ -91,7 +91,7 @@ public:
 
   virtual void postProcessStencil(const CFuint& centreStateID);
 
-  void writeToFileStream(std::ofstream& fout);
+  void writeToFileStream(std::ostream& fout);
 
   virtual void outputStencil();
   
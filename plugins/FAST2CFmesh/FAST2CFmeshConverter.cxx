@@ -151,7 +151,7 @@ void FAST2CFmeshConverter::writeFAST(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void FAST2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -198,7 +198,7 @@ void FAST2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void FAST2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
 }
 
@@ -211,7 +211,7 @@ void FAST2CFmeshConverter::readFiles(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void FAST2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -263,7 +263,7 @@ void FAST2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void FAST2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -272,7 +272,7 @@ void FAST2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeNodes(ofstream& fout)
+void FAST2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -290,13 +290,13 @@ void FAST2CFmeshConverter::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void FAST2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-void FAST2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void FAST2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
 }
 
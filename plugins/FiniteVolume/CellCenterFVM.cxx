@@ -41,6 +41,7 @@ void CellCenterFVM::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< std::vector<std::string> >("SetupCom","Setup Command to run. This command seldomly needs overriding.");
    options.addConfigOption< std::string >("AfterMeshUpdateCom","Command to run after mesh update.");
    options.addConfigOption< std::string >("BeforeMeshUpdateCom","Command to run before mesh update.");
+   options.addConfigOption< std::string >("SourceSplittingCom","Command integrating the split source terms once per physical time step, after the convergence method.");
    options.addConfigOption< std::vector<std::string> >("BcComds","Types of the boundary conditions commands.");
    options.addConfigOption< std::vector<std::string> >("SetupNames","Names of the setup commands.");
    options.addConfigOption< std::vector<std::string> >("BcNames","Names for the configuration of the boundary conditions commands.");
@@ -63,6 +64,7 @@ CellCenterFVM::CellCenterFVM(const std::string& name)
     _bcs(0),
     _beforeMeshUpdate(),
     _afterMeshUpdate(),
+    _sourceSplitting(),
     _spaceRHSForGivenCell(),
     _timeRHSForGivenCell(),
     _isBcApplied(false)
@@ -120,6 +122,10 @@ CellCenterFVM::CellCenterFVM(const std::string& name)
   _afterMeshUpdateStr = "Null";
   setParameter("AfterMeshUpdateCom",&_afterMeshUpdateStr);
 
+  // operator splitting of the source terms
+  _sourceSplittingStr = "Null";
+  setParameter("SourceSplittingCom",&_sourceSplittingStr);
+
   // default values for LU-SGS-related commands
   setParameter( "SpaceRHSForGivenCell", &_spaceRHSForGivenCellStr);
   _spaceRHSForGivenCellStr = "Null";
@@ -291,6 +297,10 @@ void CellCenterFVM::configure ( Config::ConfigArgs& args )
 							       _afterMeshUpdateStr,
 							       _data);
 
+  configureCommand<CellCenterFVMData,CellCenterFVMComProvider>(args, _sourceSplitting,
+							       _sourceSplittingStr,
+							       _data);
+
   configureCommand<CellCenterFVMData,CellCenterFVMComProvider>(args, _spaceRHSForGivenCell,
                                                                _spaceRHSForGivenCellStr,
                                                                _data);
@@ -466,6 +476,21 @@ void CellCenterFVM::postProcessSolutionImpl()
 
 //////////////////////////////////////////////////////////////////////////////
 
+bool CellCenterFVM::finalizeTimeStepImpl()
+{
+  CFAUTOTRACE;
+
+  // the transport terms have been advanced over the whole time step
+  // (all the stages or Newton iterations): integrate the split source terms
+  if (!_sourceSplitting->isNull()) {
+    _sourceSplitting->execute();
+    return true;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void CellCenterFVM::setMethodImpl()
 {
   CFAUTOTRACE;
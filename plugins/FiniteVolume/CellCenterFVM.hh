@@ -118,6 +118,10 @@ protected: // interface implementation functions
   /// Postprocess the solution.
   void postProcessSolutionImpl();
 
+  /// Finalize the physical time step, integrating the split source terms.
+  /// @return true if the source splitting command is active
+  bool finalizeTimeStepImpl();
+
   /// Action which is executed by the ActionLinstener for the "CF_ON_MESHADAPTER_BEFOREMESHUPDATE" Event
   /// @param eBefore the event which provoked this action
   /// @return an Event with a message in its body
@@ -174,6 +178,9 @@ private: // member data
   /// The command to use for the action after the mesh has been updated
   Common::SelfRegistPtr<CellCenterFVMCom> _afterMeshUpdate;
 
+  /// The command integrating the split source terms once per physical time step
+  Common::SelfRegistPtr<CellCenterFVMCom> _sourceSplitting;
+
   /// The command that computes the contribution of the spatial discretization
   /// to the rhs of a given set of states (== a cell), for use with LU-SGS.
   Common::SelfRegistPtr< CellCenterFVMCom > _spaceRHSForGivenCell;
@@ -230,6 +237,9 @@ private: // member data
   /// The string for the configuration of the action after mesh update
   std::string _afterMeshUpdateStr;
 
+  /// The string for the configuration of the source splitting command
+  std::string _sourceSplittingStr;
+
   /// The string for configuration of the m_spaceRHSForGivenCell command
   std::string _spaceRHSForGivenCellStr;
 
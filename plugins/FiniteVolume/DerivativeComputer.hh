@@ -111,6 +111,47 @@ public:
   virtual CFuint getNbVerticesInControlVolume
   (Framework::GeometricEntity *const geo) const = 0;
 
+  /**
+   * Tell if the gradients are a linear combination of the control volume
+   * values with purely geometric coefficients (no dependency on other data),
+   * so that their operator can be computed once on a non-moving mesh
+   */
+  virtual bool isLinearOperator() const
+  {
+    return false;
+  }
+
+  /**
+   * Compute the geometric operator of the gradients in the current control
+   * volume by applying computeGradients() to unit values, such that
+   * grad[i][iDim] = sum_k weights(iDim,k)*values(i,k)
+   * @pre computeControlVolume() has been called on the given face
+   * @pre isLinearOperator() is true
+   */
+  void computeGradientsOperator(Framework::GeometricEntity *const geo,
+				const CFuint nbCVStates,
+				RealMatrix& weights)
+  {
+    cf_assert(isLinearOperator());
+    const CFuint dim = Framework::PhysicalModelStack::getActive()->getDim();
+    RealMatrix unitValues(nbCVStates, nbCVStates, 0.0);
+    std::vector<RealVector> grads(nbCVStates, RealVector(dim));
+    std::vector<RealVector*> gradsPtr(nbCVStates);
+    for (CFuint k = 0; k < nbCVStates; ++k) {
+      unitValues(k,k) = 1.0;
+      gradsPtr[k] = &grads[k];
+    }
+    
+    computeGradients(geo, unitValues, gradsPtr);
+    
+    weights.resize(dim, nbCVStates);
+    for (CFuint k = 0; k < nbCVStates; ++k) {
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	weights(iDim,k) = grads[k][iDim];
+      }
+    }
+  }
+
   /**
    * Get the control volume
    */
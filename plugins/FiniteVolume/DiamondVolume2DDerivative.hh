@@ -78,6 +78,14 @@ public:
     return 4;
   }
 
+  /**
+   * Tell if the gradients only depend linearly on the control volume values
+   */
+  bool isLinearOperator() const
+  {
+    return true;
+  }
+
   /**
    * Get the jacobian of the gradients
    */
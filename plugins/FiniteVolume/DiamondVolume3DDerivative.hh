@@ -75,6 +75,14 @@ public:
    * Get the current number of vertices in the control volume
    */
   CFuint getNbVerticesInControlVolume(Framework::GeometricEntity *const geo) const;
+
+  /**
+   * Tell if the gradients only depend linearly on the control volume values
+   */
+  bool isLinearOperator() const
+  {
+    return true;
+  }
   
   /**
    * Get the jacobian of the gradients
@@ -42,6 +42,7 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   socket_limiter("limiter"),
   socket_gstates("gstates"),
   socket_nodes("nodes"),
+  socket_cellCost("cellCost"),
   _fluxSplitter(CFNULL),
   _diffusiveFlux(CFNULL),
   _reconstrVar(CFNULL),
@@ -74,7 +75,9 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   _fluxData(CFNULL),
   _tempUnitNormal(),
   _rExtraVars(),
-  _inverter(CFNULL)  
+  _inverter(CFNULL),
+  _costTimer(),
+  _faceSourceCost(0.)
 {
   addConfigOptionsTo(this);
 
@@ -89,6 +92,9 @@ FVMCC_ComputeRHS::FVMCC_ComputeRHS(const std::string& name) :
   
   _useAnalyticalMatrix = true;
   setParameter("useAnalyticalMatrix",&_useAnalyticalMatrix);
+  
+  _measureCellCost = false;
+  setParameter("MeasureCellCost",&_measureCellCost);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -125,6 +131,9 @@ void FVMCC_ComputeRHS::defineConfigOptions(Config::OptionList& options)
 
   options.addConfigOption< bool >
     ("useAnalyticalMatrix", "Flag telling if to use analytical matrix."); 
+  
+  options.addConfigOption< bool >
+    ("MeasureCellCost", "Measure the wall time spent on each cell and store it in the \"cellCost\" socket (used as node weights by the ParMetisBalancer StdRepart command).");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -212,6 +221,8 @@ void FVMCC_ComputeRHS::execute()
 	if (_currFace->getState(0)->isParUpdatable() || 
 	    (!_currFace->getState(1)->isGhost() && _currFace->getState(1)->isParUpdatable())) {
 	  
+	  const CFreal faceStartTime = (_measureCellCost) ? _costTimer.read() : 0.;
+	  
 	  // set the data for the FaceIntegrator
 	  setFaceIntegratorData();
 	  
@@ -291,6 +302,10 @@ void FVMCC_ComputeRHS::execute()
 	  CFLog(DEBUG_MIN, "FVMCC_ComputeRHS::execute() => before computeRHSJacobian()\n");
 	  computeRHSJacobian();
 	  CFLog(DEBUG_MIN, "FVMCC_ComputeRHS::execute() => after computeRHSJacobian()\n");
+	  
+	  if (_measureCellCost) {
+	    addFaceCost(_costTimer.read() - faceStartTime);
+	  }
 	}
 	
 	geoBuilder->releaseGE(); 
@@ -357,9 +372,13 @@ void FVMCC_ComputeRHS::setup()
   } 
   
   // differentiate between source terms with numerical or analytical jacobian 
+  // (the split source terms are integrated apart, see FVMCC_SourceSplitting)
   CFuint nbSourceTermsNumJacob = 0; 
   CFuint nbSourceTermsAnJacob = 0; 
   for (CFuint i = 0; i < nbSourceTerms; ++i) { 
+    if ((*_stComputers)[i]->isSplit()) {
+      continue;
+    }
     if ((*_stComputers)[i]->useAnalyticalJacob()) { 
       nbSourceTermsAnJacob++; 
     } 
@@ -375,6 +394,9 @@ void FVMCC_ComputeRHS::setup()
   _stNumJacobIDs.reserve(nbSourceTermsNumJacob); 
   _stAnJacobIDs.reserve(nbSourceTermsAnJacob); 
   for (CFuint i = 0; i < nbSourceTerms; ++i) { 
+    if ((*_stComputers)[i]->isSplit()) {
+      continue;
+    }
     CFLog(DEBUG_MIN, "FVMCC_ComputeRHS::setup() => useAnalyticalJacob() for [" << 
 	  i << "] => " << ((*_stComputers)[i]->useAnalyticalJacob()) << "\n"); 
     ((*_stComputers)[i]->useAnalyticalJacob()) ?  
@@ -439,6 +461,13 @@ void FVMCC_ComputeRHS::setup()
   CellTrsGeoBuilder::GeoData& cellGeoData = getMethodData().getCellTrsGeoBuilder()->getDataGE();
   cellGeoData.trs = cells;
   
+  if (_measureCellCost) {
+    DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+    cellCost.resize(socket_states.getDataHandle().size());
+    cellCost = 0.;
+    _costTimer.start();
+  }
+  
   CFLog(VERBOSE, "FVMCC_ComputeRHS::setup() END\n");
 }
       
@@ -550,6 +579,8 @@ void FVMCC_ComputeRHS::computeSourceTerm()
       continue;
     }
 
+    const CFreal sourceStartTime = (_measureCellCost) ? _costTimer.read() : 0.;
+    
     GeometricEntity *const currCell = _currFace->getNeighborGeo(iCell);
     CFreal invR = 1.0;
     if (getMethodData().isAxisymmetric()) {
@@ -586,6 +617,12 @@ void FVMCC_ComputeRHS::computeSourceTerm()
       cellFlag[cellID] = true;
       _sourceJacobOnCell[iCell]= true;
     }
+    
+    if (_measureCellCost) {
+      const CFreal sourceTime = _costTimer.read() - sourceStartTime;
+      socket_cellCost.getDataHandle()[cellID] += sourceTime;
+      _faceSourceCost += sourceTime;
+    }
   }
   
   CFTRACEEND;
@@ -593,6 +630,27 @@ void FVMCC_ComputeRHS::computeSourceTerm()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FVMCC_ComputeRHS::addFaceCost(CFreal faceTime)
+{
+  DataHandle<CFreal> cellCost = socket_cellCost.getDataHandle();
+  
+  // the face work is shared by the neighbouring cells which are not ghost
+  faceTime -= _faceSourceCost;
+  _faceSourceCost = 0.;
+  
+  const State *const lState = _currFace->getState(0);
+  const State *const rState = _currFace->getState(1);
+  if (rState->isGhost()) {
+    cellCost[lState->getLocalID()] += faceTime;
+  }
+  else {
+    cellCost[lState->getLocalID()] += 0.5*faceTime;
+    cellCost[rState->getLocalID()] += 0.5*faceTime;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_ComputeRHS::transformResidual()
 {
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
@@ -679,6 +737,21 @@ vector<SafePtr<BaseDataSocketSink> > FVMCC_ComputeRHS::needsSockets()
 
 //////////////////////////////////////////////////////////////////////////////
 
+vector<SafePtr<BaseDataSocketSource> > FVMCC_ComputeRHS::providesSockets()
+{
+  vector<SafePtr<BaseDataSocketSource> > result;
+  
+  // the socket is only created if needed, to avoid clashes with other
+  // instances of this command in the same namespace
+  if (_measureCellCost) {
+    result.push_back(&socket_cellCost);
+  }
+  
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FVMCC_ComputeRHS::initializeComputationRHS()
 {
   // reset rhs to 0
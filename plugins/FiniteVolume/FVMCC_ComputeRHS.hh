@@ -5,6 +5,8 @@
 
 #include "FiniteVolume/CellCenterFVMData.hh"
 #include "Framework/DataSocketSink.hh"
+#include "Framework/DataSocketSource.hh"
+#include "Common/Stopwatch.hh"
 #include "FiniteVolume/ComputeDiffusiveFlux.hh"
 #include "FiniteVolume/FVMCC_PolyRec.hh"
 
@@ -75,6 +77,12 @@ public:
    * @return a vector of SafePtr with the DataSockets
    */
   virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+  
+  /**
+   * Returns the DataSocket's that this command provides as sources
+   * @return a vector of SafePtr with the DataSockets
+   */
+  virtual std::vector<Common::SafePtr<Framework::BaseDataSocketSource> > providesSockets();
     
 protected:
   
@@ -202,6 +210,10 @@ protected:
   /// Compute the transformation matrix dP/dU numerically
   RealMatrix& computeNumericalTransMatrix(Framework::State& state);
   
+  /// Add the time spent on the current face (minus the source terms, already
+  /// assigned to their own cell) to the cost of the neighbouring cells
+  void addFaceCost(CFreal faceTime);
+  
 protected:
   
   /// flags for cells
@@ -240,6 +252,10 @@ protected:
   /// storage of the nodes
   Framework::DataSocketSink < Framework::Node* , Framework::GLOBAL > socket_nodes;
   
+  /// storage of the measured cost of each cell (wall time in seconds, accumulated
+  /// until it is reset by the consumer, e.g. the ParMetisBalancer StdRepart)
+  Framework::DataSocketSource<CFreal> socket_cellCost;
+  
   /// flux splitter
   Common::SafePtr<Framework::FluxSplitter<CellCenterFVMData> > _fluxSplitter;  
   /// diffusive flux computer
@@ -357,6 +373,15 @@ protected:
   /// flag telling if to use analytical transformation matrix
   bool _useAnalyticalMatrix;
   
+  /// flag telling if to measure the cost of each cell
+  bool _measureCellCost;
+  
+  /// timer used to measure the cost of each cell
+  Common::Stopwatch<Common::WallTime> _costTimer;
+  
+  /// time spent on the source terms of the current face
+  CFreal _faceSourceCost;
+  
 }; // class FVMCC_ComputeRHS
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,385 @@
+#include <cmath>
+
+#include "FiniteVolume/FiniteVolume.hh"
+#include "FiniteVolume/FVMCC_SourceSplitting.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/SubSystemStatus.hh"
+#include "Framework/NumericalJacobian.hh"
+#include "Framework/VarSetTransformer.hh"
+#include "MathTools/MatrixInverter.hh"
+#include "Common/PE.hh"
+#include "Common/BadValueException.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<FVMCC_SourceSplitting,
+		      CellCenterFVMData,
+		      FiniteVolumeModule>
+fvmccSourceSplittingProvider("SourceSplitting");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_SourceSplitting::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFreal >
+    ("RelativeTolerance","Relative tolerance on the states for the substeps.");
+  options.addConfigOption< CFreal >
+    ("AbsoluteTolerance","Absolute tolerance on the states for the substeps.");
+  options.addConfigOption< CFuint >
+    ("MaxNbSubSteps","Maximum number of substeps per cell and time step.");
+  options.addConfigOption< CFuint >
+    ("MaxNbNewtonIter","Maximum number of Newton iterations per implicit substep.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FVMCC_SourceSplitting::FVMCC_SourceSplitting(const std::string& name) :
+  CellCenterFVMCom(name),
+  socket_states("states"),
+  socket_gstates("gstates"),
+  socket_nodes("nodes"),
+  socket_volumes("volumes"),
+  socket_rhs("rhs"),
+  m_cellBuilder(),
+  m_splitIDs(),
+  m_updateToSolutionVecTrans(CFNULL),
+  m_numericalJacob(CFNULL),
+  m_inverter(CFNULL),
+  m_subStep(),
+  m_uStep(),
+  m_uStart(),
+  m_uFull(),
+  m_sol0(),
+  m_sol(),
+  m_solPert(),
+  m_source(),
+  m_sourcePert(),
+  m_stSource(),
+  m_stJacob(),
+  m_derivative(),
+  m_residual(),
+  m_dU(),
+  m_jacob(),
+  m_invJacob()
+{
+  addConfigOptionsTo(this);
+
+  m_relTol = 1e-4;
+  setParameter("RelativeTolerance",&m_relTol);
+
+  m_absTol = 1e-10;
+  setParameter("AbsoluteTolerance",&m_absTol);
+
+  m_maxNbSubSteps = 1000;
+  setParameter("MaxNbSubSteps",&m_maxNbSubSteps);
+
+  m_maxNbNewtonIter = 10;
+  setParameter("MaxNbNewtonIter",&m_maxNbNewtonIter);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+FVMCC_SourceSplitting::~FVMCC_SourceSplitting()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_SourceSplitting::setup()
+{
+  CFAUTOTRACE;
+
+  CellCenterFVMCom::setup();
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  SafePtr<vector<SelfRegistPtr<ComputeSourceTerm<CellCenterFVMData> > > > stComputers =
+    getMethodData().getSourceTermComputer();
+  m_splitIDs.clear();
+  for (CFuint i = 0; i < stComputers->size(); ++i) {
+    if ((*stComputers)[i]->isSplit()) {
+      m_splitIDs.push_back(i);
+    }
+  }
+
+  if (m_splitIDs.size() == 0) {
+    CFLog(WARN, "FVMCC_SourceSplitting::setup() => no source term with Split = true\n");
+  }
+
+  m_updateToSolutionVecTrans = getMethodData().getUpdateToSolutionVecTrans();
+  m_numericalJacob = &getMethodData().getNumericalJacobian();
+  m_inverter.reset(MatrixInverter::create(nbEqs, false));
+
+  m_subStep.assign(socket_states.getDataHandle().size(), 0.);
+
+  m_uStep.resize(nbEqs);
+  m_uStart.resize(nbEqs);
+  m_uFull.resize(nbEqs);
+  m_sol0.resize(nbEqs);
+  m_sol.resize(nbEqs);
+  m_solPert.resize(nbEqs);
+  m_source.resize(nbEqs);
+  m_sourcePert.resize(nbEqs);
+  m_stSource.resize(nbEqs);
+  m_stJacob.resize(nbEqs, nbEqs);
+  m_derivative.resize(nbEqs);
+  m_residual.resize(nbEqs);
+  m_dU.resize(nbEqs);
+  m_jacob.resize(nbEqs, nbEqs);
+  m_invJacob.resize(nbEqs, nbEqs);
+
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  m_cellBuilder.setup();
+  m_cellBuilder.getGeoBuilder()->setDataSockets(socket_states, socket_gstates, socket_nodes);
+  m_cellBuilder.getDataGE().trs = cells;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_SourceSplitting::execute()
+{
+  CFAUTOTRACE;
+
+  if (m_splitIDs.size() == 0) return;
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<CFreal> rhs = socket_rhs.getDataHandle();
+
+  // the sources are integrated over the physical time step: the update
+  // coefficients have already been reset by the convergence method, so
+  // there is no local pseudo time step to use in steady computations
+  const CFreal dt = SubSystemStatusStack::getActive()->getDT();
+  if (!(dt > 0.)) {
+    throw BadValueException
+      (FromHere(), "FVMCC_SourceSplitting::execute() => the split source terms need a time accurate computation (DT > 0): set Split = false for steady computations");
+  }
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  DataHandle<CFreal> volumes = socket_volumes.getDataHandle();
+  const bool isImplicit = getMethodData().getConvergenceMethod()[0]->isLinearSystemSolverSet();
+
+  CellTrsGeoBuilder::GeoData& geoData = m_cellBuilder.getDataGE();
+  const CFuint nbCells = geoData.trs->getLocalNbGeoEnts();
+
+  CFuint nbSubSteps = 0;
+  CFuint maxNbSubSteps = 0;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    geoData.idx = iCell;
+    GeometricEntity *const cell = m_cellBuilder.buildGE();
+    const State *const state = cell->getState(0);
+
+    if (state->isParUpdatable()) {
+      const CFuint stateID = state->getLocalID();
+      m_uStep = *state;
+
+      const CFuint nbCellSubSteps = integrateCell(cell, dt);
+      nbSubSteps += nbCellSubSteps;
+      maxNbSubSteps = max(maxNbSubSteps, nbCellSubSteps);
+
+      // the increment due to the sources is added to the rhs, so that the
+      // residual is computed after the source step: with an implicit method
+      // the rhs holds the update of the states, otherwise it holds the
+      // residual, which is multiplied by dt/V in the update of the states
+      const CFreal factor = (isImplicit) ? 1. : volumes[cell->getID()]/dt;
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	rhs(stateID, iEq, nbEqs) += factor*((*state)[iEq] - m_uStep[iEq]);
+      }
+    }
+
+    m_cellBuilder.releaseGE();
+  }
+
+  CFLog(VERBOSE, "FVMCC_SourceSplitting::execute() => " << nbSubSteps << " substeps, "
+	<< maxNbSubSteps << " at most in one cell\n");
+
+  // the overlap states have been updated before the source terms were integrated
+  if (PE::GetPE().IsParallel()) {
+    states.synchronize();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint FVMCC_SourceSplitting::integrateCell(GeometricEntity *const cell,
+					    const CFreal cellDt)
+{
+  State& u = *cell->getState(0);
+  const CFuint stateID = u.getLocalID();
+
+  // start from the substep accepted at the previous time step
+  CFreal h = (m_subStep[stateID] > 0.) ? min(m_subStep[stateID], cellDt) : cellDt;
+  CFreal t = 0.;
+  CFuint nbSteps = 0;
+
+  while (t < cellDt) {
+    if (nbSteps == m_maxNbSubSteps) {
+      CFLog(WARN, "FVMCC_SourceSplitting::integrateCell() => state " << stateID
+	    << " reached MaxNbSubSteps at t/dt = " << t/cellDt << "\n");
+      break;
+    }
+    ++nbSteps;
+
+    h = min(h, cellDt - t);
+    m_uStart = u;
+
+    // error estimated by step doubling: one step of size h and two of size h/2
+    bool converged = implicitEulerStep(cell, h);
+    m_uFull = u;
+    u = m_uStart;
+    converged = converged && implicitEulerStep(cell, 0.5*h) && implicitEulerStep(cell, 0.5*h);
+
+    const CFreal error = (converged) ? computeErrorNorm(u, m_uFull) : MathTools::MathConsts::CFrealMax();
+    if (error <= 1.) {
+      t += h;
+      h *= min(4., 0.9/sqrt(max(error, 1e-8)));
+    }
+    else {
+      u = m_uStart;
+      h *= (converged) ? max(0.1, 0.9/sqrt(error)) : 0.25;
+    }
+  }
+
+  m_subStep[stateID] = h;
+  return nbSteps;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool FVMCC_SourceSplitting::implicitEulerStep(GeometricEntity *const cell,
+					      const CFreal h)
+{
+  // R(U) = U_sol(U) - U_sol(U0) - h*S(U) is zeroed by a Newton method whose
+  // matrix is computed once, at the beginning of the step
+  State& u = *cell->getState(0);
+  const CFuint nbEqs = u.size();
+
+  m_sol0 = static_cast<RealVector&>(*m_updateToSolutionVecTrans->transform(&u));
+  computeSource(cell, m_source);
+
+  // the source terms read the perturbation flag from the method data, so that
+  // the frozen quantities are not recomputed with the perturbed states
+  getMethodData().setIsPerturb(true);
+  for (CFuint iVar = 0; iVar < nbEqs; ++iVar) {
+    getMethodData().setIPerturbVar(iVar);
+    m_numericalJacob->perturb(iVar, u[iVar]);
+    m_solPert = static_cast<RealVector&>(*m_updateToSolutionVecTrans->transform(&u));
+    computeSource(cell, m_sourcePert);
+    m_numericalJacob->restore(u[iVar]);
+
+    m_numericalJacob->computeDerivative(m_sol0, m_solPert, m_derivative);
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      m_jacob(iEq, iVar) = m_derivative[iEq];
+    }
+    m_numericalJacob->computeDerivative(m_source, m_sourcePert, m_derivative);
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      m_jacob(iEq, iVar) -= h*m_derivative[iEq];
+    }
+  }
+
+  getMethodData().setIsPerturb(false);
+
+  m_inverter->invert(m_jacob, m_invJacob);
+
+  m_sol = m_sol0;
+  for (CFuint iter = 0; iter < m_maxNbNewtonIter; ++iter) {
+    m_residual = m_sol - m_sol0 - h*m_source;
+    m_dU = m_invJacob*m_residual;
+
+    CFreal dUNorm = 0.;
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      u[iEq] -= m_dU[iEq];
+      if (!(std::abs(u[iEq]) < MathTools::MathConsts::CFrealMax())) {
+	return false;
+      }
+      dUNorm = max(dUNorm, std::abs(m_dU[iEq])/(m_absTol + m_relTol*std::abs(u[iEq])));
+    }
+
+    // the Newton error has to be small with respect to the time integration error
+    if (dUNorm < 0.1) {
+      return true;
+    }
+
+    m_sol = static_cast<RealVector&>(*m_updateToSolutionVecTrans->transform(&u));
+    computeSource(cell, m_source);
+  }
+
+  return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FVMCC_SourceSplitting::computeSource(GeometricEntity *const cell,
+					  RealVector& source)
+{
+  SafePtr<vector<SelfRegistPtr<ComputeSourceTerm<CellCenterFVMData> > > > stComputers =
+    getMethodData().getSourceTermComputer();
+
+  source = 0.;
+  for (CFuint i = 0; i < m_splitIDs.size(); ++i) {
+    m_stSource = 0.;
+    (*stComputers)[m_splitIDs[i]]->computeSource(cell, m_stSource, m_stJacob);
+    source += m_stSource;
+  }
+
+  // the source terms are integrated over the cell (and multiplied by r
+  // for axisymmetric flows), as in FVMCC_ComputeRHS
+  CFreal factor = 1./socket_volumes.getDataHandle()[cell->getID()];
+  if (getMethodData().isAxisymmetric()) {
+    factor /= std::abs(cell->getState(0)->getCoordinates()[YY]);
+  }
+  source *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal FVMCC_SourceSplitting::computeErrorNorm(const RealVector& a,
+					       const RealVector& b) const
+{
+  CFreal norm = 0.;
+  for (CFuint i = 0; i < a.size(); ++i) {
+    const CFreal scale = m_absTol + m_relTol*max(std::abs(a[i]), std::abs(b[i]));
+    norm = max(norm, std::abs(a[i] - b[i])/scale);
+  }
+  return norm;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+vector<SafePtr<BaseDataSocketSink> > FVMCC_SourceSplitting::needsSockets()
+{
+  vector<SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+  result.push_back(&socket_gstates);
+  result.push_back(&socket_nodes);
+  result.push_back(&socket_volumes);
+  result.push_back(&socket_rhs);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_FVMCC_SourceSplitting_hh
+#define COOLFluiD_Numerics_FiniteVolume_FVMCC_SourceSplitting_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+
+#include "CellCenterFVMData.hh"
+#include "Framework/DataSocketSink.hh"
+#include "Framework/GeometricEntityPool.hh"
+#include "Framework/CellTrsGeoBuilder.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+    class NumericalJacobian;
+    class VarSetTransformer;
+  }
+
+  namespace MathTools {
+    class MatrixInverter;
+  }
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents a command that integrates the split source terms
+ * (those configured with Split = true) over one time step, cell by cell,
+ * after the transport terms have been advanced by the convergence method
+ * (Lie splitting: transport over dt, then sources over dt).
+ * In each cell the ODE d(U_sol)/dt = S(U)/V is integrated with first order
+ * implicit (backward) Euler substeps, whose size is adapted by step
+ * doubling, so that stiff chemistry or collision terms do not limit the
+ * time step of the transport. The Jacobian of each substep is computed
+ * numerically. No higher order stiff integrator (Rosenbrock, BDF) is
+ * provided.
+ * The command is run by CellCenterFVM::finalizeTimeStep(), i.e. once per
+ * physical time step, after all the stages or Newton iterations of the
+ * convergence method. The increment of the states due to the sources is
+ * added to the rhs (as is with an implicit method, times V/dt with an
+ * explicit one, whose rhs is a residual) and the residual is recomputed by
+ * the convergence method.
+ * The numerical Jacobian is computed with the perturbation flag of the
+ * method data set, as in the rhs Jacobian commands.
+ * Only time accurate computations are supported.
+ */
+class FVMCC_SourceSplitting : public CellCenterFVMCom {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  explicit FVMCC_SourceSplitting(const std::string& name);
+
+  /**
+   * Destructor.
+   */
+  ~FVMCC_SourceSplitting();
+
+  /**
+   * Set up private data and data of the aggregated classes
+   * in this command before processing phase
+   */
+  void setup();
+
+  /**
+   * Execute Processing actions
+   */
+  void execute();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /**
+   * Integrate the split source terms in the given cell
+   * @return the number of substeps
+   */
+  CFuint integrateCell(Framework::GeometricEntity *const cell,
+		       const CFreal cellDt);
+
+  /**
+   * Take one implicit Euler step of the given size in the given cell
+   * @return false if the Newton iterations did not converge
+   */
+  bool implicitEulerStep(Framework::GeometricEntity *const cell,
+			 const CFreal h);
+
+  /**
+   * Compute the sum of the split source terms per unit volume
+   */
+  void computeSource(Framework::GeometricEntity *const cell,
+		     RealVector& source);
+
+  /**
+   * Compute the weighted norm of the difference between two states
+   */
+  CFreal computeErrorNorm(const RealVector& a, const RealVector& b) const;
+
+private: // data
+
+  /// socket for the states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+
+  /// socket for the ghost states
+  Framework::DataSocketSink<Framework::State*> socket_gstates;
+
+  /// socket for the nodes
+  Framework::DataSocketSink<Framework::Node*, Framework::GLOBAL> socket_nodes;
+
+  /// socket for the volumes
+  Framework::DataSocketSink<CFreal> socket_volumes;
+
+  /// socket for the rhs
+  Framework::DataSocketSink<CFreal> socket_rhs;
+
+  /// builder of cells
+  Framework::GeometricEntityPool<Framework::CellTrsGeoBuilder> m_cellBuilder;
+
+  /// indices of the split source terms
+  std::vector<CFuint> m_splitIDs;
+
+  /// transformer from update to solution variables
+  Common::SafePtr<Framework::VarSetTransformer> m_updateToSolutionVecTrans;
+
+  /// numerical jacobian calculator
+  Common::SafePtr<Framework::NumericalJacobian> m_numericalJacob;
+
+  /// inverter of the Newton matrix
+  std::auto_ptr<MathTools::MatrixInverter> m_inverter;
+
+  /// size of the last accepted substep in each cell
+  std::vector<CFreal> m_subStep;
+
+  /// state at the beginning of the time step
+  RealVector m_uStep;
+
+  /// state at the beginning of the current substep
+  RealVector m_uStart;
+
+  /// result of the full step
+  RealVector m_uFull;
+
+  /// solution variables at the beginning of the implicit Euler step
+  RealVector m_sol0;
+
+  /// solution variables of the current Newton iterate
+  RealVector m_sol;
+
+  /// perturbed solution variables
+  RealVector m_solPert;
+
+  /// source term of the current Newton iterate
+  RealVector m_source;
+
+  /// perturbed source term
+  RealVector m_sourcePert;
+
+  /// source term of one source term computer
+  RealVector m_stSource;
+
+  /// dummy jacobian for the source term computers
+  RealMatrix m_stJacob;
+
+  /// numerical derivative
+  RealVector m_derivative;
+
+  /// Newton residual
+  RealVector m_residual;
+
+  /// Newton correction
+  RealVector m_dU;
+
+  /// Newton matrix
+  RealMatrix m_jacob;
+
+  /// inverse of the Newton matrix
+  RealMatrix m_invJacob;
+
+  /// relative tolerance of the substeps
+  CFreal m_relTol;
+
+  /// absolute tolerance of the substeps
+  CFreal m_absTol;
+
+  /// maximum number of substeps per cell and time step
+  CFuint m_maxNbSubSteps;
+
+  /// maximum number of Newton iterations per implicit Euler step
+  CFuint m_maxNbNewtonIter;
+
+}; // class FVMCC_SourceSplitting
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_FVMCC_SourceSplitting_hh
@@ -0,0 +1,573 @@
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <set>
+
+#include "Common/PE.hh"
+#include "Common/BadValueException.hh"
+#include "Environment/DirPaths.hh"
+#include "Environment/FileHandlerOutput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+#include "Framework/LocalConnectionData.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/PathAppender.hh"
+#include "Framework/SpaceMethod.hh"
+#include "Framework/SpaceMethodData.hh"
+#include "Framework/SubSystemStatus.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "FiniteVolume/FiniteVolume.hh"
+#include "FiniteVolume/InSituExtractCC.hh"
+
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Environment;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<InSituExtractCC, DataProcessingData, FiniteVolumeModule>
+inSituExtractCCProvider("InSituExtractCC");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFuint >("SaveRate","Rate (in iterations) for writing the surface extracts.");
+  options.addConfigOption< CFuint >("ProbeRate","Rate (in iterations) for sampling the probes.");
+  options.addConfigOption< CFuint >("ProbeFlushSize","Number of probe samples kept in memory before writing.");
+  options.addConfigOption< std::vector<CFreal> >("ProbeCoords","Coordinates of the probes, one point after the other.");
+  options.addConfigOption< std::vector<CFreal> >("PlanePoints","Points of the planes, one point after the other.");
+  options.addConfigOption< std::vector<CFreal> >("PlaneNormals","Normals of the planes, one normal after the other.");
+  options.addConfigOption< std::vector<CFuint> >("IsoVarIDs","IDs of the variables of the iso-surfaces.");
+  options.addConfigOption< std::vector<CFreal> >("IsoValues","Values of the iso-surfaces.");
+  options.addConfigOption< std::vector<std::string> >("BoundaryTRSs","Names of the boundary TRSs to extract.");
+  options.addConfigOption< std::string >("OutputFile","Prefix of the output files.");
+  options.addConfigOption< bool >("AppendIter","Append the iteration number to the surface extract files.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+InSituExtractCC::InSituExtractCC(const std::string& name) :
+  DataProcessingCom(name),
+  socket_states("states"),
+  socket_nodes("nodes"),
+  socket_nstates("nstates"),
+  m_varNames(),
+  m_cellEdges(),
+  m_probeStateIDs(),
+  m_probeBuffer(),
+  m_nbProbeSamples(0),
+  m_isFirstProbeFlush(true)
+{
+  addConfigOptionsTo(this);
+
+  m_saveRate = 100;
+  setParameter("SaveRate",&m_saveRate);
+
+  m_probeRate = 1;
+  setParameter("ProbeRate",&m_probeRate);
+
+  m_probeFlushSize = 1000;
+  setParameter("ProbeFlushSize",&m_probeFlushSize);
+
+  m_probeCoords = vector<CFreal>();
+  setParameter("ProbeCoords",&m_probeCoords);
+
+  m_planePoints = vector<CFreal>();
+  setParameter("PlanePoints",&m_planePoints);
+
+  m_planeNormals = vector<CFreal>();
+  setParameter("PlaneNormals",&m_planeNormals);
+
+  m_isoVarIDs = vector<CFuint>();
+  setParameter("IsoVarIDs",&m_isoVarIDs);
+
+  m_isoValues = vector<CFreal>();
+  setParameter("IsoValues",&m_isoValues);
+
+  m_boundaryTRSs = vector<std::string>();
+  setParameter("BoundaryTRSs",&m_boundaryTRSs);
+
+  m_outputFile = "extract";
+  setParameter("OutputFile",&m_outputFile);
+
+  m_appendIter = true;
+  setParameter("AppendIter",&m_appendIter);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+InSituExtractCC::~InSituExtractCC()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSink> >
+InSituExtractCC::needsSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_states);
+  result.push_back(&socket_nodes);
+  result.push_back(&socket_nstates);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::setup()
+{
+  CFAUTOTRACE;
+
+  DataProcessingCom::setup();
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  if (m_probeCoords.size()%dim != 0) {
+    throw BadValueException(FromHere(), "InSituExtractCC::setup() => ProbeCoords size must be a multiple of the dimension");
+  }
+  if (m_planePoints.size() != m_planeNormals.size() || m_planePoints.size()%dim != 0) {
+    throw BadValueException(FromHere(), "InSituExtractCC::setup() => PlanePoints and PlaneNormals must have one point and normal per plane");
+  }
+  if (m_isoVarIDs.size() != m_isoValues.size()) {
+    throw BadValueException(FromHere(), "InSituExtractCC::setup() => IsoVarIDs and IsoValues must have the same size");
+  }
+  for (CFuint i = 0; i < m_isoVarIDs.size(); ++i) {
+    if (m_isoVarIDs[i] >= nbEqs) {
+      throw BadValueException(FromHere(), "InSituExtractCC::setup() => IsoVarIDs out of range");
+    }
+  }
+  if (m_probeFlushSize == 0) {
+    throw BadValueException(FromHere(), "InSituExtractCC::setup() => ProbeFlushSize must be > 0");
+  }
+
+  // the edges of the cells are the faces in 2D
+  SafePtr<vector<ElementTypeData> > elementType =
+    MeshDataStack::getActive()->getElementTypeData();
+  m_cellEdges.resize(elementType->size());
+  for (CFuint iType = 0; iType < elementType->size(); ++iType) {
+    const CFGeoShape::Type shape = (*elementType)[iType].getGeoShape();
+    m_cellEdges[iType] = (dim == DIM_3D) ?
+      LocalConnectionData::getInstance().getEdgeDofLocal(shape, CFPolyOrder::ORDER1, NODE, CFPolyForm::LAGRANGE) :
+      LocalConnectionData::getInstance().getFaceDofLocal(shape, CFPolyOrder::ORDER1, NODE, CFPolyForm::LAGRANGE);
+  }
+
+  SafePtr<SpaceMethod> spaceMethod = getMethodData().getCollaborator<SpaceMethod>();
+  m_varNames = spaceMethod->getSpaceMethodData()->getUpdateVar()->getVarNames();
+
+  locateProbes();
+  m_probeBuffer.resize(m_probeFlushSize*(2 + m_probeStateIDs.size()*nbEqs));
+  m_nbProbeSamples = 0;
+  m_isFirstProbeFlush = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::unsetup()
+{
+  CFAUTOTRACE;
+
+  // the last samples are written at the end of the run
+  flushProbes();
+
+  DataProcessingCom::unsetup();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::execute()
+{
+  CFAUTOTRACE;
+
+  const CFuint iter = SubSystemStatusStack::getActive()->getNbIter();
+
+  if (m_probeStateIDs.size() > 0 && m_probeRate > 0 && iter%m_probeRate == 0) {
+    sampleProbes();
+    if (m_nbProbeSamples == m_probeFlushSize) {
+      flushProbes();
+    }
+  }
+
+  if (m_saveRate > 0 && iter%m_saveRate == 0) {
+    const CFuint dim = PhysicalModelStack::getActive()->getDim();
+    vector<CFreal> points;
+
+    for (CFuint i = 0; i < m_planePoints.size()/dim; ++i) {
+      extractCutCells(i, -1, points);
+      writeExtract("plane" + StringOps::to_str(i), points);
+    }
+
+    for (CFuint i = 0; i < m_isoValues.size(); ++i) {
+      extractCutCells(-1, i, points);
+      writeExtract("iso" + StringOps::to_str(i), points);
+    }
+
+    for (CFuint i = 0; i < m_boundaryTRSs.size(); ++i) {
+      extractBoundary(m_boundaryTRSs[i], points);
+      writeExtract(m_boundaryTRSs[i], points);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::locateProbes()
+{
+  CFAUTOTRACE;
+
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbProbes = m_probeCoords.size()/dim;
+  const std::string nsp = getMethodData().getNamespace();
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+
+  m_probeStateIDs.assign(nbProbes, -1);
+  for (CFuint p = 0; p < nbProbes; ++p) {
+    // closest cell center among the cells updated by this processor
+    CFreal minDist2 = std::numeric_limits<CFreal>::max();
+    CFint closestID = -1;
+    for (CFuint i = 0; i < states.size(); ++i) {
+      if (states[i]->isParUpdatable()) {
+	const Node& center = states[i]->getCoordinates();
+	CFreal dist2 = 0.;
+	for (CFuint d = 0; d < dim; ++d) {
+	  const CFreal dx = center[d] - m_probeCoords[p*dim + d];
+	  dist2 += dx*dx;
+	}
+	if (dist2 < minDist2) {
+	  minDist2 = dist2;
+	  closestID = i;
+	}
+      }
+    }
+
+    // the processor with the closest cell owns the probe
+    CFuint owner = rank;
+#ifdef CF_HAVE_MPI
+    MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+    CFreal globalMinDist2 = 0.;
+    MPI_Allreduce(&minDist2, &globalMinDist2, 1, MPIStructDef::getMPIType(&minDist2), MPI_MIN, comm);
+    CFuint candidate = (minDist2 == globalMinDist2) ? rank : std::numeric_limits<CFuint>::max();
+    MPI_Allreduce(&candidate, &owner, 1, MPIStructDef::getMPIType(&candidate), MPI_MIN, comm);
+#endif
+
+    if (owner == rank) {
+      m_probeStateIDs[p] = closestID;
+      CFLog(VERBOSE, "InSituExtractCC::locateProbes() => probe " << p << " in cell "
+	    << states[closestID]->getLocalID() << " at distance " << std::sqrt(minDist2) << "\n");
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::sampleProbes()
+{
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint sampleSize = 2 + m_probeStateIDs.size()*nbEqs;
+  CFreal *const sample = &m_probeBuffer[m_nbProbeSamples*sampleSize];
+
+  sample[0] = SubSystemStatusStack::getActive()->getNbIter();
+  sample[1] = SubSystemStatusStack::getActive()->getCurrentTimeDim();
+  for (CFuint p = 0; p < m_probeStateIDs.size(); ++p) {
+    CFreal *const values = &sample[2 + p*nbEqs];
+    if (m_probeStateIDs[p] >= 0) {
+      const State& state = *states[m_probeStateIDs[p]];
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	values[iEq] = state[iEq];
+      }
+    }
+    else {
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	values[iEq] = 0.;
+      }
+    }
+  }
+
+  ++m_nbProbeSamples;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::flushProbes()
+{
+  CFAUTOTRACE;
+
+  if (m_probeStateIDs.size() == 0) return;
+
+  const std::string nsp = getMethodData().getNamespace();
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint sampleSize = 2 + m_probeStateIDs.size()*nbEqs;
+  const CFuint bufferSize = m_nbProbeSamples*sampleSize;
+
+  // each probe has a single owner: the sum gathers all of them
+  vector<CFreal> samples(m_probeBuffer.begin(), m_probeBuffer.begin() + bufferSize);
+#ifdef CF_HAVE_MPI
+  if (bufferSize > 0) {
+    MPI_Reduce(&m_probeBuffer[0], &samples[0], (int)bufferSize,
+	       MPIStructDef::getMPIType(&samples[0]), MPI_SUM, 0,
+	       PE::GetPE().GetCommunicator(nsp));
+  }
+#endif
+
+  if (rank == 0) {
+    // iteration and time are the same on all the processors
+    for (CFuint s = 0; s < m_nbProbeSamples; ++s) {
+      samples[s*sampleSize]     = m_probeBuffer[s*sampleSize];
+      samples[s*sampleSize + 1] = m_probeBuffer[s*sampleSize + 1];
+    }
+
+    boost::filesystem::path file = DirPaths::getInstance().getResultsDir() /
+      boost::filesystem::path(m_outputFile + "-probes.bin");
+    SelfRegistPtr<FileHandlerOutput> fhandle =
+      SingleBehaviorFactory<FileHandlerOutput>::getInstance().create();
+
+    // the file is created with its header at the first flush of the run
+    ofstream& fout = fhandle->open(file, (m_isFirstProbeFlush) ? ios::binary :
+				   (ios::binary | ios::app));
+
+    if (m_isFirstProbeFlush) {
+      const CFuint nbProbes = m_probeStateIDs.size();
+      fout.write(reinterpret_cast<const char*>(&nbProbes), sizeof(CFuint));
+      fout.write(reinterpret_cast<const char*>(&nbEqs), sizeof(CFuint));
+      fout.write(reinterpret_cast<const char*>(&dim), sizeof(CFuint));
+      fout.write(reinterpret_cast<const char*>(&m_probeCoords[0]), m_probeCoords.size()*sizeof(CFreal));
+    }
+
+    if (m_nbProbeSamples > 0) {
+      fout.write(reinterpret_cast<const char*>(&m_nbProbeSamples), sizeof(CFuint));
+      fout.write(reinterpret_cast<const char*>(&sampleSize), sizeof(CFuint));
+      fout.write(reinterpret_cast<const char*>(&samples[0]), bufferSize*sizeof(CFreal));
+    }
+
+    fhandle->close();
+  }
+
+  m_nbProbeSamples = 0;
+  m_isFirstProbeFlush = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::extractCutCells(const CFint iPlane, const CFint iIso,
+				      vector<CFreal>& points)
+{
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<Node*, GLOBAL> nodes = socket_nodes.getDataHandle();
+  DataHandle<RealVector> nstates = socket_nstates.getDataHandle();
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  SafePtr<vector<ElementTypeData> > elementType =
+    MeshDataStack::getActive()->getElementTypeData();
+
+  points.clear();
+
+  // each edge crossing the zero level is written once by this processor
+  set<pair<CFuint, CFuint> > cutEdges;
+  vector<CFreal> levels;
+
+  CFuint iCell = 0;
+  for (CFuint iType = 0; iType < elementType->size(); ++iType) {
+    const Table<CFuint>& edges = *m_cellEdges[iType];
+    const CFuint nbElemPerType = (*elementType)[iType].getNbElems();
+    for (CFuint iElem = 0; iElem < nbElemPerType; ++iElem, ++iCell) {
+      if (!states[cells->getStateID(iCell, 0)]->isParUpdatable()) continue;
+
+      // nodal function whose zero level is the extract
+      const CFuint nbNodes = cells->getNbNodesInGeo(iCell);
+      levels.resize(nbNodes);
+      for (CFuint n = 0; n < nbNodes; ++n) {
+	const CFuint nodeID = cells->getNodeID(iCell, n);
+	CFreal f = 0.;
+	if (iPlane >= 0) {
+	  const Node& node = *nodes[nodeID];
+	  for (CFuint d = 0; d < dim; ++d) {
+	    f += (node[d] - m_planePoints[iPlane*dim + d])*m_planeNormals[iPlane*dim + d];
+	  }
+	}
+	else {
+	  f = nstates[nodeID][m_isoVarIDs[iIso]] - m_isoValues[iIso];
+	}
+	levels[n] = f;
+      }
+
+      // the coordinates and the nodal states are interpolated linearly at
+      // the points where the function changes sign along the edges
+      for (CFuint iEdge = 0; iEdge < edges.nbRows(); ++iEdge) {
+	const CFuint a = edges(iEdge, 0);
+	const CFuint b = edges(iEdge, 1);
+	if ((levels[a] < 0.) == (levels[b] < 0.)) continue;
+
+	const CFuint nodeA = cells->getNodeID(iCell, a);
+	const CFuint nodeB = cells->getNodeID(iCell, b);
+	if (!cutEdges.insert(make_pair(min(nodeA, nodeB), max(nodeA, nodeB))).second) continue;
+
+	const CFreal t = levels[a]/(levels[a] - levels[b]);
+	const Node& xA = *nodes[nodeA];
+	const Node& xB = *nodes[nodeB];
+	for (CFuint d = 0; d < dim; ++d) {
+	  points.push_back(xA[d] + t*(xB[d] - xA[d]));
+	}
+	for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	  points.push_back(nstates[nodeA][iEq] + t*(nstates[nodeB][iEq] - nstates[nodeA][iEq]));
+	}
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::extractBoundary(const std::string& trsName,
+				      vector<CFreal>& points)
+{
+  DataHandle<State*, GLOBAL> states = socket_states.getDataHandle();
+  DataHandle<Node*, GLOBAL> nodes = socket_nodes.getDataHandle();
+  DataHandle<RealVector> nstates = socket_nstates.getDataHandle();
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  SafePtr<TopologicalRegionSet> trs = MeshDataStack::getActive()->getTrs(trsName);
+
+  points.clear();
+
+  const CFuint nbFaces = trs->getLocalNbGeoEnts();
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    // only the faces of the updated cells are written, to avoid duplicates
+    if (!states[trs->getStateID(iFace, 0)]->isParUpdatable()) continue;
+
+    const CFuint start = points.size();
+    points.resize(start + dim + nbEqs, 0.);
+
+    const CFuint nbNodes = trs->getNbNodesInGeo(iFace);
+    const CFreal ovNbNodes = 1./static_cast<CFreal>(nbNodes);
+    for (CFuint n = 0; n < nbNodes; ++n) {
+      const CFuint nodeID = trs->getNodeID(iFace, n);
+      const Node& node = *nodes[nodeID];
+      for (CFuint d = 0; d < dim; ++d) {
+	points[start + d] += node[d]*ovNbNodes;
+      }
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	points[start + dim + iEq] += nstates[nodeID][iEq]*ovNbNodes;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void InSituExtractCC::writeExtract(const std::string& extractName,
+				   const vector<CFreal>& points)
+{
+  CFAUTOTRACE;
+
+  const std::string nsp = getMethodData().getNamespace();
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  const CFuint nbProcs = PE::GetPE().GetProcessorCount(nsp);
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint pointSize = dim + nbEqs;
+
+  // the points of all the processors are gathered on the first one
+  vector<int> recvCounts(nbProcs, points.size());
+  vector<int> displs(nbProcs, 0);
+  vector<CFreal> allPoints;
+
+#ifdef CF_HAVE_MPI
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  int sendCount = points.size();
+  MPI_Gather(&sendCount, 1, MPI_INT, &recvCounts[0], 1, MPI_INT, 0, comm);
+
+  if (rank == 0) {
+    for (CFuint iProc = 1; iProc < nbProcs; ++iProc) {
+      displs[iProc] = displs[iProc-1] + recvCounts[iProc-1];
+    }
+    allPoints.resize(displs[nbProcs-1] + recvCounts[nbProcs-1]);
+  }
+
+  // one more entry avoids taking the address of an empty vector
+  vector<CFreal> localPoints(points);
+  localPoints.push_back(0.);
+  allPoints.push_back(0.);
+  MPI_Gatherv(&localPoints[0], sendCount, MPIStructDef::getMPIType(&localPoints[0]),
+	      &allPoints[0], &recvCounts[0], &displs[0],
+	      MPIStructDef::getMPIType(&allPoints[0]), 0, comm);
+  allPoints.pop_back();
+#else
+  allPoints = points;
+#endif
+
+  if (rank != 0) return;
+
+  boost::filesystem::path file = DirPaths::getInstance().getResultsDir() /
+    boost::filesystem::path(m_outputFile + "-" + extractName + ".plt");
+  file = PathAppender::getInstance().appendAllInfo(file, m_appendIter, false, false);
+
+  SelfRegistPtr<FileHandlerOutput> fhandle =
+    SingleBehaviorFactory<FileHandlerOutput>::getInstance().create();
+  ofstream& fout = fhandle->open(file);
+
+  fout << "TITLE = \"" << extractName << "\"\n";
+  fout << "VARIABLES = ";
+  const char* coordNames[] = {"x", "y", "z"};
+  for (CFuint d = 0; d < dim; ++d) {
+    fout << "\"" << coordNames[d] << "\" ";
+  }
+  for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+    fout << "\"" << m_varNames[iEq] << "\" ";
+  }
+  fout << "\n";
+
+  // one zone per processor
+  fout.precision(12);
+  for (CFuint iProc = 0; iProc < nbProcs; ++iProc) {
+    const CFuint nbPoints = recvCounts[iProc]/pointSize;
+    if (nbPoints > 0) {
+      fout << "ZONE T=\"P" << iProc << "\", I=" << nbPoints << ", F=POINT\n";
+      const CFreal *const procPoints = &allPoints[displs[iProc]];
+      for (CFuint p = 0; p < nbPoints; ++p) {
+	for (CFuint v = 0; v < pointSize; ++v) {
+	  fout << procPoints[p*pointSize + v] << " ";
+	}
+	fout << "\n";
+      }
+    }
+  }
+
+  fhandle->close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
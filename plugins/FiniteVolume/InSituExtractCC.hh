@@ -0,0 +1,192 @@
+#ifndef COOLFluiD_Numerics_FiniteVolume_InSituExtractCC_hh
+#define COOLFluiD_Numerics_FiniteVolume_InSituExtractCC_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/Table.hh"
+#include "Framework/DataProcessingData.hh"
+#include "Framework/DataSocketSink.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace FiniteVolume {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class extracts, while the simulation runs, small subsets of the
+ * cell centered solution instead of full-field dumps:
+ *  - planes (point and normal) and iso-surfaces of a variable, as the
+ *    points where they cross the edges of the cells, with the coordinates
+ *    and the nodal states interpolated linearly along the edges;
+ *  - boundary TRSs, as the face centers and the average of the nodal
+ *    states of the face;
+ *  - point probes, as the state of the cell whose center is the closest.
+ * The surface extracts are gathered on the first processor and written
+ * every SaveRate iterations in Tecplot point format, one zone per processor.
+ * The probes are sampled every ProbeRate iterations and buffered in
+ * memory; every ProbeFlushSize samples, and at the end of the run, the
+ * buffer is appended by the first processor to a binary file made of
+ * a header (nb probes, nb variables, probe coordinates) and blocks
+ * (nb samples, sample size, samples of iteration, time and probe values).
+ */
+class InSituExtractCC : public Framework::DataProcessingCom {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor
+   */
+  InSituExtractCC(const std::string& name);
+
+  /**
+   * Default destructor
+   */
+  ~InSituExtractCC();
+
+  /**
+   * Set up private data and data of the aggregated classes
+   * in this command before processing phase
+   */
+  void setup();
+
+  /**
+   * Unset up private data and data of the aggregated classes
+   * in this command
+   */
+  void unsetup();
+
+  /**
+   * Execute Processing actions
+   */
+  void execute();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+private:
+
+  /**
+   * Find the processor and the local state of each probe
+   */
+  void locateProbes();
+
+  /**
+   * Store the values of the probes owned by this processor
+   */
+  void sampleProbes();
+
+  /**
+   * Append the buffered probe samples to the probe file
+   */
+  void flushProbes();
+
+  /**
+   * Extract the points where the zero level of a nodal function crosses
+   * the edges of the cells
+   * @param iPlane  index of the plane, or -1 for an iso-surface
+   * @param iIso    index of the iso-surface, or -1 for a plane
+   */
+  void extractCutCells(const CFint iPlane, const CFint iIso,
+		       std::vector<CFreal>& points);
+
+  /**
+   * Extract the faces of a boundary TRS
+   */
+  void extractBoundary(const std::string& trsName,
+		       std::vector<CFreal>& points);
+
+  /**
+   * Write the given points (coordinates and values) of all the
+   * processors in a Tecplot file
+   */
+  void writeExtract(const std::string& extractName,
+		    const std::vector<CFreal>& points);
+
+private: // data
+
+  /// storage of states
+  Framework::DataSocketSink < Framework::State* , Framework::GLOBAL > socket_states;
+
+  /// storage of nodes
+  Framework::DataSocketSink < Framework::Node* , Framework::GLOBAL > socket_nodes;
+
+  /// storage of nodal states
+  Framework::DataSocketSink<RealVector> socket_nstates;
+
+  /// names of the variables
+  std::vector<std::string> m_varNames;
+
+  /// local edge-node connectivity of each element type
+  std::vector<Common::Table<CFuint>*> m_cellEdges;
+
+  /// local state ID of each probe (-1 if owned by another processor)
+  std::vector<CFint> m_probeStateIDs;
+
+  /// buffered probe samples
+  std::vector<CFreal> m_probeBuffer;
+
+  /// number of buffered probe samples
+  CFuint m_nbProbeSamples;
+
+  /// flag telling if the probe file has not been written yet
+  bool m_isFirstProbeFlush;
+
+  /// rate (in iterations) for writing the surface extracts
+  CFuint m_saveRate;
+
+  /// rate (in iterations) for sampling the probes
+  CFuint m_probeRate;
+
+  /// number of probe samples buffered before writing
+  CFuint m_probeFlushSize;
+
+  /// coordinates of the probes
+  std::vector<CFreal> m_probeCoords;
+
+  /// points of the planes
+  std::vector<CFreal> m_planePoints;
+
+  /// normals of the planes
+  std::vector<CFreal> m_planeNormals;
+
+  /// variable IDs of the iso-surfaces
+  std::vector<CFuint> m_isoVarIDs;
+
+  /// values of the iso-surfaces
+  std::vector<CFreal> m_isoValues;
+
+  /// names of the boundary TRSs to extract
+  std::vector<std::string> m_boundaryTRSs;
+
+  /// prefix of the output files
+  std::string m_outputFile;
+
+  /// append the iteration number to the surface extract files
+  bool m_appendIter;
+
+}; // end of class InSituExtractCC
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace FiniteVolume
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_FiniteVolume_InSituExtractCC_hh
@@ -40,9 +40,9 @@ LeastSquareP1PolyRec3D::LeastSquareP1PolyRec3D(const std::string& name) :
   _l22(),
   _l23(),
   _l33(),
-  _lf1(),
-  _lf2(),
-  _lf3()
+  m_rowStart(),
+  m_neighbors(),
+  m_coefficients()
 {
 }
 
@@ -83,132 +83,159 @@ void LeastSquareP1PolyRec3D::computeGradients()
   prepareReconstruction();
 
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
-  DataHandle<CFreal> weights = socket_weights.getDataHandle();
   DataHandle<CFreal> uX = socket_uX.getDataHandle();
   DataHandle<CFreal> uY = socket_uY.getDataHandle();
   DataHandle<CFreal> uZ = socket_uZ.getDataHandle();
 
-  const CFuint nbStates = states.size();
+  const CFint nbStates = states.size();
   const CFuint nbEquations = PhysicalModelStack::getActive()->getNbEq();
+  cf_assert(m_rowStart.size() == static_cast<CFuint>(nbStates) + 1);
+
+  // each state gathers the contributions of its own stencil with the
+  // precomputed least square coefficients: no scatter, so the loop over
+  // the states is free of data races and can be shared among threads
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+  for(CFint iState = 0; iState < nbStates; ++iState) {
+    const State& first = *states[iState];
+    const CFuint start = iState*nbEquations;
+    CFreal *const gradX = &uX[start];
+    CFreal *const gradY = &uY[start];
+    CFreal *const gradZ = &uZ[start];
+    for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
+      gradX[iVar] = gradY[iVar] = gradZ[iVar] = 0.0;
+    }
 
-  for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
-    _lf1 = 0.0;
-    _lf2 = 0.0;
-    _lf3 = 0.0;
-    CFuint iEdge = 0;
-
-    for(CFuint iState = 0; iState < nbStates; ++iState) {
-      const State* const first = states[iState];
-      const CFuint stencilSize = stencil[iState].size();
-      // loop over the neighbor cells belonging to the chosen stencil
-      for(CFuint in = 0; in < stencilSize; ++in) {
-        const State* const last = stencil[iState][in];
-	const CFuint lastID = (!last->isGhost()) ? last->getLocalID() : 
-	    numeric_limits<CFuint>::max();
-        const CFuint firstID = first->getLocalID();
-        cf_assert(firstID != lastID);
-
-	if (lastID > firstID) {
-	  const RealVector& nodeFirst = first->getCoordinates();
-	  const RealVector& nodeLast = last->getCoordinates();
-
-	  const CFreal dx = weights[iEdge]*(nodeLast[0]
-					    - nodeFirst[0]);
-	  const CFreal dy = weights[iEdge]*(nodeLast[1]
-					    - nodeFirst[1]);
-	  const CFreal dz = weights[iEdge]*(nodeLast[2]
-					    - nodeFirst[2]);
-
-	  const CFreal du = weights[iEdge]*((*last)[iVar] - (*first)[iVar]);
-
-	  CFLogDebugMin( "du = " << du << "\n");
-
-	    _lf1[firstID] += dx*du;
-	    _lf2[firstID] += dy*du;
-	    _lf3[firstID] += dz*du;
-	    
-	    if (!last->isGhost()) {
-		_lf1[lastID]  += dx*du; 
-		_lf2[lastID]  += dy*du;
-		_lf3[lastID]  += dz*du;
-	    }
-	  ++iEdge;
-	}
+    const CFuint endEntry = m_rowStart[iState+1];
+    for(CFuint iEntry = m_rowStart[iState]; iEntry < endEntry; ++iEntry) {
+      const State& last = *m_neighbors[iEntry];
+      const CFreal *const coeff = &m_coefficients[iEntry*DIM_3D];
+      const CFreal cx = coeff[XX];
+      const CFreal cy = coeff[YY];
+      const CFreal cz = coeff[ZZ];
+      for(CFuint iVar = 0; iVar < nbEquations; ++iVar) {
+	const CFreal du = last[iVar] - first[iVar];
+	gradX[iVar] += cx*du;
+	gradY[iVar] += cy*du;
+	gradZ[iVar] += cz*du;
       }
     }
+  }
+}
 
-    for(CFuint iState = 0; iState < nbStates; ++iState) {
+//////////////////////////////////////////////////////////////////////////////
 
-      const CFreal det = _l11[iState]*_l22[iState]*_l33[iState]
-	- _l11[iState]*_l23[iState]*_l23[iState]
-	- _l12[iState]*_l12[iState]*_l33[iState]
-	+ _l12[iState]*_l13[iState]*_l23[iState]
-	+ _l13[iState]*_l12[iState]*_l23[iState]
-	- _l13[iState]*_l13[iState]*_l22[iState];
+void LeastSquareP1PolyRec3D::computeStencilCoefficients()
+{
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle<vector<State*> > stencil = socket_stencil.getDataHandle();
+  DataHandle<CFreal> weights = socket_weights.getDataHandle();
 
-      if (!(std::abs(det) > MathTools::MathConsts::CFrealEps())) {
-	CFout << "Det is zero."<<"\n";
-      }
+  const CFuint nbStates = states.size();
 
-      const CFreal linv11 = _l22[iState]*_l33[iState] - _l23[iState]*_l23[iState];
-      const CFreal linv22 = _l11[iState]*_l33[iState] - _l13[iState]*_l13[iState];
-      const CFreal linv33 = _l11[iState]*_l22[iState] - _l12[iState]*_l12[iState];
-      const CFreal linv12 = -(_l12[iState]*_l33[iState] - _l13[iState]*_l23[iState]);
-      const CFreal linv13 = _l12[iState]*_l23[iState] - _l13[iState]*_l22[iState];
-      const CFreal linv23 = -(_l11[iState]*_l23[iState] - _l13[iState]*_l12[iState]);
-
-      // A cure to the singularites in calculating the determinant
-      if (!MathChecks::isZero(det)) {
-	uX(iState,iVar,nbEquations) = (linv11*_lf1[iState] +
-				       linv12*_lf2[iState] +
-				       linv13*_lf3[iState])/det;
-	uY(iState,iVar,nbEquations) = (linv12*_lf1[iState] +
-				       linv22*_lf2[iState] +
-				       linv23*_lf3[iState])/det;
-	uZ(iState,iVar,nbEquations) = (linv13*_lf1[iState] +
-				       linv23*_lf2[iState] +
-				       linv33*_lf3[iState])/det;
-	
-	// if (std::abs(_uX(iState,iVar,nbEquations)) > 0.) CFout << "ux = " << _uX(iState,iVar,nbEquations) << "\n";
-	// if (std::abs(_uY(iState,iVar,nbEquations)) > 0.) CFout << "uy = " << _uY(iState,iVar,nbEquations) << "\n";
-	// if (std::abs(_uZ(iState,iVar,nbEquations)) > 0.) CFout << "uz = " << _uZ(iState,iVar,nbEquations) << "\n";
-      }
-      else {
-	uX(iState,iVar,nbEquations) = 0.0;
-	uY(iState,iVar,nbEquations) = 0.0;
-	uZ(iState,iVar,nbEquations) = 0.0;
+  // first pass: count the stencil entries of each state, taking into account
+  // that each edge (first,last) with last > first contributes to both states
+  m_rowStart.assign(nbStates + 1, 0);
+  for(CFuint iState = 0; iState < nbStates; ++iState) {
+    const CFuint firstID = states[iState]->getLocalID();
+    const CFuint stencilSize = stencil[iState].size();
+    for(CFuint in = 0; in < stencilSize; ++in) {
+      const State* const last = stencil[iState][in];
+      const CFuint lastID = (!last->isGhost()) ? last->getLocalID() :
+	numeric_limits<CFuint>::max();
+      if (lastID > firstID) {
+	++m_rowStart[firstID+1];
+	if (!last->isGhost()) {
+	  ++m_rowStart[lastID+1];
+	}
       }
+    }
+  }
+  for(CFuint iState = 0; iState < nbStates; ++iState) {
+    m_rowStart[iState+1] += m_rowStart[iState];
+  }
+
+  const CFuint nbEntries = m_rowStart[nbStates];
+  m_neighbors.resize(nbEntries);
+  m_coefficients.resize(nbEntries*DIM_3D);
+
+  // the inverse of the (symmetric) least square matrix of each state
+  vector<CFreal> linv(nbStates*6, 0.0);
+  for(CFuint iState = 0; iState < nbStates; ++iState) {
+    const CFreal det = _l11[iState]*_l22[iState]*_l33[iState]
+      - _l11[iState]*_l23[iState]*_l23[iState]
+      - _l12[iState]*_l12[iState]*_l33[iState]
+      + _l12[iState]*_l13[iState]*_l23[iState]
+      + _l13[iState]*_l12[iState]*_l23[iState]
+      - _l13[iState]*_l13[iState]*_l22[iState];
+
+    if (!(std::abs(det) > MathTools::MathConsts::CFrealEps())) {
+      CFLog(WARN, "LeastSquareP1PolyRec3D::computeStencilCoefficients() => det is zero for state "
+	    << iState << "\n");
+    }
 
-      CFLogDebugMed( "det = " << det
-		     << ", l11 = " << _l11[iState]
-		     << ", l12 = " << _l12[iState]
-		     << ", l13 = " << _l13[iState]
-		     << ", l22 = " << _l22[iState]
-		     << ", l23 = " << _l23[iState]
-		     << ", l33 = " << _l33[iState]
-		     <<", lf1 = " << _lf1[iState]
-		     <<", lf2 = " << _lf2[iState]
-		     <<", lf3 = " << _lf3[iState]
-		     << ", uX =" << uX(iState,iVar,nbEquations)
-		     << ", uY =" << uY(iState,iVar,nbEquations)
-		     << ", uZ =" << uZ(iState,iVar,nbEquations)
-		     << "\n");
+    // A cure to the singularites in calculating the determinant:
+    // null coefficients give null gradients
+    if (!MathChecks::isZero(det)) {
+      const CFreal invDet = 1./det;
+      CFreal *const li = &linv[iState*6];
+      li[0] = (_l22[iState]*_l33[iState] - _l23[iState]*_l23[iState])*invDet;
+      li[1] = -(_l12[iState]*_l33[iState] - _l13[iState]*_l23[iState])*invDet;
+      li[2] = (_l12[iState]*_l23[iState] - _l13[iState]*_l22[iState])*invDet;
+      li[3] = (_l11[iState]*_l33[iState] - _l13[iState]*_l13[iState])*invDet;
+      li[4] = -(_l11[iState]*_l23[iState] - _l13[iState]*_l12[iState])*invDet;
+      li[5] = (_l11[iState]*_l22[iState] - _l12[iState]*_l12[iState])*invDet;
     }
   }
-  
-  
-  ///// TEST
-  // CFuint idxr = 0;
-  // for (CFuint cellID = 0; cellID < 5000; ++cellID) {
-  //   for (CFuint i = 0; i < 9; ++i, ++idxr) {
-  //     cout << "cellID["<< cellID << "], "<< i << " => UX (";
-  //     cout.precision(12); cout << uX[idxr] << ", " << uY[idxr] << ", " << uZ[idxr] << ")\n";
-  //   }
-  // }
-  // abort();
-  ////
-  
+
+  // second pass: store neighbors and geometric coefficients row by row
+  // (same edge traversal order as the one used for the weights)
+  vector<CFuint> fill(m_rowStart.begin(), m_rowStart.end() - 1);
+  CFuint iEdge = 0;
+  for(CFuint iState = 0; iState < nbStates; ++iState) {
+    State* const first = states[iState];
+    const CFuint firstID = first->getLocalID();
+    const CFuint stencilSize = stencil[iState].size();
+    for(CFuint in = 0; in < stencilSize; ++in) {
+      State* const last = stencil[iState][in];
+      const CFuint lastID = (!last->isGhost()) ? last->getLocalID() :
+	numeric_limits<CFuint>::max();
+      if (lastID > firstID) {
+	const RealVector& nodeFirst = first->getCoordinates();
+	const RealVector& nodeLast = last->getCoordinates();
+	const CFreal w2 = weights[iEdge]*weights[iEdge];
+	const CFreal dx = w2*(nodeLast[XX] - nodeFirst[XX]);
+	const CFreal dy = w2*(nodeLast[YY] - nodeFirst[YY]);
+	const CFreal dz = w2*(nodeLast[ZZ] - nodeFirst[ZZ]);
+
+	// for the first state, du = u_last - u_first
+	setStencilEntry(fill[firstID]++, last, &linv[firstID*6], dx, dy, dz);
+
+	// for the last state both dr and du change sign and their product doesn't
+	if (!last->isGhost()) {
+	  setStencilEntry(fill[lastID]++, first, &linv[lastID*6], -dx, -dy, -dz);
+	}
+	++iEdge;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LeastSquareP1PolyRec3D::setStencilEntry(const CFuint iEntry,
+					     const State* const neighbor,
+					     const CFreal* const linv,
+					     const CFreal dx,
+					     const CFreal dy,
+					     const CFreal dz)
+{
+  m_neighbors[iEntry] = neighbor;
+  CFreal *const coeff = &m_coefficients[iEntry*DIM_3D];
+  coeff[XX] = linv[0]*dx + linv[1]*dy + linv[2]*dz;
+  coeff[YY] = linv[1]*dx + linv[3]*dy + linv[4]*dz;
+  coeff[ZZ] = linv[2]*dx + linv[4]*dy + linv[5]*dz;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -339,10 +366,6 @@ void LeastSquareP1PolyRec3D::updateWeights()
   _l23 = 0.0;
   _l33 = 0.0;
 
-  _lf1 = 0.0;
-  _lf2 = 0.0;
-  _lf3 = 0.0;
-
   // weight coefficients are calculated
   // weight coefficients are calculated
   CFuint iEdge = 0;
@@ -398,6 +421,8 @@ void LeastSquareP1PolyRec3D::updateWeights()
       }
     }
   }
+  
+  computeStencilCoefficients();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -419,10 +444,6 @@ void LeastSquareP1PolyRec3D::setup()
   _l23.resize(nbStates);
   _l33.resize(nbStates);
 
-  _lf1.resize(nbStates);
-  _lf2.resize(nbStates);
-  _lf3.resize(nbStates);
-
   _l11 = 0.0;
   _l12 = 0.0;
   _l13 = 0.0;
@@ -430,10 +451,6 @@ void LeastSquareP1PolyRec3D::setup()
   _l23 = 0.0;
   _l33 = 0.0;
 
-  _lf1 = 0.0;
-  _lf2 = 0.0;
-  _lf3 = 0.0;
-
   // weight coefficients are calculated
   // weight coefficients are calculated
   CFuint iEdge = 0;
@@ -487,6 +504,8 @@ void LeastSquareP1PolyRec3D::setup()
       }
     }
   }
+  
+  computeStencilCoefficients();
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -168,6 +168,25 @@ public:
    */
   virtual void updateWeights();
 
+protected:
+
+  /**
+   * Precompute in CSR format the geometric least square coefficients
+   * of each state, so that gradients only require a gather over the stencil
+   * @pre the weights and the least square matrices have been computed
+   */
+  void computeStencilCoefficients();
+
+  /**
+   * Set the CSR entry @p iEntry for the given neighbor and geometric terms
+   */
+  void setStencilEntry(const CFuint iEntry,
+		       const Framework::State* const neighbor,
+		       const CFreal* const linv,
+		       const CFreal dx,
+		       const CFreal dy,
+		       const CFreal dz);
+
 protected:
 
   /**
@@ -210,11 +229,14 @@ protected:
 
   RealVector  _l33;
 
-  RealVector  _lf1;
+  /// start of the stencil entries of each state (CSR row offsets)
+  std::vector<CFuint> m_rowStart;
 
-  RealVector  _lf2;
+  /// neighbor state of each stencil entry
+  std::vector<const Framework::State*> m_neighbors;
 
-  RealVector  _lf3;
+  /// gradient coefficients (x,y,z) of each stencil entry
+  std::vector<CFreal> m_coefficients;
 
 }; // end of class LeastSquareP1PolyRec3D
 
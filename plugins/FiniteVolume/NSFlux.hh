@@ -3,6 +3,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <limits>
+
 #include "FiniteVolume/ComputeDiffusiveFlux.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -86,6 +88,41 @@ protected: //helper functions
     _diffVar->setWallDistance(distance);
   }
   
+  /**
+   * Compute and store the gradient operators of all the inner faces at once
+   */
+  void computeGradientOperators();
+  
+  /**
+   * Tell if the gradient operator of the given face is stored (inner faces
+   * only, the ones of the boundary faces are recomputed at each visit)
+   */
+  bool hasStoredOperator(const CFuint faceID) const
+  {
+    return _useGradientOperator && 
+      _opStart[faceID] != std::numeric_limits<CFuint>::max();
+  }
+  
+  /**
+   * Set the control volume states of the current face from the stored
+   * gradient operator
+   */
+  void setStoredControlVolume(Framework::GeometricEntity& geo);
+  
+  /**
+   * Recompute the geometry of the control volume of the current face in the
+   * derivative computer, which is not updated when the stored gradient
+   * operator is used: this must be called before getGradientsJacob() or
+   * getControlVolume() are requested to the derivative computer
+   */
+  void refreshControlVolume(Framework::GeometricEntity& geo);
+  
+  /**
+   * Compute the gradients of all the variables in the current face
+   * applying the stored gradient operator to the control volume values
+   */
+  void applyStoredGradientOperator(const CFuint faceID);
+  
 protected: // data
   
   /// socket for the wallDistance storage
@@ -127,6 +164,30 @@ protected: // data
   /// flag telling if the radius is needed
   bool _isRadiusNeeded;
   
+  /// flag telling to store the face gradient operators (non-moving meshes only)
+  bool _storeGradientOperator;
+  
+  /// flag telling if the stored face gradient operators are actually in use
+  bool _useGradientOperator;
+  
+  /// start of the stored gradient operator entries for each face
+  std::vector<CFuint> _opStart;
+  
+  /// number of control volume states for each face
+  std::vector<CFuint> _opNbCVStates;
+  
+  /// control volume for each face
+  std::vector<CFreal> _opVolume;
+  
+  /// control volume state of each stored gradient operator entry
+  std::vector<RealVector*> _opStates;
+  
+  /// gradient weights (dim per entry) of each stored gradient operator entry
+  std::vector<CFreal> _opWeights;
+  
+  /// gradient operator of the current face
+  RealMatrix _opFace;
+  
 }; // end of class NSFlux
 
 //////////////////////////////////////////////////////////////////////////////
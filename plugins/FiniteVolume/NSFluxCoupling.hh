@@ -36,6 +36,12 @@ public:
    */
   virtual ~NSFluxCoupling();
   
+  /**
+   * Set up private data and data of the aggregated classes
+   * in this object
+   */
+  virtual void setup();
+  
   /**
     * Compute the flux in the current face
     */
@@ -45,6 +45,12 @@ class ICPplasmaFieldComputingBC : public BASE {
 
 public: 
   
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+  
   /**
    * Constructor
    */
@@ -88,6 +94,27 @@ private:
   CFreal ellipticIntegralSecondKind(CFreal const& k);
   CFreal ellipticIntegralCombined(CFreal const& k);
   
+  /**
+   * Compute the geometric coupling between the local ghost states and
+   * the updatable cells of all the processors
+   */
+  void computeKernel();
+  
+  /**
+   * Tell if the ghost states have been moved since the kernel was computed
+   */
+  bool ghostStatesHaveMoved();
+  
+  /**
+   * Gather on all the processors the data of the updatable cells
+   * @param localData  data of the local updatable cells
+   * @param stride     number of entries per cell
+   * @param allData    data of the updatable cells of all the processors,
+   *                   ordered by processor
+   */
+  void gatherOnAllProcs(std::vector<CFreal>& localData, const CFuint stride,
+			std::vector<CFreal>& allData);
+  
 private: //data
 
   /// storage of volumes
@@ -127,6 +154,25 @@ private: //data
   /// number of states in processor
   std::vector<CFuint> m_nbStatesInProc;
   
+  /// flag telling to store the geometric coupling instead of recomputing it
+  bool m_cacheKernel;
+  
+  /// flag telling if m_kernel has been computed
+  bool m_kernelIsBuilt;
+  
+  /// geometric coupling sqrt(r/r')*ellipticIntegralCombined(k) between each
+  /// local ghost state (row) and each updatable cell of all processors (column)
+  std::vector<CFreal> m_kernel;
+  
+  /// centroids of the updatable cells of all processors
+  std::vector<CFreal> m_allCellCoords;
+  
+  /// coordinates (r and z) of the ghost states used to compute m_kernel
+  std::vector<CFreal> m_kernelGhostCoords;
+  
+  /// currents (Re and Im parts) of the updatable cells of all processors
+  std::vector<CFreal> m_allCurrents;
+  
 }; // end of class ICPplasmaFieldComputingBC
 
 //////////////////////////////////////////////////////////////////////////////
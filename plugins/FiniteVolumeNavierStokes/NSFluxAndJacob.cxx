@@ -58,8 +58,14 @@ void NSFluxAndJacob::computeFlux(RealVector& result)
     // this check is not needed
     // set the state values (pointers) corresponding to the
     // vertices of the control volume
-    derivComputer->computeControlVolume(_states, &geo);
-    _nbCVStates = derivComputer->getNbVerticesInControlVolume(&geo);
+    const bool useStoredOperator = hasStoredOperator(geo.getID());
+    if (useStoredOperator) {
+      setStoredControlVolume(geo);
+    }
+    else {
+      derivComputer->computeControlVolume(_states, &geo);
+      _nbCVStates = derivComputer->getNbVerticesInControlVolume(&geo);
+    }
     
     _radius = 0.0;
     if (getMethodData().isAxisymmetric() || _isRadiusNeeded) {
@@ -74,7 +80,12 @@ void NSFluxAndJacob::computeFlux(RealVector& result)
     _diffVar->setGradientVars(_states, _values, _nbCVStates);
     
     // compute control volume around the face and gradients
-    derivComputer->computeGradients(&geo, _values, _gradients);
+    if (useStoredOperator) {
+      applyStoredGradientOperator(geo.getID());
+    }
+    else {
+      derivComputer->computeGradients(&geo, _values, _gradients);
+    }
     
     // compute the average values
     derivComputer->computeAverageValues(&geo, _states, _avState);
@@ -90,7 +101,8 @@ void NSFluxAndJacob::computeFlux(RealVector& result)
     // flux and its jacobian and flux are computed together
     const CFreal mu    = _diffVar->getCurrDynViscosity();
     const CFreal avRho = _diffVar->getDensity(_avState);
-    const CFreal cvVolume = derivComputer->getControlVolume();
+    const CFreal cvVolume = (useStoredOperator) ? 
+      _opVolume[geo.getID()] : derivComputer->getControlVolume();
     const CFreal diffUpdateCoeff = mu*faceArea*faceArea/(avRho*cvVolume);
 
     DataHandle<CFreal> updateCoeff = this->socket_updateCoeff.getDataHandle();
@@ -104,6 +116,7 @@ void NSFluxAndJacob::computeFlux(RealVector& result)
     }
     
     // jacobian computation
+    refreshControlVolume(geo);
     SafePtr<vector<RealVector> > gradientsJacob = derivComputer->getGradientsJacob();
     RealVector& leftGradJacob  = (*gradientsJacob)[0];
     RealVector& rightGradJacob = (*gradientsJacob)[1];
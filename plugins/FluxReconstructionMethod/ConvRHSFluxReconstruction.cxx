@@ -83,9 +83,23 @@ ConvRHSFluxReconstruction::ConvRHSFluxReconstruction(const std::string& name) :
   m_nbrSolPnts(),
   m_gradUpdates(),
   m_nbrFaceFlxPnts(),
-  m_extrapolatedFluxes()
+  m_extrapolatedFluxes(),
+  m_useTensorKernels(false),
+  m_solPntIdxsAtFlxPnts(CFNULL),
+  m_solPolyValsAtFlxPntsTensor(CFNULL),
+  m_solPntIdxsDerivAtSolPnts(CFNULL),
+  m_solPolyDerivAtSolPntsTensor(CFNULL),
+  m_cellBatchSize(),
+  m_nbrCellsInBatch(0),
+  m_batchDivOperators(),
+  m_batchFluxes(),
+  m_batchResiduals(),
+  m_batchStateIDs()
   {
     addConfigOptionsTo(this);
+    
+    m_cellBatchSize = 0;
+    setParameter("CellBatchSize",&m_cellBatchSize);
   }
   
   
@@ -93,6 +107,7 @@ ConvRHSFluxReconstruction::ConvRHSFluxReconstruction(const std::string& name) :
 
 void ConvRHSFluxReconstruction::defineConfigOptions(Config::OptionList& options)
 {
+  options.addConfigOption< CFuint >("CellBatchSize","Number of cells whose residuals are computed together as matrix-matrix products (0 for cell by cell).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -252,7 +267,17 @@ void ConvRHSFluxReconstruction::execute()
       }
       
       // if the states in the cell are parallel updatable, compute the divergence of the discontinuous flx (-divFD+divhFD)
-      if ((*m_cellStates)[0]->isParUpdatable())
+      if ((*m_cellStates)[0]->isParUpdatable() && m_cellBatchSize > 0)
+      {
+	// store the discontinuous flux, the divergence is computed for the whole batch
+	addCellToBatch();
+	
+	if (m_nbrCellsInBatch == m_cellBatchSize)
+	{
+	  computeBatchResiduals();
+	}
+      }
+      else if ((*m_cellStates)[0]->isParUpdatable())
       {
 	// compute the divergence of the discontinuous flux (-divFD+divhFD)
 	computeDivDiscontFlx(m_divContFlx);
@@ -313,6 +338,12 @@ void ConvRHSFluxReconstruction::execute()
       //release the GeometricEntity
       m_cellBuilder->releaseGE();
     }
+    
+    // compute the residuals of the remaining cells in the batch
+    if (m_nbrCellsInBatch > 0)
+    {
+      computeBatchResiduals();
+    }
   }
   ///@warning set rhs to zero for plotting stuff 
   //DataHandle< CFreal > rhs = socket_rhs.getDataHandle();
@@ -385,11 +416,30 @@ void ConvRHSFluxReconstruction::computeFlxPntStates()
     *(m_cellStatesFlxPnt[RIGHT][iFlxPnt]) = 0.0;
 
     // extrapolate the left and right states to the flx pnts
-    for (CFuint iSol = 0; iSol < m_nbrSolPnts; ++iSol)
+    if (m_useTensorKernels)
     {
-      // add the contributions of the current sol pnt
-      *(m_cellStatesFlxPnt[LEFT][iFlxPnt]) += (*m_solPolyValsAtFlxPnts)[flxPntIdxL][iSol]*(*((*(m_states[LEFT]))[iSol]));
-      *(m_cellStatesFlxPnt[RIGHT][iFlxPnt]) += (*m_solPolyValsAtFlxPnts)[flxPntIdxR][iSol]*(*((*(m_states[RIGHT]))[iSol]));
+      const vector< CFuint >& solPntIdxsL = (*m_solPntIdxsAtFlxPnts)[flxPntIdxL];
+      const vector< CFreal >& coefsL = (*m_solPolyValsAtFlxPntsTensor)[flxPntIdxL];
+      for (CFuint iSol = 0; iSol < solPntIdxsL.size(); ++iSol)
+      {
+        *(m_cellStatesFlxPnt[LEFT][iFlxPnt]) += coefsL[iSol]*(*((*(m_states[LEFT]))[solPntIdxsL[iSol]]));
+      }
+
+      const vector< CFuint >& solPntIdxsR = (*m_solPntIdxsAtFlxPnts)[flxPntIdxR];
+      const vector< CFreal >& coefsR = (*m_solPolyValsAtFlxPntsTensor)[flxPntIdxR];
+      for (CFuint iSol = 0; iSol < solPntIdxsR.size(); ++iSol)
+      {
+        *(m_cellStatesFlxPnt[RIGHT][iFlxPnt]) += coefsR[iSol]*(*((*(m_states[RIGHT]))[solPntIdxsR[iSol]]));
+      }
+    }
+    else
+    {
+      for (CFuint iSol = 0; iSol < m_nbrSolPnts; ++iSol)
+      {
+        // add the contributions of the current sol pnt
+        *(m_cellStatesFlxPnt[LEFT][iFlxPnt]) += (*m_solPolyValsAtFlxPnts)[flxPntIdxL][iSol]*(*((*(m_states[LEFT]))[iSol]));
+        *(m_cellStatesFlxPnt[RIGHT][iFlxPnt]) += (*m_solPolyValsAtFlxPnts)[flxPntIdxR][iSol]*(*((*(m_states[RIGHT]))[iSol]));
+      }
     }
   }
 }
@@ -427,10 +477,28 @@ void ConvRHSFluxReconstruction::computeDivDiscontFlx(vector< RealVector >& resid
     }
     
     // extrapolate the fluxes to the flux points
+    if (!m_useTensorKernels)
+    {
+      for (CFuint iFlxPnt = 0; iFlxPnt < m_flxPntsLocalCoords->size(); ++iFlxPnt)
+      {
+        CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
+        m_extrapolatedFluxes[iFlxPnt] += (*m_solPolyValsAtFlxPnts)[iFlxPnt][iSolPnt]*(m_contFlx[iSolPnt][dim]);
+      }
+    }
+  }
+
+  // extrapolate the fluxes to the flux points, using only the sol pnts on the line normal to the face
+  if (m_useTensorKernels)
+  {
     for (CFuint iFlxPnt = 0; iFlxPnt < m_flxPntsLocalCoords->size(); ++iFlxPnt)
     {
-      CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
-      m_extrapolatedFluxes[iFlxPnt] += (*m_solPolyValsAtFlxPnts)[iFlxPnt][iSolPnt]*(m_contFlx[iSolPnt][dim]);
+      const CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
+      const vector< CFuint >& solPntIdxs = (*m_solPntIdxsAtFlxPnts)[iFlxPnt];
+      const vector< CFreal >& coefs = (*m_solPolyValsAtFlxPntsTensor)[iFlxPnt];
+      for (CFuint iSol = 0; iSol < solPntIdxs.size(); ++iSol)
+      {
+        m_extrapolatedFluxes[iFlxPnt] += coefs[iSol]*(m_contFlx[solPntIdxs[iSol]][dim]);
+      }
     }
   }
 
@@ -440,23 +508,51 @@ void ConvRHSFluxReconstruction::computeDivDiscontFlx(vector< RealVector >& resid
     // reset the divergence of FC
     residuals[iSolPnt] = 0.0;
     
-    // Loop over solution pnts to count the factor of all sol pnt polys
-    for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+    if (m_useTensorKernels)
     {
-      // Loop over deriv directions and sum them to compute divergence
+      // Loop over deriv directions, only the sol pnts on the line in that direction contribute
       for (CFuint iDir = 0; iDir < m_dim; ++iDir)
       {
-        // Loop over conservative fluxes 
-        for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+        const vector< CFuint >& solPntIdxs = (*m_solPntIdxsDerivAtSolPnts)[iSolPnt][iDir];
+        const vector< CFreal >& coefs = (*m_solPolyDerivAtSolPntsTensor)[iSolPnt][iDir];
+        for (CFuint jSol = 0; jSol < solPntIdxs.size(); ++jSol)
         {
-          // Store divFD in the vector that will be divFC
-          residuals[iSolPnt][iEq] -= (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*(m_contFlx[jSolPnt][iDir][iEq]);
-       
-	  if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+          const RealVector& contFlx = m_contFlx[solPntIdxs[jSol]][iDir];
+          for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+          {
+            residuals[iSolPnt][iEq] -= coefs[jSol]*contFlx[iEq];
+          }
+        }
+      }
+
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+        {
+          residuals[iSolPnt][iEq] = 0.0;
+        }
+      }
+    }
+    else
+    {
+      // Loop over solution pnts to count the factor of all sol pnt polys
+      for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+      {
+        // Loop over deriv directions and sum them to compute divergence
+        for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+        {
+          // Loop over conservative fluxes 
+          for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
           {
-            residuals[iSolPnt][iEq] = 0.0;
+            // Store divFD in the vector that will be divFC
+            residuals[iSolPnt][iEq] -= (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*(m_contFlx[jSolPnt][iDir][iEq]);
+       
+	    if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+            {
+              residuals[iSolPnt][iEq] = 0.0;
+	    }
 	  }
-	}
+        }
       }
     }
     
@@ -681,31 +777,68 @@ void ConvRHSFluxReconstruction::computeGradientFaceCorrections()
 
 void ConvRHSFluxReconstruction::computeGradients()
 {        
-  // Loop over solution pnts to calculate the grad updates
-  for (CFuint iSolPnt = 0; iSolPnt < m_nbrSolPnts; ++iSolPnt)
+  if (m_useTensorKernels)
   {
-    // Loop over  variables
-    for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+    // Loop over solution pnts to calculate the grad updates
+    for (CFuint iSolPnt = 0; iSolPnt < m_nbrSolPnts; ++iSolPnt)
     {
-      // set the grad updates to 0 
-      m_gradUpdates[0][iSolPnt][iEq] = 0.0;
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        RealVector& gradUpdate = m_gradUpdates[0][iSolPnt][iEq];
+        gradUpdate = 0.0;
 
-      // Loop over gradient directions
-      for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+        // only the sol pnts on the line in each direction contribute
+        for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+        {
+          const vector< CFuint >& solPntIdxs = (*m_solPntIdxsDerivAtSolPnts)[iSolPnt][iDir];
+          const vector< CFreal >& coefs = (*m_solPolyDerivAtSolPntsTensor)[iSolPnt][iDir];
+          for (CFuint jSol = 0; jSol < solPntIdxs.size(); ++jSol)
+          {
+            const CFuint jSolPnt = solPntIdxs[jSol];
+            const CFreal factor = coefs[jSol]*((*(*m_cellStates)[jSolPnt])[iEq]);
+            const RealVector& projVect = m_cellFluxProjVects[iDir][jSolPnt];
+            for (CFuint jDir = 0; jDir < m_dim; ++jDir)
+            {
+              gradUpdate[jDir] += factor*projVect[jDir];
+            }
+          }
+
+          if (fabs(gradUpdate[iDir]) < MathTools::MathConsts::CFrealEps())
+          {
+            gradUpdate[iDir] = 0.0;
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    // Loop over solution pnts to calculate the grad updates
+    for (CFuint iSolPnt = 0; iSolPnt < m_nbrSolPnts; ++iSolPnt)
+    {
+      // Loop over  variables
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
       {
-        // Loop over solution pnts to count factor of all sol pnt polys
-        for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+        // set the grad updates to 0 
+        m_gradUpdates[0][iSolPnt][iEq] = 0.0;
+
+        // Loop over gradient directions
+        for (CFuint iDir = 0; iDir < m_dim; ++iDir)
         {
-	  const RealVector projectedState = ((*(*m_cellStates)[jSolPnt])[iEq]) * m_cellFluxProjVects[iDir][jSolPnt];
+          // Loop over solution pnts to count factor of all sol pnt polys
+          for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+          {
+	    const RealVector projectedState = ((*(*m_cellStates)[jSolPnt])[iEq]) * m_cellFluxProjVects[iDir][jSolPnt];
 	  
-          // compute the grad updates
-          m_gradUpdates[0][iSolPnt][iEq] += (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*projectedState;
+            // compute the grad updates
+            m_gradUpdates[0][iSolPnt][iEq] += (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*projectedState;
        
-	  if (fabs(m_gradUpdates[0][iSolPnt][iEq][iDir]) < MathTools::MathConsts::CFrealEps())
-          {
-            m_gradUpdates[0][iSolPnt][iEq][iDir] = 0.0;
+	    if (fabs(m_gradUpdates[0][iSolPnt][iEq][iDir]) < MathTools::MathConsts::CFrealEps())
+            {
+              m_gradUpdates[0][iSolPnt][iEq][iDir] = 0.0;
+	    }
 	  }
-	}
+        }
       }
     }
   }
@@ -807,6 +940,13 @@ void ConvRHSFluxReconstruction::setup()
   
   // get the coefs for derivation of the states in the sol pnts
   m_solPolyDerivAtSolPnts = frLocalData[0]->getCoefSolPolyDerivInSolPnts();
+
+  // get the tensor product kernels, if available for this element type
+  m_useTensorKernels = frLocalData[0]->hasTensorProductKernels();
+  m_solPntIdxsAtFlxPnts = frLocalData[0]->getSolPntIdxsSolPolyInFlxPnts();
+  m_solPolyValsAtFlxPntsTensor = frLocalData[0]->getCoefSolPolyInFlxPntsTensor();
+  m_solPntIdxsDerivAtSolPnts = frLocalData[0]->getSolPntIdxsSolPolyDerivInSolPnts();
+  m_solPolyDerivAtSolPntsTensor = frLocalData[0]->getCoefSolPolyDerivInSolPntsTensor();
   
   // get the dimension on which to project the flux in a flux point
   m_flxPntFlxDim = frLocalData[0]->getFluxPntFluxDim();
@@ -899,6 +1039,166 @@ void ConvRHSFluxReconstruction::setup()
   // compute the divergence of the correction function
   m_corrFctComputer->computeDivCorrectionFunction(frLocalData[0],m_corrFctDiv);
   
+  if (m_cellBatchSize > 0)
+  {
+    setupBatchedOperators();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ConvRHSFluxReconstruction::setupBatchedOperators()
+{
+  CFAUTOTRACE;
+  
+  const CFuint nbrFlxPnts = m_flxPntsLocalCoords->size();
+  
+  // -divFD+divhFD = sum over directions of (-D + C*E) F, where D are the derivative
+  // coefficients, E the extrapolation coefficients of the flx pnts projecting the
+  // flux in that direction and C the divergence of the correction functions
+  m_batchDivOperators.resize(m_dim);
+  for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+  {
+    RealMatrix& op = m_batchDivOperators[iDir];
+    op.resize(m_nbrSolPnts,m_nbrSolPnts);
+    
+    CFreal maxCoef = 0.0;
+    for (CFuint iSol = 0; iSol < m_nbrSolPnts; ++iSol)
+    {
+      for (CFuint jSol = 0; jSol < m_nbrSolPnts; ++jSol)
+      {
+        CFreal coef = -(*m_solPolyDerivAtSolPnts)[iSol][iDir][jSol];
+        for (CFuint iFlxPnt = 0; iFlxPnt < nbrFlxPnts; ++iFlxPnt)
+        {
+          const CFreal divh = m_corrFctDiv[iSol][iFlxPnt];
+          if ((*m_flxPntFlxDim)[iFlxPnt] == iDir && fabs(divh) > MathTools::MathConsts::CFrealEps())
+          {
+            coef += divh*(*m_solPolyValsAtFlxPnts)[iFlxPnt][jSol];
+          }
+        }
+        op(iSol,jSol) = coef;
+        maxCoef = std::max(maxCoef, fabs(coef));
+      }
+    }
+    
+    // remove the round-off entries, so that the sparsity of tensor product elements is exploited
+    for (CFuint iSol = 0; iSol < m_nbrSolPnts; ++iSol)
+    {
+      for (CFuint jSol = 0; jSol < m_nbrSolPnts; ++jSol)
+      {
+        if (fabs(op(iSol,jSol)) < 1e-12*maxCoef)
+        {
+          op(iSol,jSol) = 0.0;
+        }
+      }
+    }
+  }
+  
+  const CFuint nbrCols = m_cellBatchSize*m_nbrEqs;
+  m_batchFluxes.resize(m_dim);
+  for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+  {
+    m_batchFluxes[iDir].resize(m_nbrSolPnts*nbrCols);
+  }
+  m_batchResiduals.resize(m_nbrSolPnts*nbrCols);
+  m_batchStateIDs.resize(m_cellBatchSize*m_nbrSolPnts);
+  m_nbrCellsInBatch = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ConvRHSFluxReconstruction::addCellToBatch()
+{
+  cf_assert(m_nbrCellsInBatch < m_cellBatchSize);
+  
+  const CFuint nbrCols = m_cellBatchSize*m_nbrEqs;
+  const CFuint firstCol = m_nbrCellsInBatch*m_nbrEqs;
+  
+  for (CFuint iSolPnt = 0; iSolPnt < m_nbrSolPnts; ++iSolPnt)
+  {
+    // dereference the state
+    State& stateSolPnt = *(*m_cellStates)[iSolPnt];
+    m_batchStateIDs[m_nbrCellsInBatch*m_nbrSolPnts + iSolPnt] = stateSolPnt.getLocalID();
+    
+    m_updateVarSet->computePhysicalData(stateSolPnt, m_pData);
+
+    // calculate the discontinuous flux projected on x, y, z-directions
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim)
+    {
+      const RealVector& flux = m_updateVarSet->getFlux()(m_pData,m_cellFluxProjVects[iDim][iSolPnt]);
+      CFreal* batchFlux = &m_batchFluxes[iDim][iSolPnt*nbrCols + firstCol];
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        batchFlux[iEq] = flux[iEq];
+      }
+    }
+  }
+  
+  ++m_nbrCellsInBatch;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ConvRHSFluxReconstruction::computeBatchResiduals()
+{
+  const CFuint nbrCols = m_cellBatchSize*m_nbrEqs;
+  const CFuint nbrUsedCols = m_nbrCellsInBatch*m_nbrEqs;
+  const CFint nbrSolPnts = m_nbrSolPnts;
+  
+  // residuals = sum over directions of op*fluxes, the rows are independent
+#ifdef CF_HAVE_OMP
+  #pragma omp parallel for if (nbrUsedCols > 4096)
+#endif
+  for (CFint iSolPnt = 0; iSolPnt < nbrSolPnts; ++iSolPnt)
+  {
+    CFreal* res = &m_batchResiduals[iSolPnt*nbrCols];
+    for (CFuint iCol = 0; iCol < nbrUsedCols; ++iCol)
+    {
+      res[iCol] = 0.0;
+    }
+    
+    for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+    {
+      const RealMatrix& op = m_batchDivOperators[iDir];
+      for (CFint jSolPnt = 0; jSolPnt < nbrSolPnts; ++jSolPnt)
+      {
+        const CFreal coef = op(iSolPnt,jSolPnt);
+        if (coef != 0.0)
+        {
+          const CFreal* flux = &m_batchFluxes[iDir][jSolPnt*nbrCols];
+          for (CFuint iCol = 0; iCol < nbrUsedCols; ++iCol)
+          {
+            res[iCol] += coef*flux[iCol];
+          }
+        }
+      }
+    }
+  }
+  
+  // get the datahandle of the rhs
+  DataHandle< CFreal > rhs = socket_rhs.getDataHandle();
+
+  // get residual factor
+  const CFreal resFactor = getMethodData().getResFactor();
+  
+  // update rhs
+  for (CFuint iCell = 0; iCell < m_nbrCellsInBatch; ++iCell)
+  {
+    for (CFuint iSolPnt = 0; iSolPnt < m_nbrSolPnts; ++iSolPnt)
+    {
+      const CFuint resID = m_nbrEqs*m_batchStateIDs[iCell*m_nbrSolPnts + iSolPnt];
+      const CFreal* res = &m_batchResiduals[iSolPnt*nbrCols + iCell*m_nbrEqs];
+      for (CFuint iVar = 0; iVar < m_nbrEqs; ++iVar)
+      {
+        if (fabs(res[iVar]) >= MathTools::MathConsts::CFrealEps())
+        {
+          rhs[resID+iVar] += resFactor*res[iVar];
+        }
+      }
+    }
+  }
+  
+  m_nbrCellsInBatch = 0;
 }
 
 //////////////////////////////////////////////////////////////////////////////
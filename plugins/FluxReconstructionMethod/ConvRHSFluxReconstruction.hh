@@ -110,6 +110,25 @@ protected: //functions
   /// compute the volume term contribution to the gradients
   virtual void computeGradients();
   
+  /**
+   * Build the operators of the batched cell residual: for each direction,
+   * the matrix mapping the discontinuous flux in the sol pnts to
+   * -divFD+divhFD in the sol pnts
+   */
+  void setupBatchedOperators();
+  
+  /**
+   * Compute the discontinuous flux in the sol pnts of the current cell
+   * and store it in the batch buffers
+   */
+  void addCellToBatch();
+  
+  /**
+   * Compute the residuals of the cells in the batch as small matrix-matrix
+   * products and add them to the RHS
+   */
+  void computeBatchResiduals();
+  
   /// compute the face correction to the corrected gradients
   virtual void computeGradientFaceCorrections();
 
@@ -255,6 +274,39 @@ protected: //data
   
   /// the discontinuous flux extrapolated to the flux points
   std::vector< RealVector > m_extrapolatedFluxes;
+
+  /// true if the tensor product (sum-factorised) kernels are used
+  bool m_useTensorKernels;
+
+  /// sol pnts contributing to the extrapolation to each flx pnt (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< CFuint > > > m_solPntIdxsAtFlxPnts;
+
+  /// coefs to extrapolate the states to the flx pnts (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< CFreal > > > m_solPolyValsAtFlxPntsTensor;
+
+  /// sol pnts on the coordinate lines of each sol pnt (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< std::vector< CFuint > > > > m_solPntIdxsDerivAtSolPnts;
+
+  /// coefs to compute the derivative of the states in the sol pnts (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< std::vector< CFreal > > > > m_solPolyDerivAtSolPntsTensor;
+
+  /// number of cells whose residuals are computed together (0 for cell by cell)
+  CFuint m_cellBatchSize;
+
+  /// number of cells currently stored in the batch
+  CFuint m_nbrCellsInBatch;
+
+  /// for each direction, operator from the flux in the sol pnts to -divFD+divhFD
+  std::vector< RealMatrix > m_batchDivOperators;
+
+  /// for each direction, discontinuous fluxes of the batch, stored as [sol pnt][cell eq]
+  std::vector< std::vector< CFreal > > m_batchFluxes;
+
+  /// residuals of the batch, stored as [sol pnt][cell eq]
+  std::vector< CFreal > m_batchResiduals;
+
+  /// local IDs of the states of the cells in the batch
+  std::vector< CFuint > m_batchStateIDs;
   
   private:
 
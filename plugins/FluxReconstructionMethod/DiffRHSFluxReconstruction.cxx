@@ -92,7 +92,12 @@ DiffRHSFluxReconstruction::DiffRHSFluxReconstruction(const std::string& name) :
   m_freezeGrads(),
   m_extrapolatedFluxes(),
   m_avgSol(),
-  m_avgGrad()
+  m_avgGrad(),
+  m_useTensorKernels(false),
+  m_solPntIdxsAtFlxPnts(CFNULL),
+  m_solPolyValsAtFlxPntsTensor(CFNULL),
+  m_solPntIdxsDerivAtSolPnts(CFNULL),
+  m_solPolyDerivAtSolPntsTensor(CFNULL)
   {
     addConfigOptionsTo(this);
   }
@@ -439,10 +444,28 @@ void DiffRHSFluxReconstruction::computeDivDiscontFlx(vector< RealVector >& resid
       m_contFlx[iSolPnt][iDim] = m_diffusiveVarSet->getFlux(m_avgSol,grad,m_cellFluxProjVects[iDim][iSolPnt],0);
     }
 
+    if (!m_useTensorKernels)
+    {
+      for (CFuint iFlxPnt = 0; iFlxPnt < m_flxPntsLocalCoords->size(); ++iFlxPnt)
+      {
+        CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
+        m_extrapolatedFluxes[iFlxPnt] += (*m_solPolyValsAtFlxPnts)[iFlxPnt][iSolPnt]*(m_contFlx[iSolPnt][dim]);
+      }
+    }
+  }
+
+  // extrapolate the fluxes to the flux points, using only the sol pnts on the line normal to the face
+  if (m_useTensorKernels)
+  {
     for (CFuint iFlxPnt = 0; iFlxPnt < m_flxPntsLocalCoords->size(); ++iFlxPnt)
     {
-      CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
-      m_extrapolatedFluxes[iFlxPnt] += (*m_solPolyValsAtFlxPnts)[iFlxPnt][iSolPnt]*(m_contFlx[iSolPnt][dim]);
+      const CFuint dim = (*m_flxPntFlxDim)[iFlxPnt];
+      const vector< CFuint >& solPntIdxs = (*m_solPntIdxsAtFlxPnts)[iFlxPnt];
+      const vector< CFreal >& coefs = (*m_solPolyValsAtFlxPntsTensor)[iFlxPnt];
+      for (CFuint iSol = 0; iSol < solPntIdxs.size(); ++iSol)
+      {
+        m_extrapolatedFluxes[iFlxPnt] += coefs[iSol]*(m_contFlx[solPntIdxs[iSol]][dim]);
+      }
     }
   }
 
@@ -451,23 +474,52 @@ void DiffRHSFluxReconstruction::computeDivDiscontFlx(vector< RealVector >& resid
   {
     // reset the divergence of FC
     residuals[iSolPnt] = 0.0;
-    // Loop over solution pnt to count factor of all sol pnt polys
-    for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+    
+    if (m_useTensorKernels)
     {
-      // Loop over deriv directions and sum them to compute divergence
+      // Loop over deriv directions, only the sol pnts on the line in that direction contribute
       for (CFuint iDir = 0; iDir < m_dim; ++iDir)
       {
-        // Loop over conservative fluxes 
-        for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+        const vector< CFuint >& solPntIdxs = (*m_solPntIdxsDerivAtSolPnts)[iSolPnt][iDir];
+        const vector< CFreal >& coefs = (*m_solPolyDerivAtSolPntsTensor)[iSolPnt][iDir];
+        for (CFuint jSol = 0; jSol < solPntIdxs.size(); ++jSol)
         {
-          // Store divFD in the vector that will be divFC
-          residuals[iSolPnt][iEq] += (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*(m_contFlx[jSolPnt][iDir][iEq]);
+          const RealVector& contFlx = m_contFlx[solPntIdxs[jSol]][iDir];
+          for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+          {
+            residuals[iSolPnt][iEq] += coefs[jSol]*contFlx[iEq];
+          }
+        }
+      }
 
-	  if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+      for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
+      {
+        if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+        {
+          residuals[iSolPnt][iEq] = 0.0;
+        }
+      }
+    }
+    else
+    {
+      // Loop over solution pnt to count factor of all sol pnt polys
+      for (CFuint jSolPnt = 0; jSolPnt < m_nbrSolPnts; ++jSolPnt)
+      {
+        // Loop over deriv directions and sum them to compute divergence
+        for (CFuint iDir = 0; iDir < m_dim; ++iDir)
+        {
+          // Loop over conservative fluxes 
+          for (CFuint iEq = 0; iEq < m_nbrEqs; ++iEq)
           {
-            residuals[iSolPnt][iEq] = 0.0;
+            // Store divFD in the vector that will be divFC
+            residuals[iSolPnt][iEq] += (*m_solPolyDerivAtSolPnts)[iSolPnt][iDir][jSolPnt]*(m_contFlx[jSolPnt][iDir][iEq]);
+
+	    if (fabs(residuals[iSolPnt][iEq]) < MathTools::MathConsts::CFrealEps())
+            {
+              residuals[iSolPnt][iEq] = 0.0;
+	    }
 	  }
-	}
+        }
       }
     }
 
@@ -732,6 +784,13 @@ void DiffRHSFluxReconstruction::setup()
   
   // get the coefs for derivation of the states in the sol pnts
   m_solPolyDerivAtSolPnts = frLocalData[0]->getCoefSolPolyDerivInSolPnts();
+
+  // get the tensor product kernels, if available for this element type
+  m_useTensorKernels = frLocalData[0]->hasTensorProductKernels();
+  m_solPntIdxsAtFlxPnts = frLocalData[0]->getSolPntIdxsSolPolyInFlxPnts();
+  m_solPolyValsAtFlxPntsTensor = frLocalData[0]->getCoefSolPolyInFlxPntsTensor();
+  m_solPntIdxsDerivAtSolPnts = frLocalData[0]->getSolPntIdxsSolPolyDerivInSolPnts();
+  m_solPolyDerivAtSolPntsTensor = frLocalData[0]->getCoefSolPolyDerivInSolPntsTensor();
   
   // get face flux point cell mapped coordinates
   m_faceFlxPntCellMappedCoords = frLocalData[0]->getFaceFlxPntCellMappedCoordsPerOrient();
@@ -277,6 +277,21 @@ protected: //data
   
   /// average gradients in a flux point
   std::vector< RealVector* > m_avgGrad;
+
+  /// true if the tensor product (sum-factorised) kernels are used
+  bool m_useTensorKernels;
+
+  /// sol pnts contributing to the extrapolation to each flx pnt (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< CFuint > > > m_solPntIdxsAtFlxPnts;
+
+  /// coefs to extrapolate the states to the flx pnts (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< CFreal > > > m_solPolyValsAtFlxPntsTensor;
+
+  /// sol pnts on the coordinate lines of each sol pnt (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< std::vector< CFuint > > > > m_solPntIdxsDerivAtSolPnts;
+
+  /// coefs to compute the derivative of the states in the sol pnts (tensor product kernel)
+  Common::SafePtr< std::vector< std::vector< std::vector< CFreal > > > > m_solPolyDerivAtSolPntsTensor;
   
   private:
 
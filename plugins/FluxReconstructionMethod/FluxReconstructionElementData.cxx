@@ -1,3 +1,6 @@
+#include <cmath>
+#include <algorithm>
+
 #include "Common/StringOps.hh"
 #include "Common/NotImplementedException.hh"
 #include "Common/CFLog.hh"
@@ -74,7 +77,12 @@ FluxReconstructionElementData::FluxReconstructionElementData() :
   m_flxPntFlxDim(),
   m_vandermonde(),
   m_vandermondeInv(),
-  m_coefSolPolyInNodes()
+  m_coefSolPolyInNodes(),
+  m_hasTensorProductKernels(false),
+  m_solPntIdxsSolPolyInFlxPnts(),
+  m_coefSolPolyInFlxPntsTensor(),
+  m_solPntIdxsSolPolyDerivInSolPnts(),
+  m_coefSolPolyDerivInSolPntsTensor()
 {
   CFAUTOTRACE;
 }
@@ -141,6 +149,7 @@ void FluxReconstructionElementData::resetFluxReconstructionElementData()
   setCFLConvDiffRatio();
   createCoefSolPolyDerivInSolPnts();
   createCoefSolPolyInFlxPnts();
+  createSolPolyTensorKernels();
   createFaceFlxPntsCellLocalCoords();
   createFaceOutputPntCellMappedCoords();
   createFaceOutputPntSolPolyAndDerivCoef();
@@ -705,6 +714,95 @@ void FluxReconstructionElementData::createCoefSolPolyInFlxPnts()
 
 //////////////////////////////////////////////////////////////////////
 
+void FluxReconstructionElementData::createSolPolyTensorKernels()
+{
+  CFAUTOTRACE;
+
+  m_solPntIdxsSolPolyInFlxPnts.clear();
+  m_coefSolPolyInFlxPntsTensor.clear();
+  m_solPntIdxsSolPolyDerivInSolPnts.clear();
+  m_coefSolPolyDerivInSolPntsTensor.clear();
+
+  // on quads and hexas the solution polynomials are products of 1D Lagrange
+  // polynomials: the derivative in a sol pnt only involves the sol pnts on the
+  // same coordinate line and, for flx pnts sharing the tangential 1D coordinates
+  // of the sol pnts, the extrapolation only involves the sol pnts on the line
+  // normal to the face. This reduces the cost per cell from O(p^(2d)) to
+  // O(p^(d+1)). The vanishing coefficients are found from the dense ones,
+  // up to round-off, so that any 1D point distribution is handled.
+  m_hasTensorProductKernels = (m_shape == CFGeoShape::QUAD || m_shape == CFGeoShape::HEXA);
+  if (!m_hasTensorProductKernels)
+  {
+    return;
+  }
+
+  const CFuint nbrSolPnts = m_coefSolPolyDerivInSolPnts.size();
+  const CFuint dim = static_cast<CFuint>(m_dimensionality);
+
+  m_solPntIdxsSolPolyDerivInSolPnts.resize(nbrSolPnts);
+  m_coefSolPolyDerivInSolPntsTensor.resize(nbrSolPnts);
+  for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+  {
+    m_solPntIdxsSolPolyDerivInSolPnts[iSol].resize(dim);
+    m_coefSolPolyDerivInSolPntsTensor[iSol].resize(dim);
+    for (CFuint iDir = 0; iDir < dim; ++iDir)
+    {
+      const std::vector< CFreal >& coefs = m_coefSolPolyDerivInSolPnts[iSol][iDir];
+
+      // sol pnts on the line through iSol along iDir share all other coordinates
+      for (CFuint jSol = 0; jSol < nbrSolPnts; ++jSol)
+      {
+        bool onLine = true;
+        for (CFuint jDir = 0; jDir < dim; ++jDir)
+        {
+          if (jDir != iDir &&
+              std::abs(m_solPntsLocalCoords[iSol][jDir] - m_solPntsLocalCoords[jSol][jDir]) > 1e-12)
+          {
+            onLine = false;
+          }
+        }
+
+        if (onLine)
+        {
+          m_solPntIdxsSolPolyDerivInSolPnts[iSol][iDir].push_back(jSol);
+          m_coefSolPolyDerivInSolPntsTensor[iSol][iDir].push_back(coefs[jSol]);
+        }
+      }
+    }
+  }
+
+  const CFuint nbrFlxPnts = m_coefSolPolyInFlxPnts.size();
+  CFuint nbrCoefs = 0;
+
+  m_solPntIdxsSolPolyInFlxPnts.resize(nbrFlxPnts);
+  m_coefSolPolyInFlxPntsTensor.resize(nbrFlxPnts);
+  for (CFuint iFlx = 0; iFlx < nbrFlxPnts; ++iFlx)
+  {
+    const std::vector< CFreal >& coefs = m_coefSolPolyInFlxPnts[iFlx];
+
+    CFreal maxCoef = 0.0;
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      maxCoef = std::max(maxCoef, std::abs(coefs[iSol]));
+    }
+
+    for (CFuint iSol = 0; iSol < nbrSolPnts; ++iSol)
+    {
+      if (std::abs(coefs[iSol]) > 1e-10*maxCoef)
+      {
+        m_solPntIdxsSolPolyInFlxPnts[iFlx].push_back(iSol);
+        m_coefSolPolyInFlxPntsTensor[iFlx].push_back(coefs[iSol]);
+      }
+    }
+    nbrCoefs += m_solPntIdxsSolPolyInFlxPnts[iFlx].size();
+  }
+
+  CFLog(VERBOSE, "FluxReconstructionElementData::createSolPolyTensorKernels() => "
+        << nbrCoefs << " extrapolation coefficients instead of " << nbrFlxPnts*nbrSolPnts << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////
+
 void FluxReconstructionElementData::createCoefSolPolyInNodes()
 {
   //CFLog(VERBOSE,"createCoefSolPolyDerivInFlxPnts\n");
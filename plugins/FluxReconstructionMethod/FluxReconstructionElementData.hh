@@ -405,6 +405,46 @@ public:
     return &m_coefSolPolyInFlxPnts;
   }
   
+  /**
+   * @return m_hasTensorProductKernels
+   */
+  bool hasTensorProductKernels()
+  {
+    return m_hasTensorProductKernels;
+  }
+
+  /**
+   * @return m_solPntIdxsSolPolyInFlxPnts
+   */
+  Common::SafePtr< std::vector< std::vector< CFuint > > > getSolPntIdxsSolPolyInFlxPnts()
+  {
+    return &m_solPntIdxsSolPolyInFlxPnts;
+  }
+
+  /**
+   * @return m_coefSolPolyInFlxPntsTensor
+   */
+  Common::SafePtr< std::vector< std::vector< CFreal > > > getCoefSolPolyInFlxPntsTensor()
+  {
+    return &m_coefSolPolyInFlxPntsTensor;
+  }
+
+  /**
+   * @return m_solPntIdxsSolPolyDerivInSolPnts
+   */
+  Common::SafePtr< std::vector< std::vector< std::vector< CFuint > > > > getSolPntIdxsSolPolyDerivInSolPnts()
+  {
+    return &m_solPntIdxsSolPolyDerivInSolPnts;
+  }
+
+  /**
+   * @return m_coefSolPolyDerivInSolPntsTensor
+   */
+  Common::SafePtr< std::vector< std::vector< std::vector< CFreal > > > > getCoefSolPolyDerivInSolPntsTensor()
+  {
+    return &m_coefSolPolyDerivInSolPntsTensor;
+  }
+  
   /**
    * @return m_coefSolPolyInNodes
    */
@@ -684,6 +724,12 @@ protected: // functions
    */
   void createCoefSolPolyInFlxPnts();
 
+  /**
+   * create the sum-factorised (tensor product) versions of the coefficients
+   * for the extrapolation to the flx pnts and the derivation in the sol pnts
+   */
+  void createSolPolyTensorKernels();
+
   /**
    * create the cell mapped coordinates of a uniform distribution of points on the cell faces (for output)
    */
@@ -877,6 +923,21 @@ protected: // protected data
   /// coefficients for solution polynomials in the nodes
   std::vector< std::vector < CFreal > > m_coefSolPolyInNodes;
 
+  /// true if the tensor product kernels below are available (quads and hexas)
+  bool m_hasTensorProductKernels;
+
+  /// for each flx pnt, sol pnts contributing to the extrapolation
+  std::vector< std::vector< CFuint > > m_solPntIdxsSolPolyInFlxPnts;
+
+  /// for each flx pnt, coefficients matching m_solPntIdxsSolPolyInFlxPnts
+  std::vector< std::vector< CFreal > > m_coefSolPolyInFlxPntsTensor;
+
+  /// for each sol pnt and direction, sol pnts on the same coordinate line
+  std::vector< std::vector< std::vector< CFuint > > > m_solPntIdxsSolPolyDerivInSolPnts;
+
+  /// for each sol pnt and direction, coefficients matching m_solPntIdxsSolPolyDerivInSolPnts
+  std::vector< std::vector< std::vector< CFreal > > > m_coefSolPolyDerivInSolPntsTensor;
+
   /// ratio between convective and diffusive CFL limit (results from a trial and error procedure...)
   CFreal m_cflConvDiffRatio;
 
@@ -13,12 +13,16 @@
 #include "Framework/CFL.hh"
 #include "Framework/StopConditionController.hh"
 #include "MathTools/MathConsts.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Common/BadValueException.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
 using namespace COOLFluiD::Framework;
 using namespace COOLFluiD::MathTools;
+using namespace COOLFluiD::Common;
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +47,8 @@ void FwdEuler::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< std::string >("IntermediateCom","Command to perform between the computation of the Space and Time residual.");
    options.addConfigOption< std::string >("PrepareCom","Command to prepare the solution before the iteration process.");
    options.addConfigOption< std::string >("UnSetupCom","UnSetupCommand to run. This command seldomly needs overriding.");
+   options.addConfigOption< std::vector<CFuint> >("SubSysStartVars","First variable of each equation subsystem for multirate time stepping.");
+   options.addConfigOption< std::vector<CFuint> >("NbSubSteps","Number of substeps of each equation subsystem in one time step (multirate time stepping if not empty).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -67,6 +73,12 @@ FwdEuler::FwdEuler(const std::string& name)
 
   m_intermediateStr = "Null";
   setParameter("IntermediateCom",&m_intermediateStr);
+
+  m_subSysStartVars = vector<CFuint>();
+  setParameter("SubSysStartVars",&m_subSysStartVars);
+
+  m_nbSubSteps = vector<CFuint>();
+  setParameter("NbSubSteps",&m_nbSubSteps);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -115,6 +127,33 @@ void FwdEuler::configure ( Config::ConfigArgs& args )
 
   configureCommand<FwdEulerData,FwdEulerComProvider>(args, m_updateSol,m_updateSolStr,m_data);
   CFLog(VERBOSE, "FwdEuler::configure() => Command " << m_updateSolStr << "\n");
+
+  if (m_nbSubSteps.size() > 0) {
+    if (m_nbSubSteps.size() != m_subSysStartVars.size() || m_subSysStartVars[0] != 0) {
+      throw BadValueException
+	(FromHere(), "FwdEuler::configure() => SubSysStartVars must give the first variable of each subsystem, starting from 0");
+    }
+    for (CFuint i = 0; i < m_nbSubSteps.size(); ++i) {
+      if (m_nbSubSteps[i] == 0 || (i > 0 && m_subSysStartVars[i] <= m_subSysStartVars[i-1])) {
+	throw BadValueException
+	  (FromHere(), "FwdEuler::configure() => NbSubSteps must be positive and SubSysStartVars increasing");
+      }
+    }
+    if (!m_data->isTimeAccurate()) {
+      throw BadValueException
+	(FromHere(), "FwdEuler::configure() => multirate time stepping needs TimeAccurate = true");
+    }
+
+    // sort the subsystems by increasing number of substeps
+    m_subSysOrder.clear();
+    for (CFuint n = 1; m_subSysOrder.size() < m_nbSubSteps.size(); ++n) {
+      for (CFuint i = 0; i < m_nbSubSteps.size(); ++i) {
+	if (m_nbSubSteps[i] == n) {
+	  m_subSysOrder.push_back(i);
+	}
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -176,21 +215,26 @@ void FwdEuler::takeStepImpl()
     // raise the maximum DT, the space method will compute the maximum allowed and lower it
     subSysStatus->setMaxDT(MathTools::MathConsts::CFrealMax());
 
-    CFLog(VERBOSE, "ForwardEuler::takeStep(): computing Space Residual\n");
-    getMethodData()->getCollaborator<SpaceMethod>()->computeSpaceResidual (1.0);
+    if (m_nbSubSteps.size() > 0) {
+      takeMultirateStep();
+    }
+    else {
+      CFLog(VERBOSE, "ForwardEuler::takeStep(): computing Space Residual\n");
+      getMethodData()->getCollaborator<SpaceMethod>()->computeSpaceResidual (1.0);
 
-    // do an intermediate step, useful for some special
-    // types of temporal discretization
-    CFLog(VERBOSE, "ForwardEuler::takeStep(): calling Intermediate step\n");
-    m_intermediate->execute();
+      // do an intermediate step, useful for some special
+      // types of temporal discretization
+      CFLog(VERBOSE, "ForwardEuler::takeStep(): calling Intermediate step\n");
+      m_intermediate->execute();
 
-    CFLog(VERBOSE, "ForwardEuler::takeStep(): computing the Time Residual\n");
-    getMethodData()->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
+      CFLog(VERBOSE, "ForwardEuler::takeStep(): computing the Time Residual\n");
+      getMethodData()->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
 
-    CFLog(VERBOSE, "ForwardEuler::takeStep(): updating the solution\n");
+      CFLog(VERBOSE, "ForwardEuler::takeStep(): updating the solution\n");
 
-    if (m_data->getDoUpdateSolution()) {
-      m_updateSol->execute();
+      if (m_data->getDoUpdateSolution()) {
+	m_updateSol->execute();
+      }
     }
 
     CFLog(VERBOSE, "ForwardEuler::syncGlobalDataComputeResidual()\n");
@@ -219,6 +263,99 @@ void FwdEuler::takeStepImpl()
   subSysStatus->updateCurrentTime();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void FwdEuler::takeMultirateStep()
+{
+  CFAUTOTRACE;
+
+  DataHandle<State*, GLOBAL> states =
+    MeshDataStack::getActive()->getStateDataSocketSink().getDataHandle();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint nbStates = states.size();
+  const CFuint nbSubSys = m_nbSubSteps.size();
+
+  m_oldStates.resize(nbStates*nbEqs);
+  m_newStates.resize(nbStates*nbEqs);
+  for (CFuint i = 0; i < nbStates; ++i) {
+    const State& state = *states[i];
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      m_oldStates[i*nbEqs + iEq] = state[iEq];
+    }
+  }
+  m_isAdvanced.assign(nbSubSys, false);
+
+  for (CFuint iOrder = 0; iOrder < nbSubSys; ++iOrder) {
+    const CFuint iSubSys = m_subSysOrder[iOrder];
+    const CFuint start = m_subSysStartVars[iSubSys];
+    const CFuint end = (iSubSys + 1 < nbSubSys) ? m_subSysStartVars[iSubSys + 1] : nbEqs;
+    const CFuint nbSubSteps = m_nbSubSteps[iSubSys];
+
+    PhysicalModelStack::getActive()->setEquationSubSysDescriptor(start, end - start, iSubSys);
+    m_data->setDTFraction(1./static_cast<CFreal>(nbSubSteps));
+
+    for (CFuint iStep = 0; iStep < nbSubSteps; ++iStep) {
+      CFLog(VERBOSE, "ForwardEuler::takeMultirateStep(): subsystem " << iSubSys
+	    << ", substep " << iStep << "\n");
+
+      setInactiveVars(iSubSys, (iStep + 0.5)/static_cast<CFreal>(nbSubSteps));
+
+      getMethodData()->getCollaborator<SpaceMethod>()->computeSpaceResidual(1.0);
+      m_intermediate->execute();
+      getMethodData()->getCollaborator<SpaceMethod>()->computeTimeResidual(1.0);
+
+      if (m_data->getDoUpdateSolution()) {
+	m_updateSol->execute();
+      }
+
+      // the last synchronization is done by the caller
+      if (iOrder + 1 < nbSubSys || iStep + 1 < nbSubSteps) {
+	ConvergenceMethod::syncGlobalDataComputeResidual(false);
+      }
+    }
+
+    for (CFuint i = 0; i < nbStates; ++i) {
+      const State& state = *states[i];
+      for (CFuint iEq = start; iEq < end; ++iEq) {
+	m_newStates[i*nbEqs + iEq] = state[iEq];
+      }
+    }
+    m_isAdvanced[iSubSys] = true;
+  }
+
+  setInactiveVars(m_subSysOrder.back(), 1.);
+
+  PhysicalModelStack::getActive()->resetEquationSubSysDescriptor();
+  m_data->setDTFraction(1.);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FwdEuler::setInactiveVars(const CFuint iSubSys, const CFreal theta)
+{
+  DataHandle<State*, GLOBAL> states =
+    MeshDataStack::getActive()->getStateDataSocketSink().getDataHandle();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+  const CFuint nbStates = states.size();
+  const CFuint nbSubSys = m_nbSubSteps.size();
+
+  for (CFuint jSubSys = 0; jSubSys < nbSubSys; ++jSubSys) {
+    if (jSubSys != iSubSys) {
+      const CFuint start = m_subSysStartVars[jSubSys];
+      const CFuint end = (jSubSys + 1 < nbSubSys) ? m_subSysStartVars[jSubSys + 1] : nbEqs;
+      const CFreal w = (m_isAdvanced[jSubSys]) ? theta : 0.;
+
+      for (CFuint i = 0; i < nbStates; ++i) {
+	State& state = *states[i];
+	for (CFuint iEq = start; iEq < end; ++iEq) {
+	  const CFuint idx = i*nbEqs + iEq;
+	  state[iEq] = (1. - w)*m_oldStates[idx] + w*m_newStates[idx];
+	}
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
     } // namespace ForwardEuler
@@ -24,6 +24,15 @@ namespace COOLFluiD {
 
 /// This class defines a ConvergenceMethod that implements the Explicit
 /// time stepping algorithm of first order.
+/// With NbSubSteps, the equations are split in contiguous subsystems that
+/// are advanced one after the other over the time step, each one with its
+/// own number of substeps (multirate time stepping). The subsystems are
+/// advanced from the one with fewer substeps to the one with more: while a
+/// subsystem is substepped, the variables of the subsystems already
+/// advanced are interpolated linearly in time at the middle of the
+/// substep, the others stay at the beginning of the time step.
+/// The space method must compute the residual of the current equation
+/// subsystem only (see EquationSubSysDescriptor).
 /// @author Tiago Quintino
 /// @author Thomas Wuilbaut
 class  ForwardEuler_API FwdEuler : public Framework::ConvergenceMethod {
@@ -68,6 +77,17 @@ protected: // abstract interface implementations
   /// @see Method::setMethod()
   virtual void setMethodImpl();
 
+  /// Advance the equation subsystems one after the other with their own
+  /// number of substeps
+  void takeMultirateStep();
+
+  /// Set in all the states the variables which do not belong to the given
+  /// equation subsystem
+  /// @param iSubSys  equation subsystem being advanced
+  /// @param theta    fraction of the time step at which the already
+  ///                 advanced subsystems are interpolated
+  void setInactiveVars(const CFuint iSubSys, const CFreal theta);
+
 protected: // member data
 
   ///The Setup command to use
@@ -103,6 +123,24 @@ protected: // member data
   ///The data to share between ForwardEulerMethod commands
   Common::SharedPtr<FwdEulerData> m_data;
 
+  /// first variable of each equation subsystem for multirate time stepping
+  std::vector<CFuint> m_subSysStartVars;
+
+  /// number of substeps of each equation subsystem in one time step
+  std::vector<CFuint> m_nbSubSteps;
+
+  /// equation subsystems sorted by increasing number of substeps
+  std::vector<CFuint> m_subSysOrder;
+
+  /// flag telling which equation subsystems are already advanced
+  std::vector<bool> m_isAdvanced;
+
+  /// states at the beginning of the time step
+  std::vector<CFreal> m_oldStates;
+
+  /// states at the end of the time step for the advanced subsystems
+  std::vector<CFreal> m_newStates;
+
 }; // class FwdEuler
 
 //////////////////////////////////////////////////////////////////////////////
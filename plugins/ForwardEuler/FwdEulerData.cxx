@@ -37,7 +37,8 @@ void FwdEulerData::defineConfigOptions(Config::OptionList& options)
 
 FwdEulerData::FwdEulerData(Common::SafePtr<Framework::Method> owner)
   : ConvergenceMethodData(owner),
-    m_achieved(false)
+    m_achieved(false),
+    m_dtFraction(1.)
 {
   addConfigOptionsTo(this);
 
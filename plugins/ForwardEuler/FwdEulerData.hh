@@ -113,6 +113,19 @@ public: // functions
     m_achieved = achieved;
   }
 
+  /// Gets the fraction of the time step taken by the next update
+  CFreal getDTFraction() const
+  {
+    return m_dtFraction;
+  }
+
+  /// Sets the fraction of the time step taken by the next update
+  /// (smaller than 1 for the substeps of multirate time stepping)
+  void setDTFraction(CFreal dtFraction)
+  {
+    m_dtFraction = dtFraction;
+  }
+
 private: // data
 
   /// flag to indicate that convergence has been achieved
@@ -130,6 +143,9 @@ private: // data
   /// flag to indicate if time accurate
   bool m_isTimeAccurate;
 
+  /// fraction of the time step taken by the next update
+  CFreal m_dtFraction;
+
 }; // end of class FwdEulerData
 
 //////////////////////////////////////////////////////////////////////////////
@@ -90,7 +90,7 @@ void UpdateSol::execute()
   DataHandle<CFreal> rhs  = socket_rhs.getDataHandle();
   DataHandle<CFreal> updateCoeff = socket_updateCoeff.getDataHandle();
 
-  const CFreal sys_dt  = SubSystemStatusStack::getActive()->getDT();
+  const CFreal sys_dt  = SubSystemStatusStack::getActive()->getDT()*getMethodData().getDTFraction();
   const CFreal CFL = getMethodData().getCFL()->getCFLValue();
   const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
   const CFuint nbStates = states.size();
@@ -265,8 +265,10 @@ void UpdateSol::execute()
   if(isTimeAccurate && isTimeStepTooLarge)
       CFLog(WARN, "The chosen time step is too large as it gives a maximum CFL of " << maxCFL <<".\n");
 
+  // with multirate time stepping each substep gives its own limit
   if(isTimeAccurate)
-      SubSystemStatusStack::getActive()->setMaxDT(SubSystemStatusStack::getActive()->getDT()/maxCFL);
+      SubSystemStatusStack::getActive()->setMaxDT
+        (min(SubSystemStatusStack::getActive()->getMaxDT(), SubSystemStatusStack::getActive()->getDT()/maxCFL));
 
   // computation of the norm of the dU (a.k.a rhs)
   CFreal value = 0.0;
@@ -1041,7 +1041,7 @@ void Gambit2CFmeshConverter::readFiles(const boost::filesystem::path& filepath)
 
 ////////////////////////////////////////////////////////////////////////////// 10
 
-void Gambit2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void Gambit2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1113,7 +1113,7 @@ void Gambit2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 11
 
-void Gambit2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void Gambit2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1127,7 +1127,7 @@ void Gambit2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 11
 
-void Gambit2CFmeshConverter::writeNodes(ofstream& fout)
+void Gambit2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1145,7 +1145,7 @@ void Gambit2CFmeshConverter::writeNodes(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 12
 
-void Gambit2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void Gambit2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1219,7 +1219,7 @@ void Gambit2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 13
 
-void Gambit2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void Gambit2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1258,7 +1258,7 @@ void Gambit2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 13
 
-void Gambit2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void Gambit2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1353,7 +1353,7 @@ void Gambit2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 14
 
-void Gambit2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void Gambit2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -382,41 +382,41 @@ private:
   /**
    * Write in the COOLFluiD format the element list for a FEM mesh
    */
-  void writeContinuousElements(std::ofstream& fout);
+  void writeContinuousElements(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the state list for a FEM mesh
    */
-  void writeContinuousStates(std::ofstream& fout);
+  void writeContinuousStates(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the Topological Region Set data
    * considering to have FEM
    */
-  void writeContinuousTrsData(std::ofstream& fout);
+  void writeContinuousTrsData(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the mesh data considering
    * to have cell center FVM
    */
-  void writeDiscontinuousElements(std::ofstream& fout);
+  void writeDiscontinuousElements(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the Topological Region Set data
    * considering to have FVM
    */
-  void writeDiscontinuousTrsData(std::ofstream& fout);
+  void writeDiscontinuousTrsData(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the state list for a
    * cell centered FVM mesh
    */
-  void writeDiscontinuousStates(std::ofstream& fout);
+  void writeDiscontinuousStates(std::ostream& fout);
 
   /**
    * Write in the COOLFluiD format the node list
    */
-  void writeNodes(std::ofstream& fout);
+  void writeNodes(std::ostream& fout);
 
   /**
    * Get the number of super patches
@@ -1185,7 +1185,7 @@ void Gmsh2CFmeshConverter::convertBack(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void Gmsh2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1259,7 +1259,7 @@ void Gmsh2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void Gmsh2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1273,7 +1273,7 @@ void Gmsh2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeNodes(ofstream& fout)
+void Gmsh2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1290,7 +1290,7 @@ void Gmsh2CFmeshConverter::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void Gmsh2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1379,7 +1379,7 @@ void Gmsh2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void Gmsh2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   fout << "!LIST_STATE " << _isWithSolution << "\n";
 
@@ -1417,7 +1417,7 @@ void Gmsh2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
 //////////////////////////////////////////////////////////////////////////////
 
 
-void Gmsh2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void Gmsh2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1480,7 +1480,7 @@ void Gmsh2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Gmsh2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void Gmsh2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
    CFAUTOTRACE;
 
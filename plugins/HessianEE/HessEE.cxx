@@ -34,6 +34,7 @@ void HessEE::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< std::string >("UnSetupCom","UnSetupCommand to run. This command seldomly needs overriding.");
    options.addConfigOption< std::string >("HessianCom","Command to compute the Hessian.");
    options.addConfigOption< std::string >("SmootherCom","Command to smooth either the Hessian or the Metric.");
+   options.addConfigOption< std::string >("AdaptFlagCom","Command to compute the refinement flags from the global metric.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -65,6 +66,9 @@ HessEE::HessEE(const std::string& name)
 
   _updaterStr = "StdUpdateCom";
    setParameter("UpdateCom",&_updaterStr);
+
+  _adaptFlagStr = "Null";
+   setParameter("AdaptFlagCom",&_adaptFlagStr);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -102,6 +106,7 @@ void HessEE::configure ( Config::ConfigArgs& args )
   configureCommand<HessEEData,HessEEComProvider>( args, _smoother,_smootherStr,_data);
 
   configureCommand<HessEEData,HessEEComProvider>( args, _updater,_updaterStr,_data);
+  configureCommand<HessEEData,HessEEComProvider>( args, _adaptFlag,_adaptFlagStr,_data);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -154,6 +159,8 @@ void HessEE::estimateImpl()
     _smoother->execute();
 
     _updater->execute();
+
+    _adaptFlag->execute();
   }
 }
 
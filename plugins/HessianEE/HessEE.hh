@@ -107,6 +107,9 @@ private: // member data
   ///The command used for updating global metric field
   Common::SelfRegistPtr<HessEECom> _updater;
 
+  ///The command used for computing the refinement flags
+  Common::SelfRegistPtr<HessEECom> _adaptFlag;
+
 
   ///The Setup string for configuration
   std::string _setupStr;
@@ -129,6 +132,9 @@ private: // member data
   ///The updateSolution for configuration
   std::string _updaterStr;
 
+  ///The refinement flags command for configuration
+  std::string _adaptFlagStr;
+
   ///The data to share between HessianEEMethod commands
   Common::SharedPtr<HessEEData> _data;
 
@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <cmath>
+
+#include "HessianEE/HessianEE.hh"
+#include "HessianEE/StdAdaptFlagCalc.hh"
+#include "Common/PE.hh"
+#include "Environment/DirPaths.hh"
+#include "Environment/FileHandlerOutput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+#include "Framework/MeshData.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/MethodCommandProvider.hh"
+
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Environment;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace HessianEE {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<StdAdaptFlagCalc, HessEEData, HessianEEModule> stdAdaptFlagCalcProvider("StdAdaptFlagCalc");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdAdaptFlagCalc::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< CFreal >("RefineLength","Cells with an edge longer than this in the metric are refined.");
+  options.addConfigOption< CFreal >("CoarsenLength","Cells with all the edges shorter than this in the metric are coarsened.");
+  options.addConfigOption< std::string >("FlagsFile","Name of the file where the refinement flags are written.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdAdaptFlagCalc::StdAdaptFlagCalc(const std::string& name) :
+  HessEECom(name),
+  socket_glob_metric("glob_metric"),
+  socket_nodes("nodes")
+{
+  addConfigOptionsTo(this);
+
+  _refineLength = std::sqrt(2.);
+  setParameter("RefineLength",&_refineLength);
+
+  _coarsenLength = 0.5;
+  setParameter("CoarsenLength",&_coarsenLength);
+
+  _flagsFile = "adapt_flags.dat";
+  setParameter("FlagsFile",&_flagsFile);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+StdAdaptFlagCalc::~StdAdaptFlagCalc()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<Common::SafePtr<BaseDataSocketSink> >
+StdAdaptFlagCalc::needsSockets()
+{
+  std::vector<Common::SafePtr<BaseDataSocketSink> > result;
+
+  result.push_back(&socket_glob_metric);
+  result.push_back(&socket_nodes);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdAdaptFlagCalc::execute()
+{
+  CFAUTOTRACE;
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+
+  DataHandle<RealMatrix> glob_metric = socket_glob_metric.getDataHandle();
+
+  SafePtr<GeometricEntityPool<TrsGeoWithNodesBuilder> > geoBuilder =
+    getMethodData().getGeoWithNodesBuilder();
+
+  SafePtr<TopologicalRegionSet> trs = getCurrentTRS();
+  TrsGeoWithNodesBuilder::GeoData& geoData = geoBuilder->getDataGE();
+  geoData.trs = trs;
+  const CFuint nbCells = trs->getLocalNbGeoEnts();
+
+  SafePtr<vector<CFuint> > globalElementIDs =
+    MeshDataStack::getActive()->getGlobalElementIDs();
+
+  vector<CFuint> globalIDs(nbCells);
+  vector<CFint> flags(nbCells, 0);
+  RealVector edge(dim);
+  CFuint nbRefined = 0;
+  CFuint nbCoarsened = 0;
+
+  for ( CFuint iCell=0; iCell < nbCells; ++iCell )
+  {
+    const CFuint localID = trs->getLocalGeoID(iCell);
+    globalIDs[iCell] = (globalElementIDs->size() > localID) ?
+      (*globalElementIDs)[localID] : localID;
+
+    geoData.idx = iCell;
+    GeometricEntity* cell = geoBuilder->buildGE();
+
+    const CFGeoShape::Type shape = cell->getShape();
+    if (shape == CFGeoShape::TRIAG || shape == CFGeoShape::TETRA)
+    {
+      // in a simplex all the pairs of nodes are edges
+      vector<Node*>&  tabNod = *(cell->getNodes());
+      CFreal maxLength = 0.0;
+      for ( CFuint i=0; i<tabNod.size(); ++i)
+      {
+        const RealMatrix& mtxA = glob_metric[ tabNod[i]->getLocalID() ];
+        for ( CFuint j=i+1; j<tabNod.size(); ++j)
+        {
+          const RealMatrix& mtxB = glob_metric[ tabNod[j]->getLocalID() ];
+          for ( CFuint d=0; d<dim; ++d)
+            edge[d] = (*tabNod[j])[d] - (*tabNod[i])[d];
+
+          // length in the metric averaged between the two nodes
+          CFreal length2 = 0.0;
+          for ( CFuint ih=0; ih<dim; ++ih)
+            for ( CFuint jh=0; jh<dim; ++jh)
+              length2 += 0.5 * ( mtxA(ih,jh) + mtxB(ih,jh) ) * edge[ih] * edge[jh];
+
+          maxLength = max( maxLength, std::sqrt( max(length2, 0.0) ) );
+        }
+      }
+
+      if ( maxLength > _refineLength )
+      {
+        flags[iCell] = 1;
+        ++nbRefined;
+      }
+      else if ( maxLength < _coarsenLength )
+      {
+        flags[iCell] = -1;
+        ++nbCoarsened;
+      }
+    }
+
+    geoBuilder->releaseGE();
+  }
+
+  CFLog(INFO, "StdAdaptFlagCalc::execute() => " << nbRefined << " cells to refine, "
+        << nbCoarsened << " cells to coarsen out of " << nbCells << "\n");
+
+  writeFlags(globalIDs, flags);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void StdAdaptFlagCalc::writeFlags(const std::vector<CFuint>& globalIDs,
+                                  const std::vector<CFint>& flags)
+{
+  CFAUTOTRACE;
+
+  const std::string nsp = getMethodData().getNamespace();
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+
+  CFuint nbGlobalCells = 0;
+  for (CFuint i = 0; i < globalIDs.size(); ++i) {
+    nbGlobalCells = max(nbGlobalCells, globalIDs[i] + 1);
+  }
+
+  // only the (globalID, flag) pairs of the flagged cells are sent, the flags
+  // being shifted to be positive (1 coarsen, 3 refine), so that the cells
+  // present on more than one processor are combined by taking the maximum
+  // (refinement wins)
+  vector<CFuint> localPairs;
+  for (CFuint i = 0; i < globalIDs.size(); ++i) {
+    if (flags[i] != 0) {
+      localPairs.push_back(globalIDs[i]);
+      localPairs.push_back(flags[i] + 2);
+    }
+  }
+
+  vector<CFuint> globalPairs;
+
+#ifdef CF_HAVE_MPI
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const CFuint nbProc = PE::GetPE().GetProcessorCount(nsp);
+
+  CFuint localNbCells = nbGlobalCells;
+  MPI_Reduce(&localNbCells, &nbGlobalCells, 1, MPIStructDef::getMPIType(&localNbCells), MPI_MAX, 0, comm);
+
+  int sendCount = localPairs.size();
+  vector<int> recvCounts(nbProc, 0);
+  vector<int> displs(nbProc, 0);
+  MPI_Gather(&sendCount, 1, MPI_INT, &recvCounts[0], 1, MPI_INT, 0, comm);
+
+  if (rank == 0) {
+    for (CFuint iProc = 1; iProc < nbProc; ++iProc) {
+      displs[iProc] = displs[iProc-1] + recvCounts[iProc-1];
+    }
+    globalPairs.resize(displs[nbProc-1] + recvCounts[nbProc-1]);
+  }
+
+  // one more entry avoids taking the address of an empty vector
+  localPairs.push_back(0);
+  globalPairs.push_back(0);
+  MPI_Gatherv(&localPairs[0], sendCount, MPIStructDef::getMPIType(&localPairs[0]),
+	      &globalPairs[0], &recvCounts[0], &displs[0],
+	      MPIStructDef::getMPIType(&globalPairs[0]), 0, comm);
+  localPairs.pop_back();
+  globalPairs.pop_back();
+#else
+  globalPairs.swap(localPairs);
+#endif
+
+  if (rank == 0) {
+    vector<CFint> globalFlags(nbGlobalCells, 0);
+    for (CFuint i = 0; i < globalPairs.size(); i += 2) {
+      const CFint flag = static_cast<CFint>(globalPairs[i+1]);
+      globalFlags[globalPairs[i]] = max(globalFlags[globalPairs[i]], flag);
+    }
+
+    boost::filesystem::path file = DirPaths::getInstance().getWorkingDir() / _flagsFile;
+    SelfRegistPtr<FileHandlerOutput> fhandle =
+      SingleBehaviorFactory<FileHandlerOutput>::getInstance().create();
+    ofstream& fout = fhandle->open(file);
+
+    fout << nbGlobalCells << "\n";
+    for (CFuint i = 0; i < nbGlobalCells; ++i) {
+      fout << ((globalFlags[i] > 0) ? globalFlags[i] - 2 : 0) << "\n";
+    }
+
+    fhandle->close();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace HessianEE
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
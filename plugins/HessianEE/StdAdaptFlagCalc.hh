@@ -0,0 +1,99 @@
+#ifndef COOLFluiD_Numerics_HessianEE_StdAdaptFlagCalc_hh
+#define COOLFluiD_Numerics_HessianEE_StdAdaptFlagCalc_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "HessEEData.hh"
+#include "Framework/DataSocketSink.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace HessianEE {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class represents a NumericalCommand that turns the global metric
+ * into refinement flags for the cells of the mesh.
+ * The length of each edge of a simplex cell is measured in the metric
+ * averaged between its two nodes: a cell is flagged for refinement (+1)
+ * if its longest edge is longer than RefineLength and for coarsening (-1)
+ * if its longest edge is shorter than CoarsenLength (0 otherwise).
+ * Each processor computes the flags of its local cells: the (global element
+ * ID, flag) pairs of the flagged cells are gathered on the first processor,
+ * which writes the flags of all the cells to FlagsFile, to be used by the
+ * (serial) MetricRefiner of the SimpleGlobalMeshAdapter.
+ */
+class StdAdaptFlagCalc : public HessEECom
+{
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  explicit StdAdaptFlagCalc(const std::string& name);
+
+  /**
+   * Destructor.
+   */
+  ~StdAdaptFlagCalc();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector<Common::SafePtr<Framework::BaseDataSocketSink> > needsSockets();
+
+  /**
+   * Execute Processing actions
+   */
+  void execute();
+
+private: // helper methods
+
+  /// gather the flags of all the processors and write them to file
+  /// @param globalIDs  global IDs of the local cells
+  /// @param flags      flags of the local cells
+  void writeFlags(const std::vector<CFuint>& globalIDs,
+                  const std::vector<CFint>& flags);
+
+private: // data
+
+  /// storage for the global metric at each node
+  Framework::DataSocketSink<RealMatrix> socket_glob_metric;
+
+  /// the socket to the data handle of the node's
+  Framework::DataSocketSink < Framework::Node* , Framework::GLOBAL > socket_nodes;
+
+  /// edges longer than this (in the metric) are refined
+  CFreal _refineLength;
+
+  /// cells whose edges are all shorter than this (in the metric) are coarsened
+  CFreal _coarsenLength;
+
+  /// name of the file where the flags are written
+  std::string _flagsFile;
+
+}; // class StdAdaptFlagCalc
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace HessianEE
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_HessianEE_StdAdaptFlagCalc_hh
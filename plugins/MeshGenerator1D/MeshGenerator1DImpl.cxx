@@ -268,21 +268,21 @@ void MeshGenerator1DImpl::readFiles(const boost::filesystem::path& filepath)
 }
 ////////////////////////////////////////////////////////////////////////////// 10
 
-void MeshGenerator1DImpl::writeContinuousElements(ofstream& fout)
+void MeshGenerator1DImpl::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 }
 
 ////////////////////////////////////////////////////////////////////////////// 11
 
-void MeshGenerator1DImpl::writeContinuousStates(ofstream& fout)
+void MeshGenerator1DImpl::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 }
 
 ///////////////////////////////////////////////////////////////////////////// 11
 
-void MeshGenerator1DImpl::writeNodes(ofstream& fout)
+void MeshGenerator1DImpl::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -298,7 +298,7 @@ void MeshGenerator1DImpl::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void MeshGenerator1DImpl::writeDiscontinuousElements(ofstream& fout)
+void MeshGenerator1DImpl::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -353,7 +353,7 @@ void MeshGenerator1DImpl::writeDiscontinuousElements(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 13
 
-void MeshGenerator1DImpl::writeDiscontinuousStates(ofstream& fout)
+void MeshGenerator1DImpl::writeDiscontinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -362,14 +362,14 @@ void MeshGenerator1DImpl::writeDiscontinuousStates(ofstream& fout)
 
 ////////////////////////////////////////////////////////////////////////////// 13
 
-void MeshGenerator1DImpl::writeContinuousTrsData(ofstream& fout)
+void MeshGenerator1DImpl::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 }
 
 ////////////////////////////////////////////////////////////////////////////// 14
 
-void MeshGenerator1DImpl::writeDiscontinuousTrsData(ofstream& fout)
+void MeshGenerator1DImpl::writeDiscontinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -8,6 +8,7 @@
 
 #ifdef CF_HAVE_MPI
 #include "Common/MPI/MPIStructDef.hh"
+#include "Common/MPI/MPIError.hh"
 #endif
 
 #include "Common/Stopwatch.hh"
@@ -18,8 +19,6 @@
 #include "Framework/MeshData.hh"
 #include "Framework/PhysicalModel.hh"
 
-#include "Framework/TRSDistributeData.hh"
-
 #include <vector>
 #include <cmath>
 #include "MeshTools/MeshToolsFVM.hh"
@@ -122,161 +121,23 @@ void ComputeWallDistanceVector2CCMPI::execute()
 {
   CFAUTOTRACE;
   
-  // this has only to be run at setup for now
   CFLog(VERBOSE, "ComputeWallDistanceVector2CCMPI::execute() START\n");
   
-  const CFuint dim = PhysicalModelStack::getActive()->getDim();
-  
-  // AL: gory fix to use centroid-based algorithm 
-  if (m_centroidBased && dim == DIM_3D) {execute3D(); return;}
-  
   CFLog(INFO, "ComputeWallDistanceVector2CCMPI::execute() => Computing distance to the wall ...\n");
   
   Stopwatch<WallTime> stp;
   stp.start();
   
-  RealVector faceCentroidArray(dim);
-  m_minStateFaceDistance.resize(socket_states.getDataHandle().size());
-  m_minStateFaceDistance = MathTools::MathConsts::CFrealMax();
-  
-  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
-  DataHandle <CFreal> normals = socket_normals.getDataHandle();
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
   cf_always_assert(_boundaryTRS.size() > 0);
   cf_always_assert(dim == DIM_2D || dim == DIM_3D);
   
-  // loop over all processors
-  for (CFuint root = 0; root < m_nbProc; ++root) {
-    
-    // loop over all wall boundary TRSs
-    for(CFuint iTRS = 0; iTRS < _boundaryTRS.size(); ++iTRS) {
-      SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs(_boundaryTRS[iTRS]);
-      
-      // broadcast number of faces in the current TRS to allow for buffer memory preallocation
-      CFuint nbLocalTrsFaces = faces->getLocalNbGeoEnts();
-      
-#ifdef CF_HAVE_MPI
-      MPI_Bcast(&nbLocalTrsFaces, 1, MPIStructDef::getMPIType(&nbLocalTrsFaces), root, m_comm);
-#endif
-      
-      CFuint nodeSize = 0;
-      CFuint connSize = 0;
-      // something is gonna be packed to be sent only if the number of faces 
-      // inside the current TRS in the root processor is positive
-      if (nbLocalTrsFaces > 0) {
-	int sizes[5];
-	TRSFaceDistributeData trsData; // data to be distributed
-	
-	if (m_myRank == root) {
-	  // list of the local node IDs which are referenced by this TRS
-	  SafePtr<vector<CFuint> > nodesInTrs = faces->getNodesInTrs();
-	  const CFuint nbNodesInTrs = nodesInTrs->size();
-	  cf_assert(nbNodesInTrs > 0);
-	  nodeSize = nbNodesInTrs*dim;
-	  // connectivity size overestimated to allow for memory preallocation in 3D
-	  connSize = (dim == DIM_2D) ? nbLocalTrsFaces*2 : nbLocalTrsFaces*4;
-	  
-	  // unidimensional node coordinates storage (each node is unique)
-	  // coordinate x,y(,z) of the TRS nodes
-	  trsData.trsNodes.reserve(nodeSize);
-	  // face-node connectivity in the TRS 
-	  trsData.trsNodeConn.reserve(connSize);
-	  // 3D mesh could have both triangle and quad faces, so we keep track of
-	  // the number of nodes for each individual face
-	  trsData.trsNbNodesInFace.reserve(nbLocalTrsFaces);
-	  
-	  // map local node IDs (within the mesh partition) with the local ID 
-	  // in the node storage for the current TRS (in the range [0,nbNodesInTrs-1])
-	  CFMap<CFuint, CFuint> localNodeIDs2TrsNodeIDs(nbNodesInTrs);
-	  for (CFuint n = 0; n < nbNodesInTrs; ++n){
-	    const CFuint nodeID = (*nodesInTrs)[n];
-	    localNodeIDs2TrsNodeIDs.insert(nodeID,n);
-	    // store coordinates of the node (with ID = nodeID) in "n" position
-	    for (CFuint iDim =0; iDim < dim; ++iDim) {
-	      trsData.trsNodes.push_back((*nodes[nodeID])[iDim]);
-	    }
-	  }
-	  localNodeIDs2TrsNodeIDs.sortKeys();
-	  cf_assert(trsData.trsNodes.size() == trsData.trsNodes.capacity());
-	  
-	  // loop over faces in the current TRS and store related data into TRSFaceDistributeData
-	  trsData.faceCenters.reserve(nbLocalTrsFaces*dim);
-	  for (CFuint iFace = 0; iFace < nbLocalTrsFaces; ++iFace) {
-	    const CFuint nbNodesInGeo = faces->getNbNodesInGeo(iFace);
-	    cf_assert((nbNodesInGeo == 2 && dim == DIM_2D) || 
-		      ((nbNodesInGeo == 3 || nbNodesInGeo == 4) && dim == DIM_3D)); 
-	    trsData.trsNbNodesInFace.push_back(nbNodesInGeo);
-	    
-	    // compute the face centroid
-	    faceCentroidArray = 0.;
-	    for (CFuint iNode = 0; iNode < nbNodesInGeo; ++iNode) {
-	      const CFuint nodeID = faces->getNodeID(iFace, iNode);
-	      faceCentroidArray += *nodes[nodeID];
-	      // here you push back the ID of the node within the node storage
-	      // corresponding to the current TRS
-	      bool found = false;
-	      trsData.trsNodeConn.push_back(localNodeIDs2TrsNodeIDs.find(nodeID, found));
-	      cf_assert(found);
-	    }
-	    // fix for 3D to account for possibly oversized storage: 
-	    // add "-1" as last ID for the current face
-	    if (dim == DIM_3D && nbNodesInGeo < 4) {trsData.trsNodeConn.push_back(-1);}
-	    
-	    const CFreal ovNbNodesInGeo = 1./(CFreal)nbNodesInGeo;
-	    faceCentroidArray *= ovNbNodesInGeo;
-	    
-	    for (CFuint iDim = 0; iDim < dim; ++iDim) {
-	      trsData.faceCenters.push_back(faceCentroidArray[iDim]);
-	    }
-	  }
-	  cf_assert(trsData.faceCenters.size() == trsData.faceCenters.capacity());
-	  
-	  sizes[0] = nodeSize; 
-	  sizes[1] = connSize;
-	  sizes[2] = nbLocalTrsFaces;
-	  sizes[3] = sizes[4] = nbLocalTrsFaces*dim;
-	  // face normal is needed for computing projection
-	  trsData.faceNormals.reserve(nbLocalTrsFaces*dim);
-	  for (CFuint iFace = 0; iFace < nbLocalTrsFaces; ++iFace) {
-	    const CFuint start = faces->getLocalGeoID(iFace)*dim;
-	    for (CFuint iDim = 0; iDim < dim; ++iDim) {
-	      trsData.faceNormals.push_back(normals[start+iDim]);
-	    }
-	  }
-	  cf_assert(trsData.faceNormals.size() == trsData.faceNormals.capacity());
-	}
-	
-#ifdef CF_HAVE_MPI
-	// broadcast the sizes of the storages to make possible to preallocate the distributed arrays
-	MPI_Bcast(&sizes[0], 5, MPIStructDef::getMPIType(&sizes[0]), root, m_comm);
-#endif
-	
-	if (m_myRank != root) {
-	  cf_assert(sizes[0] > 0);
-	  cf_assert(sizes[1] > 0);
-	  cf_assert(sizes[2] > 0);
-	  cf_assert(sizes[3] > 0);
-	  cf_assert(sizes[4] > 0);
-	  
-	  trsData.trsNodes.resize(sizes[0]);
-	  trsData.trsNodeConn.resize(sizes[1]);
-	  trsData.trsNbNodesInFace.resize(sizes[2]);
-	  trsData.faceCenters.resize(sizes[3]);
-	  trsData.faceNormals.resize(sizes[4]);
-	}
-	
-#ifdef CF_HAVE_MPI
-	MPIStruct ms;
-	MPIStructDef::buildMPIStruct<CFreal,CFint,CFuint,CFreal,CFreal>
-	  (&trsData.trsNodes[0], &trsData.trsNodeConn[0], &trsData.trsNbNodesInFace[0], 
-	   &trsData.faceCenters[0], &trsData.faceNormals[0], sizes, ms);
-	
-	MPI_Bcast(ms.start, 1, ms.type, root, m_comm);
-#endif
-	// compute the distance to the wall starting from broadcast data 
-	computeWallDistance(trsData);
-      }
-    }
-  }
+  gatherWallFaces();
+  
+  CFLog(VERBOSE, "ComputeWallDistanceVector2CCMPI::execute() => " << m_bvh.getNbFaces() 
+	<< " wall faces gathered in " << stp.read() << "s\n");
+  
+  computeWallDistance();
   
   CFLog(INFO, "ComputeWallDistanceVector2CCMPI::execute() => took " << stp.read() << "s\n");
   
@@ -289,208 +150,161 @@ void ComputeWallDistanceVector2CCMPI::execute()
     
 //////////////////////////////////////////////////////////////////////////////
 
-void ComputeWallDistanceVector2CCMPI::execute3D()
+void ComputeWallDistanceVector2CCMPI::gatherWallFaces()
 {
-  CFAUTOTRACE;
-  
-  CFLog(INFO, "ComputeWallDistanceVector2CCMPI::execute3D() => Computing distance to the wall ...\n");
-  
-  Stopwatch<WallTime> stp;
-  stp.start();
+  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
+  DataHandle <CFreal> normals = socket_normals.getDataHandle();
   
-  DataHandle<Framework::Node*, Framework::GLOBAL> nodes = socket_nodes.getDataHandle();
   const CFuint dim = PhysicalModelStack::getActive()->getDim();
-  cf_always_assert(_boundaryTRS.size() > 0);
-  
+  const CFuint stride = 3*dim;
   RealVector faceCentroid(dim);
-  vector<CFreal> trsFaceData;
   
-  // loop over all processors
-  for (CFuint root = 0; root < m_nbProc; ++root) {
+  // for each local wall face, store centroid, normal and first node
+  vector<CFreal> localData;
+  for(CFuint iTRS = 0; iTRS < _boundaryTRS.size(); ++iTRS) {
+    SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs(_boundaryTRS[iTRS]);
+    const CFuint nbLocalTrsFaces = faces->getLocalNbGeoEnts();
+    localData.reserve(localData.size() + nbLocalTrsFaces*stride);
     
-    // loop over all wall boundary TRSs
-    for(CFuint iTRS = 0; iTRS < _boundaryTRS.size(); ++iTRS) {  
-      CFLog(VERBOSE, "ComputeWallDistanceVector2CCMPI::execute() => Processing TRS [" 
-	    << _boundaryTRS[iTRS] << "] from P[" << root << "] => START\n");
-      
-      SafePtr<TopologicalRegionSet> faces = MeshDataStack::getActive()->getTrs(_boundaryTRS[iTRS]);
-      
-      // broadcast number of faces in the current TRS to allow for buffer memory preallocation
-      CFuint nbLocalTrsFaces = faces->getLocalNbGeoEnts();
-      
-#ifdef CF_HAVE_MPI
-      MPI_Bcast(&nbLocalTrsFaces, 1, MPIStructDef::getMPIType(&nbLocalTrsFaces), root, m_comm);
-#endif
+    for (CFuint iFace = 0; iFace < nbLocalTrsFaces; ++iFace) {
+      const CFuint nbNodesInGeo = faces->getNbNodesInGeo(iFace);
+      cf_assert((nbNodesInGeo == 2 && dim == DIM_2D) || 
+		((nbNodesInGeo == 3 || nbNodesInGeo == 4) && dim == DIM_3D)); 
       
-      // something is gonna be packed to be sent only if the number of faces 
-      // inside the current TRS in the root processor is positive
-      if (nbLocalTrsFaces > 0) {
-	// trsFaceData stores the coordinates of the wall face centroid
-	const CFuint sizeData = nbLocalTrsFaces*dim;
-	cf_assert(sizeData > 0);
-	trsFaceData.resize(sizeData); 
-	
-	if (m_myRank == root) {
-	  // loop over faces in the current TRS and store connectivity info into TRSFaceDistributeData
-	  CFuint count = 0;
-	  for (CFuint iFace = 0; iFace < nbLocalTrsFaces; ++iFace) {
-	    // compute the face centroid
-	    faceCentroid = 0.;
-	    const CFuint nbNodesInFace = faces->getNbNodesInGeo(iFace);
-	    for (CFuint n = 0; n < nbNodesInFace; ++n) {
-	      const CFuint nodeID = faces->getNodeID(iFace, n);
-	      cf_assert(nodeID < nodes.size());
-	      faceCentroid += *nodes[nodeID];
-	    }
-	    const CFreal ovNbNodesInFace = 1./(CFreal)nbNodesInFace;
-	    faceCentroid *= ovNbNodesInFace;
-	    
-	    for (CFuint iDim = 0; iDim < dim; ++iDim, ++count) {
-	      cf_assert(count < trsFaceData.size());
-	      trsFaceData[count] = faceCentroid[iDim];
-	    }
-	  }
-	  cf_assert(count == trsFaceData.size());
-	}
-	
-#ifdef CF_HAVE_MPI
-	cf_assert(trsFaceData.size() > 0);
-	MPI_Bcast(&trsFaceData[0], sizeData, MPI_DOUBLE, root, m_comm);
-	// CFLog(INFO, CFPrintContainer<vector<CFreal> >("trsFaceData    = ", &trsFaceData));
-#endif
-	
-	// compute the distance to the wall starting from broadcast data 
-	computeWallDistance3D(trsFaceData);
+      faceCentroid = 0.;
+      for (CFuint iNode = 0; iNode < nbNodesInGeo; ++iNode) {
+	const CFuint nodeID = faces->getNodeID(iFace, iNode);
+	cf_assert(nodeID < nodes.size());
+	faceCentroid += *nodes[nodeID];
       }
+      faceCentroid *= 1./(CFreal)nbNodesInGeo;
       
-      CFLog(VERBOSE, "ComputeWallDistanceVector2CCMPI::execute() => Processing TRS [" 
-	    << _boundaryTRS[iTRS] << "] from P[" << root << "] => END\n");
+      const CFuint startNormal = faces->getLocalGeoID(iFace)*dim;
+      const Node& node0 = *nodes[faces->getNodeID(iFace, 0)];
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	localData.push_back(faceCentroid[iDim]);
+      }
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	localData.push_back(normals[startNormal+iDim]);
+      }
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	localData.push_back(node0[iDim]);
+      }
     }
   }
   
-  CFLog(INFO, "ComputeWallDistanceVector2CCMPI::execute3D() => took " << stp.read() << "s\n");
-    
+  // all processors get the wall faces of all the others, ordered by rank,
+  // with a single collective instead of one broadcast per processor and TRS
   if (m_nbProc == 1) {
-    printToFile();
+    m_wallFaceData = localData;
   }
-}
-    
-//////////////////////////////////////////////////////////////////////////////
-
-void ComputeWallDistanceVector2CCMPI::computeWallDistance3D(std::vector<CFreal>& data)
-{
-  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
-  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
-  DataHandle< CFreal> wallDistance = socket_wallDistance.getDataHandle();
-  DataHandle<bool> nodeisAD = socket_nodeisAD.getDataHandle(); 
-  const CFuint dim = PhysicalModelStack::getActive()->getDim();
-  const CFuint nbStates = states.size();
-  RealVector faceCentroid(dim, (CFreal*)CFNULL);
-  const CFuint nbFaces = data.size()/dim;
-  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->
-    getTrs("InnerCells");
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-    cf_assert(iState == states[iState]->getLocalID());
-    const RealVector& stateCoord = states[iState]->getCoordinates(); 
+  else {
+#ifdef CF_HAVE_MPI
+    int localSize = localData.size();
+    vector<int> recvCounts(m_nbProc, 0);
+    vector<int> displs(m_nbProc, 0);
+    MPIError::getInstance().check
+      ("MPI_Allgather", "ComputeWallDistanceVector2CCMPI::gatherWallFaces()",
+       MPI_Allgather(&localSize, 1, MPI_INT, &recvCounts[0], 1, MPI_INT, m_comm));
     
-    // initialize the minimum distance to a huge value
-    CFreal minimumDistance = MathTools::MathConsts::CFrealMax();
-    for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
-      const CFreal start = iFace*dim;
-      cf_assert(start < data.size());
-      faceCentroid.wrap(dim, &data[start]);
-      // compute distance between face centroid and cell centroid
-      const CFreal stateFaceDistance = MathFunctions::getDistance(faceCentroid, stateCoord);
-      minimumDistance = std::min(stateFaceDistance, minimumDistance);
+    for (CFuint iProc = 1; iProc < m_nbProc; ++iProc) {
+      displs[iProc] = displs[iProc-1] + recvCounts[iProc-1];
     }
+    const CFuint totalSize = displs[m_nbProc-1] + recvCounts[m_nbProc-1];
+    cf_always_assert(totalSize > 0);
+    m_wallFaceData.resize(totalSize);
     
-    cf_assert(iState < wallDistance.size());
-    wallDistance[iState] = std::min(wallDistance[iState], minimumDistance);
-    
-    
-    const CFuint nbNodesInCell = cells->getNbNodesInGeo(iState);
-    for (CFuint in = 0; in < nbNodesInCell; ++in) {
-      // local ID of the cell node
-      const CFuint cellNodeID = cells->getNodeID(iState, in);
-      cf_assert(cellNodeID < nodeisAD.size());
-      nodeisAD[cellNodeID] = (std::min(wallDistance[iState], minimumDistance) < m_acceptableDistance  ? true : false);
+    CFreal* sendBuf = (localSize > 0) ? &localData[0] : CFNULL;
+    MPIError::getInstance().check
+      ("MPI_Allgatherv", "ComputeWallDistanceVector2CCMPI::gatherWallFaces()",
+       MPI_Allgatherv(sendBuf, localSize, MPIStructDef::getMPIType(&m_wallFaceData[0]),
+		      &m_wallFaceData[0], &recvCounts[0], &displs[0], 
+		      MPIStructDef::getMPIType(&m_wallFaceData[0]), m_comm));
+#endif
+  }
+  
+  const CFuint nbFaces = m_wallFaceData.size()/stride;
+  cf_always_assert(nbFaces > 0);
+  vector<CFreal> centers(nbFaces*dim);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    for (CFuint iDim = 0; iDim < dim; ++iDim) {
+      centers[iFace*dim + iDim] = m_wallFaceData[iFace*stride + iDim];
     }
   }
+  m_bvh.build(dim, centers);
 }
-    
 
 //////////////////////////////////////////////////////////////////////////////
-  void  ComputeWallDistanceVector2CCMPI::computeWallDistance(TRSFaceDistributeData& data)
+
+void ComputeWallDistanceVector2CCMPI::computeWallDistance()
 {
-  DataHandle < Framework::Node*, Framework::GLOBAL > nodes = socket_nodes.getDataHandle();
   DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
   DataHandle< CFreal> wallDistance = socket_wallDistance.getDataHandle();
   DataHandle <bool> nodeisAD = socket_nodeisAD.getDataHandle();
- const CFuint dim = PhysicalModelStack::getActive()->getDim();
-  
-  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->
-    getTrs("InnerCells");
   
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint stride = 3*dim;
   const CFuint nbStates = states.size();
-  RealVector node0(dim, (CFreal*)CFNULL);
-  RealVector fcenter(dim, (CFreal*)CFNULL);
-  RealVector fnormal(dim, (CFreal*)CFNULL);
-  RealVector nodeStateVector(dim);
   
-  for (CFuint iState = 0; iState < nbStates; ++iState) {
-    CFuint nodeCount0 = 0;
-    bool updateDistance = false;
-
-    // initialize the minimum distance to a huge value
-    CFreal minimumDistance = MathTools::MathConsts::CFrealMax();
-    cf_assert(minimumDistance > 0.);  
-    const CFuint nbFaces = data.trsNbNodesInFace.size();
-    cf_assert(nbFaces > 0);
-    cf_assert(nbFaces == data.faceCenters.size()/dim);
-    cf_assert(nbFaces == data.faceNormals.size()/dim);
+  // AL: the centroid-based algorithm has limited usability and is only used in 3D
+  const bool useProjection = !(m_centroidBased && dim == DIM_3D);
+  
+  if (m_minStateFaceDistance.size() != nbStates) {
+    m_minStateFaceDistance.resize(nbStates);
+    m_minStateFaceDistance = MathTools::MathConsts::CFrealMax();
+  }
+  
+  const CFint nbStatesInt = nbStates;
+#ifdef CF_HAVE_OMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+  for (CFint iState = 0; iState < nbStatesInt; ++iState) {
+    cf_assert(iState == (CFint)states[iState]->getLocalID());
+    RealVector& stateCoord = states[iState]->getCoordinates();
     
-    for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
-      cf_assert(nodeCount0 < data.trsNodeConn.size());
-      const CFuint nodeID0 = data.trsNodeConn[nodeCount0];
-      const CFuint coordID0 = nodeID0*dim;
-      cf_assert(coordID0 < data.trsNodes.size());
-      const CFuint faceID0 = iFace*dim;
-      cf_assert(faceID0 < data.faceNormals.size());
-      cf_assert(faceID0 < data.faceCenters.size());
-      
-      node0.wrap(dim, &data.trsNodes[coordID0]);
-      fcenter.wrap(dim, &data.faceCenters[faceID0]);
-      RealVector& centerCoord = states[iState]->getCoordinates();
-      nodeStateVector = centerCoord - node0;
-      // if distance between the current cell center and the boundary face center is minimal
-      // compute projection of vector joining cell center & first face node onto the face normal direction
-      const CFreal stateFaceDistance = MathFunctions::getDistance(centerCoord, fcenter);
-      cf_assert(m_minStateFaceDistance[iState] > 0.);
-      if (stateFaceDistance < m_minStateFaceDistance[iState]) {
-	fnormal.wrap(dim, &data.faceNormals[faceID0]);
-	minimumDistance = std::abs(-MathFunctions::innerProd(fnormal, nodeStateVector)/fnormal.norm2());
-	m_minStateFaceDistance[iState] = stateFaceDistance;
-	updateDistance = true;
-      }
-
-      nodeCount0 += (dim == DIM_3D) ? 4 : 2; // this is consistent with definition of "connSize"
+    // the distance to the nearest face centroid found in a previous call
+    // (e.g. previous iteration with moving mesh) prunes the search: if the 
+    // wall has moved away and nothing is found, a full search is done
+    CFreal faceDistance = m_minStateFaceDistance[iState];
+    CFuint faceID = m_bvh.findNearest(&stateCoord[0], faceDistance);
+    if (faceID == WallFacesBVH::getNoFace()) {
+      faceDistance = MathTools::MathConsts::CFrealMax();
+      faceID = m_bvh.findNearest(&stateCoord[0], faceDistance);
     }
+    cf_assert(faceID != WallFacesBVH::getNoFace());
+    m_minStateFaceDistance[iState] = faceDistance;
     
-    if (updateDistance) { 
-      wallDistance[iState] = minimumDistance;
-      const CFuint nbNodesInCell = cells->getNbNodesInGeo(iState);
-      for (CFuint in = 0; in < nbNodesInCell; ++in) {
-	// local ID of the cell node
-	const CFuint cellNodeID = cells->getNodeID(iState, in);
-	cf_assert(cellNodeID < nodeisAD.size());
-        nodeisAD[cellNodeID] = (minimumDistance < m_acceptableDistance  ? true : false); 
+    if (useProjection) {
+      // projection of the vector joining the first face node and the cell 
+      // center onto the normal of the face with the closest centroid
+      const CFreal *const fnormal = &m_wallFaceData[faceID*stride + dim];
+      const CFreal *const node0   = &m_wallFaceData[faceID*stride + 2*dim];
+      CFreal proj = 0.;
+      CFreal normalNorm = 0.;
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	proj += fnormal[iDim]*(stateCoord[iDim] - node0[iDim]);
+	normalNorm += fnormal[iDim]*fnormal[iDim];
       }
-      
-    } 
-    CFLog(DEBUG_MAX, "ComputeWallDistanceVector2CCMPI::computeWallDistance2D() => " <<
-	  "miwallDistance[ " <<  iState << " ] = " << wallDistance[iState] << "\n");}
-    
-    
+      wallDistance[iState] = std::abs(proj)/std::sqrt(normalNorm);
+    }
+    else {
+      wallDistance[iState] = faceDistance;
+    }
+
+  }
+  
+  // nodes shared by several cells are flagged as in the serial loop over cells
+  SafePtr<TopologicalRegionSet> cells = MeshDataStack::getActive()->getTrs("InnerCells");
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const bool isAD = (wallDistance[iState] < m_acceptableDistance);
+    const CFuint nbNodesInCell = cells->getNbNodesInGeo(iState);
+    for (CFuint in = 0; in < nbNodesInCell; ++in) {
+      // local ID of the cell node
+      const CFuint cellNodeID = cells->getNodeID(iState, in);
+      cf_assert(cellNodeID < nodeisAD.size());
+      nodeisAD[cellNodeID] = isAD;
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -9,8 +9,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
-#include "Framework/TRSDistributeData.hh"
 #include "MeshTools/ComputeWallDistance.hh"
+#include "MeshTools/WallFacesBVH.hh"
 #include <vector>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -23,7 +23,8 @@ namespace COOLFluiD {
 /**
  *
  * This class computes the distance from the states to the wall
- * and outputs to a file
+ * and outputs to a file. The wall faces of all processors are gathered
+ * and searched through a bounding volume hierarchy.
  *
  * @author Andrea Lani
  * @author Thomas Wuilbaut
@@ -70,32 +71,19 @@ public:
 
 
   std::vector<Common::SafePtr<Framework::BaseDataSocketSource> > provideSockets();
-
-    
-  /**
-   * This class stores face centers and normals to be distributed in parallel
-   *
-   * @author Andrea Lani
-   */
-  class TRSFaceDistributeData : public Framework::TRSDistributeData {
-  public:
-    std::vector<CFreal> faceCenters; /// face centers
-    std::vector<CFreal> faceNormals; /// face normals
-  };
-  
   
-  void execute3D();
+private:
   
   /**
-   * Compute the wall distance
+   * Gather the data of the wall faces of all processors and 
+   * build the bounding volume hierarchy over them
    */
-  void computeWallDistance3D(std::vector<CFreal>& data);
+  void gatherWallFaces();
   
   /**
-   * Compute the wall distance (2D and 3D)
+   * Compute the wall distance (2D and 3D) for all the local states
    */
-  void computeWallDistance(TRSFaceDistributeData& data);
- 
+  void computeWallDistance();
      
 private:
   
@@ -126,6 +114,12 @@ private:
   /// minimum state-face distance
   RealVector m_minStateFaceDistance;
   
+  /// centroid, normal and first node of each wall face (gathered from all processors)
+  std::vector<CFreal> m_wallFaceData;
+  
+  /// bounding volume hierarchy over the wall face centroids
+  WallFacesBVH m_bvh;
+  
 #ifdef CF_HAVE_MPI
   /// communicator
   MPI_Comm m_comm;
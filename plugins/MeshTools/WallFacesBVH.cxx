@@ -0,0 +1,208 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CFLog.hh"
+#include "MeshTools/WallFacesBVH.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// functor comparing two faces by one coordinate of their centroids
+class CenterLess {
+public:
+  CenterLess(const vector<CFreal>& centers, const CFuint dim, const CFuint axis) :
+    m_centers(centers), m_dim(dim), m_axis(axis) {}
+
+  bool operator() (const CFuint f1, const CFuint f2) const
+  {
+    return m_centers[f1*m_dim + m_axis] < m_centers[f2*m_dim + m_axis];
+  }
+
+private:
+  const vector<CFreal>& m_centers;
+  const CFuint m_dim;
+  const CFuint m_axis;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+WallFacesBVH::WallFacesBVH() :
+  m_dim(0),
+  m_centers(),
+  m_faceIDs(),
+  m_nodes()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+WallFacesBVH::~WallFacesBVH()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void WallFacesBVH::build(const CFuint dim, const vector<CFreal>& centers)
+{
+  cf_assert(dim == DIM_2D || dim == DIM_3D);
+  cf_assert(centers.size() % dim == 0);
+
+  m_dim = dim;
+  m_centers = centers;
+
+  const CFuint nbFaces = centers.size()/dim;
+  m_faceIDs.resize(nbFaces);
+  for (CFuint iFace = 0; iFace < nbFaces; ++iFace) {
+    m_faceIDs[iFace] = iFace;
+  }
+
+  m_nodes.clear();
+  if (nbFaces > 0) {
+    m_nodes.reserve(2*(nbFaces/LEAF_SIZE + 1));
+    buildNode(0, nbFaces);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint WallFacesBVH::buildNode(const CFuint start, const CFuint end)
+{
+  cf_assert(end > start);
+
+  const CFuint nodeID = m_nodes.size();
+  m_nodes.push_back(BVHNode());
+
+  // bounding box of the centroids in this node
+  BVHNode node;
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    node.bbMin[iDim] = node.bbMax[iDim] = 0.;
+  }
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    node.bbMin[iDim] = node.bbMax[iDim] = m_centers[m_faceIDs[start]*m_dim + iDim];
+  }
+  for (CFuint i = start + 1; i < end; ++i) {
+    const CFreal* center = &m_centers[m_faceIDs[i]*m_dim];
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+      node.bbMin[iDim] = std::min(node.bbMin[iDim], center[iDim]);
+      node.bbMax[iDim] = std::max(node.bbMax[iDim], center[iDim]);
+    }
+  }
+  node.start = start;
+  node.end   = end;
+  node.left  = node.right = 0;
+
+  if (end - start > LEAF_SIZE) {
+    // split at the median along the largest extent of the box
+    CFuint axis = 0;
+    for (CFuint iDim = 1; iDim < m_dim; ++iDim) {
+      if (node.bbMax[iDim] - node.bbMin[iDim] > node.bbMax[axis] - node.bbMin[axis]) {
+	axis = iDim;
+      }
+    }
+
+    const CFuint middle = start + (end - start)/2;
+    std::nth_element(m_faceIDs.begin() + start, m_faceIDs.begin() + middle,
+		     m_faceIDs.begin() + end, CenterLess(m_centers, m_dim, axis));
+
+    node.left  = buildNode(start, middle);
+    node.right = buildNode(middle, end);
+  }
+
+  // m_nodes may have been reallocated by the recursive calls
+  m_nodes[nodeID] = node;
+  return nodeID;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal WallFacesBVH::getSqDistanceToBox(const BVHNode& node, const CFreal* point) const
+{
+  CFreal dist = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    CFreal diff = 0.;
+    if (point[iDim] < node.bbMin[iDim]) {
+      diff = node.bbMin[iDim] - point[iDim];
+    }
+    else if (point[iDim] > node.bbMax[iDim]) {
+      diff = point[iDim] - node.bbMax[iDim];
+    }
+    dist += diff*diff;
+  }
+  return dist;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint WallFacesBVH::findNearest(const CFreal* point, CFreal& distance) const
+{
+  CFuint nearestFace = getNoFace();
+  if (m_nodes.size() == 0) return nearestFace;
+
+  // the bound is kept squared to avoid square roots during the traversal
+  CFreal minSqDist = (distance < std::sqrt(numeric_limits<CFreal>::max())) ?
+    distance*distance : numeric_limits<CFreal>::max();
+
+  CFuint stack[MAX_DEPTH];
+  CFuint stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BVHNode& node = m_nodes[stack[--stackSize]];
+    // faces at the same distance as the bound are kept, to preserve the
+    // lowest ID among equidistant faces
+    if (getSqDistanceToBox(node, point) > minSqDist) continue;
+
+    if (node.left == 0) {
+      for (CFuint i = node.start; i < node.end; ++i) {
+	const CFuint faceID = m_faceIDs[i];
+	const CFreal sqDist = getSqDistanceToFace(faceID, point);
+	if (sqDist < minSqDist || (sqDist == minSqDist && faceID < nearestFace)) {
+	  minSqDist = sqDist;
+	  nearestFace = faceID;
+	}
+      }
+    }
+    else {
+      cf_assert(stackSize + 2 <= MAX_DEPTH);
+      // push the farthest child first, so that the nearest is visited first
+      const CFreal dLeft  = getSqDistanceToBox(m_nodes[node.left], point);
+      const CFreal dRight = getSqDistanceToBox(m_nodes[node.right], point);
+      if (dLeft < dRight) {
+	stack[stackSize++] = node.right;
+	stack[stackSize++] = node.left;
+      }
+      else {
+	stack[stackSize++] = node.left;
+	stack[stackSize++] = node.right;
+      }
+    }
+  }
+
+  if (nearestFace != getNoFace()) {
+    distance = std::sqrt(minSqDist);
+  }
+  return nearestFace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
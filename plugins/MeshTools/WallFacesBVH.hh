@@ -0,0 +1,148 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MeshTools_WallFacesBVH_hh
+#define COOLFluiD_MeshTools_WallFacesBVH_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <limits>
+
+#include "Common/COOLFluiD.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MeshTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ *
+ * This class implements a bounding volume hierarchy (BVH) over the centroids
+ * of a set of wall faces, allowing for nearest face queries in O(log N)
+ * instead of looping over all the faces.
+ * The query is read-only and can be shared among threads.
+ */
+class WallFacesBVH {
+public:
+
+  /**
+   * Constructor.
+   */
+  WallFacesBVH();
+
+  /**
+   * Default destructor
+   */
+  ~WallFacesBVH();
+
+  /**
+   * Build the hierarchy
+   * @param dim      space dimension (2 or 3)
+   * @param centers  face centroids, stored as [x0 y0 (z0) x1 y1 (z1) ...]
+   */
+  void build(const CFuint dim, const std::vector<CFreal>& centers);
+
+  /**
+   * Find the face with the nearest centroid
+   * @param point     coordinates of the query point
+   * @param distance  in input, upper bound for the distance (faces farther
+   *                  than this are pruned); in output, distance to the nearest
+   *                  face, if found
+   * @return the ID of the nearest face in the ordering given to build()
+   *         or getNoFace() if no face lies within the given bound.
+   *         Among equidistant faces, the one with lowest ID is returned.
+   */
+  CFuint findNearest(const CFreal* point, CFreal& distance) const;
+
+  /**
+   * Get the number of faces in the hierarchy
+   */
+  CFuint getNbFaces() const
+  {
+    return m_faceIDs.size();
+  }
+
+  /**
+   * Value returned by findNearest() if no face is found
+   */
+  static CFuint getNoFace()
+  {
+    return std::numeric_limits<CFuint>::max();
+  }
+
+private:
+
+  /// node of the hierarchy: its bounding box and either its two
+  /// children or the range of faces it contains (leaf)
+  struct BVHNode {
+    CFreal bbMin[3];
+    CFreal bbMax[3];
+    CFuint start;
+    CFuint end;
+    CFuint left;
+    CFuint right;
+  };
+
+  /**
+   * Recursively build the node containing the faces in [start, end)
+   * @return the index of the built node
+   */
+  CFuint buildNode(const CFuint start, const CFuint end);
+
+  /**
+   * Squared distance between the given point and the bounding box of a node
+   */
+  CFreal getSqDistanceToBox(const BVHNode& node, const CFreal* point) const;
+
+  /**
+   * Squared distance between the given point and the centroid of a face
+   */
+  CFreal getSqDistanceToFace(const CFuint faceID, const CFreal* point) const
+  {
+    const CFreal* center = &m_centers[faceID*m_dim];
+    CFreal dist = 0.;
+    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+      const CFreal diff = point[iDim] - center[iDim];
+      dist += diff*diff;
+    }
+    return dist;
+  }
+
+private:
+
+  /// maximum number of faces in a leaf
+  static const CFuint LEAF_SIZE = 8;
+
+  /// maximum depth of the query stack
+  static const CFuint MAX_DEPTH = 128;
+
+  /// space dimension
+  CFuint m_dim;
+
+  /// face centroids
+  std::vector<CFreal> m_centers;
+
+  /// face IDs sorted such that each node references a contiguous range
+  std::vector<CFuint> m_faceIDs;
+
+  /// nodes of the hierarchy (the root is the first one)
+  std::vector<BVHNode> m_nodes;
+
+}; // end of class WallFacesBVH
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MeshTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MeshTools_WallFacesBVH_hh
@@ -17,7 +17,9 @@ namespace COOLFluiD {
 //////////////////////////////////////////////////////////////////////////////
 
 /**
- * This clas is suposed to pervorm load balancing with use of ParMetis functions
+ * This clas is suposed to pervorm load balancing with use of ParMetis functions.
+ * So far it only computes a new partitioning (see StdRepart): the mesh and
+ * the solution are not migrated, so the balance of the simulation is unchanged.
  *
  * @author
  *
@@ -75,7 +77,7 @@ protected: // interface implementation functions
   virtual void unsetMethodImpl();
 
    /**
-   * Do Repartitioning
+   * Compute a new partitioning (not applied to the mesh)
    */
   virtual void doDynamicBalanceImpl();
 
@@ -4,6 +4,7 @@
 #include "Common/NoSuchValueException.hh"
 #include "Common/BadValueException.hh"
 #include "Common/MPI/MPIException.hh"
+#include "Common/MPI/MPIStructDef.hh"
 #include "Common/ProcessInfo.hh"
 #include "Common/CFLog.hh"
 #include "Common/OSystem.hh"
@@ -45,6 +46,14 @@ stdParMetisBalancerProvider("StdRepart");
 
 //////////////////////////////////////////////////////////////////////////////
 
+void StdRepart::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("CostSocket","Name of the socket storing the measured cost of each cell (uniform weights if not available).");
+  options.addConfigOption< CFuint >("MaxWeight","Weight given to the nodes around the most expensive cells.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 StdRepart::StdRepart(const std::string& name) :
   ParMetisBalancerCom(name),
   socket_nodes("nodes"),
@@ -54,6 +63,13 @@ StdRepart::StdRepart(const std::string& name) :
   m_states(NULL)
 {
   /// Inicializes the command "StdRepart" and sets data socets to be used
+  addConfigOptionsTo(this);
+
+  m_costSocketName = "cellCost";
+  setParameter("CostSocket",&m_costSocketName);
+
+  m_maxWeight = 100;
+  setParameter("MaxWeight",&m_maxWeight);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -67,6 +83,10 @@ StdRepart::~StdRepart()
 void StdRepart::configure(Config::ConfigArgs& args)
 {
   ParMetisBalancerCom::configure(args);
+
+  if (m_maxWeight < 1) {
+    throw BadValueException (FromHere(),"StdRepart::configure() => MaxWeight must be at least 1");
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -119,6 +139,9 @@ void StdRepart::execute()
   
   // free the alocated memory
   DoClearMemory();
+  
+  CFLog(WARN, "StdRepart::execute() => the new partitioning is not applied: "
+	<< "states, past states, nodes and sockets are not migrated\n");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -233,6 +256,70 @@ void StdRepart::setupCSR()
 }
 
 //////////////////////////////////////////////////////////////////////////////
+void StdRepart::computeNodeWeights(std::vector<PartitionerData::IndexT>& weights)
+{
+  CFAUTOTRACE;
+
+  weights.clear();
+
+  const std::string nsp = getMethodData().getNamespace();
+  const std::string costName = nsp + "_" + m_costSocketName;
+  SafePtr<Framework::DataStorage> ds = MeshDataStack::getActive()->getDataStorage();
+
+  // if the cost is not measured, all nodes are processed with the same weight
+  bool hasCost = ds->checkData(costName);
+  DataHandle<CFreal> cellCost(CFNULL);
+  if (hasCost) {
+    cellCost = ds->getData<CFreal>(costName);
+    hasCost = (cellCost.size() == m_states.size());
+  }
+
+  // the cost of each cell is shared by its nodes
+  vector<CFreal> nodeCost(m_nodes.size(), 0.);
+  if (hasCost) {
+    const CFuint nbCells = m_cells->getLocalNbGeoEnts();
+    for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+      const CFuint nbNodesInCell = m_cells->getNbNodesInGeo(iCell);
+      const CFreal cost = cellCost[m_cells->getStateID(iCell,0)]/nbNodesInCell;
+      for (CFuint iNode = 0; iNode < nbNodesInCell; ++iNode) {
+	nodeCost[m_cells->getNodeID(iCell,iNode)] += cost;
+      }
+    }
+  }
+
+  // the weights are normalized with the cost of the most expensive node
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  CFreal localMaxCost = 0.;
+  for (CFuint i = 0; i < m_nodes.size(); ++i) {
+    if (dataStorage.Part1()[i] == rank) {
+      localMaxCost = std::max(localMaxCost, nodeCost[i]);
+    }
+  }
+
+  CFreal maxCost = 0.;
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  MPI_Allreduce(&localMaxCost, &maxCost, 1, MPIStructDef::getMPIType(&localMaxCost), MPI_MAX, comm);
+
+  if (maxCost > 0.) {
+    const CFreal scale = m_maxWeight/maxCost;
+    for (CFuint i = 0; i < m_nodes.size(); ++i) {
+      if (dataStorage.Part1()[i] == rank) {
+	const PartitionerData::IndexT w = static_cast<PartitionerData::IndexT>(nodeCost[i]*scale + 0.5);
+	weights.push_back(std::max(w, static_cast<PartitionerData::IndexT>(1)));
+      }
+    }
+    CFLog(INFO, "StdRepart::computeNodeWeights() => weights from measured cost, max cost per node = " << maxCost << "\n");
+
+    // start a new measurement window
+    cellCost = 0.;
+  }
+  else {
+    CFLog(INFO, "StdRepart::computeNodeWeights() => no measured cost, using uniform weights\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void StdRepart::callParMetisAdaptiveRepart()
 {
   CFAUTOTRACE;
@@ -268,26 +355,22 @@ void StdRepart::callParMetisAdaptiveRepart()
     part[i] = 0;
   }
   
-  ///HACK:: introduce waights for testing -- to be removed later!! 
-  wgtflag=2;  // 0 for no weights(vwgt and adjwgt=NULL), 2 weight on vertices only(adjwgt=NULL)
-    ncon   =1;  // no of weights for each vertex
-    
-    tpwgts = new PartitionerData::RealT[ncon*nparts];
-    for(int i=0; i<(ncon*nparts); ++i) tpwgts[i] = 1./nparts;
-    
-    ubvec = new PartitionerData::RealT[ncon];
-    for(int i=0; i<ncon; ++i) ubvec[i] = 1.05;
-    
-    vwgt = new PartitionerData::IndexT[myNodes];
-    for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=1;
+  ncon = 1;  // no of weights for each vertex
+
+  tpwgts = new PartitionerData::RealT[ncon*nparts];
+  for(int i=0; i<(ncon*nparts); ++i) tpwgts[i] = 1./nparts;
 
-      if(PE::GetPE().GetRank(nsp)==0)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=3;
-      if(PE::GetPE().GetRank(nsp)==1)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=10;
-      if(PE::GetPE().GetRank(nsp)==2)
-        for(CFuint i=0; i<(myNodes); ++i) vwgt[i]=5;
-  /// /////////////////////////////////////////////////////////////
+  ubvec = new PartitionerData::RealT[ncon];
+  for(int i=0; i<ncon; ++i) ubvec[i] = 1.05;
+
+  // weights on the vertices from the measured cost, if available
+  std::vector<PartitionerData::IndexT> nodeWeights;
+  computeNodeWeights(nodeWeights);
+  if (nodeWeights.size() > 0) {
+    cf_assert(nodeWeights.size() == myNodes);
+    wgtflag = 2;  // 0 for no weights(vwgt and adjwgt=NULL), 2 weight on vertices only(adjwgt=NULL)
+    vwgt = &nodeWeights[0];
+  }
 
   CFLogDebugMin( "Calling ParMetis::AdaptiveRepart()\n");
   Common::Stopwatch<Common::WallTime> MetisTimer;
@@ -304,7 +387,6 @@ void StdRepart::callParMetisAdaptiveRepart()
   }
   //cout<<" myNodes:"<<PE::GetPE().GetRank(nsp)<<" "<<myNodes<<" "<<i1<<endl;
   delete [] part;
-  delete [] vwgt;
   delete [] tpwgts;
   delete [] ubvec;
 
@@ -18,7 +18,12 @@ namespace COOLFluiD {
 //////////////////////////////////////////////////////////////////////////////
 
 /**
- * This class is a MethodCommand that dynamicaly balances the mesh
+ * This class is a MethodCommand that computes a new partitioning of the mesh
+ * with ParMETIS_V3_AdaptiveRepart, weighting the nodes with the measured cost
+ * of the cells around them (see CostSocket) when it is available.
+ * The cells and nodes to move are negotiated and exchanged, but the new
+ * partitioning is not applied to the mesh: the states, past states and
+ * sockets are not migrated and the result is only written for inspection.
  *
  * @author
  *
@@ -27,6 +32,12 @@ class StdRepart : public ParMetisBalancerCom {
 
 public: // functions
 
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
   /**
    * Constructor
    */
@@ -73,6 +84,13 @@ private: // helper functions
   */
   void setupCSR();
 
+  /**
+  * Computes the weights of the owned nodes from the measured cost of the
+  * cells around them. The weights are left empty if no cost is available.
+  * The measured cost is reset, to start a new measurement window.
+  */
+  void computeNodeWeights(std::vector<Framework::PartitionerData::IndexT>& weights);
+
   /**
   * Parmetis ParMETIS_V3_AdaptiveRepart is called to calculate new mesch partitoning
   */
@@ -172,6 +190,12 @@ private: // data
   
   Framework::DataHandle < Framework::State*, Framework::GLOBAL > m_states;
 
+  /// name of the socket storing the measured cost of each cell
+  std::string m_costSocketName;
+
+  /// weight given to the nodes around the most expensive cells
+  CFuint m_maxWeight;
+
 
 }; // class ReadCFmesh
 
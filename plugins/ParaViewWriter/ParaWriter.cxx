@@ -116,7 +116,7 @@ void ParaWriter::openImpl()
 {
   CFAUTOTRACE;
   computeFullOutputName();
-  m_data->setFilename(m_fullOutputName);
+  m_data->setFilename(getWritePath());
 }
 
 //////////////////////////////////////////////////////////////////////////////
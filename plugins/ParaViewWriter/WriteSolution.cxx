@@ -71,7 +71,7 @@ void WriteSolution::execute()
   
   if(m_fileFormatStr == "ASCII")
   {
-    writeToFile(getMethodData().getFilename());
+    getMethodData().writeOutput(*this, getMethodData().getFilename());
   }
   else
   {
@@ -100,7 +100,7 @@ void WriteSolution::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolution::writeToFileStream(std::ofstream& fout)
+void WriteSolution::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -540,7 +540,7 @@ void WriteSolution::writeToFileStream(std::ofstream& fout)
   fout << "</VTKFile>\n";
 
   // close the file
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
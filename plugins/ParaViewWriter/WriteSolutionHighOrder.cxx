@@ -69,7 +69,7 @@ void WriteSolutionHighOrder::execute()
   
   if(m_fileFormatStr == "ASCII")
   {
-    writeToFile(getMethodData().getFilename());
+    getMethodData().writeOutput(*this, getMethodData().getFilename());
   }
   else
   {
@@ -98,7 +98,7 @@ void WriteSolutionHighOrder::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
+void WriteSolutionHighOrder::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -547,7 +547,7 @@ void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
   fout << "</VTKFile>\n";
 
   // close the file
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
@@ -6,9 +6,12 @@
 
 #include "Petsc/BaseSetup.hh" // must come first because includes PetscHeaders
 
+#include <limits>
+
 #include "Framework/MeshData.hh"
 #include "Framework/State.hh"
 #include "Common/PE.hh"
+#include "Common/BadValueException.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +66,18 @@ void BaseSetup::execute()
   const bool useNodeBased = getMethodData().useNodeBased();
   const CFuint nbStates = (!useNodeBased) ? states.size() : nodes.size();
   
+  CFgid totalNbStates = nbStates;
+  if (PE::GetPE().IsParallel()) {
+    totalNbStates = (!useNodeBased) ? states.getGlobalSize() : nodes.getGlobalSize();
+  }
+  
+  // the LSS row and column IDs are stored as CFint
+  const CFgid nbEqs = getMethodData().getNbSysEquations();
+  if (totalNbStates*nbEqs > static_cast<CFgid>(numeric_limits<CFint>::max())) {
+    throw BadValueException
+      (FromHere(), "BaseSetup::execute() => the system has too many rows for the LSS indices");
+  }
+  
   // set the index mapping (global IDs to global Petsc IDs)
   setIdxMapping();
 
@@ -74,14 +89,6 @@ void BaseSetup::execute()
     }
   }
   
-  CFuint totalNbStates = 0;
-  if (PE::GetPE().IsParallel()) {
-    totalNbStates = (!useNodeBased) ? states.getGlobalSize() : nodes.getGlobalSize();
-  }
-  else {
-    totalNbStates = nbStates;
-  }
-
   // set the vectors
   setVectors(nbUpdatableStates, totalNbStates);
 
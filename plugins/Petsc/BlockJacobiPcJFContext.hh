@@ -9,6 +9,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include "Framework/DataStorage.hh"
 #include "MathTools/RealMatrix.hh"
 #include "Common/ConnectivityTable.hh"
@@ -33,7 +35,8 @@ class BlockJacobiPcJFContext {
 public: // functions
 
   /// Constructor
-  BlockJacobiPcJFContext() : diagMatrices(CFNULL), upLocalIDsAll(CFNULL) {}
+  BlockJacobiPcJFContext() : 
+    diagMatrices(CFNULL), upLocalIDsAll(CFNULL), singlePrecision(false), invMatricesSP(CFNULL) {}
   
   /// handle of diagonal inverted matrices
   Common::SafePtr<Framework::DataSocketSink<CFreal> > diagMatrices;
@@ -44,6 +47,13 @@ public: // functions
   /// pointer to JFContext - we will use bkpStates from this object during the LU-SGS preconditioning
   JFContext* pJFC;
   
+  /// flag telling that the inverted matrices are stored in single precision
+  /// in invMatricesSP instead of diagMatrices
+  bool singlePrecision;
+  
+  /// inverted diagonal matrices in single precision
+  const std::vector<CFfloat>* invMatricesSP;
+  
 }; // end of class BlockJacobiPcJFContext
 
 //////////////////////////////////////////////////////////////////////////////
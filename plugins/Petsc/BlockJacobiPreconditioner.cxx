@@ -12,7 +12,7 @@
 #include "Framework/SpaceMethodData.hh"
 #include "Framework/GlobalJacobianSparsity.hh"
 #include "Framework/MethodStrategyProvider.hh"
-#include "MathTools/MatrixInverter.hh"
+#include "MathTools/BatchedBlockInverter.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -39,13 +39,27 @@ BlockJacobiPreconditionerProvider("BJacobi");
 
 //////////////////////////////////////////////////////////////////////////////
 
+void BlockJacobiPreconditioner::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< bool >
+    ("SinglePrecision","Apply the inverted diagonal blocks in single precision (the vectors stay in double).");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 BlockJacobiPreconditioner::BlockJacobiPreconditioner(const std::string& name) :
   ShellPreconditioner(name),
   socket_diagMatrices("diagMatrices"),
   socket_upLocalIDsAll("upLocalIDsAll"),
   _pcc(),
-  _inverter(CFNULL)
+  _inverter(CFNULL),
+  _invMatricesSP(),
+  _nbDiagEntries(0)
 {
+  addConfigOptionsTo(this);
+  
+  _singlePrecision = false;
+  setParameter("SinglePrecision",&_singlePrecision);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -62,8 +76,10 @@ void BlockJacobiPreconditioner::setPreconditioner()
   _pcc.pJFC = getMethodData().getJFContext();
   _pcc.diagMatrices = &socket_diagMatrices;
   _pcc.upLocalIDsAll = &socket_upLocalIDsAll;
+  _pcc.singlePrecision = _singlePrecision;
+  _pcc.invMatricesSP = &_invMatricesSP;
 
-  _inverter.reset(MatrixInverter::create(getMethodData().getNbSysEquations(), false));
+  _inverter.reset(new BatchedBlockInverter(getMethodData().getNbSysEquations()));
 
   DataHandle<State*, GLOBAL> states = _pcc.pJFC->states->getDataHandle();
 
@@ -82,18 +98,30 @@ void BlockJacobiPreconditioner::computeBeforeSolving()
   const CFuint nbEqs2 = nbEqs*nbEqs;
   const CFuint nbUpdatableStates = diagMatrices.size()/nbEqs2;
 
-  RealMatrix invMat(nbEqs, nbEqs);
-  RealMatrix matIter(nbEqs, nbEqs, &diagMatrices[0]);
-
-  for (CFuint i = 0; i < nbUpdatableStates; ++i) {
-    // the matrix is used as an iterator here
-    matIter.wrap(nbEqs, nbEqs, &diagMatrices[i*nbEqs2]);
-    _inverter->invert(matIter,invMat);
-    
-    for (CFuint m = 0; m < nbEqs2; ++m) {
-      matIter[m] = invMat[m];
+  // the inversion is always done in double precision, only the result
+  // applied at each Krylov iteration is rounded
+  _inverter->invert(&diagMatrices[0], nbUpdatableStates);
+  
+  if (_singlePrecision) {
+    const CFuint size = nbUpdatableStates*nbEqs2;
+    _invMatricesSP.resize(size);
+    for (CFuint m = 0; m < size; ++m) {
+      _invMatricesSP[m] = static_cast<CFfloat>(diagMatrices[m]);
     }
+    
+    // the double precision matrices are not used until the next assembly
+    _nbDiagEntries = diagMatrices.size();
+#if defined(CF_HAVE_CUDA)
+    diagMatrices.getLocalArray()->free();
+#elif defined(CF_ENABLE_GROWARRAY)
+    diagMatrices.resize(0);
+#else
+    std::vector<CFreal>().swap(*diagMatrices.getLocalArray());
+#endif
   }
+  
+  CFLog(VERBOSE, "BlockJacobiPreconditioner::computeBeforeSolving() => "
+	<< _inverter->getNbFallbackBlocks() << " nearly singular blocks inverted alone\n");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -102,6 +130,10 @@ void BlockJacobiPreconditioner::computeAfterSolving()
 {
   // reset to 0 all the matrices
   DataHandle<CFreal> diagMatrices = socket_diagMatrices.getDataHandle(); 
+  if (_singlePrecision) {
+    // storage released by computeBeforeSolving()
+    diagMatrices.resize(_nbDiagEntries);
+  }
   for (CFuint i =0 ; i < diagMatrices.size(); ++i) {
     diagMatrices[i] = 0.0;
   }
@@ -137,20 +169,40 @@ PetscErrorCode BlockJacobiPcApply(PC pc, Vec X, Vec Y)
 
   // getting nuber of equations
   DataHandle<State*, GLOBAL> states = pcContext->pJFC->states->getDataHandle();
-  const CFint nbUpdatableStates = diagMatInv.size()/nbEqs2;
-
-  RealVector tmpX(nbEqs, &x[0]);
-  RealVector tmpY(nbEqs, &y[0]);
-  RealMatrix invMatIter(nbEqs, nbEqs, &diagMatInv[0]);
-
-  for(CFint i = 0; i < nbUpdatableStates; ++i)
-  {
-    const CFuint startIdx = i*nbEqs;
-    tmpX.wrap(nbEqs,&x[startIdx]);
-    tmpY.wrap(nbEqs,&y[startIdx]);
-    invMatIter.wrap(nbEqs, nbEqs, &diagMatInv[i*nbEqs2]);
+  const CFint nbUpdatableStates = (!pcContext->singlePrecision) ?
+    diagMatInv.size()/nbEqs2 : pcContext->invMatricesSP->size()/nbEqs2;
+
+  if (!pcContext->singlePrecision) {
+    RealVector tmpX(nbEqs, &x[0]);
+    RealVector tmpY(nbEqs, &y[0]);
+    RealMatrix invMatIter(nbEqs, nbEqs, &diagMatInv[0]);
     
-    tmpY = invMatIter*tmpX;
+    for(CFint i = 0; i < nbUpdatableStates; ++i)
+    {
+      const CFuint startIdx = i*nbEqs;
+      tmpX.wrap(nbEqs,&x[startIdx]);
+      tmpY.wrap(nbEqs,&y[startIdx]);
+      invMatIter.wrap(nbEqs, nbEqs, &diagMatInv[i*nbEqs2]);
+      
+      tmpY = invMatIter*tmpX;
+    }
+  }
+  else {
+    // single precision blocks, double precision vectors and accumulation
+    const CFfloat *const invMatSP = &(*pcContext->invMatricesSP)[0];
+    for(CFint i = 0; i < nbUpdatableStates; ++i)
+    {
+      const CFuint startIdx = i*nbEqs;
+      const CFfloat *const block = &invMatSP[i*nbEqs2];
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	const CFfloat *const row = &block[iEq*nbEqs];
+	CFreal sum = 0.;
+	for (CFuint jEq = 0; jEq < nbEqs; ++jEq) {
+	  sum += static_cast<CFreal>(row[jEq])*x[startIdx + jEq];
+	}
+	y[startIdx + iEq] = sum;
+      }
+    }
   }
 
   // restoring of arrays X - vector to be preconditioned and Y - preconditioned vector
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include <memory>
+#include <vector>
 
 #include "Petsc/ShellPreconditioner.hh"
 #include "Petsc/BlockJacobiPcJFContext.hh"
@@ -19,7 +20,7 @@
 namespace COOLFluiD {
   
   namespace MathTools { 
-    class MatrixInverter; 
+    class BatchedBlockInverter; 
   }
   
   namespace Petsc {
@@ -29,6 +30,14 @@ namespace COOLFluiD {
 /**
  * This class represents a shell preconditioner object
  *
+ * With SinglePrecision, the inverted diagonal blocks are rounded to CFfloat
+ * and kept in a separate array, so that each application reads half of the
+ * data, while the double precision blocks are released until the next
+ * assembly. Only this shell preconditioner of the
+ * Jacobian-free solvers is covered: the blocks are still assembled in
+ * double precision by the space method, and the assembled PETSc matrices
+ * keep the scalar type of the PETSc build.
+ *
  * @author Jiri Simonek
  *
  */
@@ -84,8 +93,17 @@ private:
   /// BlockJacobi context 
   BlockJacobiPcJFContext _pcc;
   
-  /// temporary data for holding the matrix inverter
-  std::auto_ptr<MathTools::MatrixInverter> _inverter;
+  /// inverter of all the diagonal blocks at once
+  std::auto_ptr<MathTools::BatchedBlockInverter> _inverter;
+  
+  /// flag telling to apply the inverted matrices in single precision
+  bool _singlePrecision;
+  
+  /// inverted diagonal matrices rounded to single precision
+  std::vector<CFfloat> _invMatricesSP;
+  
+  /// size of the storage of the diagonal matrices assembled in double precision
+  CFuint _nbDiagEntries;
   
 }; // end of class BlockJacobiPreconditioner
     
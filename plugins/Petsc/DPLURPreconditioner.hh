@@ -19,7 +19,7 @@
 namespace COOLFluiD {
   
   namespace MathTools { 
-    class MatrixInverter; 
+    class BatchedBlockInverter; 
   }
   
 	namespace Petsc {
@@ -84,8 +84,8 @@ private:
   /// DPLUR context 
   DPLURPcJFContext _pcc;
   
-  /// temporary data for holding the matrix inverter
-  std::auto_ptr<MathTools::MatrixInverter> _inverter;
+  /// inverter of all the diagonal blocks at once
+  std::auto_ptr<MathTools::BatchedBlockInverter> _inverter;
   
   /// Omega - under/over relaxation parameter
   CFreal _omega;
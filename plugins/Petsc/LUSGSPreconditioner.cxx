@@ -12,7 +12,7 @@
 #include "Framework/SpaceMethodData.hh"
 #include "Framework/GlobalJacobianSparsity.hh"
 #include "Framework/MethodStrategyProvider.hh"
-#include "MathTools/MatrixInverter.hh"
+#include "MathTools/BatchedBlockInverter.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -83,7 +83,7 @@ void LUSGSPreconditioner::setPreconditioner()
     getMethodData().getCollaborator<SpaceMethod>()->createJacobianSparsity();
   sparsity->computeMatrixPattern(*_pcc.pJFC->states, _pcc.stateNeighbors);
 
-  _inverter.reset(MatrixInverter::create(getMethodData().getNbSysEquations(), false));
+  _inverter.reset(new BatchedBlockInverter(getMethodData().getNbSysEquations()));
 
   // pointer to the SpaceMethod
   SafePtr<SpaceMethod> spaceMethod = _pcc.pJFC->spaceMethod;
@@ -107,18 +107,10 @@ void LUSGSPreconditioner::computeBeforeSolving()
   const CFuint nbEqs2 = nbEqs*nbEqs;
   const CFuint nbUpdatableStates = diagMatrices.size()/nbEqs2;
 
-  RealMatrix invMat(nbEqs, nbEqs);
-  RealMatrix matIter(nbEqs, nbEqs, &diagMatrices[0]);
-
-  for (CFuint i = 0; i < nbUpdatableStates; ++i) {
-    // the matrix is used as an iterator here
-    matIter.wrap(nbEqs, nbEqs, &diagMatrices[i*nbEqs2]);
-    _inverter->invert(matIter,invMat);
-
-    for (CFuint m = 0; m < nbEqs2; ++m) {
-      matIter[m] = invMat[m];
-    }
-  }
+  _inverter->invert(&diagMatrices[0], nbUpdatableStates);
+  
+  CFLog(VERBOSE, "LUSGSPreconditioner::computeBeforeSolving() => "
+	<< _inverter->getNbFallbackBlocks() << " nearly singular blocks inverted alone\n");
 }
 
 //////////////////////////////////////////////////////////////////////////////
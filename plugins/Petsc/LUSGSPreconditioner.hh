@@ -19,7 +19,7 @@
 namespace COOLFluiD {
   
   namespace MathTools { 
-    class MatrixInverter; 
+    class BatchedBlockInverter; 
   }
   
   namespace Petsc {
@@ -88,8 +88,8 @@ private:
   /// omega - relaxation factor
   CFreal _omega;
   
-  /// temporary data for holding the matrix inverter
-  std::auto_ptr<MathTools::MatrixInverter> _inverter;
+  /// inverter of all the diagonal blocks at once
+  std::auto_ptr<MathTools::BatchedBlockInverter> _inverter;
 
 }; // end of class LUSGSPreconditioner
     
@@ -59,7 +59,7 @@ void NewParSetup::setIdxMapping()
   const bool useNodeBased = getMethodData().useNodeBased();
   const CFuint nbStates = (!useNodeBased) ? states.size() : nodes.size();
   
-  std::valarray<CFuint> stateGlobalIDs(nbStates);
+  std::valarray<CFgid> stateGlobalIDs(nbStates);
   std::valarray<bool> isGhost(nbStates);
   
   if (!useNodeBased) {
@@ -153,6 +153,7 @@ void NewParSetup::setMatrix(const CFuint localSize,
   // create a parallel sparse matrix in block compressed row format
   mat.setGPU(getMethodData().useGPU());
   mat.setAIJ(getMethodData().useAIJ());
+  mat.setDirectAssembly(getMethodData().useDirectAssembly());
   mat.createParBAIJ(PE::GetPE().GetCommunicator(nsp),
                     nbEqs,
                     localSize*nbEqs,
@@ -80,7 +80,7 @@ void ParJFSetup::setIdxMapping()
   // build a contiguos mapping
   states.buildContiguosGlobal();
 
-  std::valarray<CFuint> stateGlobalIDs(nbStates);
+  std::valarray<CFgid> stateGlobalIDs(nbStates);
   std::valarray<bool> isGhost(nbStates);
   for (CFuint i = 0; i< nbStates; ++i) {
     stateGlobalIDs[i] = states.getContiguosID(states[i]->getLocalID());
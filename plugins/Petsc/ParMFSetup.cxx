@@ -71,7 +71,7 @@ void ParMFSetup::setIdxMapping()
   // build a contiguos mapping
   states.buildContiguosGlobal();
 
-  std::valarray<CFuint> stateGlobalIDs(nbStates);
+  std::valarray<CFgid> stateGlobalIDs(nbStates);
   std::valarray<bool> isGhost(nbStates);
   for (CFuint i = 0; i< nbStates; ++i) {
     stateGlobalIDs[i] = states.getContiguosID(states[i]->getLocalID());
@@ -177,6 +177,8 @@ void PetscLSS::setMethodImpl()
 {
 
   LinearSystemSolver::setMethodImpl();
+  m_data->getPreconditionerMatrix().setName(getName() + "/PreconditionerMatrix");
+  m_data->getJFMatrix().setName(getName() + "/JFMatrix");
 
 //  setupCommandsAndStrategies();
 
@@ -44,6 +44,7 @@ void PetscLSSData::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< string >("ShellPreconditioner","Shell preconditioner.");
   options.addConfigOption< bool >("DifferentPreconditionerMatrix", "Enable/Disable usage of different matrix for preconditioner");
   options.addConfigOption< bool >("UseAIJ", "Tell if AIJ structure must be used insted of BAIJ (default)");
+  options.addConfigOption< bool >("DirectAssembly", "Add the block contributions directly in the BAIJ matrix storage once its structure is frozen.");
 }
       
 //////////////////////////////////////////////////////////////////////////////
@@ -102,6 +103,9 @@ PetscLSSData::PetscLSSData(SafePtr<std::valarray<bool> > maskArray,
   _useAIJ = false;
   setParameter("UseAIJ", &_useAIJ);
   
+  _directAssembly = false;
+  setParameter("DirectAssembly", &_directAssembly);
+  
   PetscOptions::setAllOptions();
 }
 
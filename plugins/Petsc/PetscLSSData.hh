@@ -252,6 +252,11 @@ public:
    */
   bool useAIJ() {return _useAIJ;}
   
+  /**
+   * Tell if the block contributions are added directly in the matrix storage
+   */
+  bool useDirectAssembly() {return _directAssembly;}
+  
 private:
 
   /// Shell preconditioner
@@ -322,6 +327,9 @@ private:
 
   /// Use the AIJ structure instead of BAIJ
   bool _useAIJ;
+  
+  /// Add the block contributions directly in the BAIJ matrix storage
+  bool _directAssembly;
     
 }; // end of class PetscLSSData
 
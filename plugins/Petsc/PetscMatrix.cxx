@@ -6,7 +6,10 @@
 
 #include "Petsc/PetscHeaders.hh" // must come before any header
 
+#include <algorithm>
+
 #include "Common/PE.hh"
+#include "Common/SwapEmpty.hh"
 #include "Framework/BlockAccumulator.hh"
 #include "Petsc/PetscMatrix.hh"
 
@@ -22,7 +25,27 @@ PetscMatrix::PetscMatrix() :
   Framework::LSSMatrix(),
   m_mat(),
   _isMatShell(false),
-  _isAIJ(false)
+  _isAIJ(false),
+  m_directAssembly(false),
+  m_isFrozen(false),
+  m_inDirectPass(false),
+  m_slotsReady(false),
+  m_callID(0),
+  m_callStart(),
+  m_callIdx(),
+  m_slots(),
+  m_diagRowStart(),
+  m_diagCols(),
+  m_offRowStart(),
+  m_offCols(),
+  m_rowStart(0),
+  m_colStart(0),
+  m_colEnd(0),
+  m_diagMat(CFNULL),
+  m_offMat(CFNULL),
+  m_diagValues(CFNULL),
+  m_offValues(CFNULL),
+  m_blockSize(0)
 {
 }
       
@@ -34,6 +57,22 @@ PetscMatrix::~PetscMatrix()
 
 //////////////////////////////////////////////////////////////////////////////
 
+CFdouble PetscMatrix::getMemoryBytes() const
+{
+  if (m_mat == CFNULL || _isMatShell) return 0.;
+  
+  // the sequential shell matrices are not flagged as such
+  PetscBool isShell = PETSC_FALSE;
+  CF_CHKERRCONTINUE(PetscObjectTypeCompare((PetscObject) m_mat, MATSHELL, &isShell));
+  if (isShell) return 0.;
+  
+  MatInfo info;
+  CF_CHKERRCONTINUE(MatGetInfo(m_mat, MAT_LOCAL, &info));
+  return info.memory;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void PetscMatrix::createSeqAIJ(const CFint m,
                                const CFint n,
                                const CFint nz,
@@ -232,12 +271,254 @@ void PetscMatrix::setValues(const Framework::BlockAccumulator& acc)
 void PetscMatrix::addValues(const Framework::BlockAccumulator& acc)
 {
   CFLog(DEBUG_MIN, "PetscMatrix::addValues()\n");
+  if (m_inDirectPass && addValuesDirect(acc)) return;
+  
   CF_CHKERRCONTINUE( MatSetValuesBlocked(m_mat,acc.getM(),&acc.getIM()[0],acc.getN(),&acc.getIN()[0],
 					 const_cast<Framework::BlockAccumulator&>(acc).getPtr(), ADD_VALUES) );
 }
       
 //////////////////////////////////////////////////////////////////////////////
 
+/// Copy the block rows of a SeqBAIJ matrix, with the columns given as
+/// global block IDs (through colMap if not null, else shifted by colShift)
+static bool getBlockRows(Mat mat, const PetscInt* colMap, const CFint colShift,
+			 std::vector<CFint>& rowStart, std::vector<CFint>& cols)
+{
+  PetscInt nbRows = 0;
+  const PetscInt* ia = CFNULL;
+  const PetscInt* ja = CFNULL;
+  PetscBool done = PETSC_FALSE;
+  CF_CHKERRCONTINUE(MatGetRowIJ(mat, 0, PETSC_FALSE, PETSC_TRUE, &nbRows, &ia, &ja, &done));
+  if (!done) return false;
+  
+  rowStart.assign(ia, ia + nbRows + 1);
+  cols.resize(ia[nbRows]);
+  for (CFuint k = 0; k < cols.size(); ++k) {
+    cols[k] = (colMap != CFNULL) ? colMap[ja[k]] : ja[k] + colShift;
+  }
+  
+  CF_CHKERRCONTINUE(MatRestoreRowIJ(mat, 0, PETSC_FALSE, PETSC_TRUE, &nbRows, &ia, &ja, &done));
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PetscMatrix::startDirectPass()
+{
+  cf_assert(!m_inDirectPass);
+  
+  // the local parts of the matrix, whose structure does not change anymore
+  PetscBool isMPI = PETSC_FALSE;
+  PetscBool isSeq = PETSC_FALSE;
+  CF_CHKERRCONTINUE(PetscObjectTypeCompare((PetscObject) m_mat, MATMPIBAIJ, &isMPI));
+  CF_CHKERRCONTINUE(PetscObjectTypeCompare((PetscObject) m_mat, MATSEQBAIJ, &isSeq));
+  
+  const PetscInt* colMap = CFNULL;
+  m_offMat = CFNULL;
+  if (isMPI) {
+    CF_CHKERRCONTINUE(MatMPIBAIJGetSeqBAIJ(m_mat, &m_diagMat, &m_offMat, &colMap));
+  }
+  else if (isSeq) {
+    m_diagMat = m_mat;
+  }
+  else {
+    disableDirectAssembly("the matrix is not a BAIJ matrix");
+    return;
+  }
+  
+  if (!m_slotsReady) {
+    PetscInt bs = 0;
+    PetscInt rstart = 0;
+    PetscInt rend = 0;
+    PetscInt cstart = 0;
+    PetscInt cend = 0;
+    CF_CHKERRCONTINUE(MatGetBlockSize(m_mat, &bs));
+    CF_CHKERRCONTINUE(MatGetOwnershipRange(m_mat, &rstart, &rend));
+    CF_CHKERRCONTINUE(MatGetOwnershipRangeColumn(m_mat, &cstart, &cend));
+    m_blockSize = bs;
+    m_rowStart  = rstart/bs;
+    m_colStart  = cstart/bs;
+    m_colEnd    = cend/bs;
+    
+    bool done = getBlockRows(m_diagMat, CFNULL, m_colStart, m_diagRowStart, m_diagCols);
+    if (done && m_offMat != CFNULL) {
+      done = getBlockRows(m_offMat, colMap, 0, m_offRowStart, m_offCols);
+    }
+    if (!done) {
+      disableDirectAssembly("the block structure of the matrix is not available");
+      return;
+    }
+    
+    m_callStart.assign(2, 0);
+    m_callIdx.clear();
+    m_slots.clear();
+  }
+  
+  CF_CHKERRCONTINUE(MatSeqBAIJGetArray(m_diagMat, &m_diagValues));
+  if (m_offMat != CFNULL) {
+    CF_CHKERRCONTINUE(MatSeqBAIJGetArray(m_offMat, &m_offValues));
+  }
+  
+  m_callID = 0;
+  m_inDirectPass = true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PetscMatrix::endDirectPass()
+{
+  cf_assert(m_inDirectPass);
+  
+  CF_CHKERRCONTINUE(MatSeqBAIJRestoreArray(m_diagMat, &m_diagValues));
+  if (m_offMat != CFNULL) {
+    CF_CHKERRCONTINUE(MatSeqBAIJRestoreArray(m_offMat, &m_offValues));
+  }
+  m_inDirectPass = false;
+  
+  if (!m_slotsReady) {
+    m_slotsReady = true;
+    Common::SwapEmpty(m_diagRowStart);
+    Common::SwapEmpty(m_diagCols);
+    Common::SwapEmpty(m_offRowStart);
+    Common::SwapEmpty(m_offCols);
+    
+    CFLog(VERBOSE, "PetscMatrix::endDirectPass() => slots of "
+	  << m_callID << " contributions recorded\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool PetscMatrix::addValuesDirect(const Framework::BlockAccumulator& acc)
+{
+  const CFuint m  = acc.getM();
+  const CFuint n  = acc.getN();
+  const CFuint nb = acc.getNB();
+  if (nb != m_blockSize) {
+    disableDirectAssembly("the contributions do not have the block size of the matrix");
+    return false;
+  }
+  
+  const std::vector<CFint>& im = acc.getIM();
+  const std::vector<CFint>& in = acc.getIN();
+  if (!m_slotsReady) {
+    recordSlots(acc);
+  }
+  else {
+    // check that this contribution is the recorded one
+    bool isSame = (m_callID + 1 < m_callStart.size()/2);
+    if (isSame) {
+      const CFuint start = m_callStart[2*m_callID];
+      isSame = (m_callStart[2*m_callID+2] - start == 1 + m + n) &&
+	(m_callIdx[start] == static_cast<CFint>(m)) &&
+	std::equal(im.begin(), im.begin() + m, &m_callIdx[start+1]) &&
+	std::equal(in.begin(), in.begin() + n, &m_callIdx[start+1+m]);
+    }
+    if (!isSame) {
+      disableDirectAssembly("the contributions differ from the recorded ones");
+      return false;
+    }
+  }
+  
+  const CFint* slots = &m_slots[m_callStart[2*m_callID+1]];
+  ++m_callID;
+  
+  // the accumulator stores its values by rows, BAIJ stores each block by columns
+  const CFreal* values = const_cast<Framework::BlockAccumulator&>(acc).getPtr();
+  const CFuint bs2 = nb*nb;
+  const CFuint rowSize = n*nb;
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      const CFint slot = slots[i*n + j];
+      if (slot == -1) continue;
+      
+      PetscScalar* block = (slot >= 0) ? m_diagValues + slot*bs2 :
+	m_offValues + (-slot-2)*bs2;
+      const CFreal* v = values + i*nb*rowSize + j*nb;
+      for (CFuint r = 0; r < nb; ++r) {
+	for (CFuint c = 0; c < nb; ++c) {
+	  block[c*nb + r] += v[r*rowSize + c];
+	}
+      }
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PetscMatrix::recordSlots(const Framework::BlockAccumulator& acc)
+{
+  const CFuint m = acc.getM();
+  const CFuint n = acc.getN();
+  const std::vector<CFint>& im = acc.getIM();
+  const std::vector<CFint>& in = acc.getIN();
+  
+  m_callIdx.push_back(m);
+  m_callIdx.insert(m_callIdx.end(), im.begin(), im.begin() + m);
+  m_callIdx.insert(m_callIdx.end(), in.begin(), in.begin() + n);
+  
+  // negative indices are ignored, as in MatSetValuesBlocked()
+  for (CFuint i = 0; i < m; ++i) {
+    for (CFuint j = 0; j < n; ++j) {
+      m_slots.push_back((im[i] >= 0 && in[j] >= 0) ? findSlot(im[i], in[j]) : -1);
+    }
+  }
+  
+  m_callStart.push_back(m_callIdx.size());
+  m_callStart.push_back(m_slots.size());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFint PetscMatrix::findSlot(const CFint row, const CFint col) const
+{
+  const bool isDiag = (col >= m_colStart && col < m_colEnd);
+  const std::vector<CFint>& rowStart = isDiag ? m_diagRowStart : m_offRowStart;
+  const std::vector<CFint>& cols = isDiag ? m_diagCols : m_offCols;
+  
+  // blocks outside the frozen structure are dropped, as PETSc does
+  const CFint localRow = row - m_rowStart;
+  if (cols.empty() || localRow < 0 ||
+      localRow + 1 >= static_cast<CFint>(rowStart.size())) return -1;
+  
+  const CFint* first = &cols[0] + rowStart[localRow];
+  const CFint* last  = &cols[0] + rowStart[localRow+1];
+  const CFint* itr = std::lower_bound(first, last, col);
+  if (itr == last || *itr != col) return -1;
+  
+  const CFint k = itr - &cols[0];
+  return isDiag ? k : -k-2;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void PetscMatrix::disableDirectAssembly(const std::string& reason)
+{
+  if (m_inDirectPass) {
+    CF_CHKERRCONTINUE(MatSeqBAIJRestoreArray(m_diagMat, &m_diagValues));
+    if (m_offMat != CFNULL) {
+      CF_CHKERRCONTINUE(MatSeqBAIJRestoreArray(m_offMat, &m_offValues));
+    }
+    m_inDirectPass = false;
+  }
+  
+  m_directAssembly = false;
+  m_isFrozen = false;
+  m_slotsReady = false;
+  Common::SwapEmpty(m_diagRowStart);
+  Common::SwapEmpty(m_diagCols);
+  Common::SwapEmpty(m_offRowStart);
+  Common::SwapEmpty(m_offCols);
+  Common::SwapEmpty(m_callStart);
+  Common::SwapEmpty(m_callIdx);
+  Common::SwapEmpty(m_slots);
+  
+  CFLog(INFO, "PetscMatrix: direct assembly disabled, " << reason << "\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void PetscMatrix::printToScreen() const
 {
   CF_CHKERRCONTINUE(MatAssemblyBegin(m_mat,MAT_FINAL_ASSEMBLY));
@@ -188,6 +188,10 @@ public: // functions
     MatAssemblyType matAssType = (assemblyType == FLUSH_ASSEMBLY) ?
       MAT_FLUSH_ASSEMBLY : MAT_FINAL_ASSEMBLY;
     CF_CHKERRCONTINUE(MatAssemblyEnd(m_mat, matAssType));
+    
+    if (m_inDirectPass && assemblyType == FINAL_ASSEMBLY) {
+      endDirectPass();
+    }
   }
 
   /**
@@ -195,6 +199,12 @@ public: // functions
    */
   void printToScreen() const;
 
+  /**
+   * @return the number of bytes allocated by PETSc for the local part
+   *         of this matrix (0 for a shell matrix)
+   */
+  CFdouble getMemoryBytes() const;
+
   /**
    * Print this matrix to a file
    */
@@ -312,6 +322,10 @@ public: // functions
   {
     if (!_isMatShell) {
       CF_CHKERRCONTINUE(MatZeroEntries(m_mat));
+      
+      if (m_isFrozen) {
+	startDirectPass();
+      }
     }
   }
 
@@ -333,6 +347,7 @@ public: // functions
   {
     MatSetOption(m_mat, MAT_NEW_NONZERO_LOCATIONS, PETSC_FALSE);
    // MatSetOption(m_mat, MAT_NEW_NONZERO_LOCATIONS_ERR, PETSC_FALSE);
+    m_isFrozen = m_directAssembly && !_isAIJ && !_isMatShell;
   }
 
   /**
@@ -361,6 +376,54 @@ public: // functions
    */
   void setAIJ(bool isAIJ);
   
+  /**
+   * Enable the direct assembly of the BlockAccumulator's in a BAIJ matrix.
+   * Once the non zero structure is frozen, the first assembly pass (from
+   * resetToZeroEntries() to the final assembly) records where the blocks
+   * of each contribution are in the values of the local matrix, and the
+   * following passes add them there directly, without searching the rows.
+   * A pass whose contributions differ from the recorded ones falls back
+   * to MatSetValuesBlocked() for good.
+   * @param flag true to enable the direct assembly
+   */
+  void setDirectAssembly(bool flag) {m_directAssembly = flag;}
+  
+private: // helper functions
+  
+  /**
+   * Start a pass of direct assembly: get the values of the local matrix
+   * and, the first time, build the block structure to record the slots
+   */
+  void startDirectPass();
+  
+  /**
+   * End the current pass of direct assembly
+   */
+  void endDirectPass();
+  
+  /**
+   * Add the given contribution directly in the values of the local matrix
+   * @return false if the contribution must be added by PETSc
+   */
+  bool addValuesDirect(const Framework::BlockAccumulator& acc);
+  
+  /**
+   * Record the slots of the given contribution
+   */
+  void recordSlots(const Framework::BlockAccumulator& acc);
+  
+  /**
+   * Find the block of the local matrix at the given global block row and
+   * column
+   * @return the slot of the block (see m_slots)
+   */
+  CFint findSlot(const CFint row, const CFint col) const;
+  
+  /**
+   * Stop using the direct assembly
+   */
+  void disableDirectAssembly(const std::string& reason);
+  
 private: // data
 
   /// matrix
@@ -372,6 +435,56 @@ private: // data
   /// flag to tell if the matrix is a AIJ
   bool _isAIJ;
   
+  /// flag telling if the direct assembly is enabled
+  bool m_directAssembly;
+  
+  /// flag telling if the non zero structure is frozen for the direct assembly
+  bool m_isFrozen;
+  
+  /// flag telling if a pass of direct assembly is in progress
+  bool m_inDirectPass;
+  
+  /// flag telling if the slots of the contributions have been recorded
+  bool m_slotsReady;
+  
+  /// index of the next contribution in the current pass
+  CFuint m_callID;
+  
+  /// start of the row and column indices of each contribution in m_callIdx
+  /// and of its slots in m_slots (2 entries per contribution)
+  std::vector<CFuint> m_callStart;
+  
+  /// row and column indices of each recorded contribution
+  std::vector<CFint> m_callIdx;
+  
+  /// block of the local matrix for each block of each contribution:
+  /// k >= 0 is the block k of the diagonal part, k <= -2 the block -k-2
+  /// of the off-diagonal part, -1 a block which is not stored
+  std::vector<CFint> m_slots;
+  
+  /// block rows of the diagonal and off-diagonal parts, used to record the
+  /// slots (the columns are global block IDs)
+  std::vector<CFint> m_diagRowStart;
+  std::vector<CFint> m_diagCols;
+  std::vector<CFint> m_offRowStart;
+  std::vector<CFint> m_offCols;
+  
+  /// first local block row, first and past-the-end local block columns
+  CFint m_rowStart;
+  CFint m_colStart;
+  CFint m_colEnd;
+  
+  /// diagonal and off-diagonal parts of the local matrix
+  Mat m_diagMat;
+  Mat m_offMat;
+  
+  /// values of the diagonal and off-diagonal parts during a direct pass
+  PetscScalar* m_diagValues;
+  PetscScalar* m_offValues;
+  
+  /// size of the blocks
+  CFuint m_blockSize;
+  
 }; // end of class PetscMatrix
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,960 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cmath>
+#include <map>
+
+#include "Common/Stopwatch.hh"
+#include "Common/BadValueException.hh"
+#include "Common/NotImplementedException.hh"
+#include "Environment/DirPaths.hh"
+#include "Environment/ObjectProvider.hh"
+#include "Environment/FileHandlerInput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+#include "Framework/BadFormatException.hh"
+#include "SimpleGlobalMeshAdapter/MetricRefiner.hh"
+#include "SimpleGlobalMeshAdapter/SimpleGlobalMeshAdapter.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Framework;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Environment;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SimpleGlobalMeshAdapter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+Environment::ObjectProvider<MetricRefiner,
+               MeshFormatConverter,
+               SimpleGlobalMeshAdapterModule,
+               1>
+metricRefinerProvider("MetricRefiner");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("FlagsFile","Name of the file with the refinement flags of the cells.");
+  options.addConfigOption< bool >("Coarsen","Coarsen the cells flagged for coarsening.");
+  options.addConfigOption< CFreal >("MinVolumeRatio","Minimum ratio between the volumes of a cell after and before a node collapse.");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MetricRefiner::MetricRefiner(const std::string& name)
+  : MeshFormatConverter(name),
+    _data(new CFmeshReaderWriterSource()),
+    _dim(0),
+    _nbEqs(0),
+    _nbCellNodes(0),
+    _isCellCentered(false)
+{
+  addConfigOptionsTo(this);
+
+  _flagsFile = "adapt_flags.dat";
+  setParameter("FlagsFile",&_flagsFile);
+
+  _coarsen = true;
+  setParameter("Coarsen",&_coarsen);
+
+  _minVolumeRatio = 0.01;
+  setParameter("MinVolumeRatio",&_minVolumeRatio);
+
+  SafePtr<CFmeshReaderWriterSource> ptr = _data.get();
+  _reader.setReadData(ptr);
+  _writer.setWriteData(ptr);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MetricRefiner::~MetricRefiner()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::convertBack(const boost::filesystem::path& filepath)
+{
+  throw Common::NotImplementedException (FromHere(), "MetricRefiner::convertBack()");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::convert(const boost::filesystem::path& fromFilepath,
+                            const boost::filesystem::path& filepath)
+{
+  CFAUTOTRACE;
+
+  Common::Stopwatch<WallTime> stp;
+  stp.start();
+
+  _reader.readFromFile(fromFilepath);
+  adapt();
+  _writer.writeToFile(filepath);
+
+  stp.stop();
+  CFout << "Adapting the CFmesh took: " << stp.read() << "s\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::convertToBuffer(const boost::filesystem::path& fromFilepath,
+                                    std::string& buffer)
+{
+  CFAUTOTRACE;
+
+  Common::Stopwatch<WallTime> stp;
+  stp.start();
+
+  _reader.readFromFile(fromFilepath);
+  adapt();
+  _writer.writeToBuffer(buffer);
+
+  stp.stop();
+  CFout << "Adapting the CFmesh in memory took: " << stp.read() << "s\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::adapt()
+{
+  CFAUTOTRACE;
+
+  CFmeshReaderWriterSource& data = *(_data.get());
+
+  cf_assert(data.getGeometricPolyOrder() == CFPolyOrder::ORDER1);
+  data.consistencyCheck();
+
+  loadMesh();
+  readFlags();
+
+  const CFuint nbCells = _flags.size();
+  const CFuint nbNodes = _nodes.size()/_dim;
+
+  if (_coarsen) {
+    coarsenCells();
+  }
+
+  refineCells();
+
+  CFout << "Adapted mesh: " << nbCells << " -> " << _flags.size() << " cells, "
+        << nbNodes << " -> " << _nodes.size()/_dim << " nodes\n";
+
+  storeMesh();
+
+  data.consistencyCheck();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::readFlags()
+{
+  CFAUTOTRACE;
+
+  boost::filesystem::path file =
+    DirPaths::getInstance().getWorkingDir() / boost::filesystem::path(_flagsFile);
+
+  SelfRegistPtr<FileHandlerInput> fhandle =
+    SingleBehaviorFactory<FileHandlerInput>::getInstance().create();
+  ifstream& fin = fhandle->open(file);
+
+  const CFuint nbCells = _cells.size()/_nbCellNodes;
+
+  CFuint nbFlags = 0;
+  fin >> nbFlags;
+  if (nbFlags != nbCells) {
+    fhandle->close();
+    throw BadFormatException
+      (FromHere(), "MetricRefiner: " + _flagsFile + " has " + StringOps::to_str(nbFlags) +
+       " flags for " + StringOps::to_str(nbCells) + " cells");
+  }
+
+  _flags.resize(nbCells);
+  for (CFuint i = 0; i < nbCells; ++i) {
+    fin >> _flags[i];
+  }
+
+  fhandle->close();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::loadMesh()
+{
+  CFAUTOTRACE;
+
+  CFmeshReaderWriterSource& data = *(_data.get());
+
+  _dim = data.getDimension();
+  _nbEqs = data.getNbEquations();
+  _nbCellNodes = _dim + 1;
+
+  const CFGeoShape::Type simplex = (_dim == DIM_2D) ? CFGeoShape::TRIAG : CFGeoShape::TETRA;
+
+  SafePtr< vector<ElementTypeData> > elementType = data.getElementTypeData();
+  for (CFuint iType = 0; iType < elementType->size(); ++iType) {
+    if ((*elementType)[iType].getGeoShape() != simplex) {
+      const std::string shape =
+        CFGeoShape::Convert::to_str((*elementType)[iType].getGeoShape());
+      throw BadValueException
+        (FromHere(), "MetricRefiner: wrong kind of elements present in the mesh: " + shape);
+    }
+  }
+
+  // the extra variables are not kept by the reader, the writer would write
+  // garbage for them in the adapted mesh
+  if (data.getNbExtraNodalVars() > 0 || data.getNbExtraStateVars() > 0 ||
+      data.getNbExtraVars() > 0) {
+    throw BadValueException
+      (FromHere(), "MetricRefiner: meshes with extra nodal or state variables are not supported");
+  }
+
+  const CFuint nbCells = data.getNbElements();
+  const CFuint nbNodes = data.getTotalNbNodes();
+  _isCellCentered = ((*elementType)[0].getNbStates() == 1);
+  if (!_isCellCentered && data.getTotalNbStates() != nbNodes) {
+    throw BadValueException
+      (FromHere(), "MetricRefiner: the states must be in the nodes or in the cells");
+  }
+
+  SafePtr< Table<CFuint> > elementNode  = data.getElementNode();
+  SafePtr< Table<CFuint> > elementState = data.getElementState();
+
+  _cells.resize(nbCells*_nbCellNodes);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    for (CFuint i = 0; i < _nbCellNodes; ++i) {
+      _cells[iCell*_nbCellNodes + i] = (*elementNode)(iCell,i);
+    }
+  }
+
+  _nodes = *data.getNodeList();
+
+  // in cell centered meshes the state of each cell is stored in the
+  // position of the cell
+  const vector<CFreal>& states = *data.getStateList();
+  if (_isCellCentered) {
+    _states.resize(nbCells*_nbEqs);
+    for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+      const CFuint stateID = (*elementState)(iCell,0);
+      for (CFuint iEq = 0; iEq < _nbEqs; ++iEq) {
+        _states[iCell*_nbEqs + iEq] = states[stateID*_nbEqs + iEq];
+      }
+    }
+  }
+  else {
+    _states = states;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFreal MetricRefiner::computeVolume(const CFuint* cellNodes) const
+{
+  const CFreal* x0 = &_nodes[cellNodes[0]*_dim];
+  const CFreal* x1 = &_nodes[cellNodes[1]*_dim];
+  const CFreal* x2 = &_nodes[cellNodes[2]*_dim];
+
+  if (_dim == DIM_2D) {
+    return (x1[0] - x0[0])*(x2[1] - x0[1]) - (x2[0] - x0[0])*(x1[1] - x0[1]);
+  }
+
+  const CFreal* x3 = &_nodes[cellNodes[3]*_dim];
+  const CFreal a[3] = {x1[0] - x0[0], x1[1] - x0[1], x1[2] - x0[2]};
+  const CFreal b[3] = {x2[0] - x0[0], x2[1] - x0[1], x2[2] - x0[2]};
+  const CFreal c[3] = {x3[0] - x0[0], x3[1] - x0[1], x3[2] - x0[2]};
+  return a[0]*(b[1]*c[2] - b[2]*c[1]) -
+    a[1]*(b[0]*c[2] - b[2]*c[0]) +
+    a[2]*(b[0]*c[1] - b[1]*c[0]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::computeNormal(const CFuint* faceNodes, CFreal* normal) const
+{
+  const CFreal* x0 = &_nodes[faceNodes[0]*_dim];
+  const CFreal* x1 = &_nodes[faceNodes[1]*_dim];
+  const CFreal* x2 = &_nodes[faceNodes[2]*_dim];
+  const CFreal a[3] = {x1[0] - x0[0], x1[1] - x0[1], x1[2] - x0[2]};
+  const CFreal b[3] = {x2[0] - x0[0], x2[1] - x0[1], x2[2] - x0[2]};
+  normal[0] = a[1]*b[2] - a[2]*b[1];
+  normal[1] = a[2]*b[0] - a[0]*b[2];
+  normal[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::getNeighbourNodes(const CFuint a,
+                                      const std::vector<CFuint>& cells,
+                                      std::vector<CFuint>& nodes) const
+{
+  nodes.clear();
+  for (CFuint i = 0; i < cells.size(); ++i) {
+    const CFuint* cellNodes = &_cells[cells[i]*_nbCellNodes];
+    for (CFuint k = 0; k < _nbCellNodes; ++k) {
+      if (cellNodes[k] != a) {
+        nodes.push_back(cellNodes[k]);
+      }
+    }
+  }
+  sort(nodes.begin(), nodes.end());
+  nodes.erase(unique(nodes.begin(), nodes.end()), nodes.end());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool MetricRefiner::isCollapsible(const CFuint a, const CFuint b,
+                                  const std::vector<CFuint>& ball,
+                                  const std::vector<std::vector<CFuint> >& nodeCells) const
+{
+  // cells around the edge ab and around b
+  vector<CFuint> shell;
+  vector<CFuint> ballB;
+  for (CFuint i = 0; i < ball.size(); ++i) {
+    const CFuint* cellNodes = &_cells[ball[i]*_nbCellNodes];
+    if (find(cellNodes, cellNodes + _nbCellNodes, b) != cellNodes + _nbCellNodes) {
+      shell.push_back(ball[i]);
+    }
+  }
+  const vector<CFuint>& cellsB = nodeCells[b];
+  for (CFuint i = 0; i < cellsB.size(); ++i) {
+    if (_flags[cellsB[i]] != -2) {
+      ballB.push_back(cellsB[i]);
+    }
+  }
+
+  // link condition: the nodes common to the neighbours of a and of b
+  // must be the nodes of the cells around the edge ab
+  vector<CFuint> nodesA;
+  vector<CFuint> nodesB;
+  vector<CFuint> nodesAB;
+  getNeighbourNodes(a, ball, nodesA);
+  getNeighbourNodes(b, ballB, nodesB);
+  getNeighbourNodes(a, shell, nodesAB);
+  nodesAB.erase(remove(nodesAB.begin(), nodesAB.end(), b), nodesAB.end());
+
+  vector<CFuint> common;
+  set_intersection(nodesA.begin(), nodesA.end(), nodesB.begin(), nodesB.end(),
+                   back_inserter(common));
+  if (common != nodesAB) {
+    return false;
+  }
+
+  // the cells moved from a to b must not be inverted or flattened
+  vector<CFuint> moved(_nbCellNodes);
+  for (CFuint i = 0; i < ball.size(); ++i) {
+    const CFuint* cellNodes = &_cells[ball[i]*_nbCellNodes];
+    if (find(shell.begin(), shell.end(), ball[i]) == shell.end()) {
+      for (CFuint k = 0; k < _nbCellNodes; ++k) {
+        moved[k] = (cellNodes[k] == a) ? b : cellNodes[k];
+      }
+      const CFreal before = computeVolume(cellNodes);
+      const CFreal after = computeVolume(&moved[0]);
+      if (after*before <= 0. || std::abs(after) < _minVolumeRatio*std::abs(before)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::coarsenCells()
+{
+  CFAUTOTRACE;
+
+  CFmeshReaderWriterSource& data = *(_data.get());
+
+  const CFuint nbNodes = _nodes.size()/_dim;
+  const CFuint nbCells = _flags.size();
+
+  // the boundary nodes are never removed
+  vector<bool> isFixed(nbNodes, false);
+  const CFuint nbTRSs = data.getNbTRSs();
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    TRGeoConn& trGeoConn = data.getTRGeoConn(iTRS);
+    for (CFuint iTR = 0; iTR < trGeoConn.size(); ++iTR) {
+      for (CFuint iGeo = 0; iGeo < trGeoConn[iTR].size(); ++iGeo) {
+        const valarray<CFuint>& faceNodes = trGeoConn[iTR][iGeo].first;
+        for (CFuint k = 0; k < faceNodes.size(); ++k) {
+          isFixed[faceNodes[k]] = true;
+        }
+      }
+    }
+  }
+
+  vector<vector<CFuint> > nodeCells(nbNodes);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    for (CFuint k = 0; k < _nbCellNodes; ++k) {
+      nodeCells[_cells[iCell*_nbCellNodes + k]].push_back(iCell);
+    }
+  }
+
+  // removed cells are flagged with -2
+  vector<bool> isRemoved(nbNodes, false);
+  vector<bool> isLocked(nbNodes, false);
+  vector<CFuint> ball;
+  vector<CFuint> neighbours;
+  vector<pair<CFreal, CFuint> > candidates;
+  CFuint nbCollapsed = 0;
+
+  for (CFuint a = 0; a < nbNodes; ++a) {
+    if (isFixed[a] || isLocked[a]) continue;
+
+    // all the cells around the node must be flagged for coarsening
+    ball.clear();
+    bool toCoarsen = true;
+    for (CFuint i = 0; i < nodeCells[a].size(); ++i) {
+      const CFuint iCell = nodeCells[a][i];
+      if (_flags[iCell] != -2) {
+        ball.push_back(iCell);
+        toCoarsen = toCoarsen && (_flags[iCell] == -1);
+      }
+    }
+    if (!toCoarsen || ball.empty()) continue;
+
+    // collapse on the nearest possible neighbour
+    getNeighbourNodes(a, ball, neighbours);
+    candidates.clear();
+    for (CFuint i = 0; i < neighbours.size(); ++i) {
+      CFreal dist2 = 0.;
+      for (CFuint d = 0; d < _dim; ++d) {
+        const CFreal dx = _nodes[neighbours[i]*_dim + d] - _nodes[a*_dim + d];
+        dist2 += dx*dx;
+      }
+      candidates.push_back(make_pair(dist2, neighbours[i]));
+    }
+    sort(candidates.begin(), candidates.end());
+
+    for (CFuint ic = 0; ic < candidates.size(); ++ic) {
+      const CFuint b = candidates[ic].second;
+      if (!isCollapsible(a, b, ball, nodeCells)) continue;
+
+      for (CFuint i = 0; i < ball.size(); ++i) {
+        CFuint* cellNodes = &_cells[ball[i]*_nbCellNodes];
+        if (find(cellNodes, cellNodes + _nbCellNodes, b) != cellNodes + _nbCellNodes) {
+          _flags[ball[i]] = -2;
+        }
+        else {
+          replace(cellNodes, cellNodes + _nbCellNodes, a, b);
+          nodeCells[b].push_back(ball[i]);
+          // the moved cells are not adapted any further
+          _flags[ball[i]] = 0;
+        }
+      }
+
+      // the nodes around a are left untouched in this pass
+      for (CFuint i = 0; i < neighbours.size(); ++i) {
+        isLocked[neighbours[i]] = true;
+      }
+      isRemoved[a] = true;
+      ++nbCollapsed;
+      break;
+    }
+  }
+
+  // renumber the remaining nodes and cells
+  vector<CFuint> newNodeIDs(nbNodes, 0);
+  CFuint nbNewNodes = 0;
+  for (CFuint i = 0; i < nbNodes; ++i) {
+    if (!isRemoved[i]) {
+      newNodeIDs[i] = nbNewNodes;
+      for (CFuint d = 0; d < _dim; ++d) {
+        _nodes[nbNewNodes*_dim + d] = _nodes[i*_dim + d];
+      }
+      if (!_isCellCentered) {
+        for (CFuint iEq = 0; iEq < _nbEqs; ++iEq) {
+          _states[nbNewNodes*_nbEqs + iEq] = _states[i*_nbEqs + iEq];
+        }
+      }
+      ++nbNewNodes;
+    }
+  }
+  _nodes.resize(nbNewNodes*_dim);
+
+  CFuint nbNewCells = 0;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    if (_flags[iCell] != -2) {
+      for (CFuint k = 0; k < _nbCellNodes; ++k) {
+        _cells[nbNewCells*_nbCellNodes + k] = newNodeIDs[_cells[iCell*_nbCellNodes + k]];
+      }
+      if (_isCellCentered) {
+        for (CFuint iEq = 0; iEq < _nbEqs; ++iEq) {
+          _states[nbNewCells*_nbEqs + iEq] = _states[iCell*_nbEqs + iEq];
+        }
+      }
+      _flags[nbNewCells] = _flags[iCell];
+      ++nbNewCells;
+    }
+  }
+  _cells.resize(nbNewCells*_nbCellNodes);
+  _flags.resize(nbNewCells);
+  _states.resize(((_isCellCentered) ? nbNewCells : nbNewNodes)*_nbEqs);
+
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    TRGeoConn& trGeoConn = data.getTRGeoConn(iTRS);
+    for (CFuint iTR = 0; iTR < trGeoConn.size(); ++iTR) {
+      for (CFuint iGeo = 0; iGeo < trGeoConn[iTR].size(); ++iGeo) {
+        valarray<CFuint>& faceNodes = trGeoConn[iTR][iGeo].first;
+        for (CFuint k = 0; k < faceNodes.size(); ++k) {
+          faceNodes[k] = newNodeIDs[faceNodes[k]];
+        }
+      }
+    }
+  }
+
+  CFout << "MetricRefiner: " << nbCollapsed << " nodes collapsed\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::split(const std::vector<CFuint>& nodes,
+                          const std::vector<CFint>& mid,
+                          const CFuint nbNodes,
+                          std::vector<CFuint>& children) const
+{
+  children.clear();
+
+  const CFuint nbEdges = nbNodes*(nbNodes - 1)/2;
+  CFuint nbMarked = 0;
+  for (CFuint e = 0; e < nbEdges; ++e) {
+    if (mid[e] >= 0) ++nbMarked;
+  }
+
+  // middle node of the edge between the local nodes i and j
+#define MID(i,j) static_cast<CFuint>(mid[getLocalEdge(i,j,nbNodes)])
+
+  if (nbMarked == 0) {
+    children = nodes;
+  }
+  else if (nbMarked == 1) {
+    // bisection: each end of the edge is replaced by its middle
+    for (CFuint i = 0; i < nbNodes; ++i) {
+      for (CFuint j = i+1; j < nbNodes; ++j) {
+        if (mid[getLocalEdge(i,j,nbNodes)] >= 0) {
+          for (CFuint k = 0; k < nbNodes; ++k) {
+            children.push_back((k == j) ? MID(i,j) : nodes[k]);
+          }
+          for (CFuint k = 0; k < nbNodes; ++k) {
+            children.push_back((k == i) ? MID(i,j) : nodes[k]);
+          }
+        }
+      }
+    }
+  }
+  else if (nbMarked == nbEdges) {
+    // one simplex at each corner
+    for (CFuint i = 0; i < nbNodes; ++i) {
+      for (CFuint k = 0; k < nbNodes; ++k) {
+        children.push_back((k == i) ? nodes[i] : MID(i,k));
+      }
+    }
+
+    if (nbNodes == 3) {
+      children.push_back(MID(0,1));
+      children.push_back(MID(1,2));
+      children.push_back(MID(0,2));
+    }
+    else {
+      // the inner octahedron is split along its shortest diagonal
+      const CFuint diag[3][4] = {{MID(0,1), MID(2,3), MID(0,2), MID(1,3)},
+                                 {MID(0,2), MID(1,3), MID(0,3), MID(1,2)},
+                                 {MID(0,3), MID(1,2), MID(0,1), MID(2,3)}};
+      CFuint best = 0;
+      CFreal minLength2 = 0.;
+      for (CFuint id = 0; id < 3; ++id) {
+        CFreal length2 = 0.;
+        for (CFuint d = 0; d < _dim; ++d) {
+          const CFreal dx = _nodes[diag[id][0]*_dim + d] - _nodes[diag[id][1]*_dim + d];
+          length2 += dx*dx;
+        }
+        if (id == 0 || length2 < minLength2) {
+          minLength2 = length2;
+          best = id;
+        }
+      }
+
+      // the other two diagonals give the ring around the chosen one
+      const CFuint other = (best + 2)%3;
+      const CFuint ring[4] = {diag[best][2], diag[other][0], diag[best][3], diag[other][1]};
+      for (CFuint t = 0; t < 4; ++t) {
+        children.push_back(diag[best][0]);
+        children.push_back(diag[best][1]);
+        children.push_back(ring[t]);
+        children.push_back(ring[(t+1)%4]);
+      }
+    }
+  }
+  else if (nbNodes == 4 && nbMarked == 3) {
+    // the marked edges belong to the face opposite to the node l
+    CFuint l = 0;
+    for (; l < 4; ++l) {
+      bool isFace = true;
+      for (CFuint k = 0; k < 4; ++k) {
+        if (k != l && mid[getLocalEdge(k,l,4)] >= 0) isFace = false;
+      }
+      if (isFace) break;
+    }
+    cf_assert(l < 4);
+
+    const CFuint i = (l + 1)%4;
+    const CFuint j = (l + 2)%4;
+    const CFuint k = (l + 3)%4;
+    const CFuint face[4][3] = {{nodes[i], MID(i,j), MID(i,k)},
+                               {MID(i,j), nodes[j], MID(j,k)},
+                               {MID(i,k), MID(j,k), nodes[k]},
+                               {MID(i,j), MID(j,k), MID(i,k)}};
+    for (CFuint f = 0; f < 4; ++f) {
+      children.push_back(face[f][0]);
+      children.push_back(face[f][1]);
+      children.push_back(face[f][2]);
+      children.push_back(nodes[l]);
+    }
+  }
+  else {
+    throw BadValueException
+      (FromHere(), "MetricRefiner: non conforming pattern with " +
+       StringOps::to_str(nbMarked) + " split edges");
+  }
+
+#undef MID
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::refineCells()
+{
+  CFAUTOTRACE;
+
+  CFmeshReaderWriterSource& data = *(_data.get());
+
+  const CFuint nbCells = _flags.size();
+  const CFuint nbCellEdges = _nbCellNodes*(_nbCellNodes - 1)/2;
+
+  // number the edges of the cells
+  map<pair<CFuint, CFuint>, CFuint> edgeIDs;
+  vector<pair<CFuint, CFuint> > edges;
+  vector<CFuint> cellEdges(nbCells*nbCellEdges);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    const CFuint* cellNodes = &_cells[iCell*_nbCellNodes];
+    for (CFuint i = 0; i < _nbCellNodes; ++i) {
+      for (CFuint j = i+1; j < _nbCellNodes; ++j) {
+        const pair<CFuint, CFuint> edge(min(cellNodes[i], cellNodes[j]),
+                                        max(cellNodes[i], cellNodes[j]));
+        map<pair<CFuint, CFuint>, CFuint>::iterator it = edgeIDs.find(edge);
+        if (it == edgeIDs.end()) {
+          it = edgeIDs.insert(make_pair(edge, static_cast<CFuint>(edges.size()))).first;
+          edges.push_back(edge);
+        }
+        cellEdges[iCell*nbCellEdges + getLocalEdge(i,j,_nbCellNodes)] = it->second;
+      }
+    }
+  }
+
+  // mark the edges of the cells to refine
+  vector<bool> isMarked(edges.size(), false);
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    if (_flags[iCell] == 1) {
+      for (CFuint e = 0; e < nbCellEdges; ++e) {
+        isMarked[cellEdges[iCell*nbCellEdges + e]] = true;
+      }
+    }
+  }
+
+  // mark more edges until each cell has a conforming pattern:
+  // no edge, one edge, the edges of one face (3D) or all the edges
+  bool isChanged = true;
+  while (isChanged) {
+    isChanged = false;
+    for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+      const CFuint* ce = &cellEdges[iCell*nbCellEdges];
+      CFuint nbMarked = 0;
+      for (CFuint e = 0; e < nbCellEdges; ++e) {
+        if (isMarked[ce[e]]) ++nbMarked;
+      }
+      if (nbMarked <= 1 || nbMarked == nbCellEdges) continue;
+
+      // face (opposite to the local node l) holding all the marked edges
+      CFuint l = _nbCellNodes;
+      if (_dim == DIM_3D) {
+        for (l = 0; l < _nbCellNodes; ++l) {
+          bool isFace = true;
+          for (CFuint k = 0; k < _nbCellNodes; ++k) {
+            if (k != l && isMarked[ce[getLocalEdge(k,l,_nbCellNodes)]]) isFace = false;
+          }
+          if (isFace) break;
+        }
+      }
+
+      if (l < _nbCellNodes) {
+        if (nbMarked == 3) continue;
+        for (CFuint i = 0; i < _nbCellNodes; ++i) {
+          for (CFuint j = i+1; j < _nbCellNodes; ++j) {
+            if (i != l && j != l) isMarked[ce[getLocalEdge(i,j,_nbCellNodes)]] = true;
+          }
+        }
+      }
+      else {
+        for (CFuint e = 0; e < nbCellEdges; ++e) {
+          isMarked[ce[e]] = true;
+        }
+      }
+      isChanged = true;
+    }
+  }
+
+  // add the middle nodes of the marked edges
+  vector<CFint> midNodes(edges.size(), -1);
+  for (CFuint iEdge = 0; iEdge < edges.size(); ++iEdge) {
+    if (isMarked[iEdge]) {
+      const CFuint a = edges[iEdge].first;
+      const CFuint b = edges[iEdge].second;
+      midNodes[iEdge] = static_cast<CFint>(_nodes.size()/_dim);
+      for (CFuint d = 0; d < _dim; ++d) {
+        _nodes.push_back(0.5*(_nodes[a*_dim + d] + _nodes[b*_dim + d]));
+      }
+      if (!_isCellCentered) {
+        for (CFuint iEq = 0; iEq < _nbEqs; ++iEq) {
+          _states.push_back(0.5*(_states[a*_nbEqs + iEq] + _states[b*_nbEqs + iEq]));
+        }
+      }
+    }
+  }
+
+  // split the cells, keeping the orientation of the parent
+  vector<CFuint> newCells;
+  vector<CFreal> newStates;
+  vector<CFuint> parent(_nbCellNodes);
+  vector<CFint> mid(nbCellEdges);
+  vector<CFuint> children;
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    for (CFuint k = 0; k < _nbCellNodes; ++k) {
+      parent[k] = _cells[iCell*_nbCellNodes + k];
+    }
+    for (CFuint e = 0; e < nbCellEdges; ++e) {
+      mid[e] = midNodes[cellEdges[iCell*nbCellEdges + e]];
+    }
+    split(parent, mid, _nbCellNodes, children);
+
+    const CFreal volume = computeVolume(&parent[0]);
+    for (CFuint c = 0; c < children.size(); c += _nbCellNodes) {
+      if (computeVolume(&children[c])*volume < 0.) {
+        std::swap(children[c], children[c+1]);
+      }
+      newCells.insert(newCells.end(), children.begin() + c, children.begin() + c + _nbCellNodes);
+      if (_isCellCentered) {
+        newStates.insert(newStates.end(), _states.begin() + iCell*_nbEqs,
+                         _states.begin() + (iCell + 1)*_nbEqs);
+      }
+    }
+  }
+  const CFuint nbNewCells = newCells.size()/_nbCellNodes;
+  _cells.swap(newCells);
+  _flags.assign(nbNewCells, 0);
+  if (_isCellCentered) {
+    _states.swap(newStates);
+  }
+
+  // split the boundary faces in the same way
+  const CFuint nbFaceNodes = _dim;
+  const CFuint nbFaceEdges = nbFaceNodes*(nbFaceNodes - 1)/2;
+  vector<CFuint> face(nbFaceNodes);
+  vector<CFint> faceMid(nbFaceEdges);
+  const CFuint nbTRSs = data.getNbTRSs();
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    TRGeoConn& trGeoConn = data.getTRGeoConn(iTRS);
+    for (CFuint iTR = 0; iTR < trGeoConn.size(); ++iTR) {
+      GeoConn newFaces;
+      for (CFuint iGeo = 0; iGeo < trGeoConn[iTR].size(); ++iGeo) {
+        const valarray<CFuint>& faceNodes = trGeoConn[iTR][iGeo].first;
+        cf_assert(faceNodes.size() == nbFaceNodes);
+        for (CFuint k = 0; k < nbFaceNodes; ++k) {
+          face[k] = faceNodes[k];
+        }
+        for (CFuint i = 0; i < nbFaceNodes; ++i) {
+          for (CFuint j = i+1; j < nbFaceNodes; ++j) {
+            const pair<CFuint, CFuint> edge(min(face[i], face[j]), max(face[i], face[j]));
+            map<pair<CFuint, CFuint>, CFuint>::const_iterator it = edgeIDs.find(edge);
+            cf_assert(it != edgeIDs.end());
+            faceMid[getLocalEdge(i,j,nbFaceNodes)] = midNodes[it->second];
+          }
+        }
+
+        if (nbFaceNodes == 2) {
+          // an edge keeps its direction when split
+          if (faceMid[0] >= 0) {
+            children.resize(4);
+            children[0] = face[0];
+            children[1] = faceMid[0];
+            children[2] = faceMid[0];
+            children[3] = face[1];
+          }
+          else {
+            children = face;
+          }
+        }
+        else {
+          split(face, faceMid, nbFaceNodes, children);
+        }
+
+        CFreal normal[3] = {0., 0., 0.};
+        CFreal childNormal[3] = {0., 0., 0.};
+        if (nbFaceNodes == 3) {
+          computeNormal(&face[0], normal);
+        }
+        for (CFuint c = 0; c < children.size(); c += nbFaceNodes) {
+          if (nbFaceNodes == 3) {
+            computeNormal(&children[c], childNormal);
+            if (normal[0]*childNormal[0] + normal[1]*childNormal[1] + normal[2]*childNormal[2] < 0.) {
+              std::swap(children[c], children[c+1]);
+            }
+          }
+          // the states are set when storing the mesh
+          GeoConnElement newFace;
+          newFace.first.resize(nbFaceNodes);
+          for (CFuint k = 0; k < nbFaceNodes; ++k) {
+            newFace.first[k] = children[c + k];
+          }
+          newFaces.push_back(newFace);
+        }
+      }
+      trGeoConn[iTR].swap(newFaces);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MetricRefiner::storeMesh()
+{
+  CFAUTOTRACE;
+
+  CFmeshReaderWriterSource& data = *(_data.get());
+
+  const CFuint nbCells = _flags.size();
+  const CFuint nbNodes = _nodes.size()/_dim;
+  const CFuint nbStates = _states.size()/_nbEqs;
+  const CFuint nbCellStates = (_isCellCentered) ? 1 : _nbCellNodes;
+
+  data.getNodeList()->swap(_nodes);
+  data.getStateList()->swap(_states);
+  data.setNbUpdatableNodes(nbNodes);
+  data.setNbNonUpdatableNodes(0);
+  data.setNbUpdatableStates(nbStates);
+  data.setNbNonUpdatableStates(0);
+
+  SafePtr< Table<CFuint> > elementNode  = data.getElementNode();
+  SafePtr< Table<CFuint> > elementState = data.getElementState();
+  elementNode->clear();
+  elementState->clear();
+  elementNode->resize(valarray<CFuint>(_nbCellNodes, nbCells));
+  elementState->resize(valarray<CFuint>(nbCellStates, nbCells));
+  for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+    for (CFuint k = 0; k < _nbCellNodes; ++k) {
+      (*elementNode)(iCell,k) = _cells[iCell*_nbCellNodes + k];
+    }
+    for (CFuint k = 0; k < nbCellStates; ++k) {
+      (*elementState)(iCell,k) = (_isCellCentered) ? iCell : _cells[iCell*_nbCellNodes + k];
+    }
+  }
+  data.setNbElements(nbCells);
+
+  const CFGeoShape::Type simplex = (_dim == DIM_2D) ? CFGeoShape::TRIAG : CFGeoShape::TETRA;
+  SafePtr<vector<ElementTypeData> > elementType = data.getElementTypeData();
+  elementType->resize(1);
+  (*elementType)[0].setGeoShape(simplex);
+  (*elementType)[0].setShape(CFGeoShape::Convert::to_str(simplex));
+  (*elementType)[0].setNbNodes(_nbCellNodes);
+  (*elementType)[0].setNbStates(nbCellStates);
+  (*elementType)[0].setNbElems(nbCells);
+  (*elementType)[0].setStartIdx(0);
+  (*elementType)[0].setGeoOrder(1);
+  (*elementType)[0].setSolOrder((_isCellCentered) ? 0 : 1);
+  data.setNbElementTypes(1);
+
+  // the state of a boundary face is the one of its node or of its cell
+  map<vector<CFuint>, CFuint> faceCells;
+  const CFuint nbTRSs = data.getNbTRSs();
+  if (_isCellCentered) {
+    vector<CFuint> key(_dim);
+    for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+      TRGeoConn& trGeoConn = data.getTRGeoConn(iTRS);
+      for (CFuint iTR = 0; iTR < trGeoConn.size(); ++iTR) {
+        for (CFuint iGeo = 0; iGeo < trGeoConn[iTR].size(); ++iGeo) {
+          const valarray<CFuint>& faceNodes = trGeoConn[iTR][iGeo].first;
+          for (CFuint k = 0; k < _dim; ++k) {
+            key[k] = faceNodes[k];
+          }
+          sort(key.begin(), key.end());
+          faceCells[key] = nbCells;
+        }
+      }
+    }
+
+    for (CFuint iCell = 0; iCell < nbCells; ++iCell) {
+      for (CFuint l = 0; l < _nbCellNodes; ++l) {
+        key.clear();
+        for (CFuint k = 0; k < _nbCellNodes; ++k) {
+          if (k != l) key.push_back(_cells[iCell*_nbCellNodes + k]);
+        }
+        sort(key.begin(), key.end());
+        map<vector<CFuint>, CFuint>::iterator it = faceCells.find(key);
+        if (it != faceCells.end()) {
+          it->second = iCell;
+        }
+      }
+    }
+  }
+
+  SafePtr<vector<vector<CFuint> > > nbGeomEntsPerTR = data.getNbGeomEntsPerTR();
+  for (CFuint iTRS = 0; iTRS < nbTRSs; ++iTRS) {
+    TRGeoConn& trGeoConn = data.getTRGeoConn(iTRS);
+    for (CFuint iTR = 0; iTR < trGeoConn.size(); ++iTR) {
+      for (CFuint iGeo = 0; iGeo < trGeoConn[iTR].size(); ++iGeo) {
+        const valarray<CFuint>& faceNodes = trGeoConn[iTR][iGeo].first;
+        valarray<CFuint>& faceStates = trGeoConn[iTR][iGeo].second;
+        if (_isCellCentered) {
+          vector<CFuint> key(faceNodes.size());
+          for (CFuint k = 0; k < faceNodes.size(); ++k) {
+            key[k] = faceNodes[k];
+          }
+          sort(key.begin(), key.end());
+          const CFuint iCell = faceCells.find(key)->second;
+          if (iCell == nbCells) {
+            throw BadValueException
+              (FromHere(), "MetricRefiner: boundary face without cell in TRS " + data.getNameTRS(iTRS));
+          }
+          faceStates.resize(1);
+          faceStates[0] = iCell;
+        }
+        else {
+          faceStates.resize(faceNodes.size());
+          faceStates = faceNodes;
+        }
+      }
+      (*nbGeomEntsPerTR)[iTRS][iTR] = trGeoConn[iTR].size();
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SimpleGlobalMeshAdapter
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,279 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_SimpleGlobalMeshAdapter_MetricRefiner_hh
+#define COOLFluiD_Numerics_SimpleGlobalMeshAdapter_MetricRefiner_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "Framework/MeshFormatConverter.hh"
+#include "Framework/CFmeshFileReader.hh"
+#include "Framework/CFmeshFileWriter.hh"
+#include "Framework/CFmeshReaderWriterSource.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SimpleGlobalMeshAdapter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A class that locally refines and coarsens a CFmesh file made of
+ * triangles (2D) or tetrahedra (3D), following the flags of the cells
+ * computed from the metric by the HessianEE (StdAdaptFlagCalc).
+ * The i-th flag of FlagsFile belongs to the i-th cell of the CFmesh file
+ * (+1 refine, -1 coarsen, 0 keep).
+ *
+ * Coarsening collapses each interior node, whose surrounding cells are all
+ * flagged for coarsening, on its nearest neighbour, provided that the
+ * topology is kept and that no cell is inverted or flattened.
+ * Refinement splits the edges of the cells flagged for refinement at their
+ * middle; the neighbouring cells are then split with the conforming
+ * patterns (one edge, the edges of one face or all the edges), so that
+ * the mesh has no hanging nodes. Boundary faces are split accordingly.
+ *
+ * The solution is carried over (interpolated at the new nodes, copied in
+ * the new cells), for both vertex and cell centered meshes.
+ *
+ * This is a serial remeshing step, not a distributed h-refinement: the
+ * whole CFmesh file is read, adapted and written by one process, and the
+ * resulting mesh is partitioned again when it is read by the solver.
+ * Meshes with other elements than triangles and tetrahedra (e.g. hexahedra)
+ * or with extra nodal or state variables are not supported.
+ */
+class MetricRefiner : public Framework::MeshFormatConverter {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  typedef Framework::CFmeshFileReader
+  <Framework::CFmeshReaderWriterSource> Reader;
+
+  typedef Framework::CFmeshFileWriter
+  <Framework::CFmeshReaderWriterSource> Writer;
+
+  /**
+   * Constructor
+   */
+  MetricRefiner(const std::string& name);
+
+  /**
+   * Destructor
+   */
+  virtual ~MetricRefiner();
+
+  /**
+   * Nothing to read before the conversion.
+   */
+  void readFiles(const boost::filesystem::path& filepath) {}
+
+  /**
+   * Tries to check the file for conformity to the format.
+   * Possibly not full proof.
+   */
+  void checkFormat(const boost::filesystem::path& filepath) {}
+
+  /**
+   * Writes the data read to the original format.
+   * Not supported.
+   */
+  void convertBack(const boost::filesystem::path& filepath);
+
+  /**
+   * Adapts the given CFmesh file
+   * @param fromFilepath name of the file to adapt
+   * @param filepath name of the adapted file
+   */
+  void convert(const boost::filesystem::path& fromFilepath,
+               const boost::filesystem::path& filepath);
+
+  /**
+   * Adapts the given CFmesh file, writing the result in the given
+   * buffer in memory instead of in a file
+   * @param fromFilepath name of the file to adapt
+   * @param buffer string where to write the adapted CFmesh
+   */
+  void convertToBuffer(const boost::filesystem::path& fromFilepath,
+                       std::string& buffer);
+
+protected:
+
+  /**
+   * Adjust the node (state) numbering to make it stick to the
+   * COOLFluiD convention.
+   */
+  void adjustToCFmeshNodeNumbering() {}
+
+  /**
+   * Gets the target format.
+   */
+  std::string getTargetFormat() const
+  {
+    return "CFmesh";
+  }
+
+  /**
+   * Gets the origin format.
+   */
+  std::string getOriginFormat() const
+  {
+    return "CFmesh";
+  }
+
+private:
+
+  /**
+   * Adapts the mesh read in the data
+   */
+  void adapt();
+
+  /**
+   * Reads the flags of the cells
+   */
+  void readFlags();
+
+  /**
+   * Copies the cells, the nodes and the states from the data
+   */
+  void loadMesh();
+
+  /**
+   * Collapses the interior nodes surrounded by cells to coarsen
+   */
+  void coarsenCells();
+
+  /**
+   * Splits the cells to refine and their neighbours
+   */
+  void refineCells();
+
+  /**
+   * Copies the adapted cells, nodes and states back to the data
+   */
+  void storeMesh();
+
+  /**
+   * Checks if a node can be collapsed on a neighbouring node
+   * @param a     node to remove
+   * @param b     node where a is moved
+   * @param ball  cells around a
+   * @param nodeCells  cells around each node
+   */
+  bool isCollapsible(const CFuint a, const CFuint b,
+                     const std::vector<CFuint>& ball,
+                     const std::vector<std::vector<CFuint> >& nodeCells) const;
+
+  /**
+   * Adds the nodes of the cells around the given node to a sorted list
+   * @param a     node
+   * @param cells  cells around the node
+   * @param nodes  sorted list of the neighbouring nodes (without a)
+   */
+  void getNeighbourNodes(const CFuint a,
+                         const std::vector<CFuint>& cells,
+                         std::vector<CFuint>& nodes) const;
+
+  /**
+   * Splits a simplex with the pattern of its marked edges
+   * @param nodes   nodes of the simplex
+   * @param mid     middle node of each local edge (-1 if not marked)
+   * @param nbNodes  number of nodes of the simplex (3 or 4)
+   * @param children  nodes of the resulting simplices
+   */
+  void split(const std::vector<CFuint>& nodes,
+             const std::vector<CFint>& mid,
+             const CFuint nbNodes,
+             std::vector<CFuint>& children) const;
+
+  /**
+   * Signed volume (area in 2D) of a cell, up to a constant factor
+   */
+  CFreal computeVolume(const CFuint* cellNodes) const;
+
+  /**
+   * Normal of a triangular face in 3D, up to a constant factor
+   */
+  void computeNormal(const CFuint* faceNodes, CFreal* normal) const;
+
+  /**
+   * Gets the local index of the edge between the given local nodes
+   * of a simplex with nbNodes nodes
+   */
+  static CFuint getLocalEdge(const CFuint i, const CFuint j, const CFuint nbNodes)
+  {
+    const CFuint a = std::min(i,j);
+    const CFuint b = std::max(i,j);
+    return a*(2*nbNodes - a - 1)/2 + b - a - 1;
+  }
+
+private:
+
+  /// the data to be read, adapted and rewritten to file
+  /// this memory is owned here
+  std::auto_ptr<Framework::CFmeshReaderWriterSource> _data;
+
+  /// the file reader
+  Reader _reader;
+
+  /// the file writer
+  Writer  _writer;
+
+  /// name of the file with the flags of the cells
+  std::string _flagsFile;
+
+  /// flag telling if the cells are coarsened
+  bool _coarsen;
+
+  /// minimum ratio between the volumes of a cell after and before a collapse
+  CFreal _minVolumeRatio;
+
+  /// dimension of the mesh
+  CFuint _dim;
+
+  /// number of equations
+  CFuint _nbEqs;
+
+  /// number of nodes per cell
+  CFuint _nbCellNodes;
+
+  /// flag telling if the states are in the cells (cell centered)
+  bool _isCellCentered;
+
+  /// flags of the cells
+  std::vector<CFint> _flags;
+
+  /// nodes of the cells
+  std::vector<CFuint> _cells;
+
+  /// coordinates of the nodes
+  std::vector<CFreal> _nodes;
+
+  /// states (one per node or one per cell)
+  std::vector<CFreal> _states;
+
+}; // end class MetricRefiner
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SimpleGlobalMeshAdapter
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_SimpleGlobalMeshAdapter_MetricRefiner_hh
@@ -0,0 +1,154 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BadValueException.hh"
+#include "Framework/MethodCommandProvider.hh"
+#include "Framework/PhysicalModel.hh"
+#include "Framework/State.hh"
+#include "Framework/DistributedMeshInterpolator.hh"
+#include "SimpleGlobalMeshAdapter/SimpleGlobalMeshAdapter.hh"
+#include "SimpleGlobalMeshAdapter/ParallelMeshInterpolator.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::Framework;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SimpleGlobalMeshAdapter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+MethodCommandProvider<ParallelMeshInterpolator,
+		      SimpleMeshAdapterData,
+		      SimpleGlobalMeshAdapterModule>
+ParallelMeshInterpolatorProvider("ParallelMeshInterpolator");
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParallelMeshInterpolator::defineConfigOptions(Config::OptionList& options)
+{
+  options.addConfigOption< std::string >("InterpolationType","Interpolation type: Nearest or Linear.");
+  options.addConfigOption< CFuint >("NbNeighbors","Number of donors used by the Linear interpolation (0 for default).");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ParallelMeshInterpolator::ParallelMeshInterpolator(const std::string& name)  :
+  SimpleMeshAdapterCom(name),
+  socket_states("states"),
+  socket_otherStates("states")
+{
+  addConfigOptionsTo(this);
+
+  _interpolationType = "Linear";
+  setParameter("InterpolationType",&_interpolationType);
+
+  _nbNeighbors = 0;
+  setParameter("NbNeighbors",&_nbNeighbors);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParallelMeshInterpolator::configure ( Config::ConfigArgs& args )
+{
+  SimpleMeshAdapterCom::configure(args);
+
+  socket_otherStates.setDataSocketNamespace(getMethodData().getOtherNamespace());
+
+  if (_interpolationType != "Nearest" && _interpolationType != "Linear") {
+    throw BadValueException (FromHere(),"ParallelMeshInterpolator::configure() => unknown InterpolationType " + _interpolationType);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ParallelMeshInterpolator::execute()
+{
+  CFAUTOTRACE;
+
+  CFout << "Interpolating solution on new mesh\n";
+
+  DataHandle < Framework::State*, Framework::GLOBAL > states = socket_states.getDataHandle();
+  DataHandle < Framework::State*, Framework::GLOBAL > otherStates = socket_otherStates.getDataHandle();
+
+  const CFuint dim = PhysicalModelStack::getActive()->getDim();
+  const CFuint nbEqs = PhysicalModelStack::getActive()->getNbEq();
+
+  // donors: the updatable states of the old mesh, so that each one is given once
+  vector<CFreal> donorCoords;
+  vector<CFreal> donorValues;
+  donorCoords.reserve(otherStates.size()*dim);
+  donorValues.reserve(otherStates.size()*nbEqs);
+  for (CFuint iState = 0; iState < otherStates.size(); ++iState) {
+    const State& state = *otherStates[iState];
+    if (state.isParUpdatable()) {
+      const Node& coord = state.getCoordinates();
+      for (CFuint iDim = 0; iDim < dim; ++iDim) {
+	donorCoords.push_back(coord[iDim]);
+      }
+      for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+	donorValues.push_back(state[iEq]);
+      }
+    }
+  }
+
+  // targets: all the local states of the new mesh, ghosts included
+  const CFuint nbStates = states.size();
+  vector<CFreal> targetCoords(nbStates*dim);
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    const Node& coord = states[iState]->getCoordinates();
+    for (CFuint iDim = 0; iDim < dim; ++iDim) {
+      targetCoords[iState*dim + iDim] = coord[iDim];
+    }
+  }
+
+  DistributedMeshInterpolator interpolator(getMethodData().getNamespace());
+  interpolator.setInterpolationType((_interpolationType == "Nearest") ?
+				    DistributedMeshInterpolator::NEAREST :
+				    DistributedMeshInterpolator::LINEAR);
+  interpolator.setNbNeighbors(_nbNeighbors);
+  interpolator.setDonors(dim, nbEqs, donorCoords, donorValues);
+
+  vector<CFreal> targetValues;
+  interpolator.interpolate(targetCoords, targetValues);
+
+  for (CFuint iState = 0; iState < nbStates; ++iState) {
+    State& state = *states[iState];
+    for (CFuint iEq = 0; iEq < nbEqs; ++iEq) {
+      state[iEq] = targetValues[iState*nbEqs + iEq];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector< Common::SafePtr< BaseDataSocketSink > >
+  ParallelMeshInterpolator::needsSockets()
+{
+  std::vector< Common::SafePtr< BaseDataSocketSink > > result;
+
+  result.push_back(&socket_states);
+  result.push_back(&socket_otherStates);
+
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SimpleGlobalMeshAdapter
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
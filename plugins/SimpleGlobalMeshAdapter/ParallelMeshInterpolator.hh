@@ -0,0 +1,96 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Numerics_SimpleGlobalMeshAdapter_ParallelMeshInterpolator_hh
+#define COOLFluiD_Numerics_SimpleGlobalMeshAdapter_ParallelMeshInterpolator_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "SimpleMeshAdapterData.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Numerics {
+
+    namespace SimpleGlobalMeshAdapter {
+
+//////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * This class represents a NumericalCommand action to be
+   * sent to interpolate the solution from the old mesh onto the new one,
+   * both meshes being distributed over the processors.
+   * Unlike the other interpolators, the donor states do not need to be
+   * available on the processor owning the interpolated states
+   * (see Framework::DistributedMeshInterpolator).
+   */
+class ParallelMeshInterpolator : public SimpleMeshAdapterCom {
+public:
+
+  /**
+   * Defines the Config Option's of this class
+   * @param options a OptionList where to add the Option's
+   */
+  static void defineConfigOptions(Config::OptionList& options);
+
+  /**
+   * Constructor.
+   */
+  explicit ParallelMeshInterpolator(const std::string& name);
+
+  /**
+   * Destructor.
+   */
+  ~ParallelMeshInterpolator()
+  {
+  }
+
+  /**
+   * Configures the command.
+   */
+  virtual void configure ( Config::ConfigArgs& args );
+
+  /**
+   * Execute Processing actions
+   */
+  void execute();
+
+  /**
+   * Returns the DataSocket's that this command needs as sinks
+   * @return a vector of SafePtr with the DataSockets
+   */
+  std::vector< Common::SafePtr< Framework::BaseDataSocketSink > >
+    needsSockets();
+
+protected: // data
+
+  /// Socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_states;
+
+  /// Socket for states
+  Framework::DataSocketSink<Framework::State*, Framework::GLOBAL> socket_otherStates;
+
+  /// interpolation type (Nearest or Linear)
+  std::string _interpolationType;
+
+  /// number of nearest donors used by the linear interpolation
+  CFuint _nbNeighbors;
+
+}; // class ParallelMeshInterpolator
+
+//////////////////////////////////////////////////////////////////////////////
+
+    } // namespace SimpleGlobalMeshAdapter
+
+  } // namespace Numerics
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Numerics_SimpleGlobalMeshAdapter_ParallelMeshInterpolator_hh
@@ -150,6 +150,15 @@ public:
     return _meshFileName;
   }
 
+  /**
+   * Gets the buffer holding the new mesh in memory
+   * (empty if the new mesh is in a file)
+   */
+  std::string& getAdaptedMeshBuffer()
+  {
+    return _meshBuffer;
+  }
+
   /**
    * Gets the other namespace
    */
@@ -198,6 +207,9 @@ private:
   /// The filename of the adapted mesh
   std::string _meshFileName;
 
+  /// The adapted mesh in CFmesh format, when it is kept in memory
+  std::string _meshBuffer;
+
   ///flag if remeshing is needed
   bool _isRemeshNeeded;
 
@@ -4,10 +4,16 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <algorithm>
+
 #include "Common/PEFunctions.hh"
 #include "Common/SelfRegistPtr.hh"
 #include "Environment/DirPaths.hh"
 
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#endif
+
 #include "Framework/MethodCommandProvider.hh"
 #include "Framework/MeshFormatConverter.hh"
 
@@ -39,6 +45,7 @@ void SimpleRefiner::defineConfigOptions(Config::OptionList& options)
 {
   options.addConfigOption< std::string >("Filename","Name of the input file.");
   options.addConfigOption< std::string >("Refiner","Name of the refiner object.");
+  options.addConfigOption< bool >("InMemory","Hand the refined CFmesh text to the MeshCreator in memory instead of through a file (the refinement is still serial).");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -53,6 +60,9 @@ SimpleRefiner::SimpleRefiner(const std::string& name)  :
 
   _refinerStr = "";
   setParameter("Refiner",&_refinerStr);
+
+  _inMemory = false;
+  setParameter("InMemory",&_inMemory);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -78,14 +88,50 @@ void SimpleRefiner::execute()
   path fromfile = Environment::DirPaths::getInstance().getWorkingDir() / path ( _filename );
   path tofile   = Environment::DirPaths::getInstance().getWorkingDir() / path ( outputFileName );
   
-  // refiner works serially on the processor with rank == 0
   const std::string nsp = getMethodData().getNamespace();
+  
+  if (_inMemory) {
+    // the processor with rank == 0 refines the mesh serially and writes it
+    // in CFmesh text format in a buffer, which is broadcast to the others:
+    // this only saves the disk round trip, since every processor parses
+    // the whole text afterwards in the MeshCreator
+    std::string& buffer = getMethodData().getAdaptedMeshBuffer();
+    if (PE::GetPE().GetRank(nsp) == 0) {
+      refiner->convertToBuffer(fromfile, buffer);
+    }
+    broadcastBuffer(buffer, nsp);
+    return;
+  }
+  
+  // refiner works serially on the processor with rank == 0
   runSerial<void, const path&, const path&, MeshFormatConverter, &MeshFormatConverter::convert>
     (&(*refiner), fromfile, tofile, nsp);
 }
       
 //////////////////////////////////////////////////////////////////////////////
 
+void SimpleRefiner::broadcastBuffer(std::string& buffer, const std::string& nsp)
+{
+#ifdef CF_HAVE_MPI
+  if (!PE::GetPE().IsParallel()) return;
+  
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  // the size can exceed 4 GB even if CFuint is 32 bit
+  long long unsigned int size = buffer.size();
+  MPI_Bcast(&size, 1, MPIStructDef::getMPIType(&size), 0, comm);
+  buffer.resize(size);
+  
+  // the buffer is sent in chunks whose size fits in an int
+  const long long unsigned int maxChunk = 1 << 30;
+  for (long long unsigned int start = 0; start < size; start += maxChunk) {
+    const int count = static_cast<int>(std::min(maxChunk, size - start));
+    MPI_Bcast(&buffer[start], count, MPI_CHAR, 0, comm);
+  }
+#endif
+}
+      
+//////////////////////////////////////////////////////////////////////////////
+
 void SimpleRefiner::configure ( Config::ConfigArgs& args )
 {
   SimpleMeshAdapterCom::configure ( args );
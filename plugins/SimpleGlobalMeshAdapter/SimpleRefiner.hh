@@ -43,6 +43,12 @@ public:
   /// Execute Processing actions
   void execute();
 
+private:
+
+  /// Send the refined mesh held in memory by the processor with rank == 0
+  /// to all the other processors of the given namespace
+  void broadcastBuffer(std::string& buffer, const std::string& nsp);
+
 private:
 
   /// Name of the refiner
@@ -51,6 +57,11 @@ private:
   /// Name of the refiner
   std::string _refinerStr;
 
+  /// Hand the refined CFmesh text to the MeshCreator in memory instead of
+  /// through a file: the refinement still runs on the processor with
+  /// rank == 0 and every processor parses the whole text
+  bool _inMemory;
+
   /// stored configuration arguments
   /// @todo this should be avoided and removed.
   ///       It is currently only a quick fix for delayed configuration of an object (MeshFormatConverter)
@@ -57,7 +57,18 @@ void StdMeshReader::execute()
 
   meshCreator[0]->modifyFileName(filename);
 
+  // the new mesh can be kept in memory by the mesh generator
+  std::string& buffer = getMethodData().getAdaptedMeshBuffer();
+  if (!buffer.empty()) {
+    meshCreator[0]->setMeshBuffer(&buffer);
+  }
+
   buildMeshData();
+
+  if (!buffer.empty()) {
+    meshCreator[0]->setMeshBuffer(CFNULL);
+    std::string().swap(buffer);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -113,6 +113,29 @@ void TriangleSplitter::convert(const boost::filesystem::path& fromFilepath,
 
 //////////////////////////////////////////////////////////////////////////////
 
+void TriangleSplitter::convertToBuffer(const boost::filesystem::path& fromFilepath,
+                                       std::string& buffer)
+{
+  CFAUTOTRACE;
+
+  Common::Stopwatch<WallTime> stp;
+  stp.start();
+
+  // reads the origin 2D CFmesh
+  _reader.readFromFile(fromFilepath);
+
+  // transforms the data
+  split();
+
+  // write the new 2D data in memory
+  _writer.writeToBuffer(buffer);
+
+  stp.stop();
+  CFout << "Refining of the 2D CFmesh in memory took: " << stp.read() << "s\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void TriangleSplitter::convertBack(const boost::filesystem::path& filepath)
 {
 
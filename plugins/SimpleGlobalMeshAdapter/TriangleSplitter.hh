@@ -91,6 +91,15 @@ public:
   void convert(const boost::filesystem::path& fromFilepath,
          const boost::filesystem::path& filepath);
 
+  /**
+   * Refines the given CFmesh file, writing the result in the given
+   * buffer in memory instead of in a file
+   * @param fromFilepath name of the file to refine
+   * @param buffer string where to write the refined CFmesh
+   */
+  void convertToBuffer(const boost::filesystem::path& fromFilepath,
+                       std::string& buffer);
+
   /**
    * Configures this object.
    *
@@ -627,7 +627,7 @@ void THOR2CFmeshConverter::writeTHOR(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void THOR2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -690,7 +690,7 @@ void THOR2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void THOR2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -923,7 +923,7 @@ void THOR2CFmeshConverter::readFiles(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void THOR2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -997,7 +997,7 @@ void THOR2CFmeshConverter::writeContinuousElements(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void THOR2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1011,7 +1011,7 @@ void THOR2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeNodes(ofstream& fout)
+void THOR2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1029,7 +1029,7 @@ void THOR2CFmeshConverter::writeNodes(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void THOR2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1161,7 +1161,7 @@ CFuint THOR2CFmeshConverter::getNbStatesInType(const CFuint& typeID)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void THOR2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void THOR2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
 
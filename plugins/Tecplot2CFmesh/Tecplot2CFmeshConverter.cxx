@@ -493,7 +493,7 @@ void Tecplot2CFmeshConverter::writeTecplot(const boost::filesystem::path& filepa
       
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
+void Tecplot2CFmeshConverter::writeContinuousTrsData(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -536,7 +536,7 @@ void Tecplot2CFmeshConverter::writeContinuousTrsData(ofstream& fout)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeDiscontinuousTrsData(ofstream& fout)
+void Tecplot2CFmeshConverter::writeDiscontinuousTrsData(std::ostream& fout)
 {  
   CFLog(VERBOSE, "Tecplot2CFmeshConverter::writeDiscontinuousTrsData() => START\n");
   
@@ -645,7 +645,7 @@ void Tecplot2CFmeshConverter::readFiles(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeContinuousElements(ofstream& fout)
+void Tecplot2CFmeshConverter::writeContinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
   CFLog(VERBOSE, "Tecplot2CFmeshConverter::writeContinuousElements() => START\n");
@@ -719,7 +719,7 @@ void Tecplot2CFmeshConverter::writeContinuousElements(ofstream& fout)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeContinuousStates(ofstream& fout)
+void Tecplot2CFmeshConverter::writeContinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -748,7 +748,7 @@ void Tecplot2CFmeshConverter::writeContinuousStates(ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
       
-void Tecplot2CFmeshConverter::writeNodes(ofstream& fout)
+void Tecplot2CFmeshConverter::writeNodes(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -802,7 +802,7 @@ void Tecplot2CFmeshConverter::writeNodes(ofstream& fout)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
+void Tecplot2CFmeshConverter::writeDiscontinuousElements(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -902,7 +902,7 @@ void Tecplot2CFmeshConverter::writeDiscontinuousElements(ofstream& fout)
       
 //////////////////////////////////////////////////////////////////////////////
 
-void Tecplot2CFmeshConverter::writeDiscontinuousStates(ofstream& fout)
+void Tecplot2CFmeshConverter::writeDiscontinuousStates(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -181,7 +181,7 @@ MapGeoEntToTecplot::identifyGeoEnt(const GeoEntityInfo& geoinfo)
 //////////////////////////////////////////////////////////////////////////////
 
 void
-MapGeoEntToTecplot::writeGeoEntConn(std::ofstream& file,
+MapGeoEntToTecplot::writeGeoEntConn(std::ostream& file,
 				               std::valarray<CFuint>& stateIDs,
 				               const GeoEntityInfo& geoinfo)
 {
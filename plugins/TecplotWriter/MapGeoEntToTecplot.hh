@@ -39,7 +39,7 @@ public:
   /// Useful to circunvent the fact that different formats
   /// have different element numberings.
   virtual
-  void writeGeoEntConn(std::ofstream& file,
+  void writeGeoEntConn(std::ostream& file,
   			               std::valarray<CFuint>& stateIDs,
   			               const Framework::GeoEntityInfo& geoinfo);
 
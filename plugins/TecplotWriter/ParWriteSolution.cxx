@@ -143,21 +143,31 @@ void ParWriteSolution::writeData(const boost::filesystem::path& filepath,
   
   // reset to 0 the new file flag
   flag = false;
-  ofstream* file = CFNULL;
+  std::ostream* file = CFNULL;
   Common::SelfRegistPtr<Environment::FileHandlerOutput>* fhandle =
     Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().createPtr();
   
+  // in asynchronous mode, the parts of the file are written in memory
+  // and the OutputFormatter writes them in the file in background
+  const bool isSparse = _isWriterRank && getMethodData().useSparseSnapshot();
+  
   if (_isWriterRank) { 
+    const bool isOldFile = (_fileList.count(filepath) > 0);
+    if (!isOldFile) {
+      // if the file is a new one add it to the file list
+      _fileList.insert(filepath);
+      flag = true;
+    }
+    
+    if (isSparse) {
+      file = &getMethodData().openSparseSnapshot(filepath, flag);
+    }
     // if the file has already been processed once, open in I/O mode
-    if (_fileList.count(filepath) > 0) {
+    else if (isOldFile) {
       file = &(*fhandle)->open(filepath, ios_base::in | ios_base::out);
     }
     else {
       file = &(*fhandle)->open(filepath);
-      
-      // if the file is a new one add it to the file list
-      _fileList.insert(filepath);
-      flag = true;
     }
   }
   
@@ -172,7 +182,7 @@ void ParWriteSolution::writeData(const boost::filesystem::path& filepath,
     const string writerName = getMethodData().getNamespace() + "_Writers";
     Group& wg = PE::GetPE().getGroup(writerName);
     MPI_Barrier(wg.comm);
-    (*fhandle)->close();
+    if (!isSparse) {(*fhandle)->close();}
   }
 
   delete fhandle;
@@ -200,7 +210,7 @@ void ParWriteSolution::writeInnerData
 (const boost::filesystem::path& filepath,
  const bool isNewFile,
  const std::string title,
- std::ofstream* fout)
+ std::ostream* fout)
 {
   CFAUTOTRACE;
   
@@ -440,7 +450,7 @@ void ParWriteSolution:: buildNodeIDMapping()
 void ParWriteSolution::writeBoundaryData(const boost::filesystem::path& filepath,
 					 const bool isNewFile,
 					 const std::string title,
-					 std::ofstream* fout)
+					 std::ostream* fout)
 {
   CFAUTOTRACE;
   
@@ -629,7 +639,7 @@ ParWriteSolution::needsSockets()
   
 //////////////////////////////////////////////////////////////////////////////
 
-void ParWriteSolution::writeHeader(std::ofstream* fout, 
+void ParWriteSolution::writeHeader(std::ostream* fout, 
 				   const std::string title,
 				   SafePtr<DataHandleOutput> dh)
 {
@@ -699,7 +709,7 @@ void ParWriteSolution::writeHeader(std::ofstream* fout,
  
 //////////////////////////////////////////////////////////////////////////////
   
-void ParWriteSolution::writeNodeList(ofstream* fout, const CFuint iType,
+void ParWriteSolution::writeNodeList(std::ostream* fout, const CFuint iType,
 				     SafePtr<TopologicalRegionSet> elements,
 				     const bool isBoundary)
 {
@@ -952,7 +962,7 @@ void ParWriteSolution::writeNodeList(ofstream* fout, const CFuint iType,
 //////////////////////////////////////////////////////////////////////////////
 
 void ParWriteSolution::writeElementList
-(std::ofstream* fout,
+(std::ostream* fout,
  const CFuint iType,
  const CFuint nbNodesInType,
  const CFuint nbElementsInType,
@@ -1227,7 +1237,7 @@ CFuint ParWriteSolution::getWriteNbNodesInType(const CFuint nbNodes,
 
 //////////////////////////////////////////////////////////////////////////////
 
-void ParWriteSolution::writeElementConn(ofstream& file,
+void ParWriteSolution::writeElementConn(std::ostream& file,
 					CFuint* nodeIDs,
 					const CFuint nbNodes,
 					const CFuint geoOrder,
@@ -1621,7 +1631,7 @@ ParWriteSolution::TecplotTRSType::~TecplotTRSType()
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParWriteSolution::writeInnerZoneHeader(std::ofstream* fout, 
+void ParWriteSolution::writeInnerZoneHeader(std::ostream* fout, 
 					    const CFuint iType,
 					    ElementTypeData& eType,
 					    SafePtr<TopologicalRegionSet> trs) 
@@ -1650,7 +1660,7 @@ void ParWriteSolution::writeInnerZoneHeader(std::ofstream* fout,
     
 //////////////////////////////////////////////////////////////////////////////
   
-void ParWriteSolution::writeZoneHeader(std::ofstream* fout, 
+void ParWriteSolution::writeZoneHeader(std::ostream* fout, 
 				       const CFuint iType,
 				       const string& geoShape,
 				       const CFuint nbNodesInType,
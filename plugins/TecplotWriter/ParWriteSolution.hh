@@ -78,7 +78,7 @@ public:
   
   /// typedef for pointer to member function
   typedef void (ParWriteSolution::*WriterFun)
-    (const boost::filesystem::path&, const bool, const std::string, std::ofstream*);
+    (const boost::filesystem::path&, const bool, const std::string, std::ostream*);
   
   /// This class stores indexes and offsets useful for the writing TRS data 
   class TecplotTRSType {
@@ -134,7 +134,7 @@ public:
   virtual void writeInnerData(const boost::filesystem::path& filepath,
 			      const bool isNewFile,
 			      const std::string title,
-			      std::ofstream* fout);
+			      std::ostream* fout);
   
   /// Writes the boundary data to file
   /// @param filename  name of output file
@@ -143,18 +143,18 @@ public:
   virtual void writeBoundaryData(const boost::filesystem::path& filepath,
 				 const bool isNewFile,
 				 const std::string title,
-				 std::ofstream* fout);
+				 std::ostream* fout);
   
   /// Writes the TECPLOT header
   // void writeHeader(MPI_File* fh);
   
   /// Writes the TECPLOT header
-  virtual void writeHeader(std::ofstream* fout, 
+  virtual void writeHeader(std::ostream* fout, 
 			   const std::string title,
 			   Common::SafePtr<Framework::DataHandleOutput> dh);
   
   /// Writes the TECPLOT zone header
-  virtual void writeZoneHeader(std::ofstream* fout, 
+  virtual void writeZoneHeader(std::ostream* fout, 
 			       const CFuint iType,
 			       const std::string& geoShape,
 			       const CFuint nbNodesInType,
@@ -164,7 +164,7 @@ public:
 			       const bool isBoundary); 
   
   /// Writes the TECPLOT inner zone header
-  virtual void writeInnerZoneHeader(std::ofstream* fout, 
+  virtual void writeInnerZoneHeader(std::ostream* fout, 
 				    const CFuint iType,
 				    Framework::ElementTypeData& eType,
 				    Common::SafePtr<Framework::TopologicalRegionSet> trs); 
@@ -174,12 +174,12 @@ public:
   virtual void writeToBinaryFile();
   
   /// Write the node list corresponding to the given element type
-  virtual void writeNodeList(std::ofstream* fout, const CFuint iType, 
+  virtual void writeNodeList(std::ostream* fout, const CFuint iType, 
 			     Common::SafePtr<Framework::TopologicalRegionSet> elements,
 			     const bool isBoundary);
   
   /// Write the element list corresponding to the given element type
-  void writeElementList(std::ofstream* fout,
+  void writeElementList(std::ostream* fout,
 			const CFuint iType,
 			const CFuint nbNodesInType,
 			const CFuint nbElementsInType,
@@ -196,7 +196,7 @@ public:
   
   /// Write the connectivity for one element, after having translated the local 
   /// element connectivity (node ordering) from CFmesh to Tecplot format
-  void writeElementConn(std::ofstream& file,
+  void writeElementConn(std::ostream& file,
 			CFuint* nodeIDs,
 			const CFuint nbNodes,
 			const CFuint geoOrder,
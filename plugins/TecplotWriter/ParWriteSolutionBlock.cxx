@@ -87,7 +87,7 @@ void ParWriteSolutionBlock::setup()
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParWriteSolutionBlock::writeNodeList(ofstream* fout, const CFuint iType,
+void ParWriteSolutionBlock::writeNodeList(std::ostream* fout, const CFuint iType,
 					  SafePtr<TopologicalRegionSet> elements,
 					  const bool isBoundary)
 {
@@ -521,7 +521,7 @@ void ParWriteSolutionBlock::writeNodeList(ofstream* fout, const CFuint iType,
       
 //////////////////////////////////////////////////////////////////////////////
 
-void ParWriteSolutionBlock::writeZoneHeader(std::ofstream* fout, 
+void ParWriteSolutionBlock::writeZoneHeader(std::ostream* fout, 
 					    const CFuint iType,
 					    const string& geoShape,
 					    const CFuint nbNodesInType,
@@ -39,7 +39,7 @@ public:
  protected:
   
   /// Writes the TECPLOT zone header
-  virtual void writeZoneHeader(std::ofstream* fout, 
+  virtual void writeZoneHeader(std::ostream* fout, 
 			       const CFuint iType,
 			       const std::string& geoShape,
 			       const CFuint nbNodesInType,
@@ -53,7 +53,7 @@ public:
   virtual void writeToBinaryFile();
   
   /// Write the node list corresponding to the given element type
-  virtual void writeNodeList(std::ofstream* fout, const CFuint iType, 
+  virtual void writeNodeList(std::ostream* fout, const CFuint iType, 
 			     Common::SafePtr<Framework::TopologicalRegionSet> elements,
 			     const bool isBoundary);
   
@@ -124,7 +124,7 @@ void TecWriter::openImpl()
 {
   CFAUTOTRACE;
   computeFullOutputName();
-  m_data->setFilename(m_fullOutputName);
+  m_data->setFilename(getWritePath());
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -84,7 +84,7 @@ void WriteSolution::execute()
   CFLog(INFO, "Writing solution to: " << getMethodData().getFilename().string() << "\n");
 
   if(_fileFormatStr == "ASCII"){
-    writeToFile(getMethodData().getFilename());
+    getMethodData().writeOutput(*this, getMethodData().getFilename());
   }
   else
   {
@@ -957,7 +957,7 @@ void WriteSolution::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolution::writeToFileStream(std::ofstream& fout)
+void WriteSolution::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -1175,7 +1175,7 @@ void WriteSolution::writeToFileStream(std::ofstream& fout)
       }
     } //end if inner cells
   } //end loop over trs
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
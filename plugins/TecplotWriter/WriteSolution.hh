@@ -72,7 +72,7 @@ protected:
 
   /// Write the to the given file stream the MeshData.
   /// @throw Common::FilesystemException
-  virtual void writeToFileStream(std::ofstream& fout);
+  virtual void writeToFileStream(std::ostream& fout);
   
   /// Write the boundary surface data
   virtual void writeBoundarySurface();
@@ -61,12 +61,12 @@ WriteSolution1D::WriteSolution1D(const std::string& name) :
 void WriteSolution1D::execute()
 {
   CFLog(INFO, "Writing solution to: " << getMethodData().getFilename().string() << "\n");
-  writeToFile(getMethodData().getFilename());
+  getMethodData().writeOutput(*this, getMethodData().getFilename());
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolution1D::writeToFileStream(std::ofstream& fout)
+void WriteSolution1D::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -151,7 +151,7 @@ void WriteSolution1D::writeToFileStream(std::ofstream& fout)
       fout << dimState << "\n";
     }
   }
-  fout.close();
+  fout.flush();
 }
 
 //////////////////////////////////////////////////////////////////////////////
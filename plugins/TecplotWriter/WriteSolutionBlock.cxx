@@ -97,7 +97,7 @@ void WriteSolutionBlock::execute()
 
   if ( m_fileFormatStr == "ASCII" )
   {
-      writeToFile(getMethodData().getFilename());
+      getMethodData().writeOutput(*this, getMethodData().getFilename());
       return;
   }
 
@@ -127,7 +127,7 @@ void WriteSolutionBlock::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlock::writeToFileStream(std::ofstream& fout)
+void WriteSolutionBlock::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -415,7 +415,7 @@ void WriteSolutionBlock::writeToFileStream(std::ofstream& fout)
 
   } //end loop over trs
 
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
@@ -438,7 +438,7 @@ void WriteSolutionBlock::setup()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlock::write_tecplot_header(std::ofstream& fout)
+void WriteSolutionBlock::write_tecplot_header(std::ostream& fout)
 {
   CFAUTOTRACE;
 
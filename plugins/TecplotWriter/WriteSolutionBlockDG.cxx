@@ -106,7 +106,7 @@ void WriteSolutionBlockDG::execute()
 
   if ( m_fileFormatStr == "ASCII" )
   {
-      writeToFile(getMethodData().getFilename());
+      getMethodData().writeOutput(*this, getMethodData().getFilename());
       return;
   }
 
@@ -136,7 +136,7 @@ void WriteSolutionBlockDG::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlockDG::writeToFileStream(std::ofstream& fout)
+void WriteSolutionBlockDG::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -345,7 +345,7 @@ void WriteSolutionBlockDG::writeToFileStream(std::ofstream& fout)
   // write boundary surface data
   writeBoundarySurface();
 
-  fout.close();
+  fout.flush();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -363,7 +363,7 @@ void WriteSolutionBlockDG::setup()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlockDG::write_tecplot_header(std::ofstream& fout)
+void WriteSolutionBlockDG::write_tecplot_header(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -106,7 +106,7 @@ void WriteSolutionBlockFV::execute()
 
   if ( m_fileFormatStr == "ASCII" )
   {
-      writeToFile(getMethodData().getFilename());
+      getMethodData().writeOutput(*this, getMethodData().getFilename());
       return;
   }
 
@@ -136,7 +136,7 @@ void WriteSolutionBlockFV::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlockFV::writeToFileStream(std::ofstream& fout)
+void WriteSolutionBlockFV::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -447,7 +447,7 @@ void WriteSolutionBlockFV::writeToFileStream(std::ofstream& fout)
 
   } //end loop over trs
 
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
@@ -466,6 +466,7 @@ void WriteSolutionBlockFV::writeToFileStream(std::ofstream& fout)
         Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().createPtr();
       ofstream& fout = (*fhandle)->open(filepath);
       writeBoundarySurface(fout);
+      (*fhandle)->close();
       delete fhandle;
     }
   }
@@ -503,7 +504,7 @@ void WriteSolutionBlockFV::unsetup()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlockFV::write_tecplot_header(std::ofstream& fout)
+void WriteSolutionBlockFV::write_tecplot_header(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -557,7 +558,7 @@ void WriteSolutionBlockFV::write_tecplot_header(std::ofstream& fout)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionBlockFV::writeBoundarySurface(std::ofstream& fout)
+void WriteSolutionBlockFV::writeBoundarySurface(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -783,7 +784,7 @@ void WriteSolutionBlockFV::writeBoundarySurface(std::ofstream& fout)
         }
       }
 
-      fout.close();
+      fout.flush();
     }
 
 }
@@ -79,16 +79,16 @@ protected: // functions
 
   /// Write the to the given file stream the MeshData.
   /// @throw Common::FilesystemException
-  void writeToFileStream(std::ofstream& fout);
+  void writeToFileStream(std::ostream& fout);
 
   /// Write the boundary surface data
-  void writeBoundarySurface(std::ofstream& fout);
+  void writeBoundarySurface(std::ostream& fout);
 
   /// Get the name of the writer
   const std::string getWriterName() const;
 
   /// Writes the Tecplot file header
-  void write_tecplot_header(std::ofstream& fout);
+  void write_tecplot_header(std::ostream& fout);
 
 protected: // data
 
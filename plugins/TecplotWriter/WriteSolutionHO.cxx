@@ -92,7 +92,7 @@ void WriteSolutionHO::execute()
 
   if ( m_fileFormatStr == "ASCII" )
   {
-      writeToFile(getMethodData().getFilename());
+      getMethodData().writeOutput(*this, getMethodData().getFilename());
       return;
   }
   
@@ -122,7 +122,7 @@ void WriteSolutionHO::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionHO::writeToFileStream(std::ofstream& fout)
+void WriteSolutionHO::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
   
@@ -309,7 +309,7 @@ void WriteSolutionHO::writeToFileStream(std::ofstream& fout)
     
   } //end loop over trs
   
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
@@ -332,7 +332,7 @@ void WriteSolutionHO::setup()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionHO::write_tecplot_header(std::ofstream& fout)
+void WriteSolutionHO::write_tecplot_header(std::ostream& fout)
 {
   CFAUTOTRACE;
 
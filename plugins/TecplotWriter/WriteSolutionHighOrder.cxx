@@ -83,7 +83,7 @@ void WriteSolutionHighOrder::execute()
   CFLog(INFO, "Writing solution to: " << getMethodData().getFilename().string() << "\n");
 
   if(_fileFormatStr == "ASCII"){
-    writeToFile(getMethodData().getFilename());
+    getMethodData().writeOutput(*this, getMethodData().getFilename());
   }
   else
   {
@@ -117,7 +117,7 @@ void WriteSolutionHighOrder::writeToBinaryFile()
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
+void WriteSolutionHighOrder::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -360,7 +360,7 @@ void WriteSolutionHighOrder::writeToFileStream(std::ofstream& fout)
     }
   }
 
-  fout.close();
+  fout.flush();
 
   } // if only surface
 
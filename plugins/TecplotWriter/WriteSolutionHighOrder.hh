@@ -72,7 +72,7 @@ protected:
 
   /// Write the to the given file stream the MeshData.
   /// @throw Common::FilesystemException
-  void writeToFileStream(std::ofstream& fout);
+  void writeToFileStream(std::ostream& fout);
 
   /// Write the boundary surface data
   void writeBoundarySurface();
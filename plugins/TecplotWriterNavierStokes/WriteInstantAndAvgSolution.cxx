@@ -95,7 +95,7 @@ WriteInstantAndAvgSolution::WriteInstantAndAvgSolution(const std::string& name)
 
 //////////////////////////////////////////////////////////////////////////////
 
-void WriteInstantAndAvgSolution::writeToFileStream(std::ofstream& fout)
+void WriteInstantAndAvgSolution::writeToFileStream(std::ostream& fout)
 {
   CFAUTOTRACE;
 
@@ -415,14 +415,14 @@ void WriteInstantAndAvgSolution::writeToFileStream(std::ofstream& fout)
 
     foutAvg.flush();
   } //end loop over trs
-  fout.close();
+  fout.flush();
   foutAvg.close();
 
   }
   else
   {
     CFLog(INFO,"WriteInstantAndAvgSolution::writeToFileStream --> NOT writing files this iteration...");
-    fout.close();
+    fout.flush();
     path cfgpath = getMethodData().getFilename();
     remove(cfgpath);
   }
@@ -82,7 +82,7 @@ protected:
    * Write the to the given file stream the MeshData.
    * @throw Common::FilesystemException
    */
-  void writeToFileStream(std::ofstream& fout);
+  void writeToFileStream(std::ostream& fout);
 
   /**
    * Configures the command.
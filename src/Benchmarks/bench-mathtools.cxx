@@ -0,0 +1,228 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Common/Stopwatch.hh"
+#include "Common/StringOps.hh"
+#include "MathTools/RealVector.hh"
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/LUInverter.hh"
+#include "MathTools/BatchedBlockInverter.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD;
+using namespace COOLFluiD::Common;
+using namespace COOLFluiD::MathTools;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Micro-benchmarks of the small dense kernels of the MathTools library
+/// which dominate the cost of the flux, gradient and preconditioner loops.
+/// Each kernel is run on as many entities as a medium size mesh and the
+/// time per entity is written in the JSON file given as argument.
+
+/// number of entities (cells or faces) processed by each kernel
+static const CFuint NB_ENTITIES = 200000;
+
+/// number of times each kernel is repeated
+static const CFuint NB_REPEATS = 5;
+
+/// names and times per entity of the kernels
+static vector<string> kernelNames;
+static vector<CFreal> kernelTimes;
+
+/// value used to prevent the compiler from removing the kernels
+static CFreal checkSum = 0.;
+
+//////////////////////////////////////////////////////////////////////////////
+
+void addResult(const string& name, const CFreal time)
+{
+  kernelNames.push_back(name);
+  kernelTimes.push_back(time/(NB_ENTITIES*NB_REPEATS));
+  cout << name << " : " << kernelTimes.back()*1e9 << " ns/entity" << endl;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Vector expressions as in the flux splitters: F = 0.5*(FL + FR) - a*(UR - UL)
+void benchVectorExpressions(const CFuint nbEqs)
+{
+  RealVector fL(nbEqs), fR(nbEqs), uL(nbEqs), uR(nbEqs), flux(nbEqs);
+  for (CFuint i = 0; i < nbEqs; ++i) {
+    fL[i] = 1. + i; fR[i] = 2. - i; uL[i] = 0.5*i; uR[i] = 0.1 + i;
+  }
+
+  Stopwatch<WallTime> timer;
+  timer.start();
+  for (CFuint r = 0; r < NB_REPEATS; ++r) {
+    for (CFuint e = 0; e < NB_ENTITIES; ++e) {
+      const CFreal a = 1e-6*e;
+      flux = 0.5*(fL + fR) - a*(uR - uL);
+      checkSum += flux[0];
+    }
+  }
+  timer.stop();
+
+  addResult("VectorExpression" + StringOps::to_str(nbEqs), timer.read());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Matrix-vector products as in the Jacobians of the implicit schemes
+void benchMatrixVector(const CFuint nbEqs)
+{
+  RealMatrix jacob(nbEqs, nbEqs);
+  RealVector u(nbEqs), v(nbEqs);
+  for (CFuint i = 0; i < nbEqs; ++i) {
+    u[i] = 1. + i;
+    for (CFuint j = 0; j < nbEqs; ++j) {
+      jacob(i,j) = (i == j) ? 4. : 1./(1. + i + j);
+    }
+  }
+
+  Stopwatch<WallTime> timer;
+  timer.start();
+  for (CFuint r = 0; r < NB_REPEATS; ++r) {
+    for (CFuint e = 0; e < NB_ENTITIES; ++e) {
+      u[0] = 1e-6*e;
+      v = jacob*u;
+      checkSum += v[0];
+    }
+  }
+  timer.stop();
+
+  addResult("MatrixVector" + StringOps::to_str(nbEqs), timer.read());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Inversion of the diagonal blocks of the block preconditioners, one by one
+/// with the LUInverter and all together with the BatchedBlockInverter
+void benchBlockInversion(const CFuint nbEqs)
+{
+  const CFuint blockSize = nbEqs*nbEqs;
+  const CFuint nbBlocks = NB_ENTITIES/10;
+  vector<CFreal> blocks(nbBlocks*blockSize);
+  for (CFuint b = 0; b < nbBlocks; ++b) {
+    for (CFuint i = 0; i < nbEqs; ++i) {
+      for (CFuint j = 0; j < nbEqs; ++j) {
+	blocks[b*blockSize + i*nbEqs + j] = (i == j) ? 4. + 1e-6*b : 1./(1. + i + j);
+      }
+    }
+  }
+  vector<CFreal> inverses(blocks.size());
+
+  LUInverter luInverter(nbEqs);
+  RealMatrix a(nbEqs, nbEqs), x(nbEqs, nbEqs);
+  Stopwatch<WallTime> timer;
+  timer.start();
+  for (CFuint r = 0; r < 10*NB_REPEATS; ++r) {
+    for (CFuint b = 0; b < nbBlocks; ++b) {
+      for (CFuint k = 0; k < blockSize; ++k) {
+	a[k] = blocks[b*blockSize + k];
+      }
+      luInverter.invert(a, x);
+      for (CFuint k = 0; k < blockSize; ++k) {
+	inverses[b*blockSize + k] = x[k];
+      }
+    }
+  }
+  timer.stop();
+  checkSum += inverses[0];
+  addResult("LUInverter" + StringOps::to_str(nbEqs), timer.read());
+
+  BatchedBlockInverter batchedInverter(nbEqs);
+  timer.reset();
+  timer.start();
+  for (CFuint r = 0; r < 10*NB_REPEATS; ++r) {
+    batchedInverter.invert(&blocks[0], &inverses[0], nbBlocks);
+  }
+  timer.stop();
+  checkSum += inverses[0];
+  addResult("BatchedBlockInverter" + StringOps::to_str(nbEqs), timer.read());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Assembly of the normal matrix of the least square gradient reconstruction
+/// for a 2D cell with a stencil of 8 neighbours
+void benchLeastSquareMatrix()
+{
+  const CFuint stencilSize = 8;
+  vector<CFreal> dx(stencilSize), dy(stencilSize);
+  for (CFuint s = 0; s < stencilSize; ++s) {
+    dx[s] = 1. + 0.1*s; dy[s] = 0.5 - 0.2*s;
+  }
+  RealMatrix lsMatrix(2,2);
+
+  Stopwatch<WallTime> timer;
+  timer.start();
+  for (CFuint r = 0; r < NB_REPEATS; ++r) {
+    for (CFuint e = 0; e < NB_ENTITIES; ++e) {
+      lsMatrix = 0.;
+      for (CFuint s = 0; s < stencilSize; ++s) {
+	const CFreal w = 1./(dx[s]*dx[s] + dy[s]*dy[s] + 1e-9*e);
+	lsMatrix(0,0) += w*dx[s]*dx[s];
+	lsMatrix(0,1) += w*dx[s]*dy[s];
+	lsMatrix(1,1) += w*dy[s]*dy[s];
+      }
+      lsMatrix(1,0) = lsMatrix(0,1);
+      checkSum += lsMatrix(1,0);
+    }
+  }
+  timer.stop();
+
+  addResult("LeastSquareMatrix2D", timer.read());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+  if (argc != 2) {
+    cerr << "usage: " << argv[0] << " <output JSON file>" << endl;
+    return 1;
+  }
+
+  benchVectorExpressions(5);
+  benchVectorExpressions(9);
+  benchMatrixVector(5);
+  benchMatrixVector(9);
+  benchBlockInversion(5);
+  benchBlockInversion(9);
+  benchLeastSquareMatrix();
+
+  ofstream fout(argv[1]);
+  if (!fout) {
+    cerr << "cannot open " << argv[1] << endl;
+    return 1;
+  }
+
+  fout.precision(8);
+  fout << "{\n"
+       << "  \"case\": \"mathtools\",\n"
+       << "  \"nbEntities\": " << NB_ENTITIES << ",\n"
+       << "  \"checkSum\": " << checkSum << ",\n"
+       << "  \"phases\": {";
+  for (CFuint i = 0; i < kernelNames.size(); ++i) {
+    fout << ((i > 0) ? ",\n" : "\n")
+	 << "    \"" << kernelNames[i] << "\": {\"time\": " << kernelTimes[i]
+	 << ", \"calls\": " << NB_ENTITIES*NB_REPEATS << "}";
+  }
+  fout << "\n  }\n}\n";
+
+  return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
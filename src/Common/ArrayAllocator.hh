@@ -80,6 +80,9 @@ public:
   /// factor for which dividing the element size
   size_t sizeFactor() const {return 1;}
   
+  /// @return the number of bytes allocated for the elements
+  size_t getMemoryBytes() const {return getCurrSize()*ElementSize;}
+  
   /// For valarray compatibility
   void resize (size_t NewSize);
   
@@ -0,0 +1,89 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/BenchmarkTimers.hh"
+#include "Common/OSystem.hh"
+#include "Common/ProcessInfo.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+BenchmarkTimers& BenchmarkTimers::getInstance()
+{
+  static BenchmarkTimers timers;
+  return timers;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BenchmarkTimers::BenchmarkTimers() :
+  m_isEnabled(false),
+  m_isMemoryTracked(false),
+  m_allocCounter(CFNULL),
+  m_phaseIDs(),
+  m_names(),
+  m_times(),
+  m_nbCalls(),
+  m_maxMemory(),
+  m_nbPhaseAllocs()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BenchmarkTimers::~BenchmarkTimers()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BenchmarkTimers::enableMemoryTracking(AllocCounter counter)
+{
+  m_isEnabled = true;
+  m_isMemoryTracked = true;
+  m_allocCounter = counter;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BenchmarkTimers::add(const std::string& name, const CFreal seconds,
+			  const CFuint nbAllocs)
+{
+  std::map<std::string, CFuint>::iterator itr = m_phaseIDs.find(name);
+  if (itr == m_phaseIDs.end()) {
+    itr = m_phaseIDs.insert(std::make_pair(name, CFuint(m_names.size()))).first;
+    m_names.push_back(name);
+    m_times.push_back(0.);
+    m_nbCalls.push_back(0);
+    m_maxMemory.push_back(0.);
+    m_nbPhaseAllocs.push_back(0);
+  }
+
+  const CFuint id = itr->second;
+  m_times[id] += seconds;
+  ++m_nbCalls[id];
+  m_nbPhaseAllocs[id] += nbAllocs;
+  
+  if (m_isMemoryTracked) {
+    // the peak, not the current usage, so that the memory allocated and
+    // released inside the phase is accounted for
+    const CFdouble memory = OSystem::getInstance().getProcessInfo()->peakMemoryUsageBytes();
+    if (memory > m_maxMemory[id]) {m_maxMemory[id] = memory;}
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,171 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_BenchmarkTimers_hh
+#define COOLFluiD_Common_BenchmarkTimers_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "Common/Stopwatch.hh"
+#include "Common/CommonAPI.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class accumulates the wall time spent in the main phases of a
+/// simulation (mesh reading, residual computation, linear solver,
+/// synchronization of the states, output, ...) for the benchmark runs of
+/// coolfluid-solver.
+/// The timers are disabled by default: a timed Scope then only checks a flag.
+/// Optionally, the memory high-water mark and the number of allocations of
+/// each phase are tracked too.
+class Common_API BenchmarkTimers : public Common::NonCopyable<BenchmarkTimers> {
+public:
+
+  /// Times the life of this object and adds it to the given phase
+  class Scope {
+  public:
+
+    /// Constructor, starting the timer if the timers are enabled
+    /// @param name  name of the phase
+    Scope(const char* name) :
+      m_name(name),
+      m_isEnabled(BenchmarkTimers::getInstance().isEnabled()),
+      m_nbAllocs(0)
+    {
+      if (m_isEnabled) {
+        m_nbAllocs = BenchmarkTimers::getInstance().getNbAllocs();
+        m_stopwatch.start();
+      }
+    }
+
+    /// Destructor, adding the time to the phase
+    ~Scope()
+    {
+      if (m_isEnabled) {
+        m_stopwatch.stop();
+        BenchmarkTimers& timers = BenchmarkTimers::getInstance();
+        timers.add(m_name, m_stopwatch.read(), timers.getNbAllocs() - m_nbAllocs);
+      }
+    }
+
+  private:
+
+    /// name of the phase
+    const char* m_name;
+
+    /// flag telling if the timers were enabled at construction
+    bool m_isEnabled;
+
+    /// number of allocations at construction
+    CFuint m_nbAllocs;
+
+    /// timer of the scope
+    Stopwatch<WallTime> m_stopwatch;
+  };
+
+  /// Function returning the current number of allocations
+  typedef CFuint (*AllocCounter)();
+
+  /// @return the single instance of this class
+  static BenchmarkTimers& getInstance();
+
+  /// Enable the timers
+  void enable() {m_isEnabled = true;}
+
+  /// @return true if the timers are enabled
+  bool isEnabled() const {return m_isEnabled;}
+
+  /// Enable the timers and the tracking of the memory high-water mark
+  /// of each phase (peak resident set size of the process, ru_maxrss,
+  /// reached by the end of the phase)
+  /// @param counter  function giving the number of allocations done so
+  ///                 far, or CFNULL if the allocations are not counted
+  void enableMemoryTracking(AllocCounter counter);
+
+  /// @return true if the memory of the phases is tracked
+  bool isMemoryTracked() const {return m_isMemoryTracked;}
+
+  /// Add the given time and number of allocations to the given phase
+  void add(const std::string& name, const CFreal seconds, const CFuint nbAllocs = 0);
+
+  /// @return the current number of allocations (0 if they are not counted)
+  CFuint getNbAllocs() const {return (m_allocCounter != CFNULL) ? m_allocCounter() : 0;}
+
+  /// @return the names of the phases, in order of first use
+  const std::vector<std::string>& getNames() const {return m_names;}
+
+  /// @return the total time spent in each phase
+  const std::vector<CFreal>& getTimes() const {return m_times;}
+
+  /// @return the number of times each phase was timed
+  const std::vector<CFuint>& getNbCalls() const {return m_nbCalls;}
+
+  /// @return the peak resident set size (in bytes) of the process reached
+  ///         by the end of each phase
+  const std::vector<CFdouble>& getMaxMemory() const {return m_maxMemory;}
+
+  /// @return the number of allocations done in each phase
+  const std::vector<CFuint>& getNbPhaseAllocs() const {return m_nbPhaseAllocs;}
+
+private:
+
+  /// Constructor
+  BenchmarkTimers();
+
+  /// Destructor
+  ~BenchmarkTimers();
+
+private:
+
+  /// flag telling if the timers are enabled
+  bool m_isEnabled;
+
+  /// flag telling if the memory of the phases is tracked
+  bool m_isMemoryTracked;
+
+  /// function giving the current number of allocations
+  AllocCounter m_allocCounter;
+
+  /// index of each phase in the following arrays
+  std::map<std::string, CFuint> m_phaseIDs;
+
+  /// names of the phases
+  std::vector<std::string> m_names;
+
+  /// total time of each phase
+  std::vector<CFreal> m_times;
+
+  /// number of times each phase was timed
+  std::vector<CFuint> m_nbCalls;
+
+  /// peak resident set size of the process reached by the end of each phase
+  std::vector<CFdouble> m_maxMemory;
+
+  /// number of allocations done in each phase
+  std::vector<CFuint> m_nbPhaseAllocs;
+
+}; // end of class BenchmarkTimers
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_BenchmarkTimers_hh
@@ -1,116 +1,128 @@
-// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
-//
-// This software is distributed under the terms of the
-// GNU Lesser General Public License version 3 (LGPLv3).
-// See doc/lgpl.txt and doc/gpl.txt for the license text.
-
-#ifndef COOLFluiD_COOLFluiD_hh
-#define COOLFluiD_COOLFluiD_hh
-
-//////////////////////////////////////////////////////////////////////////////
-
-#ifdef CF_HAVE_CONFIG_H
-#  include "coolfluid_config.h"
-#endif // CF_HAVE_CONFIG_H
-
-//////////////////////////////////////////////////////////////////////////////
-
-#include "Common/Compatibility.hh"
-#include "Common/StlHeaders.hh"
-#include "Common/Common.hh"
-#include "Common/CFAssert.hh"
-#include "Common/DemangledTypeID.hh"
-#include "Common/PtrAlloc.hh"
-
-/// macro to impose exiting after a certain number of iterations
-#define EXIT_AT(__exitIter__) {static int count = 0; if (count++ == __exitIter__) exit(1);}
-
-  /// macro to impose aborting after a certain number of iterations
-#define ABORT_AT(__exitIter__) {static int count = 0; if (count++ == __exitIter__) abort();}
-
-//////////////////////////////////////////////////////////////////////////////
-
-/// Definition of COOLFluiD namespace.
-/// @author Tiago Quintino
-/// @author Andrea Lani
-namespace COOLFluiD {
-
-//////////////////////////////////////////////////////////////////////////////
-
-  /// Definition of the basic types for possible portability conflicts
-
-  /// typedef for float
-  typedef float              CFfloat;
-  /// typedef for double
-  typedef double             CFdouble;
-  /// typedef for long double
-  typedef long double        CFldouble;
-  
-#ifdef CF_HAVE_LONG 
-/// typedef for int
-  typedef long int      CFint;
-  /// typedef for unsigned int
-  typedef long int      CFuint;
-#else
-#ifdef CF_HAVE_LLONG 
-  /// typedef for int
-  typedef long long int      CFint;
-  /// typedef for unsigned int
-  typedef long long int      CFuint;
-#else  
-/// typedef for int
-  typedef int                CFint;
-  /// typedef for unsigned int
-  typedef unsigned int       CFuint;
-#endif
-#endif
-  
-  /// typedef for char
-  typedef char               CFchar;
-
-  /// Enumeration of the dimensions
-  enum CFDim         {DIM_0D, DIM_1D, DIM_2D, DIM_3D};
-
-  /// Enumeration of the coordinates indexes
-  enum CoordXYZ       {XX, YY, ZZ};
-  
-  /// Enumeration of the reference coordinates indexes
-  enum CoordRefXiEtaZeta    {KSI, ETA, ZTA};
-
-  /// Enumeration of the device types
-  enum DeviceType {CPU=0, GPU=1};
-
-  /// class to be used to define a default type
-  class NOTYPE {};
- 
-  /// function to reset to 0 a certain input variable
-  template <typename T> static void RESET_TO_ZERO(T& input) {input = 0;}
-  
-//////////////////////////////////////////////////////////////////////////////
-
-/// Definition of the default precision
-#ifdef CF_PRECISION_LONG_DOUBLE
-  typedef CFldouble CFreal;
-#else
-  #ifdef CF_PRECISION_DOUBLE
-    typedef CFdouble CFreal;
-  #else
-    #ifdef CF_PRECISION_SINGLE
-      typedef CFfloat CFreal;
-    #endif
-  #endif
-#endif
-// if nothing defined, use double
-#if !defined CF_PRECISION_DOUBLE && !defined CF_PRECISION_SINGLE && !defined CF_PRECISION_LONG_DOUBLE
-  typedef CFdouble CFreal;
-#endif
-
-typedef std::complex<CFreal>  CFcomplex;
-
-//////////////////////////////////////////////////////////////////////////////
-
-} // namespace COOLFluiD
-
-//////////////////////////////////////////////////////////////////////////////
-
-#endif // COOLFluiD_COOLFLUID_hh
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_COOLFluiD_hh
+#define COOLFluiD_COOLFluiD_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CF_HAVE_CONFIG_H
+#  include "coolfluid_config.h"
+#endif // CF_HAVE_CONFIG_H
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/Compatibility.hh"
+#include "Common/StlHeaders.hh"
+#include "Common/Common.hh"
+#include "Common/CFAssert.hh"
+#include "Common/DemangledTypeID.hh"
+#include "Common/PtrAlloc.hh"
+
+/// macro to impose exiting after a certain number of iterations
+#define EXIT_AT(__exitIter__) {static int count = 0; if (count++ == __exitIter__) exit(1);}
+
+  /// macro to impose aborting after a certain number of iterations
+#define ABORT_AT(__exitIter__) {static int count = 0; if (count++ == __exitIter__) abort();}
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of COOLFluiD namespace.
+/// @author Tiago Quintino
+/// @author Andrea Lani
+namespace COOLFluiD {
+
+//////////////////////////////////////////////////////////////////////////////
+
+  /// Definition of the basic types for possible portability conflicts
+
+  /// typedef for float
+  typedef float              CFfloat;
+  /// typedef for double
+  typedef double             CFdouble;
+  /// typedef for long double
+  typedef long double        CFldouble;
+  
+#ifdef CF_HAVE_LONG 
+/// typedef for int
+  typedef long int      CFint;
+  /// typedef for unsigned int
+  typedef long int      CFuint;
+#else
+#ifdef CF_HAVE_LLONG 
+  /// typedef for int
+  typedef long long int      CFint;
+  /// typedef for unsigned int
+  typedef long long int      CFuint;
+#else  
+/// typedef for int
+  typedef int                CFint;
+  /// typedef for unsigned int
+  typedef unsigned int       CFuint;
+#endif
+#endif
+
+#if defined(CF_HAVE_LONG_GLOBAL_IDS) && !defined(CF_HAVE_LONG) && !defined(CF_HAVE_LLONG)
+  /// typedef for global indices (numbering across all the processors),
+  /// wider than CFuint which is kept for local indices.
+  /// The element connectivities (and the CFmesh files) are still stored in
+  /// CFuint: the readers reject meshes with more than 4G entities, which
+  /// still need CF_ENABLE_LONG or CF_ENABLE_LLONG
+  typedef long long unsigned int CFgid;
+#else
+  /// typedef for global indices (numbering across all the processors)
+  typedef CFuint             CFgid;
+#endif
+  
+  /// typedef for char
+  typedef char               CFchar;
+
+  /// Enumeration of the dimensions
+  enum CFDim         {DIM_0D, DIM_1D, DIM_2D, DIM_3D};
+
+  /// Enumeration of the coordinates indexes
+  enum CoordXYZ       {XX, YY, ZZ};
+  
+  /// Enumeration of the reference coordinates indexes
+  enum CoordRefXiEtaZeta    {KSI, ETA, ZTA};
+
+  /// Enumeration of the device types
+  enum DeviceType {CPU=0, GPU=1};
+
+  /// class to be used to define a default type
+  class NOTYPE {};
+ 
+  /// function to reset to 0 a certain input variable
+  template <typename T> static void RESET_TO_ZERO(T& input) {input = 0;}
+  
+//////////////////////////////////////////////////////////////////////////////
+
+/// Definition of the default precision
+#ifdef CF_PRECISION_LONG_DOUBLE
+  typedef CFldouble CFreal;
+#else
+  #ifdef CF_PRECISION_DOUBLE
+    typedef CFdouble CFreal;
+  #else
+    #ifdef CF_PRECISION_SINGLE
+      typedef CFfloat CFreal;
+    #endif
+  #endif
+#endif
+// if nothing defined, use double
+#if !defined CF_PRECISION_DOUBLE && !defined CF_PRECISION_SINGLE && !defined CF_PRECISION_LONG_DOUBLE
+  typedef CFdouble CFreal;
+#endif
+
+typedef std::complex<CFreal>  CFcomplex;
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_COOLFLUID_hh
@@ -11,6 +11,7 @@
 
 #include <ostream>
 #include <valarray>
+#include <vector>
 #include <limits>
 
 #include "Common/SafePtr.hh"
@@ -35,11 +36,14 @@ namespace COOLFluiD {
 
 /// This class provides a generic table with arbitrary number
 /// of columns for its rows.
-/// If the data member m_isHybrid is true the table has the
-/// logical number of columns equal to the maximum number of
-/// columns and m_columnPattern keeps knowledge of the actual size and
-/// m_columnPattern.size() == _mrowSize
-/// If the storage is not hybrid then m_columnPattern.size() == 1.
+/// The entries are stored row by row. If the rows have different sizes
+/// (hybrid table) they are packed one after the other and m_rowStart
+/// keeps the position of the first entry of each row (CSR storage),
+/// otherwise m_rowStart is empty and all rows have m_nbcols entries.
+/// The row offsets are CFuint, as the entries of the mesh connectivities:
+/// their width is set by the build (64 bit with CF_HAVE_LONG or CF_HAVE_LLONG).
+/// With CUDA, the entries are stored column by column, padded with NOVALUE
+/// up to the maximum number of columns, as expected by the kernels.
 /// @author Andrea Lani
 /// @author Tiago Quintino
 template <class T>
@@ -82,7 +86,7 @@ public: // methods
   /// Default constructor
   ConnectivityTable() :
     NOVALUE(std::numeric_limits<T>::max()), 
-    m_nbentries(0), m_nbrows(0), m_nbcols(0), m_table()
+    m_nbentries(0), m_nbrows(0), m_nbcols(0), m_rowStart(), m_table()
   {
   }
 
@@ -93,8 +97,7 @@ public: // methods
     NOVALUE(std::numeric_limits<T>::max())
   {
     deallocate();
-    const CFuint maxCol = findMaxCol(columnPattern);
-    allocate(columnPattern.size(),maxCol);
+    allocate(columnPattern);
     putPattern(columnPattern,value);
   }
   
@@ -120,6 +123,12 @@ public: // methods
     cf_assert(m_nbentries <= m_nbrows*m_nbcols);
     return m_nbentries;
   }
+  
+  /// Get the number of bytes allocated for the table
+  size_t getMemoryBytes() const
+  {
+    return m_table.size()*sizeof(T) + m_rowStart.capacity()*sizeof(CFuint);
+  }
 
   /// Resize the table
   /// @param columnPattern gives the number of columns per row
@@ -127,8 +136,7 @@ public: // methods
   void resize(const std::valarray<CFuint>& columnPattern, T value = T())
   {
     deallocate();
-    const CFuint maxCol = findMaxCol(columnPattern);
-    allocate(columnPattern.size(),maxCol);
+    allocate(columnPattern);
     putPattern(columnPattern,value);
   }
 
@@ -150,7 +158,7 @@ public: // methods
   {
     cf_assert(iRow < m_nbrows);
     cf_assert(jCol < nbCols(iRow));
-    return m_table[jCol*m_nbrows + iRow];
+    return m_table[getIndex(iRow,jCol)];
   }
 
   /// Accessor for table elements
@@ -159,7 +167,7 @@ public: // methods
     cf_assert(m_table.size() > 0);
     cf_assert(iRow < m_nbrows);
     cf_assert(jCol < nbCols(iRow));
-    return m_table[jCol*m_nbrows + iRow];
+    return m_table[getIndex(iRow,jCol)];
   }
 
   /// Get the number of rows
@@ -168,15 +176,13 @@ public: // methods
   /// Get the number of columns
   CFuint nbCols(CFuint iRow) const
   {
-    ///@todo change this
     cf_assert(iRow < m_nbrows);
-    CFuint nbcol = m_nbcols;
-    for (; nbcol >= 1; --nbcol) {
-      if (m_table[(nbcol-1)*m_nbrows + iRow] != NOVALUE) return nbcol;
-    }
-    return 0;
+    return (m_rowStart.size() > 0) ? m_rowStart[iRow+1] - m_rowStart[iRow] : m_nbcols;
   }
 
+  /// Get the maximum number of columns
+  CFuint maxNbCols() const {return m_nbcols;}
+
   /// Tell if the table is hybrid
   bool isHybrid() const {return true;}
 
@@ -220,21 +226,55 @@ public: // methods
 
 private: // helper functions
 
+  /// Get the position of the given entry in the storage
+  CFuint getIndex(CFuint iRow, CFuint jCol) const
+  {
+#ifdef CF_HAVE_CUDA
+    return jCol*m_nbrows + iRow;
+#else
+    return (m_rowStart.size() > 0) ? m_rowStart[iRow] + jCol : iRow*m_nbcols + jCol;
+#endif
+  }
+  
   /// create the storage
   void create(const ConnectivityTable<T>& init) 
   {
     deallocate();
-    allocate(init.m_nbrows, init.m_nbcols);
-    copyTable(init.m_table);
     m_nbentries = init.m_nbentries;
+    m_nbrows = init.m_nbrows;
+    m_nbcols = init.m_nbcols;
+    m_rowStart = init.m_rowStart;
+    m_table.resize(init.m_table.size());
+    copyTable(init.m_table);
   }
   
   /// Allocate
-  void allocate(CFuint nbrows, CFuint nbcols)
+  void allocate(const std::valarray<CFuint>& columnPattern)
   {
-    m_nbrows = nbrows;
-    m_nbcols = nbcols;
-    m_table.resize(nbrows*nbcols);
+    m_nbrows = columnPattern.size();
+    m_nbcols = findMaxCol(columnPattern);
+    m_nbentries = 0;
+    
+    bool isUniform = true;
+    for (CFuint iRow = 0; iRow < m_nbrows; ++iRow) {
+      m_nbentries += columnPattern[iRow];
+      if (columnPattern[iRow] != m_nbcols) isUniform = false;
+    }
+    
+    // row offsets are needed only if the rows have different sizes
+    if (!isUniform) {
+      m_rowStart.resize(m_nbrows+1);
+      m_rowStart[0] = 0;
+      for (CFuint iRow = 0; iRow < m_nbrows; ++iRow) {
+	m_rowStart[iRow+1] = m_rowStart[iRow] + columnPattern[iRow];
+      }
+    }
+    
+#ifdef CF_HAVE_CUDA
+    m_table.resize(m_nbrows*m_nbcols);
+#else
+    m_table.resize(m_nbentries);
+#endif
   }
   
   /// Deallocate
@@ -243,6 +283,7 @@ private: // helper functions
     m_nbentries = 0;
     m_nbrows = 0;
     m_nbcols = 0;
+    std::vector<CFuint>().swap(m_rowStart);
     if (m_table.size() > 0) {
 #ifdef CF_HAVE_CUDA
       m_table.free();
@@ -267,22 +308,18 @@ private: // helper functions
   /// Put the pattern in the table
   void putPattern(const std::valarray<CFuint>& columnPattern, T value)
   {
-    m_nbentries = 0;
+#ifdef CF_HAVE_CUDA
     for (CFuint iRow = 0; iRow < m_nbrows; ++iRow) {
-      // update the number of entries
-      m_nbentries += columnPattern[iRow];
-      
       for (CFuint jCol = 0; jCol < m_nbcols; ++jCol) {
-        if (jCol < columnPattern[iRow]) {
-	  // here operator() cannot be used, it could assert if entries in table are not initialized to 0
-	  m_table[jCol*m_nbrows + iRow] = value;
-	}
-        else {
-	  // here operator() cannot be used, it should assert because jCol > nbCols(iRow)
-	  m_table[jCol*m_nbrows + iRow] = NOVALUE;
-	}
+	// padding entries are set to NOVALUE
+	m_table[getIndex(iRow,jCol)] = (jCol < columnPattern[iRow]) ? value : NOVALUE;
       }
     }
+#else
+    for (CFuint i = 0; i < m_nbentries; ++i) {
+      m_table[i] = value;
+    }
+#endif
     cf_assert(m_nbentries <= m_nbrows*m_nbcols);
   }
   
@@ -291,7 +328,7 @@ private: // helper functions
   void copyTable(const T1& other)
   {
     cf_assert(m_table.size() == other.size());
-    const CFuint tsize = m_nbrows*m_nbcols;
+    const CFuint tsize = m_table.size();
     for (CFuint i = 0; i < tsize; ++i) {
       m_table[i] = other[i];
     }
@@ -309,6 +346,10 @@ private: // data
   /// maximum column size
   CFuint m_nbcols;
   
+  /// position of the first entry of each row (plus the total number of
+  /// entries), empty if all the rows have m_nbcols entries
+  std::vector<CFuint> m_rowStart;
+  
   /// the actual storage of the table
   ARRAY m_table;
   
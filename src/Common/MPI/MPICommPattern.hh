@@ -157,6 +157,9 @@ public:
   /// The index type (inherited from ArrayAllocator)
   typedef typename COOLFluiD::Common::ArrayAllocator<T>::IndexType  IndexType;
 
+  /// The global index type (can be wider than the local one)
+  typedef CFgid GlobalIndexType;
+
   /// Represents the type stored in the vector
   typedef T _ElementType;
 
@@ -169,12 +172,12 @@ private:
   struct IdxStruct
   {
     // GlobalIndex is also used for the free list
-    IndexType GlobalIndex;
+    GlobalIndexType GlobalIndex;
   };
   typedef IdxStruct DataType;
 
-  typedef std::map<IndexType,IndexType> TGhostMap;
-  typedef std::map<IndexType,IndexType> TIndexMap;
+  typedef std::map<GlobalIndexType,IndexType> TGhostMap;
+  typedef std::map<GlobalIndexType,IndexType> TIndexMap;
 
 
   //============================================================
@@ -212,8 +215,8 @@ private:
   /// instantiation; TODO: Try out some scheme with extern
   /// to avoid duplication of useless constants
   static const IndexType _NO_MORE_FREE;
-  static const IndexType _FLAG_DELETED;
-  static const IndexType _FLAG_GHOST;
+  static const GlobalIndexType _FLAG_DELETED;
+  static const GlobalIndexType _FLAG_GHOST;
   static const IndexType _NOT_FOUND;
 
   /// The used tags
@@ -242,7 +245,7 @@ private:
   MPI_Comm _Communicator;
   
   /// mapping from global ghost IDs to donor ranks
-  Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> > m_mapGhost2Donor;
+  Common::SharedPtr<Common::CFMultiMap<GlobalIndexType, CFuint> > m_mapGhost2Donor;
   
   /// send counts for ghost points
   std::vector<int> m_sendCount;
@@ -290,10 +293,10 @@ private:
   std::vector<MPI_Request> _SendRequests;
 
   /// Data of the CGLobal map
-  std::vector<IndexType> _CGlobal;
+  std::vector<GlobalIndexType> _CGlobal;
 
   /// The CGlobal index of our first local element
-  IndexType _FirstCGlobal;
+  GlobalIndexType _FirstCGlobal;
 
   //=============================================================
   //=================== Private Functions =======================
@@ -320,18 +323,18 @@ private:
 
   /// Find functions (for internal use)
   /// These take advantage of a index map if one is present
-  IndexType FindLocal (IndexType GlobalIndex) const;
-  IndexType FindGhost (IndexType GlobalIndex) const;
+  IndexType FindLocal (GlobalIndexType GlobalIndex) const;
+  IndexType FindGhost (GlobalIndexType GlobalIndex) const;
 
-  void AddLocalIndex (IndexType LocalIndex, IndexType GlobalIndex);
-  void AddGhostIndex (IndexType LocalIndex, IndexType GlobalIndex);
+  void AddLocalIndex (IndexType LocalIndex, GlobalIndexType GlobalIndex);
+  void AddGhostIndex (IndexType LocalIndex, GlobalIndexType GlobalIndex);
 
-  IndexType NormalIndex (IndexType GlobalIndex) const;
+  GlobalIndexType NormalIndex (GlobalIndexType GlobalIndex) const;
 
   //= Flag helper functions
-  inline bool IsFlagSet (IndexType GlobalIndex, IndexType Fl) const;
-  inline IndexType SetFlag (IndexType GlobalIndex, IndexType Fl) const;
-  inline IndexType ClearFlag (IndexType GLobalIndex, IndexType Fl) const;
+  inline bool IsFlagSet (GlobalIndexType GlobalIndex, GlobalIndexType Fl) const;
+  inline GlobalIndexType SetFlag (GlobalIndexType GlobalIndex, GlobalIndexType Fl) const;
+  inline GlobalIndexType ClearFlag (GlobalIndexType GLobalIndex, GlobalIndexType Fl) const;
 
 #ifdef CF_ENABLE_PARALLEL_DEBUG
   void WriteCommPattern () const;
@@ -364,7 +367,7 @@ public: // funcions
 
   /// Return the total vector size (not counting ghost points)
   /// This is a COLLECTIVE operation!
-  IndexType GetGlobalSize () const; /* collective */
+  GlobalIndexType GetGlobalSize () const; /* collective */
 
   /// Return the number of local (non-ghost) points
   /// Local operation.
@@ -378,23 +381,23 @@ public: // funcions
   /// Local operation.
   /// For now, NO Add operations are allowed after
   /// BuildGhostMap is called.
-  IndexType AddGhostPoint (IndexType GlobalIndex);
+  IndexType AddGhostPoint (GlobalIndexType GlobalIndex);
 
   /// Insert new local point
   /// Local operation.
   /// For now, NO add operations are allowed after
   /// BuildGhostMap is called.
-  IndexType AddLocalPoint (IndexType GlobalIndex);
+  IndexType AddLocalPoint (GlobalIndexType GlobalIndex);
 
   /// Local to global mapping:
   ///  (LOCAL operation)
   /// To determine if an element is a ghost element,
   /// use IsGhost ()
-  IndexType LocalToGlobal (IndexType LocalIndex) const; /* local */
+  GlobalIndexType LocalToGlobal (IndexType LocalIndex) const; /* local */
 
   /// Global to local mapping.
   /// Can be slow if no indexes were built.
-  IndexType GlobalToLocal (IndexType GlobalIndex) const; /* local */
+  IndexType GlobalToLocal (GlobalIndexType GlobalIndex) const; /* local */
 
   /// Start the synchronisation
   /// Collective operation.
@@ -439,7 +442,7 @@ public: // funcions
    
   /// Set the mapping from global ghost IDs to donor ranks
   void setMapGhost2DonorRanks
-  (Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> >& mapGhost2Donor) 
+  (Common::SharedPtr<Common::CFMultiMap<GlobalIndexType, CFuint> >& mapGhost2Donor) 
   {
     m_mapGhost2Donor.reset(mapGhost2Donor);
   }
@@ -494,7 +497,7 @@ public: // funcions
   void FreeCGlobal ();
 
   /// Lookup the global continuous ID of a local element
-  inline IndexType LocalToCGlobal (IndexType LocalID) const;
+  inline GlobalIndexType LocalToCGlobal (IndexType LocalID) const;
   
   /// Return the local size: This is the number of
   /// locally owned points incremented by the number of ghost points
@@ -535,11 +538,11 @@ const typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::_NO_MORE_FR
   std::numeric_limits<typename MPICommPattern<DATA>::IndexType>::max();
       
 template <typename DATA>
-const typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::_FLAG_DELETED =
-  (std::numeric_limits<IndexType>::max()/ 2) + 1;
+const typename MPICommPattern<DATA>::GlobalIndexType MPICommPattern<DATA>::_FLAG_DELETED =
+  (std::numeric_limits<GlobalIndexType>::max()/ 2) + 1;
       
 template <typename DATA>
-const typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::_FLAG_GHOST =
+const typename MPICommPattern<DATA>::GlobalIndexType MPICommPattern<DATA>::_FLAG_GHOST =
   (MPICommPattern<DATA>::_FLAG_DELETED >> 1);
       
 template <typename DATA>
@@ -555,11 +558,11 @@ void MPICommPattern<DATA>::BuildCGlobalLocal (std::vector<IndexType> & Ghosts)
 {
   // Ghosts contains the local index of the ghost element
   // The number of locally owned elements
-  const CFuint LocalOwned = GetLocalSize();
-  CFuint StartID = 0;
+  GlobalIndexType LocalOwned = GetLocalSize();
+  GlobalIndexType StartID = 0;
 
   // Prefix scan
-  MPI_Scan (const_cast<CFuint*>(&LocalOwned), 
+  MPI_Scan (&LocalOwned, 
 	    &StartID, 1, MPIStructDef::getMPIType(&StartID),
 	    MPI_SUM, _Communicator);
   
@@ -644,8 +647,8 @@ void MPICommPattern<DATA>::BuildCGlobal ()
   MPI_Request SendRequest;
   MPI_Request ReceiveRequest;
   
-  std::vector<IndexType> SendBuf (MaxGhostSize+1, 666);
-  std::vector<IndexType> ReceiveBuf (MaxGhostSize+1, 666);
+  std::vector<GlobalIndexType> SendBuf (MaxGhostSize+1, 666);
+  std::vector<GlobalIndexType> ReceiveBuf (MaxGhostSize+1, 666);
   
   // We store all the global IDs we want to translate in the
   // send buffer (first element is number of elements following)
@@ -680,7 +683,7 @@ void MPICommPattern<DATA>::BuildCGlobal ()
       {
 	const CFuint CurID = i+1;
 	
-	const IndexType CurVal = ReceiveBuf[CurID];
+	const GlobalIndexType CurVal = ReceiveBuf[CurID];
 	
 	// We have to map CurGlobalID to CGlobalID
 	
@@ -748,13 +751,13 @@ template <typename DATA>
 void MPICommPattern<DATA>::InvalidateCGlobal ()
 {
   _CGlobalValid = false;
-  std::swap (_CGlobal, std::vector<CFuint>());
+  std::vector<GlobalIndexType>().swap(_CGlobal);
 }
 
 //////////////////////////////////////////////////////////////////////////////
  
 template <typename DATA>
-typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::LocalToCGlobal (IndexType LocalID) const
+typename MPICommPattern<DATA>::GlobalIndexType MPICommPattern<DATA>::LocalToCGlobal (IndexType LocalID) const
 {
   cf_assert (_CGlobalValid);
   cf_assert (LocalID < _CGlobal.size());
@@ -765,22 +768,22 @@ typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::LocalToCGlobal (I
 //////////////////////////////////////////////////////////////////////////////
       
 template <typename DATA>
-inline typename MPICommPattern<DATA>::IndexType
-MPICommPattern<DATA>::ClearFlag (IndexType Global, IndexType Flag) const
+inline typename MPICommPattern<DATA>::GlobalIndexType
+MPICommPattern<DATA>::ClearFlag (GlobalIndexType Global, GlobalIndexType Flag) const
 {
   return (Global & (~Flag));
 }
       
 template <typename DATA>
-inline typename MPICommPattern<DATA>::IndexType
-MPICommPattern<DATA>::SetFlag (IndexType Global, IndexType Flag) const
+inline typename MPICommPattern<DATA>::GlobalIndexType
+MPICommPattern<DATA>::SetFlag (GlobalIndexType Global, GlobalIndexType Flag) const
 {
   return (Global | (Flag));
 }
 
 template <typename DATA>
-inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
-					     IndexType Flag) const
+inline bool MPICommPattern<DATA>::IsFlagSet (GlobalIndexType Global,
+					     GlobalIndexType Flag) const
 {
   return (Global & Flag);
 }
@@ -792,15 +795,15 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
     /// ==================================================*/
    
     template <typename DATA>
-    typename MPICommPattern<DATA>::IndexType
-    MPICommPattern<DATA>::NormalIndex (IndexType Global) const
+    typename MPICommPattern<DATA>::GlobalIndexType
+    MPICommPattern<DATA>::NormalIndex (GlobalIndexType Global) const
     {
       return ClearFlag (Global, _FLAG_DELETED|_FLAG_GHOST);
     }
 
     template <typename DATA>
     typename MPICommPattern<DATA>::IndexType
-    MPICommPattern<DATA>::FindLocal (IndexType GlobalIndex) const
+    MPICommPattern<DATA>::FindLocal (GlobalIndexType GlobalIndex) const
     {
       cf_assert (!IsFlagSet (GlobalIndex, _FLAG_GHOST|_FLAG_DELETED));
       
@@ -817,7 +820,7 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
 		     " MPICommPattern<DATA>\n");
       for (CFuint i=0; i<size(); i++)
         {
-	  IndexType I = _MetaData(i).GlobalIndex;
+	  GlobalIndexType I = _MetaData(i).GlobalIndex;
 	  if (IsFlagSet (I, _FLAG_DELETED|_FLAG_GHOST))
 	    continue;
 	  if (NormalIndex(I)==GlobalIndex)
@@ -828,7 +831,7 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
       
       template <typename DATA>
       typename MPICommPattern<DATA>::IndexType
-      MPICommPattern<DATA>::FindGhost (IndexType GlobalIndex) const
+      MPICommPattern<DATA>::FindGhost (GlobalIndexType GlobalIndex) const
       {
 	cf_assert (!IsFlagSet (GlobalIndex, _FLAG_GHOST|_FLAG_DELETED));
 	
@@ -844,7 +847,7 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
 		       " MPICommPattern<DATA>\n");
 	for (CFuint i=0; i<size (); i++)
 	  {
-	    IndexType I = _MetaData(i).GlobalIndex;
+	    GlobalIndexType I = _MetaData(i).GlobalIndex;
 	    if (!IsFlagSet (I, _FLAG_GHOST))
 	      continue;
 	    if (IsFlagSet (I, _FLAG_DELETED))
@@ -867,7 +870,7 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
     }
 
     template <typename DATA>
-    void MPICommPattern<DATA>::AddLocalIndex (IndexType Local, IndexType Global)
+    void MPICommPattern<DATA>::AddLocalIndex (IndexType Local, GlobalIndexType Global)
     {
       if (!_IsIndexed)
         return;
@@ -878,7 +881,7 @@ inline bool MPICommPattern<DATA>::IsFlagSet (IndexType Global,
     }
 
     template <typename DATA>
-    void MPICommPattern<DATA>::AddGhostIndex (IndexType Local, IndexType Global)
+    void MPICommPattern<DATA>::AddGhostIndex (IndexType Local, GlobalIndexType Global)
     {
       if (!_IsIndexed)
         return;
@@ -902,7 +905,7 @@ void MPICommPattern<DATA>::CreateIndex()
   _GhostMap.clear();
   
   for (unsigned int i=0; i < m_data->size(); ++i) {
-    IndexType Global = _MetaData(i).GlobalIndex;
+    GlobalIndexType Global = _MetaData(i).GlobalIndex;
     
     if (IsFlagSet (Global, _FLAG_DELETED))
       continue;
@@ -924,7 +927,7 @@ void MPICommPattern<DATA>::CreateIndex()
 //////////////////////////////////////////////////////////////////////////////
       
 template <typename DATA>
-typename MPICommPattern<DATA>::IndexType
+typename MPICommPattern<DATA>::GlobalIndexType
 MPICommPattern<DATA>::LocalToGlobal (IndexType LocalIndex) const
 {
   return NormalIndex(_MetaData(LocalIndex).GlobalIndex);
@@ -943,7 +946,7 @@ inline bool MPICommPattern<DATA>::IsGhost (IndexType LocalID) const
    
 template <typename DATA>
 typename MPICommPattern<DATA>::IndexType
-MPICommPattern<DATA>::GlobalToLocal (IndexType GlobalIndex) const
+MPICommPattern<DATA>::GlobalToLocal (GlobalIndexType GlobalIndex) const
 {   
   // TODO: adapt for search functions
   //
@@ -985,7 +988,7 @@ void MPICommPattern<DATA>::Sync_BroadcastNeeded ()
   
   // Allocate storage
   const int StorageSize = MaxGhostSize+1;
-  IndexType* Storage = new IndexType[StorageSize];
+  GlobalIndexType* Storage = new GlobalIndexType[StorageSize];
   
   typename TIndexMap::const_iterator Iter;
   
@@ -1017,10 +1020,10 @@ void MPICommPattern<DATA>::Sync_BroadcastNeeded ()
 					    MPIStructDef::getMPIType(&Storage[0]), RankTurn,
 					    _Communicator));
 	  
-	  const IndexType Aantal = Storage[0];
+	  const GlobalIndexType Aantal = Storage[0];
 	  cf_assert (Aantal <= MaxGhostSize);
 	  
-	  for (IndexType j=1; j<=Aantal; j++)
+	  for (GlobalIndexType j=1; j<=Aantal; j++)
 	    {
 	      // Could use GlobalToLocal here, the exception-
 	      // overhead would be too big.
@@ -1050,8 +1053,8 @@ void MPICommPattern<DATA>::Sync_BuildReceiveList()
   for (IndexType i=0; i< (IndexType) _CommSize; i++)
     MaxSendSize = std::max(MaxSendSize, static_cast<IndexType>(_GhostSendList[i].size()) );
   
-  IndexType * ReceiveStorage = new IndexType[_CommSize*_GhostSize];
-  IndexType * SendStorage = new IndexType[MaxSendSize];
+  GlobalIndexType * ReceiveStorage = new GlobalIndexType[_CommSize*_GhostSize];
+  GlobalIndexType * SendStorage = new GlobalIndexType[MaxSendSize];
   MPI_Request * Requests = new MPI_Request[_CommSize];
   
   // Post receives
@@ -1100,7 +1103,7 @@ void MPICommPattern<DATA>::Sync_BuildReceiveList()
     cf_assert (Requests[Current]==MPI_REQUEST_NULL);
     
     int Aantal = 0;
-    MPI_Get_count (&Status, MPIStructDef::getMPIType(&MaxSendSize), &Aantal);
+    MPI_Get_count (&Status, MPIStructDef::getMPIType(ReceiveStorage), &Aantal);
     
     if (Aantal > _GhostSize) {
       CFLog(WARN, "MPICommPattern<DATA>::Sync_BuildReceiveList() => Aantal > _GhostSize : " 
@@ -1159,7 +1162,7 @@ void MPICommPattern<DATA>::BuildGhostMapBcast()
   // 0) the number of ghost IDs of the broadcasting process 
   // 1) ghost global IDs in the receiving process
   // 2) donor rank from which ghosts are sent
-  vector<CFuint> gGlobalDonorIDs(bcastSize);
+  vector<GlobalIndexType> gGlobalDonorIDs(bcastSize);
 
   const CFuint elemsize = _ElementSize/sizeof(T);
   vector<CFuint> sendLocalIDs; 
@@ -1174,10 +1177,10 @@ void MPICommPattern<DATA>::BuildGhostMapBcast()
       // ghosts have to be ordered by donor ID to be consistent with MPI_Alltoallv order
       // therefore we build a (multi) mapping to store pairs donorID->globalID
       // after the sorting, we can access directly the pairs ordered by donorID
-      CFMultiMap<int,CFuint> donor2GhostGlobalID(_GhostMap.size());
+      CFMultiMap<int,GlobalIndexType> donor2GhostGlobalID(_GhostMap.size());
       typename TGhostMap::const_iterator itr;
       for (itr = _GhostMap.begin(); itr != _GhostMap.end(); ++itr) {
-	const CFuint globalID = itr->first;
+	const GlobalIndexType globalID = itr->first;
 	bool flag = false;
 	const CFuint donorID = m_mapGhost2Donor->find(globalID, flag).first->second;
 	cf_assert(flag);
@@ -1192,7 +1195,7 @@ void MPICommPattern<DATA>::BuildGhostMapBcast()
       for (CFuint i = 0; i < dsize; ++i, countl+=2) {
 	cf_assert(countl <= (CFuint) bcastSize);
 	// store the ghost local IDs in root
-	const CFuint globalID = donor2GhostGlobalID[i];
+	const GlobalIndexType globalID = donor2GhostGlobalID[i];
 	const CFuint donorID  = donor2GhostGlobalID.getKey(i);
 	gGlobalDonorIDs[countl]   = globalID;
 	gGlobalDonorIDs[countl+1] = donorID;
@@ -1224,7 +1227,7 @@ void MPICommPattern<DATA>::BuildGhostMapBcast()
 	  // count how many ghosts*elemsize will be sent from _CommRank to root
 	  m_sendCount[root] += elemsize;
 	  // store the local IDs in _CommRank to be sent to root
-	  const CFuint globalGhostID = gGlobalDonorIDs[countr];
+	  const GlobalIndexType globalGhostID = gGlobalDonorIDs[countr];
 	  const CFuint localGhostID = GlobalToLocal(globalGhostID);
 	  cf_assert(localGhostID < size());
 	  sendLocalIDs.push_back(localGhostID);
@@ -1302,10 +1305,10 @@ void MPICommPattern<DATA>::BuildGhostMapAllToAll()
   // ghosts have to be ordered by donor ID to be consistent with MPI_Alltoallv order
   // therefore we build a (multi) mapping to store pairs donorID->globalID
   // after the sorting, we can access directly the pairs ordered by donorID
-  CFMultiMap<int,CFuint> donor2GhostGlobalID(_GhostMap.size());
+  CFMultiMap<int,GlobalIndexType> donor2GhostGlobalID(_GhostMap.size());
   typename TGhostMap::const_iterator itr;
   for (itr = _GhostMap.begin(); itr != _GhostMap.end(); ++itr) {
-    const CFuint globalID = itr->first;
+    const GlobalIndexType globalID = itr->first;
     bool flag = false;
     const CFuint donorID = m_mapGhost2Donor->find(globalID, flag).first->second;
     cf_assert(flag);
@@ -1321,10 +1324,10 @@ void MPICommPattern<DATA>::BuildGhostMapAllToAll()
   vector<int> recvCount(_CommSize, 0);
   vector<int> sendDispl(_CommSize, 0);
   vector<int> recvDispl(_CommSize, 0);
-  vector<CFuint> sendGhostGlobalIDs(dsize);
+  vector<GlobalIndexType> sendGhostGlobalIDs(dsize);
   
   for (CFuint i = 0; i < dsize; ++i) {
-    const CFuint globalID = donor2GhostGlobalID[i];
+    const GlobalIndexType globalID = donor2GhostGlobalID[i];
     sendGhostGlobalIDs[i] = globalID;
     const CFuint donorID  = donor2GhostGlobalID.getKey(i);
     // donor is always != current rank
@@ -1364,7 +1367,7 @@ void MPICommPattern<DATA>::BuildGhostMapAllToAll()
   // during the first MPI_Alltoallv, each rank sends the global IDs to the rank that 
   // will send the updated ghost state/node data back at the next MPI_Alltoallv
   
-  vector<CFuint> recvGhostGlobalIDs(rcount);
+  vector<GlobalIndexType> recvGhostGlobalIDs(rcount);
   
   MPIError::getInstance().check
     ("MPI_Alltoallv", "MPICommPattern<DATA>::BuildGhostMapAllToAll()",
@@ -1376,7 +1379,7 @@ void MPICommPattern<DATA>::BuildGhostMapAllToAll()
   
   m_sendLocalIDs.resize(rcount);
   for (CFuint i = 0; i < rcount; ++i) {
-    const CFuint globalGhostID = recvGhostGlobalIDs[i];
+    const GlobalIndexType globalGhostID = recvGhostGlobalIDs[i];
     const CFuint localGhostID = GlobalToLocal(globalGhostID);
     cf_assert(localGhostID < size());
     m_sendLocalIDs[i] = localGhostID;
@@ -1439,9 +1442,9 @@ void MPICommPattern<DATA>::BuildGhostMapOld()
       // Error: we don't have all the ghost points
       CFLog(DEBUG_MIN, "Not all ghost points were found! Starting investigation\n");
       
-      std::set<CFuint> Ghosts;
-      std::set<CFuint> Receives;
-      std::set<CFuint> Missing;
+      std::set<GlobalIndexType> Ghosts;
+      std::set<GlobalIndexType> Receives;
+      std::set<GlobalIndexType> Missing;
       
       typename TGhostMap::const_iterator Iter;
       
@@ -1457,7 +1460,7 @@ void MPICommPattern<DATA>::BuildGhostMapOld()
       
       std::ostringstream S;
       S << "Missing ghost elements (globalID): ";
-      for (std::set<CFuint>::const_iterator I = Missing.begin();
+      for (typename std::set<GlobalIndexType>::const_iterator I = Missing.begin();
 	   I!=Missing.end(); ++I)
 	S << *I << " ";
       S << "\n";
@@ -1664,7 +1667,7 @@ typename MPICommPattern<DATA>::IndexType MPICommPattern<DATA>::AllocNext()
 
       for (CFuint i=0; i<size(); ++i)
         {
-    int Global = LocalToGlobal(i);
+    GlobalIndexType Global = LocalToGlobal(i);
     Out << i << " " << Global;
     if (IsFlagSet (_MetaData(i).GlobalIndex, _FLAG_GHOST))
       Out << " [ghost]";
@@ -1785,7 +1788,7 @@ void MPICommPattern<DATA>::EndSync ()
 
 template <typename DATA>
 typename MPICommPattern<DATA>::IndexType
-MPICommPattern<DATA>::AddGhostPoint (IndexType GlobalIndex)
+MPICommPattern<DATA>::AddGhostPoint (GlobalIndexType GlobalIndex)
 {
   typename TGhostMap::const_iterator Iter = _GhostMap.find(GlobalIndex);
   
@@ -1823,7 +1826,7 @@ MPICommPattern<DATA>::AddGhostPoint (IndexType GlobalIndex)
 
 template <typename DATA>
 typename MPICommPattern<DATA>::IndexType
-MPICommPattern<DATA>::AddLocalPoint (IndexType GlobalIndex)
+MPICommPattern<DATA>::AddLocalPoint (GlobalIndexType GlobalIndex)
 {
   IndexType NewLocalID = AllocNext ();
   
@@ -1872,13 +1875,13 @@ MPICommPattern<DATA>::GetLocalSize () const
 //////////////////////////////////////////////////////////////////////////////
 
 template <typename DATA>
-typename MPICommPattern<DATA>::IndexType
+typename MPICommPattern<DATA>::GlobalIndexType
 MPICommPattern<DATA>::GetGlobalSize () const
 {
   cf_assert (_InitMPIOK);
   
-  IndexType Total = 0;
-  IndexType Local = GetLocalSize();
+  GlobalIndexType Total = 0;
+  GlobalIndexType Local = GetLocalSize();
   
   Common::CheckMPIStatus(MPI_Allreduce 
 			 (&Local, &Total, 1, 
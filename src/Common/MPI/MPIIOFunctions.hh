@@ -65,6 +65,8 @@ public:
   }
   
   /// Write a buffer using all cores
+  /// A core with nothing to write (bufSize = 0) still takes part in the
+  /// collective calls, buf must then point to a valid dummy entry
   template <typename T> 
   static void writeAll(const std::string& name, MPI_File* fh, 
 		       MPI_Offset offset, T* buf, 
@@ -92,7 +94,7 @@ public:
       int wBufSize = (bufOff < maxOffset) ? ((nbBuf > 0) ? (int)maxSendSize : (int)wSize) : 0;
       cf_assert(wBufSize <= maxSendSize);
       cf_assert(wBufSize <= bufSize);
-      cf_assert(bufID < bufSize);
+      cf_assert(bufID < bufSize || bufSize == 0);
       
       CFLog(VERBOSE, myRank << " in " << name << " writes buffer of size " 
 	    << wBufSize << "/" << bufSize << " starting from " << bufOff << "\n");
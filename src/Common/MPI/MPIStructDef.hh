@@ -59,6 +59,7 @@ MPIDTYPE(unsigned int,MPI_UNSIGNED)
 MPIDTYPE(long unsigned int,MPI_UNSIGNED_LONG)
 MPIDTYPE(long int,MPI_LONG)
 MPIDTYPE(long long int, MPI_LONG_LONG_INT)
+MPIDTYPE(long long unsigned int, MPI_UNSIGNED_LONG_LONG)
 MPIDTYPE(char,MPI_CHAR)
 
 #undef MPIDTYPE
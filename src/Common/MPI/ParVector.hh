@@ -43,6 +43,9 @@ public: // functions
   
   /// communication pattern
   typedef MPICommPattern<ARRAY> CPATTERN;
+
+  /// global index type
+  typedef typename CPATTERN::GlobalIndexType GlobalIndexType;
   
   /// Constructor.
   /// WARNING: Size parameter is IGNORED!
@@ -63,7 +66,7 @@ public: // functions
   
   /// Set the mapping from global ghost IDs to donor ranks
   void setMapGhost2DonorRanks
-  (Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> >& mapGhost2Donor) 
+  (Common::SharedPtr<Common::CFMultiMap<GlobalIndexType, CFuint> >& mapGhost2Donor) 
   {
     m_pattern->setMapGhost2DonorRanks(mapGhost2Donor);
   }
@@ -77,10 +80,18 @@ public: // functions
   /// Local operation.
   CFuint GetTotalSize () const {return size();}
   
+  /// Returns the number of bytes allocated for the local entries
+  /// (also valid before the communication pattern is built)
+  /// Local operation.
+  size_t getMemoryBytes() const 
+  {
+    return m_data.size()*((m_esize > sizeof(T)) ? m_esize : sizeof(T));
+  }
+  
   /// This function returns the global (cross-processes) size of
   /// the underlying parallel array
   /// @return the global size of the parallel array
-  CFuint GetGlobalSize() const {return  m_pattern->GetGlobalSize();}
+  GlobalIndexType GetGlobalSize() const {return  m_pattern->GetGlobalSize();}
   
   /// This function returns the global (cross-processes) size of
   /// the underlying parallel array
@@ -144,19 +155,19 @@ public: // functions
   void DestroyIndex() {m_pattern->DestroyIndex();}
   
   /// Lookup the global continuous ID of a local element
-  CFuint LocalToCGlobal (CFuint localID) const {return m_pattern->LocalToCGlobal(localID);}
+  GlobalIndexType LocalToCGlobal (CFuint localID) const {return m_pattern->LocalToCGlobal(localID);}
   
   /// Insert a new ghost point
   /// Local operation.
   /// For now, NO Add operations are allowed after
   /// BuildGhostMap is called.
-  IndexType AddGhostPoint (IndexType GlobalIndex) {return m_pattern->AddGhostPoint(GlobalIndex);}
+  IndexType AddGhostPoint (GlobalIndexType GlobalIndex) {return m_pattern->AddGhostPoint(GlobalIndex);}
   
   /// Insert new local point
   /// Local operation.
   /// For now, NO add operations are allowed after
   /// BuildGhostMap is called.
-  IndexType AddLocalPoint (IndexType GlobalIndex) {return m_pattern->AddLocalPoint(GlobalIndex);}
+  IndexType AddLocalPoint (GlobalIndexType GlobalIndex) {return m_pattern->AddLocalPoint(GlobalIndex);}
   
   /// Get array 
   Common::SafePtr<ARRAY> getPtr() {return &m_data;}
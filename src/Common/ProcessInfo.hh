@@ -48,6 +48,10 @@ public: // functions
   /// @return a double with the memory usage in bytes
   virtual CFdouble memoryUsageBytes () const = 0;
 
+  /// Gets the peak resident set size of the process
+  /// @return a double with the peak memory usage in bytes
+  virtual CFdouble peakMemoryUsageBytes () const = 0;
+
   /// @returns a string with the memory usage
   /// @post adds the unit of memory (B, KB, MB or GB)
   /// @post  no end of line added
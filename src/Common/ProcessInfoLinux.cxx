@@ -12,6 +12,7 @@
 #endif
 
 #include <malloc.h>      //  for mallinfo
+#include <sys/resource.h> // for getrusage
 
 #include <cstdio>
 #include <sstream>       // streamstring
@@ -135,6 +136,19 @@ CFdouble ProcessInfoLinux::memoryUsageBytes() const
          static_cast<CFdouble>(info.hblkhd);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble ProcessInfoLinux::peakMemoryUsageBytes() const
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+
+  // ru_maxrss is in kilobytes on Linux
+  return static_cast<CFdouble>(usage.ru_maxrss)*1024.;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Common
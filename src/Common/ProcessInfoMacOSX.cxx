@@ -8,6 +8,7 @@
 
 #include <unistd.h>      // for getting the PID of the process
 #include <sys/types.h>   // for getting the PID of the process
+#include <sys/resource.h> // for getrusage
 
 #include <mach/mach_types.h> 
 #include <mach/mach_init.h>
@@ -99,6 +100,19 @@ CFdouble ProcessInfoMacOSX::memoryUsageBytes() const
   return static_cast<CFdouble>(t_info.resident_size);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble ProcessInfoMacOSX::peakMemoryUsageBytes() const
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+
+  // ru_maxrss is in bytes on Mac OS X
+  return static_cast<CFdouble>(usage.ru_maxrss);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Common
@@ -50,6 +50,10 @@ public:
   /// @return a double with the memory usage
   virtual CFdouble memoryUsageBytes() const;
 
+  /// Gets the peak resident set size
+  /// @return a double with the peak memory usage
+  virtual CFdouble peakMemoryUsageBytes() const;
+
 }; // end of class ProcessInfo
 
 //////////////////////////////////////////////////////////////////////////////
@@ -356,6 +356,27 @@ CFdouble ProcessInfoWin32::memoryUsageBytes () const
   return return_value;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+CFdouble ProcessInfoWin32::peakMemoryUsageBytes () const
+{
+  CFdouble return_value = 0.;
+
+  HANDLE hProcess = GetCurrentProcess();
+  PROCESS_MEMORY_COUNTERS pmc;
+
+  if ( hProcess != NULL )
+  {
+    if ( GetProcessMemoryInfo( hProcess, &pmc, sizeof(pmc)) )
+    {
+      return_value = static_cast<CFdouble>(pmc.PeakWorkingSetSize);
+    }
+    CloseHandle( hProcess );
+  }
+
+  return return_value;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Common
@@ -0,0 +1,123 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include "Common/ShuffleCompressor.hh"
+#include "Common/BadValueException.hh"
+#include "Common/FileFormatException.hh"
+#include "Common/NotImplementedException.hh"
+#include "Common/StringOps.hh"
+
+#ifdef CF_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+ShuffleCompressor::ShuffleCompressor(const CFuint level) :
+  m_level(level),
+  m_shuffled()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ShuffleCompressor::~ShuffleCompressor()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool ShuffleCompressor::isAvailable()
+{
+#ifdef CF_HAVE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ShuffleCompressor::compress(const CFreal* data, const CFuint n,
+				 std::vector<char>& out)
+{
+#ifdef CF_HAVE_ZLIB
+  const CFuint nbBytes = n*sizeof(CFreal);
+  m_shuffled.resize(nbBytes);
+  
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  for (CFuint b = 0; b < sizeof(CFreal); ++b) {
+    unsigned char* shuffled = &m_shuffled[0] + b*n;
+    for (CFuint i = 0; i < n; ++i) {
+      shuffled[i] = bytes[i*sizeof(CFreal) + b];
+    }
+  }
+  
+  uLongf outSize = compressBound(nbBytes);
+  out.resize(outSize);
+  const int err = compress2(reinterpret_cast<Bytef*>(&out[0]), &outSize,
+			    (nbBytes > 0) ? &m_shuffled[0] : CFNULL, nbBytes, (int)m_level);
+  if (err == Z_STREAM_ERROR) {
+    throw BadValueException
+      (FromHere(), "ShuffleCompressor::compress() => invalid compression level " +
+       StringOps::to_str(m_level));
+  }
+  if (err != Z_OK) {
+    throw FileFormatException
+      (FromHere(), "ShuffleCompressor::compress() => zlib error " + StringOps::to_str(err) +
+       " while compressing " + StringOps::to_str(n) + " values");
+  }
+  out.resize(outSize);
+#else
+  throw NotImplementedException
+    (FromHere(), "ShuffleCompressor::compress() => COOLFluiD was built without zlib");
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ShuffleCompressor::decompress(const char* in, const CFuint inSize,
+				   CFreal* data, const CFuint n)
+{
+#ifdef CF_HAVE_ZLIB
+  const CFuint nbBytes = n*sizeof(CFreal);
+  m_shuffled.resize(nbBytes + 1);
+  
+  uLongf outSize = nbBytes + 1;
+  const int err = uncompress(&m_shuffled[0], &outSize,
+			     reinterpret_cast<const Bytef*>(in), inSize);
+  if (err != Z_OK || outSize != nbBytes) {
+    throw FileFormatException
+      (FromHere(), "ShuffleCompressor::decompress() => corrupted chunk of " +
+       StringOps::to_str(n) + " values");
+  }
+  
+  unsigned char* bytes = reinterpret_cast<unsigned char*>(data);
+  for (CFuint b = 0; b < sizeof(CFreal); ++b) {
+    const unsigned char* shuffled = &m_shuffled[0] + b*n;
+    for (CFuint i = 0; i < n; ++i) {
+      bytes[i*sizeof(CFreal) + b] = shuffled[i];
+    }
+  }
+#else
+  throw NotImplementedException
+    (FromHere(), "ShuffleCompressor::decompress() => COOLFluiD was built without zlib");
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_ShuffleCompressor_hh
+#define COOLFluiD_Common_ShuffleCompressor_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/CommonAPI.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class compresses arrays of reals without loss.
+/// The bytes of the values are first shuffled (all the first bytes, then
+/// all the second bytes, ...): the exponent and high mantissa bytes of
+/// smooth CFD fields are then grouped in long and very repetitive
+/// sequences, which are compressed with zlib.
+/// The compression is only available if COOLFluiD was built with zlib.
+class Common_API ShuffleCompressor {
+public:
+  
+  /// Constructor
+  /// @param level  zlib compression level, from 1 (fastest) to 9 (smallest)
+  ShuffleCompressor(const CFuint level = 1);
+  
+  /// Destructor
+  ~ShuffleCompressor();
+  
+  /// Compress the given values
+  /// @param data  values to compress
+  /// @param n     number of values
+  /// @param out   compressed bytes (resized)
+  /// @throw NotImplementedException if zlib is not available
+  /// @throw BadValueException if the compression level is not valid
+  /// @throw FileFormatException if zlib fails to compress the values
+  void compress(const CFreal* data, const CFuint n, std::vector<char>& out);
+  
+  /// Decompress the given bytes
+  /// @param in      compressed bytes
+  /// @param inSize  number of compressed bytes
+  /// @param data    where to put the values
+  /// @param n       number of values
+  /// @throw FileFormatException if the bytes do not hold n values
+  void decompress(const char* in, const CFuint inSize, CFreal* data, const CFuint n);
+  
+  /// @return true if the compression is available in this build
+  static bool isAvailable();
+  
+private:
+  
+  /// compression level
+  CFuint m_level;
+  
+  /// shuffled bytes
+  std::vector<unsigned char> m_shuffled;
+  
+}; // end of class ShuffleCompressor
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_ShuffleCompressor_hh
@@ -0,0 +1,137 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <fstream>
+
+#include "Common/SparseFileBuffer.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+SparseFileBuffer::SparseFileBuffer() :
+  std::streambuf(),
+  m_parts(),
+  m_pos(0),
+  m_end(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+SparseFileBuffer::~SparseFileBuffer()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void SparseFileBuffer::clear()
+{
+  std::vector<std::pair<std::streamoff, std::string> >().swap(m_parts);
+  m_pos = 0;
+  m_end = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void SparseFileBuffer::swap(SparseFileBuffer& other)
+{
+  m_parts.swap(other.m_parts);
+  std::swap(m_pos, other.m_pos);
+  std::swap(m_end, other.m_end);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string& SparseFileBuffer::getCurrentPart()
+{
+  // a new part starts after each jump
+  if (m_parts.empty() ||
+      m_parts.back().first + (std::streamoff)m_parts.back().second.size() != m_pos) {
+    m_parts.push_back(std::make_pair(m_pos, std::string()));
+  }
+  return m_parts.back().second;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+SparseFileBuffer::int_type SparseFileBuffer::overflow(int_type c)
+{
+  if (traits_type::eq_int_type(c, traits_type::eof())) {
+    return traits_type::not_eof(c);
+  }
+  getCurrentPart().push_back(traits_type::to_char_type(c));
+  m_end = std::max(m_end, ++m_pos);
+  return c;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::streamsize SparseFileBuffer::xsputn(const char* s, std::streamsize n)
+{
+  getCurrentPart().append(s, n);
+  m_pos += n;
+  m_end = std::max(m_end, m_pos);
+  return n;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+SparseFileBuffer::pos_type SparseFileBuffer::seekoff(off_type off,
+						     std::ios_base::seekdir dir,
+						     std::ios_base::openmode which)
+{
+  if (!(which & std::ios_base::out)) return pos_type(off_type(-1));
+
+  std::streamoff pos = off;
+  if (dir == std::ios_base::cur) pos += m_pos;
+  if (dir == std::ios_base::end) pos += m_end;
+  if (pos < 0) return pos_type(off_type(-1));
+
+  m_pos = pos;
+  return pos_type(m_pos);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+SparseFileBuffer::pos_type SparseFileBuffer::seekpos(pos_type pos,
+						     std::ios_base::openmode which)
+{
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+bool SparseFileBuffer::writeTo(const std::string& filename) const
+{
+  // the file is created without truncation, since other processors
+  // may be writing their own parts in it
+  {
+    std::ofstream create(filename.c_str(), std::ios::binary | std::ios::app);
+    if (!create) return false;
+  }
+
+  std::fstream out(filename.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+  for (CFuint i = 0; i < m_parts.size() && out; ++i) {
+    out.seekp(m_parts[i].first);
+    out.write(m_parts[i].second.data(), m_parts[i].second.size());
+  }
+  out.flush();
+  return !out.fail();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
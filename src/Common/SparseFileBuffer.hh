@@ -0,0 +1,98 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Common_SparseFileBuffer_hh
+#define COOLFluiD_Common_SparseFileBuffer_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "Common/COOLFluiD.hh"
+#include "Common/CommonAPI.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Common {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class is a stream buffer holding in memory the parts of a file
+/// written by one processor at given positions (seekp() then <<), e.g. its
+/// share of a file written in parallel. The parts are written to the file
+/// afterwards by writeTo(), in the order in which they were written in the
+/// buffer, without touching the rest of the file.
+class Common_API SparseFileBuffer : public std::streambuf {
+public:
+
+  /// Constructor
+  SparseFileBuffer();
+
+  /// Destructor
+  virtual ~SparseFileBuffer();
+
+  /// Remove all the parts and go back to the beginning of the file
+  void clear();
+
+  /// Swap the parts and the position with the given buffer
+  void swap(SparseFileBuffer& other);
+
+  /// @return true if nothing was written in the buffer
+  bool empty() const {return m_parts.empty();}
+
+  /// @return the position after the last byte of the file written in the buffer
+  std::streamoff getEnd() const {return m_end;}
+
+  /// Write the parts in the given file, which is created if it does not exist
+  /// @return false if the file could not be written
+  bool writeTo(const std::string& filename) const;
+
+protected:
+
+  /// Append one character at the current position
+  virtual int_type overflow(int_type c);
+
+  /// Append n characters at the current position
+  virtual std::streamsize xsputn(const char* s, std::streamsize n);
+
+  /// Move the current position
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+			   std::ios_base::openmode which);
+
+  /// Move the current position
+  virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+
+private:
+
+  /// @return the part where to append the data written at the current position
+  std::string& getCurrentPart();
+
+private:
+
+  /// parts of the file with their position, in the order they were written
+  std::vector<std::pair<std::streamoff, std::string> > m_parts;
+
+  /// current position in the file
+  std::streamoff m_pos;
+
+  /// position after the last byte written
+  std::streamoff m_end;
+
+}; // end of class SparseFileBuffer
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Common
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Common_SparseFileBuffer_hh
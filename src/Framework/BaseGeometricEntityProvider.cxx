@@ -14,6 +14,10 @@ namespace COOLFluiD {
 
 //////////////////////////////////////////////////////////////////////////////
 
+CFdouble BaseGeometricEntityProvider::m_createdBytes = 0.;
+
+//////////////////////////////////////////////////////////////////////////////
+
 BaseGeometricEntityProvider::BaseGeometricEntityProvider(const std::string& name) 
   : Environment::Provider<GeometricEntity>(name)
 {
@@ -89,6 +89,20 @@ class Framework_API BaseGeometricEntityProvider : public Environment::Provider<G
   /// Sets the ID for the geometric interpolation
   virtual void setGeomInterpolatorID(const InterpolatorID& id) = 0;
 
+  /// @return the number of bytes of all the GeometricEntity's created so far
+  ///         by the providers (used to measure the GeometricEntityPool's)
+  static CFdouble getCreatedBytes() {return m_createdBytes;}
+
+protected:
+
+  /// Count a newly created GeometricEntity of the given size
+  static void addCreatedBytes(const size_t bytes) {m_createdBytes += bytes;}
+
+private:
+
+  /// number of bytes of all the GeometricEntity's created so far
+  static CFdouble m_createdBytes;
+
 }; // end of class BaseGeometricEntityProvider
 
 //////////////////////////////////////////////////////////////////////////////
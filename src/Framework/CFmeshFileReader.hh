@@ -92,7 +92,7 @@ public: // functions
 private: // typedefs
 
   /// pointer to ReaderFunction
-  typedef void (CFmeshFileReader<DATA>::*ReaderFunction)(std::ifstream& fin);
+  typedef void (CFmeshFileReader<DATA>::*ReaderFunction)(std::istream& fin);
 
   /// type that maps a string read in the File with a ReaderFunction
   typedef std::map<std::string,
@@ -102,7 +102,7 @@ private: // typedefs
 private: // helper functions
 
   /// Read an entry in the .CFmesh file
-  bool readString(std::ifstream& file);
+  bool readString(std::istream& file);
 
   /// Get the file extension
   const std::string getReaderTerminator() const
@@ -122,76 +122,76 @@ private: // helper functions
   void setMapString2Readers();
 
   /// Reads the space dimension
-  void readCFVersion(std::ifstream& fin);
+  void readCFVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readSvnVersion(std::ifstream& fin);
+  void readSvnVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readCFmeshVersion(std::ifstream& fin);
+  void readCFmeshVersion(std::istream& fin);
 
   /// Reads the space dimension
-  void readDimension(std::ifstream& fin);
+  void readDimension(std::istream& fin);
 
   /// Reads the number of equations
-  void readNbEquations(std::ifstream& fin);
+  void readNbEquations(std::istream& fin);
 
   /// Reads the number of nodes
-  void readNbNodes(std::ifstream& fin);
+  void readNbNodes(std::istream& fin);
 
   /// Reads the nb of dofs state tensors and initialize with them the dofs
-  void readNbStates(std::ifstream& fin);
+  void readNbStates(std::istream& fin);
 
   /// Reads the nb of extra variables associated with nodes
-  void readNbExtraNodalVars(std::ifstream& fin);
+  void readNbExtraNodalVars(std::istream& fin);
 
   /// Reads the nb of extra variables associated with states
-  void readNbExtraStateVars(std::ifstream& fin);
+  void readNbExtraStateVars(std::istream& fin);
 
   /// Reads the names of the extra variables associated with nodes
-  void readExtraNodalVarNames(std::ifstream& fin);
+  void readExtraNodalVarNames(std::istream& fin);
 
   /// Reads the names of the extra variables associated with states
-  void readExtraStateVarNames(std::ifstream& fin);
+  void readExtraStateVarNames(std::istream& fin);
 
   /// Reads the nb of elements
-  void readNbElements(std::ifstream& fin);
+  void readNbElements(std::istream& fin);
 
   /// Reads the nb of element types
-  void readNbElementTypes(std::ifstream& fin);
+  void readNbElementTypes(std::istream& fin);
 
   /// Reads the order of the polynomial representation of the geometry
-  void readGeometricPolyOrder(std::ifstream& fin);
+  void readGeometricPolyOrder(std::istream& fin);
 
   /// Reads the order of the polynomial representation of the solution
-  void readSolutionPolyOrder(std::ifstream& fin);
+  void readSolutionPolyOrder(std::istream& fin);
 
   /// Reads the Type of the polynomial representation of the geometry
-  void readGeometricPolyType(std::ifstream& fin);
+  void readGeometricPolyType(std::istream& fin);
 
   /// Reads the Type of the polynomial representation of the solution
-  void readSolutionPolyType(std::ifstream& fin);
+  void readSolutionPolyType(std::istream& fin);
 
   /// Reads the element types (CFGeoShape::Type)
-  void readElementTypes(std::ifstream& fin);
+  void readElementTypes(std::istream& fin);
 
   /// Reads the nb of elements per type
-  void readNbElementsPerType(std::ifstream& fin);
+  void readNbElementsPerType(std::istream& fin);
 
   /// Reads the nb of nodes per type
-  void readNbNodesPerType(std::ifstream& fin);
+  void readNbNodesPerType(std::istream& fin);
 
   /// Reads the nb of dofs per type
-  void readNbStatesPerType(std::ifstream& fin);
+  void readNbStatesPerType(std::istream& fin);
 
   /// Reads the list of nodes
-  void readNodeList(std::ifstream& fin);
+  void readNodeList(std::istream& fin);
 
   /// Reads the list of state tensors and initialize the dofs
-  void readStateList(std::ifstream& fin);
+  void readStateList(std::istream& fin);
 
   /// Reads the data concerning the elements
-  void readElementList(std::ifstream& fin);
+  void readElementList(std::istream& fin);
 
   /// Reads the number of topological region sets and initialize the vector
   /// that will contain the all the topological region sets
@@ -199,31 +199,31 @@ private: // helper functions
   /// @pre Connection has been already been and set
   /// @pre some topological region sets have been already constructed
   ///      (INNER_CELLS and, in FVM, INNER_FACES)
-  void readNbTRSs(std::ifstream& fin);
+  void readNbTRSs(std::istream& fin);
 
   /// Reads the name of the current topological region sets
-  void readTRSName(std::ifstream& fin);
+  void readTRSName(std::istream& fin);
 
   /// Reads the number of topological regions in the current
   /// topological region  set
-  void readNbTRs(std::ifstream& fin);
+  void readNbTRs(std::istream& fin);
 
   /// Reads the number of geometric entities in each topological
   /// region of the current topological region set
-  void readNbGeomEnts(std::ifstream& fin);
+  void readNbGeomEnts(std::istream& fin);
 
   /// Reads the type of geometric entity in the current topological
   /// region set
   /// @pre  the read string must be "Face", "Cell" (or "Edge" in the future)
   /// @post the read string is converted in the corresponding CFGeoEnt::Type
   ///       by the method m_getCFGeoEnt::Type()
-  void readGeomType(std::ifstream& fin);
+  void readGeomType(std::istream& fin);
 
   /// Reads all the lists of geometric entities, using them to build the
   /// corresponding topological region.
   /// Once that all the topological regions belonging to the current topological
   /// region set have been built, the topological region set itself is built.
-  void readGeomEntList(std::ifstream& fin);
+  void readGeomEntList(std::istream& fin);
 
 private: // data
 
@@ -71,7 +71,7 @@ protected: // methods
 
   /// Writes to the given file.
   /// @throw Common::FilesystemException
-  void writeToFileStream(std::ofstream& fout);
+  void writeToFileStream(std::ostream& fout);
 
   /// Get the name of the reader
   const std::string getWriterName() const
@@ -82,62 +82,62 @@ protected: // methods
 private: // helper functions
 
   /// Writes the space dimension
-  void writeDimension(std::ofstream& fout);
+  void writeDimension(std::ostream& fout);
 
   /// Writes the version stamp
-  void writeVersionStamp(std::ofstream& fout);
+  void writeVersionStamp(std::ostream& fout);
 
   /// Writes the number of equations
-  void writeNbEquations(std::ofstream& fout);
+  void writeNbEquations(std::ostream& fout);
 
   /// Writes the extra variables info
-  void writeExtraVarsInfo(std::ofstream& fout);
+  void writeExtraVarsInfo(std::ostream& fout);
 
   /// Writes the number of nodes
-  void writeNbNodes(std::ofstream& fout);
+  void writeNbNodes(std::ostream& fout);
 
   /// Writes the nb of dofs state tensors and initialize with them the dofs
-  void writeNbStates(std::ofstream& fout);
+  void writeNbStates(std::ostream& fout);
 
   /// Writes the nb of elements
-  void writeNbElements(std::ofstream& fout);
+  void writeNbElements(std::ostream& fout);
 
   /// Writes the nb of element types
-  void writeNbElementTypes(std::ofstream& fout);
+  void writeNbElementTypes(std::ostream& fout);
 
   /// Writes the order of the polynomial representation of the geometry
-  void writeGeometricPolyOrder(std::ofstream& fout);
+  void writeGeometricPolyOrder(std::ostream& fout);
 
   /// Writes the order of the polynomial representation of the solution
-  void writeSolutionPolyOrder(std::ofstream& fout);
+  void writeSolutionPolyOrder(std::ostream& fout);
 
   /// Writes the element types (CFGeoShape::Type)
-  void writeElementTypes(std::ofstream& fout);
+  void writeElementTypes(std::ostream& fout);
 
   /// Writes the nb of elements per type
-  void writeNbElementsPerType(std::ofstream& fout);
+  void writeNbElementsPerType(std::ostream& fout);
 
   /// Writes the nb of nodes per type
-  void writeNbNodesPerType(std::ofstream& fout);
+  void writeNbNodesPerType(std::ostream& fout);
 
   /// Writes the nb of dofs per type
-  void writeNbStatesPerType(std::ofstream& fout);
+  void writeNbStatesPerType(std::ostream& fout);
 
   /// Writes the list of nodes
-  void writeNodeList(std::ofstream& fout);
+  void writeNodeList(std::ostream& fout);
 
   /// Writes the list of state tensors and initialize the dofs
-  void writeStateList(std::ofstream& fout);
+  void writeStateList(std::ostream& fout);
 
   /// Writes the data concerning the elements
-  void writeElementList(std::ofstream& fout);
+  void writeElementList(std::ostream& fout);
 
   /// Writes the number of topological region sets and initialize the vector
   /// that will contain the all the topological region sets
-  void writeNbTRSs(std::ofstream& fout);
+  void writeNbTRSs(std::ostream& fout);
 
   /// Writes the all the data relative to all TRSs
-  void writeTrsData(std::ofstream& fout);
+  void writeTrsData(std::ostream& fout);
 
 protected: // data
 
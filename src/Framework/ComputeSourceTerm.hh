@@ -49,10 +49,12 @@ public:
     _iVar(0),
     _useAnalyticalJacob(false),
     _analyticalJacob(false),
-    _isPerturb(false)
+    _isPerturb(false),
+    _isSplit(false)
   {
     this->addConfigOptionsTo(this);
     this->setParameter("UseAnalyticalJacob",&_useAnalyticalJacob);
+    this->setParameter("Split",&_isSplit);
   }
 
   /// Default destructor
@@ -67,6 +69,9 @@ public:
     options.template addConfigOption< bool >
       ("UseAnalyticalJacob",
       "Flag forcing to use the analytical jacobian");
+    options.template addConfigOption< bool >
+      ("Split",
+      "Flag telling to integrate this source term separately from the transport terms (operator splitting)");
   }
 
   /// Set up private data and data of the aggregated classes
@@ -119,6 +124,12 @@ public:
   {
     return _useAnalyticalJacob;
   }
+  
+  /// Tells if the source term is integrated separately from the transport terms
+  bool isSplit() const
+  {
+    return _isSplit;
+  }
 
   /// Set the analtyical jacobian matrix
   void setAnalyticalJacob(bool flag)
@@ -162,6 +173,9 @@ protected: //data
   /// flag telling if the source term is being perturbed
   bool _isPerturb;
   
+  /// flag telling if the source term is integrated separately from the transport terms
+  bool _isSplit;
+  
 }; // end of class ComputeSourceTerm
 
 //////////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <sstream>
 
+#include "Common/BenchmarkTimers.hh"
 #include "Common/PE.hh"
 #include "Common/ProcessInfo.hh"
 #include "Common/OSystem.hh"
@@ -19,6 +20,8 @@
 #include "Framework/PathAppender.hh"
 #include "Framework/ConvergenceMethod.hh"
 #include "Framework/ConvergenceMethodData.hh"
+#include "Framework/MethodRegistry.hh"
+#include "Framework/SpaceMethod.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/NamespaceSwitcher.hh"
 #include "Framework/StopConditionController.hh"
@@ -153,7 +156,9 @@ void ConvergenceMethod::takeStep()
 
   if (m_stopwatch.isNotRunning()) { m_stopwatch.start(); }
 
+  Common::BenchmarkTimers::Scope timer("ConvergenceStep");
   takeStepImpl();
+  finalizeTimeStep();
   if ( hasToUpdateConv() ) updateConvergenceFile();
 
   popNamespace();
@@ -161,6 +166,30 @@ void ConvergenceMethod::takeStep()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void ConvergenceMethod::finalizeTimeStep()
+{
+  CFAUTOTRACE;
+
+  // the space methods of this namespace act once per physical time step,
+  // after all the stages or iterations of the convergence method
+  typedef std::vector<Common::SafePtr<SpaceMethod> > VecSM;
+  VecSM sms = MethodRegistry::getInstance().getAllMethods<SpaceMethod>(getNamespace());
+
+  bool isModified = false;
+  for (VecSM::iterator itr = sms.begin(); itr != sms.end(); ++itr) {
+    isModified = (*itr)->finalizeTimeStep() || isModified;
+  }
+
+  // the residual is computed again from the modified rhs
+  if (isModified) {
+    syncGlobalDataComputeResidual(true);
+    getConvergenceMethodData()->getConvergenceStatus().res =
+      SubSystemStatusStack::getActive()->getResidual();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 Common::SafePtr<Framework::CFL> ConvergenceMethod::getCFL()
 {
   return getConvergenceMethodData()->getCFL();
@@ -312,6 +341,7 @@ void ConvergenceMethod::syncGlobalDataComputeResidual(const bool computeResidual
 
   const bool isParallel = Common::PE::GetPE().IsParallel();
   Common::Stopwatch<Common::WallTime> syncTimer;
+  Common::BenchmarkTimers::Scope benchTimer("Synchronization");
   
   Common::SafePtr<Namespace> nsp = NamespaceSwitcher::getInstance
     (SubSystemStatusStack::getCurrentName()).getNamespace(getNamespace());
@@ -135,6 +135,10 @@ protected: // helper functions
   /// Syncronize the states and compute the residual
   void syncGlobalDataComputeResidual(const bool computeResidual);
 
+  /// Let the SpaceMethod's of this namespace finalize the physical time step
+  /// and compute again the residual if they modified the solution
+  void finalizeTimeStep();
+
   /// Prepare the convergence file
   void prepareConvergenceFile();
 
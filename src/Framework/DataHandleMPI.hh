@@ -84,13 +84,13 @@ public:
   }
   
   /// Add a local point
-  CFuint addLocalPoint (CFuint GlobalIndex)
+  CFuint addLocalPoint (CFgid GlobalIndex)
   {
     return _globalPtr->AddLocalPoint (GlobalIndex);;
   }
 
   /// Add a ghost point
-  CFuint addGhostPoint (CFuint GlobalIndex)
+  CFuint addGhostPoint (CFgid GlobalIndex)
   {
     if (!Common::PE::GetPE().IsParallel()) {
       throw Common::ParallelException
@@ -114,7 +114,7 @@ public:
   
   /// Set the mapping from global ghost IDs to donor ranks
   void setMapGhost2DonorRanks
-    (Common::SharedPtr<Common::CFMultiMap<CFuint, CFuint> >& mapGhost2Donor) 
+    (Common::SharedPtr<Common::CFMultiMap<CFgid, CFuint> >& mapGhost2Donor) 
   {_globalPtr->setMapGhost2DonorRanks(mapGhost2Donor);}
   
   /// Build a continuous global mapping.
@@ -133,7 +133,7 @@ public:
   }
 
   /// Lookup the global continuous ID of a local element
-  CFuint getContiguosID (CFuint localID) const
+  CFgid getContiguosID (CFuint localID) const
   {
     return _globalPtr->LocalToCGlobal(localID);
   }
@@ -151,7 +151,7 @@ public:
   /// This function returns the global (cross-processes) size of
   /// the underlying parallel array
   /// @return the global size of the parallel array
-  CFuint getGlobalSize() const
+  CFgid getGlobalSize() const
   {
     return (_globalPtr != CFNULL) ? _globalPtr->GetGlobalSize() : 0;
   }
@@ -5,6 +5,7 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include "Framework/DataStorage.hh"
+#include "Framework/MemoryRegistry.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -57,5 +58,20 @@ CF_DEBUG_POINT;
 
 //////////////////////////////////////////////////////////////////////////////
 
+void DataStorage::reportMemory(MemoryRegistry& registry,
+                               const std::string& prefix) const
+{
+  typedef std::map<std::string, std::pair<MemoryFunction, CFuint> > FunctionMap;
+  for (FunctionMap::const_iterator itr = m_memoryFunctions.begin();
+       itr != m_memoryFunctions.end(); ++itr) {
+    MapType::const_iterator data = m_dataStorage.find(itr->first);
+    cf_assert(data != m_dataStorage.end());
+    const CFdouble bytes = itr->second.first(data->second, itr->second.second);
+    registry.add(MemoryRegistry::DATA_SOCKET, prefix + itr->first, bytes);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 }  //  namespace Framework
 }  //  namespace COOLFluiD
@@ -24,6 +24,49 @@
 namespace COOLFluiD {
 namespace Framework {
 
+  class MemoryRegistry;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Computes the number of bytes allocated by a storage container.
+/// By default it is the number of entries times the size of an entry.
+template <class CONTAINER>
+struct StorageMemory {
+  static CFdouble getBytes(const void* store, const CFuint elementSize)
+  {
+    return static_cast<CFdouble>(static_cast<const CONTAINER*>(store)->size())*elementSize;
+  }
+};
+
+/// Number of bytes allocated by a std::vector storage
+template <class T>
+struct StorageMemory<std::vector<T> > {
+  static CFdouble getBytes(const void* store, const CFuint elementSize)
+  {
+    return static_cast<CFdouble>(static_cast<const std::vector<T>*>(store)->capacity())*elementSize;
+  }
+};
+
+/// Number of bytes allocated by a GrowArray storage (including the capacity)
+template <class T, class ALLOC>
+struct StorageMemory<Common::GrowArray<T, ALLOC> > {
+  static CFdouble getBytes(const void* store, const CFuint)
+  {
+    return static_cast<const Common::GrowArray<T, ALLOC>*>(store)->getMemoryBytes();
+  }
+};
+
+#ifdef CF_HAVE_MPI
+/// Number of bytes allocated by a parallel storage
+template <class T>
+struct StorageMemory<Common::ParVector<T> > {
+  static CFdouble getBytes(const void* store, const CFuint)
+  {
+    return static_cast<const Common::ParVector<T>*>(store)->getMemoryBytes();
+  }
+};
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 
 /// Class DataStorage
@@ -112,14 +155,31 @@ public:
   
   /// Dumps the contents of the DataStorage to a string
   std::string dump () const;
+  
+  /// Adds the memory of each storage to the given registry
+  /// @param prefix prefix of the names of the storages in the report
+  void reportMemory(MemoryRegistry& registry, const std::string& prefix) const;
 
 private:
 
+  /// Function computing the number of bytes of a storage
+  typedef CFdouble (*MemoryFunction)(const void* store, const CFuint elementSize);
+  
   /// Places a storage inside.
   /// @param name std::string identifier for the storage
   /// @param store pointer holding the storage
   void setDataPtr(const std::string& name, void* store);
 
+  /// Sets how to compute the memory of a storage
+  /// @param name std::string identifier for the storage
+  /// @param elementSize number of bytes of each entry
+  template <class CONTAINER>
+  void setMemoryFunction(const std::string& name, const CFuint elementSize)
+  {
+    m_memoryFunctions[name] = std::make_pair
+      (&StorageMemory<CONTAINER>::getBytes, elementSize);
+  }
+
   /// Gets the storage known by the name supplied.
   /// @param name is the name of the storage to get
   /// @return the pointer to the storage
@@ -137,6 +197,9 @@ private: // data
   /// map to store the pointers that hold the data
   MapType m_dataStorage;
 
+  /// map to store how to compute the memory of each storage
+  std::map<std::string, std::pair<MemoryFunction, CFuint> > m_memoryFunctions;
+
 }; // end class DataStorageInternal
 
 //////////////////////////////////////////////////////////////////////////////
@@ -172,6 +235,7 @@ DataHandle< TYPE, LOCAL> DataStorage::createDataDynamic
   {
     ContainerType* ptr = new ContainerType(init,size,elementSize);
     setDataPtr(name,ptr);
+    setMemoryFunction<ContainerType>(name, elementSize);
     CFLogDebugMin("Created Storage(dynamic): " << name << "\n");
     return ReturnType (ptr);
   }
@@ -195,6 +259,7 @@ DataHandle< TYPE, LOCAL> DataStorage::createData
   {
     ContainerType* ptr = new ContainerType(init,size); // this will not work with std::vector(size,init)
     setDataPtr(name,ptr);
+    setMemoryFunction<ContainerType>(name, sizeof(TYPE));
     CFLogDebugMin("Created Storage: " << name << "\n");
     return ReturnType(ptr);
   }
@@ -270,6 +335,7 @@ inline void* DataStorage::getDataPtr(const std::string& name)
 
 inline CFuint DataStorage::removeDataPtr(const std::string& name)
 {
+  m_memoryFunctions.erase(name);
   return static_cast<CFuint>(m_dataStorage.erase(name));
 }
 
@@ -291,10 +357,12 @@ const typename Framework::GlobalTypeTrait<TYPE>::GTYPE & init)
   LocalVectorType* vLocal = new LocalVectorType(CFNULL, size, elementSize);
   const std::string localname  = name + "_local";
   m_dataStorage[localname] = static_cast<void *>(vLocal);
+  setMemoryFunction<LocalVectorType>(localname, sizeof(TYPE));
 
   GlobalVectorType* vGlobal = new GlobalVectorType (init, size, elementSize);
   const std::string globalname = name + "_global";
   m_dataStorage[globalname] = static_cast<void *>(vGlobal);
+  setMemoryFunction<GlobalVectorType>(globalname, elementSize);
 
   return DataHandle<TYPE,GLOBAL>(static_cast<void *>(vLocal),static_cast<void *>(vGlobal));
 }
@@ -343,10 +411,12 @@ DataHandle<TYPE,GLOBAL> DataStorage::createGlobalData
   LocalVectorType* vLocal = new LocalVectorType(CFNULL, size);
   const std::string localname  = name + "_local";
   m_dataStorage[localname] = static_cast<void *>(vLocal);
+  setMemoryFunction<LocalVectorType>(localname, sizeof(TYPE));
   
   GlobalVectorType* vGlobal = new GlobalVectorType (nspaceName, init, size);
   const std::string globalname = name + "_global";
   m_dataStorage[globalname] = static_cast<void *>(vGlobal);
+  setMemoryFunction<GlobalVectorType>(globalname, sizeof(GTYPE));
   
   return DataHandle<TYPE,GLOBAL>(static_cast<void *>(vLocal),static_cast<void *>(vGlobal));
 }
@@ -0,0 +1,738 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Common/PE.hh"
+#include "Common/CFLog.hh"
+#include "Common/MPI/MPIStructDef.hh"
+#include "Common/MPI/MPIError.hh"
+#include "Framework/DistributedMeshInterpolator.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// layout of MPI_DOUBLE_INT, used for the MPI_MINLOC reduction
+struct DistanceRank {
+  double dist;
+  int rank;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+DistributedMeshInterpolator::DistributedMeshInterpolator(const std::string& nsp) :
+  m_comm(PE::GetPE().GetCommunicator(nsp)),
+  m_rank(PE::GetPE().GetRank(nsp)),
+  m_nbProc(PE::GetPE().GetProcessorCount(nsp)),
+  m_type(LINEAR),
+  m_nbNeighbors(0),
+  m_dim(0),
+  m_nbVars(0),
+  m_donorCoords(),
+  m_donorValues(),
+  m_minCellSize(0.),
+  m_nbTotalCells(0),
+  m_rvDonors(),
+  m_rvCellIDs(),
+  m_rvCellStart()
+{
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    m_bbMin[iDim] = 0.;
+    m_cellSize[iDim] = 1.;
+    m_nbCells[iDim] = 1;
+    m_rvLo[iDim] = 0;
+    m_rvHi[iDim] = 0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+DistributedMeshInterpolator::~DistributedMeshInterpolator()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::setDonors(const CFuint dim, const CFuint nbVars,
+					    const vector<CFreal>& coords,
+					    const vector<CFreal>& values)
+{
+  cf_assert(dim >= DIM_1D && dim <= DIM_3D);
+  cf_assert(nbVars > 0);
+  cf_assert(coords.size() % dim == 0);
+  cf_assert(values.size() == (coords.size()/dim)*nbVars);
+
+  m_dim = dim;
+  m_nbVars = nbVars;
+  m_donorCoords = coords;
+  m_donorValues = values;
+
+  if (m_nbNeighbors == 0) {
+    m_nbNeighbors = 3*dim + 1;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::interpolate(const vector<CFreal>& coords,
+					      vector<CFreal>& values)
+{
+  cf_assert(m_dim > 0);
+  cf_assert(coords.size() % m_dim == 0);
+
+  const CFuint nbTargets = coords.size()/m_dim;
+  values.assign(nbTargets*m_nbVars, 0.);
+
+  CFuint nbLocalDonors = m_donorCoords.size()/m_dim;
+  CFuint nbDonors = 0;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::interpolate()",
+     MPI_Allreduce(&nbLocalDonors, &nbDonors, 1, MPIStructDef::getMPIType(&nbDonors),
+		   MPI_SUM, m_comm));
+  if (nbDonors == 0) {
+    CFLog(WARN, "DistributedMeshInterpolator::interpolate() => no donors given\n");
+    return;
+  }
+
+  computeRendezvousGrid(coords);
+
+  vector<vector<CFreal> > sendBuf(m_nbProc);
+  vector<CFreal> recvBuf;
+  vector<int> recvCounts;
+
+  // send each donor to the rendezvous processors owning its cell
+  // and the neighbouring ones
+  vector<CFuint> lastDonor(m_nbProc, nbLocalDonors);
+  for (CFuint iDonor = 0; iDonor < nbLocalDonors; ++iDonor) {
+    const CFreal* x = &m_donorCoords[iDonor*m_dim];
+    CFuint ijk[3];
+    getCellID(x, ijk);
+
+    CFuint lo[3];
+    CFuint hi[3];
+    for (CFuint iDim = 0; iDim < 3; ++iDim) {
+      lo[iDim] = (ijk[iDim] > 0) ? ijk[iDim] - 1 : 0;
+      hi[iDim] = std::min(ijk[iDim] + 1, m_nbCells[iDim] - 1);
+    }
+
+    CFuint n[3];
+    for (n[2] = lo[2]; n[2] <= hi[2]; ++n[2]) {
+      for (n[1] = lo[1]; n[1] <= hi[1]; ++n[1]) {
+	for (n[0] = lo[0]; n[0] <= hi[0]; ++n[0]) {
+	  const CFuint rank = getCellRank(getCellID(n));
+	  if (lastDonor[rank] != iDonor) {
+	    lastDonor[rank] = iDonor;
+	    sendBuf[rank].insert(sendBuf[rank].end(), x, x + m_dim);
+	    sendBuf[rank].insert(sendBuf[rank].end(),
+				 m_donorValues.begin() + iDonor*m_nbVars,
+				 m_donorValues.begin() + (iDonor+1)*m_nbVars);
+	  }
+	}
+      }
+    }
+  }
+
+  exchange(sendBuf, recvBuf, recvCounts);
+  storeRendezvousDonors(recvBuf);
+
+  // send each target to the rendezvous processor owning its cell
+  vector<vector<CFuint> > targetIDs(m_nbProc);
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    sendBuf[iProc].clear();
+  }
+  for (CFuint iTarget = 0; iTarget < nbTargets; ++iTarget) {
+    const CFreal* x = &coords[iTarget*m_dim];
+    CFuint ijk[3];
+    const CFuint rank = getCellRank(getCellID(x, ijk));
+    sendBuf[rank].insert(sendBuf[rank].end(), x, x + m_dim);
+    targetIDs[rank].push_back(iTarget);
+  }
+
+  exchange(sendBuf, recvBuf, recvCounts);
+
+  // answer the received queries: a flag telling if donors have been found,
+  // followed by the interpolated values
+  const CFuint answerSize = m_nbVars + 1;
+  vector<pair<CFreal, CFuint> > nearest;
+  CFuint offset = 0;
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    const CFuint nbQueries = recvCounts[iProc]/m_dim;
+    sendBuf[iProc].assign(nbQueries*answerSize, 0.);
+    for (CFuint iQuery = 0; iQuery < nbQueries; ++iQuery) {
+      const CFreal* x = &recvBuf[offset + iQuery*m_dim];
+      findNearestDonors(x, nearest);
+      if (nearest.size() > 0) {
+	CFreal* answer = &sendBuf[iProc][iQuery*answerSize];
+	answer[0] = 1.;
+	computeValues(x, nearest, &answer[1]);
+      }
+    }
+    offset += recvCounts[iProc];
+  }
+
+  exchange(sendBuf, recvBuf, recvCounts);
+
+  // scatter the answers to the targets
+  vector<CFuint> unresolvedIDs;
+  vector<CFreal> unresolvedCoords;
+  offset = 0;
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    cf_assert(recvCounts[iProc] == static_cast<int>(targetIDs[iProc].size()*answerSize));
+    for (CFuint i = 0; i < targetIDs[iProc].size(); ++i) {
+      const CFuint iTarget = targetIDs[iProc][i];
+      const CFreal* answer = &recvBuf[offset + i*answerSize];
+      if (answer[0] > 0.5) {
+	std::copy(answer + 1, answer + answerSize, &values[iTarget*m_nbVars]);
+      }
+      else {
+	unresolvedIDs.push_back(iTarget);
+	unresolvedCoords.insert(unresolvedCoords.end(), &coords[iTarget*m_dim],
+				&coords[iTarget*m_dim] + m_dim);
+      }
+    }
+    offset += recvCounts[iProc];
+  }
+
+  // rendezvous data are not needed anymore
+  vector<CFreal>().swap(m_rvDonors);
+  vector<CFuint>().swap(m_rvCellIDs);
+  vector<CFuint>().swap(m_rvCellStart);
+
+  vector<CFreal> unresolvedValues;
+  findGlobalNearest(unresolvedCoords, unresolvedValues);
+  for (CFuint i = 0; i < unresolvedIDs.size(); ++i) {
+    std::copy(&unresolvedValues[i*m_nbVars], &unresolvedValues[i*m_nbVars] + m_nbVars,
+	      &values[unresolvedIDs[i]*m_nbVars]);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::computeRendezvousGrid(const vector<CFreal>& targetCoords)
+{
+  CFreal localMin[3];
+  CFreal localMax[3];
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    localMin[iDim] = numeric_limits<CFreal>::max();
+    localMax[iDim] = -numeric_limits<CFreal>::max();
+  }
+
+  const vector<CFreal>* allCoords[2] = {&m_donorCoords, &targetCoords};
+  for (CFuint iSet = 0; iSet < 2; ++iSet) {
+    const vector<CFreal>& x = *allCoords[iSet];
+    for (CFuint i = 0; i < x.size(); ++i) {
+      const CFuint iDim = i % m_dim;
+      localMin[iDim] = std::min(localMin[iDim], x[i]);
+      localMax[iDim] = std::max(localMax[iDim], x[i]);
+    }
+  }
+
+  CFreal bbMax[3];
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::computeRendezvousGrid()",
+     MPI_Allreduce(localMin, m_bbMin, m_dim, MPIStructDef::getMPIType(&localMin[0]),
+		   MPI_MIN, m_comm));
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::computeRendezvousGrid()",
+     MPI_Allreduce(localMax, bbMax, m_dim, MPIStructDef::getMPIType(&localMax[0]),
+		   MPI_MAX, m_comm));
+
+  CFuint nbLocalDonors = m_donorCoords.size()/m_dim;
+  CFuint nbDonors = 0;
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::computeRendezvousGrid()",
+     MPI_Allreduce(&nbLocalDonors, &nbDonors, 1, MPIStructDef::getMPIType(&nbDonors),
+		   MPI_SUM, m_comm));
+
+  // slightly enlarge the box, so that all the points fall strictly inside
+  CFreal maxExtent = 0.;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    maxExtent = std::max(maxExtent, bbMax[iDim] - m_bbMin[iDim]);
+  }
+  if (maxExtent <= 0.) {
+    maxExtent = 1.;
+  }
+  const CFreal tolerance = 1e-8*maxExtent;
+
+  // the cell size is chosen to get DONORS_PER_CELL donors per cell on average
+  // over the directions with a non zero extent
+  CFreal extent[3];
+  CFreal volume = 1.;
+  CFuint nbActiveDims = 0;
+  for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+    m_bbMin[iDim] -= tolerance;
+    extent[iDim] = bbMax[iDim] + tolerance - m_bbMin[iDim];
+    if (extent[iDim] > 1e3*tolerance) {
+      volume *= extent[iDim];
+      ++nbActiveDims;
+    }
+  }
+
+  const CFuint maxNbCells = (m_dim == DIM_3D) ? 1024 : ((m_dim == DIM_2D) ? 32768 : 1 << 30);
+  const CFreal cellSize = (nbActiveDims > 0) ?
+    std::pow(volume*DONORS_PER_CELL/nbDonors, 1./nbActiveDims) : maxExtent;
+
+  m_nbTotalCells = 1;
+  m_minCellSize = numeric_limits<CFreal>::max();
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    m_nbCells[iDim] = 1;
+    if (iDim < m_dim) {
+      if (extent[iDim] > 1e3*tolerance) {
+	const CFreal nbCells = std::ceil(extent[iDim]/cellSize);
+	m_nbCells[iDim] = (nbCells < maxNbCells) ?
+	  std::max(static_cast<CFuint>(nbCells), static_cast<CFuint>(1)) : maxNbCells;
+      }
+      m_cellSize[iDim] = extent[iDim]/m_nbCells[iDim];
+      if (extent[iDim] > 1e3*tolerance) {
+	m_minCellSize = std::min(m_minCellSize, m_cellSize[iDim]);
+      }
+    }
+    else {
+      m_bbMin[iDim] = 0.;
+      m_cellSize[iDim] = 1.;
+    }
+    m_nbTotalCells *= m_nbCells[iDim];
+  }
+  if (nbActiveDims == 0) {
+    m_minCellSize = maxExtent;
+  }
+
+  CFLog(VERBOSE, "DistributedMeshInterpolator::computeRendezvousGrid() => "
+	<< m_nbCells[0] << " x " << m_nbCells[1] << " x " << m_nbCells[2]
+	<< " cells for " << nbDonors << " donors\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+CFuint DistributedMeshInterpolator::getCellID(const CFreal* point, CFuint* ijk) const
+{
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    ijk[iDim] = 0;
+    if (iDim < m_dim) {
+      const CFreal i = std::floor((point[iDim] - m_bbMin[iDim])/m_cellSize[iDim]);
+      if (i > 0.) {
+	ijk[iDim] = std::min(static_cast<CFuint>(i), m_nbCells[iDim] - 1);
+      }
+    }
+  }
+  return getCellID(ijk);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::exchange(const vector<vector<CFreal> >& sendBuf,
+					   vector<CFreal>& recvBuf,
+					   vector<int>& recvCounts) const
+{
+  vector<int> sendCounts(m_nbProc);
+  vector<int> sendDispls(m_nbProc, 0);
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    sendCounts[iProc] = sendBuf[iProc].size();
+    if (iProc > 0) {
+      sendDispls[iProc] = sendDispls[iProc-1] + sendCounts[iProc-1];
+    }
+  }
+
+  recvCounts.resize(m_nbProc);
+  MPIError::getInstance().check
+    ("MPI_Alltoall", "DistributedMeshInterpolator::exchange()",
+     MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, m_comm));
+
+  vector<int> recvDispls(m_nbProc, 0);
+  for (CFuint iProc = 1; iProc < m_nbProc; ++iProc) {
+    recvDispls[iProc] = recvDispls[iProc-1] + recvCounts[iProc-1];
+  }
+
+  vector<CFreal> sendData;
+  sendData.reserve(sendDispls[m_nbProc-1] + sendCounts[m_nbProc-1] + 1);
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    sendData.insert(sendData.end(), sendBuf[iProc].begin(), sendBuf[iProc].end());
+  }
+  // avoid passing the address of an empty buffer to MPI
+  sendData.push_back(0.);
+
+  recvBuf.resize(recvDispls[m_nbProc-1] + recvCounts[m_nbProc-1] + 1);
+  MPIError::getInstance().check
+    ("MPI_Alltoallv", "DistributedMeshInterpolator::exchange()",
+     MPI_Alltoallv(&sendData[0], &sendCounts[0], &sendDispls[0],
+		   MPIStructDef::getMPIType(&sendData[0]),
+		   &recvBuf[0], &recvCounts[0], &recvDispls[0],
+		   MPIStructDef::getMPIType(&recvBuf[0]), m_comm));
+  recvBuf.pop_back();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::storeRendezvousDonors(const vector<CFreal>& recvBuf)
+{
+  const CFuint stride = m_dim + m_nbVars;
+  const CFuint nbDonors = recvBuf.size()/stride;
+
+  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+    m_rvLo[iDim] = m_nbCells[iDim] - 1;
+    m_rvHi[iDim] = 0;
+  }
+
+  vector<pair<CFuint, CFuint> > cellDonors(nbDonors);
+  for (CFuint iDonor = 0; iDonor < nbDonors; ++iDonor) {
+    CFuint ijk[3];
+    cellDonors[iDonor].first = getCellID(&recvBuf[iDonor*stride], ijk);
+    cellDonors[iDonor].second = iDonor;
+    for (CFuint iDim = 0; iDim < 3; ++iDim) {
+      m_rvLo[iDim] = std::min(m_rvLo[iDim], ijk[iDim]);
+      m_rvHi[iDim] = std::max(m_rvHi[iDim], ijk[iDim]);
+    }
+  }
+  std::sort(cellDonors.begin(), cellDonors.end());
+
+  m_rvDonors.resize(recvBuf.size());
+  m_rvCellIDs.clear();
+  m_rvCellStart.clear();
+  for (CFuint i = 0; i < nbDonors; ++i) {
+    if (i == 0 || cellDonors[i].first != cellDonors[i-1].first) {
+      m_rvCellIDs.push_back(cellDonors[i].first);
+      m_rvCellStart.push_back(i);
+    }
+    const CFuint iDonor = cellDonors[i].second;
+    std::copy(&recvBuf[iDonor*stride], &recvBuf[iDonor*stride] + stride,
+	      &m_rvDonors[i*stride]);
+  }
+  m_rvCellStart.push_back(nbDonors);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::findNearestDonors
+(const CFreal* point, vector<pair<CFreal, CFuint> >& nearest) const
+{
+  nearest.clear();
+
+  const CFuint stride = m_dim + m_nbVars;
+  const CFuint nbNeighbors = (m_type == NEAREST) ? 1 : m_nbNeighbors;
+  const CFuint maxRing = std::max(m_nbCells[0], std::max(m_nbCells[1], m_nbCells[2]));
+
+  CFuint ijk[3];
+  getCellID(point, ijk);
+
+  // visit the cells ring by ring around the one containing the point:
+  // donors outside ring r are at least r*m_minCellSize far from the point,
+  // so that the search stops as soon as the nbNeighbors-th nearest donor
+  // found is closer than that, or when the whole grid has been visited.
+  // Once all the cells holding donors on this rendezvous processor have been
+  // visited, nearer donors can only be in the cells of other processors: if
+  // the nearest donors are not proven to be closer than the visited rings,
+  // none is returned, so that the point is searched globally
+  bool isFound = false;
+  for (CFuint ring = 0; ring < maxRing; ++ring) {
+    CFuint lo[3];
+    CFuint hi[3];
+    bool coversAll = true;
+    bool coversGrid = true;
+    for (CFuint iDim = 0; iDim < 3; ++iDim) {
+      lo[iDim] = (ijk[iDim] > ring) ? ijk[iDim] - ring : 0;
+      hi[iDim] = std::min(ijk[iDim] + ring, m_nbCells[iDim] - 1);
+      coversAll = coversAll && lo[iDim] <= m_rvLo[iDim] && hi[iDim] >= m_rvHi[iDim];
+      coversGrid = coversGrid && lo[iDim] == 0 && hi[iDim] == m_nbCells[iDim] - 1;
+
+      // no donor lies outside the box of the rendezvous cells
+      lo[iDim] = std::max(lo[iDim], m_rvLo[iDim]);
+      hi[iDim] = std::min(hi[iDim], m_rvHi[iDim]);
+    }
+
+    CFuint n[3];
+    for (n[2] = lo[2]; n[2] <= hi[2]; ++n[2]) {
+      for (n[1] = lo[1]; n[1] <= hi[1]; ++n[1]) {
+	for (n[0] = lo[0]; n[0] <= hi[0]; ++n[0]) {
+	  // skip the cells visited in the previous rings
+	  bool onRing = false;
+	  for (CFuint iDim = 0; iDim < 3; ++iDim) {
+	    if (n[iDim] + ring == ijk[iDim] || n[iDim] == ijk[iDim] + ring) {
+	      onRing = true;
+	    }
+	  }
+	  if (!onRing) continue;
+
+	  const vector<CFuint>::const_iterator it =
+	    std::lower_bound(m_rvCellIDs.begin(), m_rvCellIDs.end(), getCellID(n));
+	  if (it == m_rvCellIDs.end() || *it != getCellID(n)) continue;
+
+	  const CFuint iCell = it - m_rvCellIDs.begin();
+	  for (CFuint iDonor = m_rvCellStart[iCell]; iDonor < m_rvCellStart[iCell+1]; ++iDonor) {
+	    const CFreal* x = &m_rvDonors[iDonor*stride];
+	    CFreal sqDist = 0.;
+	    for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	      sqDist += (x[iDim] - point[iDim])*(x[iDim] - point[iDim]);
+	    }
+	    nearest.push_back(pair<CFreal, CFuint>(sqDist, iDonor));
+	  }
+	}
+      }
+    }
+
+    if (nearest.size() >= nbNeighbors) {
+      std::nth_element(nearest.begin(), nearest.begin() + nbNeighbors - 1, nearest.end());
+      const CFreal radius = ring*m_minCellSize;
+      if (nearest[nbNeighbors-1].first <= radius*radius) {
+	isFound = true;
+	break;
+      }
+    }
+
+    if (coversGrid) {
+      isFound = true;
+      break;
+    }
+
+    if (coversAll) break;
+  }
+
+  if (!isFound) {
+    nearest.clear();
+    return;
+  }
+
+  if (nearest.size() > nbNeighbors) {
+    std::nth_element(nearest.begin(), nearest.begin() + nbNeighbors - 1, nearest.end());
+    nearest.resize(nbNeighbors);
+  }
+  std::sort(nearest.begin(), nearest.end());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::computeValues
+(const CFreal* point, const vector<pair<CFreal, CFuint> >& nearest, CFreal* values) const
+{
+  cf_assert(nearest.size() > 0);
+
+  const CFuint stride = m_dim + m_nbVars;
+  const CFreal h2 = m_minCellSize*m_minCellSize;
+  const CFreal* nearestValues = &m_rvDonors[nearest[0].second*stride + m_dim];
+
+  if (m_type == NEAREST || nearest[0].first <= 1e-20*h2) {
+    std::copy(nearestValues, nearestValues + m_nbVars, values);
+    return;
+  }
+
+  const CFuint nbNeighbors = nearest.size();
+  const CFuint n = m_dim + 1;
+
+  bool useFit = (nbNeighbors >= n);
+  if (useFit) {
+    // weighted least squares fit of a linear function, the unknowns being
+    // the value in the point and the gradient scaled by the stencil radius.
+    // The weights are bounded to keep the system well conditioned when a
+    // donor is very close to the point
+    const CFreal r2 = nearest[nbNeighbors-1].first;
+    const CFreal r = std::sqrt(r2);
+    CFreal a[4][4];
+    vector<CFreal> b(n*m_nbVars, 0.);
+    for (CFuint i = 0; i < n; ++i) {
+      for (CFuint j = 0; j < n; ++j) {
+	a[i][j] = 0.;
+      }
+    }
+
+    for (CFuint k = 0; k < nbNeighbors; ++k) {
+      const CFreal* x = &m_rvDonors[nearest[k].second*stride];
+      const CFreal w = r2/(nearest[k].first + 0.01*r2);
+      CFreal dx[4];
+      dx[0] = 1.;
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	dx[iDim+1] = (x[iDim] - point[iDim])/r;
+      }
+      for (CFuint i = 0; i < n; ++i) {
+	for (CFuint j = 0; j < n; ++j) {
+	  a[i][j] += w*dx[i]*dx[j];
+	}
+	for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	  b[i*m_nbVars + iVar] += w*dx[i]*x[m_dim + iVar];
+	}
+      }
+    }
+
+    // gaussian elimination with partial pivoting
+    CFreal maxDiag = 0.;
+    for (CFuint i = 0; i < n; ++i) {
+      maxDiag = std::max(maxDiag, std::abs(a[i][i]));
+    }
+    for (CFuint col = 0; col < n && useFit; ++col) {
+      CFuint pivot = col;
+      for (CFuint i = col + 1; i < n; ++i) {
+	if (std::abs(a[i][col]) > std::abs(a[pivot][col])) pivot = i;
+      }
+      if (std::abs(a[pivot][col]) <= 1e-10*maxDiag) {
+	// donors aligned or coplanar: no unique linear fit
+	useFit = false;
+	break;
+      }
+      if (pivot != col) {
+	for (CFuint j = 0; j < n; ++j) {
+	  std::swap(a[col][j], a[pivot][j]);
+	}
+	for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	  std::swap(b[col*m_nbVars + iVar], b[pivot*m_nbVars + iVar]);
+	}
+      }
+      for (CFuint i = col + 1; i < n; ++i) {
+	const CFreal factor = a[i][col]/a[col][col];
+	for (CFuint j = col; j < n; ++j) {
+	  a[i][j] -= factor*a[col][j];
+	}
+	for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	  b[i*m_nbVars + iVar] -= factor*b[col*m_nbVars + iVar];
+	}
+      }
+    }
+
+    if (useFit) {
+      for (CFint i = n - 1; i >= 0; --i) {
+	for (CFuint j = i + 1; j < n; ++j) {
+	  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	    b[i*m_nbVars + iVar] -= a[i][j]*b[j*m_nbVars + iVar];
+	  }
+	}
+	for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	  b[i*m_nbVars + iVar] /= a[i][i];
+	}
+      }
+
+      // the fitted value is bounded by the donor values, to avoid creating
+      // new extrema (e.g. negative densities) when extrapolating
+      for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+	CFreal vMin = nearestValues[iVar];
+	CFreal vMax = nearestValues[iVar];
+	for (CFuint k = 1; k < nbNeighbors; ++k) {
+	  const CFreal v = m_rvDonors[nearest[k].second*stride + m_dim + iVar];
+	  vMin = std::min(vMin, v);
+	  vMax = std::max(vMax, v);
+	}
+	values[iVar] = std::max(vMin, std::min(vMax, b[iVar]));
+      }
+      return;
+    }
+  }
+
+  // inverse distance weighting
+  CFreal sumW = 0.;
+  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+    values[iVar] = 0.;
+  }
+  for (CFuint k = 0; k < nbNeighbors; ++k) {
+    const CFreal w = h2/nearest[k].first;
+    const CFreal* v = &m_rvDonors[nearest[k].second*stride + m_dim];
+    for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+      values[iVar] += w*v[iVar];
+    }
+    sumW += w;
+  }
+  for (CFuint iVar = 0; iVar < m_nbVars; ++iVar) {
+    values[iVar] /= sumW;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void DistributedMeshInterpolator::findGlobalNearest(const vector<CFreal>& coords,
+						    vector<CFreal>& values) const
+{
+  int nbLocal = coords.size()/m_dim;
+  vector<int> counts(m_nbProc);
+  MPIError::getInstance().check
+    ("MPI_Allgather", "DistributedMeshInterpolator::findGlobalNearest()",
+     MPI_Allgather(&nbLocal, 1, MPI_INT, &counts[0], 1, MPI_INT, m_comm));
+
+  vector<int> coordCounts(m_nbProc);
+  vector<int> displs(m_nbProc, 0);
+  CFuint nbTotal = 0;
+  for (CFuint iProc = 0; iProc < m_nbProc; ++iProc) {
+    coordCounts[iProc] = counts[iProc]*m_dim;
+    if (iProc > 0) {
+      displs[iProc] = displs[iProc-1] + coordCounts[iProc-1];
+    }
+    nbTotal += counts[iProc];
+  }
+
+  values.assign(nbLocal*m_nbVars, 0.);
+  if (nbTotal == 0) return;
+
+  CFLog(VERBOSE, "DistributedMeshInterpolator::findGlobalNearest() => "
+	<< nbTotal << " targets without nearby donors\n");
+
+  vector<CFreal> sendCoords(coords);
+  sendCoords.push_back(0.);
+  vector<CFreal> allCoords(nbTotal*m_dim);
+  MPIError::getInstance().check
+    ("MPI_Allgatherv", "DistributedMeshInterpolator::findGlobalNearest()",
+     MPI_Allgatherv(&sendCoords[0], nbLocal*m_dim, MPIStructDef::getMPIType(&sendCoords[0]),
+		    &allCoords[0], &coordCounts[0], &displs[0],
+		    MPIStructDef::getMPIType(&allCoords[0]), m_comm));
+
+  // nearest local donor of each target, then global minimum location
+  vector<DistanceRank> localMin(nbTotal);
+  vector<DistanceRank> globalMin(nbTotal);
+  vector<CFuint> nearestDonor(nbTotal, 0);
+
+  const CFuint nbDonors = m_donorCoords.size()/m_dim;
+  for (CFuint i = 0; i < nbTotal; ++i) {
+    localMin[i].dist = numeric_limits<double>::max();
+    localMin[i].rank = m_rank;
+    for (CFuint iDonor = 0; iDonor < nbDonors; ++iDonor) {
+      double sqDist = 0.;
+      for (CFuint iDim = 0; iDim < m_dim; ++iDim) {
+	const double diff = m_donorCoords[iDonor*m_dim + iDim] - allCoords[i*m_dim + iDim];
+	sqDist += diff*diff;
+      }
+      if (sqDist < localMin[i].dist) {
+	localMin[i].dist = sqDist;
+	nearestDonor[i] = iDonor;
+      }
+    }
+  }
+
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::findGlobalNearest()",
+     MPI_Allreduce(&localMin[0], &globalMin[0], nbTotal, MPI_DOUBLE_INT, MPI_MINLOC, m_comm));
+
+  vector<CFreal> allValues(nbTotal*m_nbVars, 0.);
+  vector<CFreal> sumValues(nbTotal*m_nbVars, 0.);
+  for (CFuint i = 0; i < nbTotal; ++i) {
+    if (globalMin[i].rank == static_cast<int>(m_rank)) {
+      std::copy(&m_donorValues[nearestDonor[i]*m_nbVars],
+		&m_donorValues[nearestDonor[i]*m_nbVars] + m_nbVars,
+		&allValues[i*m_nbVars]);
+    }
+  }
+
+  MPIError::getInstance().check
+    ("MPI_Allreduce", "DistributedMeshInterpolator::findGlobalNearest()",
+     MPI_Allreduce(&allValues[0], &sumValues[0], nbTotal*m_nbVars,
+		   MPIStructDef::getMPIType(&allValues[0]), MPI_SUM, m_comm));
+
+  const CFuint start = displs[m_rank]/m_dim;
+  std::copy(&sumValues[start*m_nbVars], &sumValues[(start + nbLocal)*m_nbVars],
+	    values.begin());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
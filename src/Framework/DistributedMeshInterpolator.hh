@@ -0,0 +1,246 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_DistributedMeshInterpolator_hh
+#define COOLFluiD_Framework_DistributedMeshInterpolator_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "Framework/Framework.hh"
+
+#ifdef CF_HAVE_MPI
+
+#include <mpi.h>
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * This class transfers a solution between two non-matching meshes which are
+ * both distributed over the processors of the same namespace.
+ *
+ * The donor points (e.g. the cell centers of the old mesh) and the target
+ * points (e.g. the cell centers of the new mesh) are sent to "rendezvous"
+ * processors, owning blocks of a uniform grid covering the global bounding
+ * box. Donors are also replicated in the grid cells adjacent to their own,
+ * so that each rendezvous processor can locate the nearest donors of all
+ * the targets falling in its cells. The interpolated values are then sent
+ * back to the processors owning the targets.
+ * Targets for which no donor is available on the rendezvous processor take
+ * the value of the globally nearest donor.
+ *
+ * All the functions are collective on the namespace communicator.
+ */
+class Framework_API DistributedMeshInterpolator {
+public:
+
+  /// available interpolation schemes
+  enum InterpolationType {
+    /// value of the nearest donor
+    NEAREST=0,
+    /// weighted least squares linear fit on the nearest donors
+    LINEAR=1
+  };
+
+  /**
+   * Constructor
+   * @param nsp  namespace whose communicator is used
+   */
+  DistributedMeshInterpolator(const std::string& nsp);
+
+  /**
+   * Default destructor
+   */
+  ~DistributedMeshInterpolator();
+
+  /**
+   * Set the interpolation scheme
+   */
+  void setInterpolationType(const InterpolationType type)
+  {
+    m_type = type;
+  }
+
+  /**
+   * Set the number of nearest donors used by the LINEAR scheme
+   * (0 selects a default depending on the dimension)
+   */
+  void setNbNeighbors(const CFuint nbNeighbors)
+  {
+    m_nbNeighbors = nbNeighbors;
+  }
+
+  /**
+   * Set the donors owned by this processor. Each donor must be given by
+   * one processor only (e.g. exclude the ghost states).
+   * @param dim     space dimension
+   * @param nbVars  number of variables per donor
+   * @param coords  donor coordinates, stored as [x0 y0 (z0) x1 ...]
+   * @param values  donor values, stored as [v0_0 ... v0_nbVars-1 v1_0 ...]
+   */
+  void setDonors(const CFuint dim, const CFuint nbVars,
+		 const std::vector<CFreal>& coords,
+		 const std::vector<CFreal>& values);
+
+  /**
+   * Interpolate the donor values in the given target points
+   * @param coords  target coordinates, stored as the donor ones
+   * @param values  interpolated values (resized here), stored as the donor ones
+   */
+  void interpolate(const std::vector<CFreal>& coords, std::vector<CFreal>& values);
+
+private:
+
+  /**
+   * Compute the rendezvous grid covering all donors and targets
+   */
+  void computeRendezvousGrid(const std::vector<CFreal>& targetCoords);
+
+  /**
+   * Get the rendezvous grid cell containing the given point
+   */
+  CFuint getCellID(const CFreal* point, CFuint* ijk) const;
+
+  /**
+   * Get the ID of a cell from its indices
+   */
+  CFuint getCellID(const CFuint* ijk) const
+  {
+    return ijk[0] + m_nbCells[0]*(ijk[1] + m_nbCells[1]*ijk[2]);
+  }
+
+  /**
+   * Get the rendezvous processor owning the given cell
+   */
+  CFuint getCellRank(const CFuint cellID) const
+  {
+    const CFuint rank = static_cast<CFuint>
+      (static_cast<CFreal>(cellID)*m_nbProc/static_cast<CFreal>(m_nbTotalCells));
+    return (rank < m_nbProc) ? rank : m_nbProc - 1;
+  }
+
+  /**
+   * Send a buffer to each processor and receive the buffers sent to this one
+   * @param sendBuf     buffers to send, one per processor
+   * @param recvBuf     received data, ordered by sending processor
+   * @param recvCounts  number of entries received from each processor
+   */
+  void exchange(const std::vector<std::vector<CFreal> >& sendBuf,
+		std::vector<CFreal>& recvBuf,
+		std::vector<int>& recvCounts) const;
+
+  /**
+   * Store the donors received by this rendezvous processor, sorted by cell
+   */
+  void storeRendezvousDonors(const std::vector<CFreal>& recvBuf);
+
+  /**
+   * Find the nearest donors stored on this rendezvous processor
+   * @param point    query point
+   * @param nearest  (squared distance, donor index) pairs, sorted by distance,
+   *                 empty if nearer donors could be on other processors
+   */
+  void findNearestDonors(const CFreal* point,
+			 std::vector<std::pair<CFreal, CFuint> >& nearest) const;
+
+  /**
+   * Compute the interpolated values from the nearest donors
+   */
+  void computeValues(const CFreal* point,
+		     const std::vector<std::pair<CFreal, CFuint> >& nearest,
+		     CFreal* values) const;
+
+  /**
+   * Give the value of the globally nearest donor to the unresolved targets
+   * @param coords    coordinates of the local unresolved targets
+   * @param values    corresponding values to fill in
+   */
+  void findGlobalNearest(const std::vector<CFreal>& coords,
+			 std::vector<CFreal>& values) const;
+
+private:
+
+  /// average number of donors per rendezvous cell
+  static const CFuint DONORS_PER_CELL = 16;
+
+  /// namespace communicator
+  MPI_Comm m_comm;
+
+  /// rank of this processor
+  CFuint m_rank;
+
+  /// number of processors
+  CFuint m_nbProc;
+
+  /// interpolation scheme
+  InterpolationType m_type;
+
+  /// number of nearest donors used by the LINEAR scheme
+  CFuint m_nbNeighbors;
+
+  /// space dimension
+  CFuint m_dim;
+
+  /// number of variables per donor
+  CFuint m_nbVars;
+
+  /// coordinates of the donors owned by this processor
+  std::vector<CFreal> m_donorCoords;
+
+  /// values of the donors owned by this processor
+  std::vector<CFreal> m_donorValues;
+
+  /// lower corner of the rendezvous grid
+  CFreal m_bbMin[3];
+
+  /// size of the rendezvous grid cells in each direction
+  CFreal m_cellSize[3];
+
+  /// smallest cell size among the active directions
+  CFreal m_minCellSize;
+
+  /// number of rendezvous grid cells in each direction
+  CFuint m_nbCells[3];
+
+  /// total number of rendezvous grid cells
+  CFuint m_nbTotalCells;
+
+  /// donors held by this rendezvous processor, stored as
+  /// [coords values] and sorted by cell
+  std::vector<CFreal> m_rvDonors;
+
+  /// sorted IDs of the cells containing donors on this rendezvous processor
+  std::vector<CFuint> m_rvCellIDs;
+
+  /// start of the donors of each cell in m_rvCellIDs (CSR storage)
+  std::vector<CFuint> m_rvCellStart;
+
+  /// lower corner (in cells) of the box containing the cells of m_rvCellIDs
+  CFuint m_rvLo[3];
+
+  /// upper corner (in cells) of the box containing the cells of m_rvCellIDs
+  CFuint m_rvHi[3];
+
+}; // end of class DistributedMeshInterpolator
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // CF_HAVE_MPI
+
+#endif // COOLFluiD_Framework_DistributedMeshInterpolator_hh
@@ -1093,7 +1093,7 @@ void FVMCC_MeshDataBuilder::renumberCells()
   bool doRenumber = true;
 
   for (CFuint i = 0; i < nbCells; ++i) {
-    const CFuint globalStateID = states[cells->getStateID(i,0)]->getGlobalID();
+    const CFgid globalStateID = states[cells->getStateID(i,0)]->getGlobalID();
     if (globalStateID != cells->getGlobalGeoID(i)) {
       doRenumber = false;
       break;
@@ -1104,7 +1104,7 @@ void FVMCC_MeshDataBuilder::renumberCells()
   
   if (doRenumber) {
     // build a mapping global cellID to local cellID
-    CFMap<CFuint, CFuint> mapGlobalToLocalCellID;
+    CFMap<CFgid, CFuint> mapGlobalToLocalCellID;
     mapGlobalToLocalCellID.reserve(nbCells);
     cf_assert(nbCells == states.size());
     
@@ -1120,7 +1120,7 @@ void FVMCC_MeshDataBuilder::renumberCells()
     // perform a local renumbering of the cells so that their local IDs match
     // the local state IDs
     for (CFuint iState = 0; iState < states.size(); ++iState) {
-      const CFuint globalStateID = states[iState]->getGlobalID();
+      const CFgid globalStateID = states[iState]->getGlobalID();
       const CFuint oldLocalCellID = mapGlobalToLocalCellID.find(globalStateID);
       const CFuint nbNodesInCell = cells->getNbNodesInGeo(oldLocalCellID);
       // renumber the node connectivity of the current cell
@@ -1137,7 +1137,7 @@ void FVMCC_MeshDataBuilder::renumberCells()
 
     // redo the consistency check
     for (CFuint i = 0; i < nbCells; ++i) {
-      const CFuint globalStateID = states[cells->getStateID(i,0)]->getGlobalID();
+      const CFgid globalStateID = states[cells->getStateID(i,0)]->getGlobalID();
       if (globalStateID != cells->getGlobalGeoID(i)) {
 	CFLog(ERROR, "ERROR: globalStateID " << globalStateID
 	      << " != globalCellID " << cells->getGlobalGeoID(i) << "\n");
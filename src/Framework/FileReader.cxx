@@ -5,6 +5,7 @@
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
 #include <limits>
+#include <sstream>
 #include "Common/CFLog.hh"
 #include "Common/FactoryRegistry.hh"
 #include "Framework/FileReader.hh"
@@ -47,8 +48,6 @@ void FileReader::readFromFile(const boost::filesystem::path& filepath)
   
   CFLog(VERBOSE, "FileReader::readFromFile() => start\n");
   
-  const CFuint MAXLINESINFILE = std::numeric_limits<CFuint>::max()-1;
-
   m_readCount = 0;
 
   do {
@@ -59,17 +58,7 @@ void FileReader::readFromFile(const boost::filesystem::path& filepath)
     std::ifstream& file = (*fhandle)->open(filepath);
     
     m_readAgain = false;
-    bool keepOnReading = true;
-    CFuint linesRead = 0;
-
-    do {
-      keepOnReading = readString(file);
-
-      if (++linesRead > MAXLINESINFILE)
-        throw BadFormatException (FromHere(),"File too long, probably misformatted."
-				  "\nSee void FileReader::readFromFile for more info\n");
-
-    } while (keepOnReading);
+    readAllStrings(file);
 
     CFLog(VERBOSE, "FileReader::readFromFile() => 2\n");    
     (*fhandle)->close();
@@ -90,6 +79,42 @@ void FileReader::readFromFile(const boost::filesystem::path& filepath)
 
 //////////////////////////////////////////////////////////////////////////////
 
+void FileReader::readFromBuffer(const std::string& buffer)
+{
+  CFAUTOTRACE;
+  
+  CFLog(VERBOSE, "FileReader::readFromBuffer() => start\n");
+  
+  m_readCount = 0;
+  do {
+    std::istringstream file(buffer);
+    
+    m_readAgain = false;
+    readAllStrings(file);
+    m_readCount++;
+  } while (m_readAgain);
+  
+  finish();
+  CFLog(VERBOSE, "FileReader::readFromBuffer() => end\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void FileReader::readAllStrings(std::istream& file)
+{
+  const CFuint MAXLINESINFILE = std::numeric_limits<CFuint>::max()-1;
+  bool keepOnReading = true;
+  CFuint linesRead = 0;
+  do {
+    keepOnReading = readString(file);
+    if (++linesRead > MAXLINESINFILE)
+      throw BadFormatException (FromHere(),"File too long, probably misformatted."
+				"\nSee void FileReader::readFromFile for more info\n");
+  } while (keepOnReading);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void FileReader::finish()
 {
 }
@@ -43,6 +43,10 @@ public: // functions
   /// @throw Common::FilesystemException
   virtual void readFromFile(const boost::filesystem::path& filepath);
 
+  /// Read the given buffer, holding the content of a file already in memory.
+  /// This is a template method
+  virtual void readFromBuffer(const std::string& buffer);
+
   /// Gets the file extension to append to the file name
   virtual const std::string getReaderFileExtension() const = 0;
  
@@ -55,7 +59,10 @@ public: // functions
 protected: // functions
   
   /// Read a string
-  virtual bool readString(std::ifstream& file) {return false;}
+  virtual bool readString(std::istream& file) {return false;}
+  
+  /// Read all the strings of the given stream, calling readString()
+  void readAllStrings(std::istream& file);
   
   /// Get the name of the reader
   virtual const std::string getReaderName() const = 0;
@@ -4,6 +4,8 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <sstream>
+
 #include "Framework/FileWriter.hh"
 #include "Common/CFLog.hh"
 #include "Environment/FileHandlerOutput.hh"
@@ -48,6 +50,17 @@ void FileWriter::writeToFile(const boost::filesystem::path& filepath)
   delete fhandle;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+void FileWriter::writeToBuffer(std::string& buffer)
+{
+  CFAUTOTRACE;
+
+  std::ostringstream out;
+  writeToFileStream(out);
+  buffer = out.str();
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
@@ -42,6 +42,10 @@ public:
   /// @throw Common::FilesystemException
   virtual void writeToFile(const boost::filesystem::path& filepath);
   
+  /// Writes the content of the file in the given buffer in memory
+  /// instead of on disk
+  virtual void writeToBuffer(std::string& buffer);
+  
   /// Gets the file extension to append to the file name
   virtual const std::string getWriterFileExtension() const = 0;
 
@@ -49,7 +53,7 @@ protected:
 
   /// Write the given file. This is an pure abstract method
   /// @throw Common::FilesystemException
-  virtual void writeToFileStream(std::ofstream& fout) 
+  virtual void writeToFileStream(std::ostream& fout) 
   {
     throw Common::NotImplementedException (FromHere(),"FileWriter::writeToFileStream()");
   }
@@ -9,7 +9,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include "Common/DemangledTypeID.hh"
 #include "Framework/GeometricEntity.hh"
+#include "Framework/BaseGeometricEntityProvider.hh"
+#include "Framework/MemoryRegistry.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -31,6 +34,8 @@ namespace COOLFluiD {
 /// client code (Method, NumericalCommand or other class) that can select
 /// therefore how to build ad-hoc GeometricEntity's in the most efficient
 /// way.
+/// Once set up, the pool reports to the MemoryRegistry the size of its
+/// builder and of the GeometricEntity's created during the set up.
 /// The building steps for a GeometricEntity are the following:
 /// 1. getDataGE() to get and set the GE_BUILDER::GeoData used by the builder
 /// 2. buildGE()   to build the GeometricEntity based on current GE_BUILDER::GeoData
@@ -45,25 +50,39 @@ namespace COOLFluiD {
 /// @author Andrea Lani
 /// @author Tiago Quintino
 template <class GEOBUILDER>
-class GeometricEntityPool {
+class GeometricEntityPool : public MemorySource {
 public:
 
   /// Constructor
-  GeometricEntityPool() : m_geBuilder() {}
+  GeometricEntityPool() : m_geBuilder(), m_geBytes(0.) {}
 
   /// Default destructor (this class should not be overriden)
-  ~GeometricEntityPool() {}
+  ~GeometricEntityPool()
+  {
+    MemoryRegistry::getInstance().unregisterSource(this);
+  }
 
   /// Set up the pool
-  void setup()   {  m_geBuilder.setup(); }
+  void setup()
+  {
+    const CFdouble bytes = BaseGeometricEntityProvider::getCreatedBytes();
+    m_geBuilder.setup();
+    registerMemory(bytes);
+  }
 
   /// Set up the pool
-  void unsetup() {  m_geBuilder.unsetup(); }
+  void unsetup()
+  {
+    MemoryRegistry::getInstance().unregisterSource(this);
+    m_geBuilder.unsetup();
+  }
 
   /// Set up the pool in a different namespace
   void setupInNamespace(const std::string& namespaceName)
   {
+    const CFdouble bytes = BaseGeometricEntityProvider::getCreatedBytes();
     m_geBuilder.setupInNamespace(namespaceName);
+    registerMemory(bytes);
   }
 
   /// Get the data of the GeometricEntity builder.
@@ -82,11 +101,31 @@ public:
   /// Get a SafePtr to the GeoBuilder
   Common::SafePtr<GEOBUILDER> getGeoBuilder() { return &m_geBuilder; }
 
+  /// Add the memory of this pool to the registry
+  void reportMemory(MemoryRegistry& registry) const
+  {
+    registry.add(MemoryRegistry::GEOENTITY_POOL,
+                 DEMANGLED_TYPEID(GEOBUILDER), sizeof(GEOBUILDER) + m_geBytes);
+  }
+
+private: // helper functions
+
+  /// Register this pool, which has allocated the GeometricEntity's
+  /// created since the given number of created bytes
+  void registerMemory(const CFdouble createdBytes)
+  {
+    m_geBytes = BaseGeometricEntityProvider::getCreatedBytes() - createdBytes;
+    MemoryRegistry::getInstance().registerSource(this);
+  }
+
 private: //data
 
   /// Geometric entity builder
   GEOBUILDER m_geBuilder;
 
+  /// number of bytes of the GeometricEntity's created during the set up
+  CFdouble m_geBytes;
+
 }; // end of class GeometricEntityPool
 
 //////////////////////////////////////////////////////////////////////////////
@@ -56,6 +56,7 @@ public:
   /// @param nodes  list of the nodes to be put in the new GeometricEntity
   GeometricEntity* create ()
   {
+    addCreatedBytes(sizeof(GEOENTTYPE<GEO_SHAPE_FUNCTION,SOL_SHAPE_FUNCTION>));
     return new GEOENTTYPE<GEO_SHAPE_FUNCTION,SOL_SHAPE_FUNCTION>();
   }
 
@@ -52,7 +52,7 @@ public:
   /// @return if the object has been indexed.
   bool isIndexed() const
   {
-    return (_localID != NO_INDEX && _globalID != NO_INDEX);
+    return (_localID != NO_INDEX && _globalID != NO_GLOBAL_INDEX);
   }
 
   /// missing documentation
@@ -65,14 +65,14 @@ public:
 
   /// missing documentation
   /// @return the ID of this IndexedObject.
-  std::pair<CFuint, CFuint> getID() const
+  std::pair<CFuint, CFgid> getID() const
   {
-    return std::pair<CFuint, CFuint>(getLocalID(),getGlobalID());
+    return std::pair<CFuint, CFgid>(getLocalID(),getGlobalID());
   }
 
   /// missing documentation
   ///@return the Global ID of this IndexedObject.
-  CFuint getGlobalID() const
+  CFgid getGlobalID() const
   {
     cf_assert (hasGlobalID());
     return _globalID ;
@@ -81,16 +81,16 @@ public:
   /// Set the Global ID of this IndexedObject.
   /// The local ID's are handed out by an IndexList,
   /// the Global ID's we can choose.
-  void setGlobalID(const CFuint id)
+  void setGlobalID(const CFgid id)
   {
-    cf_assert (id!=NO_INDEX);
+    cf_assert (id!=NO_GLOBAL_INDEX);
     _globalID = id;
   }
 
   /// Check if a global index was set
   bool hasGlobalID () const
   {
-    return _globalID != NO_INDEX;
+    return _globalID != NO_GLOBAL_INDEX;
   }
 
   /// check if a local index was set
@@ -112,11 +112,14 @@ private:
   CFuint _localID;
 
   /// The global index
-  CFuint _globalID;
+  CFgid _globalID;
 
   /// This value means there was no index given to this object
   static const CFuint NO_INDEX;
 
+  /// This value means there was no global index given to this object
+  static const CFgid NO_GLOBAL_INDEX;
+
 }; // end of class IndexedObject
 
 //////////////////////////////////////////////////////////////////////////////
@@ -124,6 +127,9 @@ private:
 template <typename TYPE>
 const CFuint IndexedObject<TYPE>::NO_INDEX = std::numeric_limits<CFuint>::max();
 
+template <typename TYPE>
+const CFgid IndexedObject<TYPE>::NO_GLOBAL_INDEX = std::numeric_limits<CFgid>::max();
+
 //////////////////////////////////////////////////////////////////////////////
 
   } // namespace Framework
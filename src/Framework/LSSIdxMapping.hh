@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include <valarray>
+#include <limits>
 
 #include "Common/COOLFluiD.hh"
 #include "Common/NonCopyable.hh"
@@ -60,13 +61,20 @@ public:
   }
 
 
-  void createMapping(const std::valarray<CFuint>& globalIDs,
+  /// Create a mapping from local IDs to global LSS IDs
+  /// @param globalIDs LSS IDs of all the points (CFuint or CFgid), which must
+  ///                  fit in the CFuint storage of the mapping
+  template <typename ID>
+  void createMapping(const std::valarray<ID>& globalIDs,
       const std::valarray<bool>& isNonLocalRow)
   {
     
     const CFuint nbPoints = globalIDs.size();
     _localToLSSIDs.resize(nbPoints);
-    _localToLSSIDs = globalIDs;
+    for (CFuint i = 0; i < nbPoints; ++i) {
+      cf_assert(globalIDs[i] <= static_cast<ID>(std::numeric_limits<CFuint>::max()));
+      _localToLSSIDs[i] = static_cast<CFuint>(globalIDs[i]);
+    }
  //   CFLog(NOTICE,"createMapping size " << nbPoints << "\n");
     // in the sequential case all rows are locally owned
     _isNonLocalRow.resize(nbPoints);
@@ -11,13 +11,27 @@ namespace COOLFluiD {
 
 //////////////////////////////////////////////////////////////////////////////
 
-LSSMatrix::LSSMatrix() : m_useGPU(false) 
+LSSMatrix::LSSMatrix() : m_useGPU(false), m_name("LSSMatrix")
 {
+  MemoryRegistry::getInstance().registerSource(this);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-LSSMatrix::~LSSMatrix() {}
+LSSMatrix::~LSSMatrix()
+{
+  MemoryRegistry::getInstance().unregisterSource(this);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void LSSMatrix::reportMemory(MemoryRegistry& registry) const
+{
+  const CFdouble bytes = getMemoryBytes();
+  if (bytes > 0.) {
+    registry.add(MemoryRegistry::LSS_MATRIX, m_name, bytes);
+  }
+}
 
 //////////////////////////////////////////////////////////////////////////////
 
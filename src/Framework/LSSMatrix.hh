@@ -13,6 +13,7 @@
 #include "Common/NonCopyable.hh"
 
 #include "Framework/Framework.hh"
+#include "Framework/MemoryRegistry.hh"
 
 #ifdef CF_HAVE_MPI
 #  include <mpi.h>
@@ -32,7 +33,8 @@ namespace COOLFluiD {
 /// This class represents an abstract Linear System Solver Matrix
 /// @author Andrea Lani
 /// @author Tiago Quintino
-class Framework_API LSSMatrix : public Common::NonCopyable<LSSMatrix> {
+class Framework_API LSSMatrix : public MemorySource,
+                                 public Common::NonCopyable<LSSMatrix> {
 public:
 
   enum LSSMatrixAssemblyType {FLUSH_ASSEMBLY, FINAL_ASSEMBLY};
@@ -45,6 +47,9 @@ public:
  
   /// use GPU support
   void setGPU(bool useGPU) {m_useGPU = useGPU;}
+
+  /// Set the name under which the memory of this matrix is reported
+  void setName(const std::string& name) {m_name = name;}
   
   /// Create a sequential sparse matrix
   virtual void createSeqAIJ(const CFint m,
@@ -165,6 +170,13 @@ public:
   /// locations
   virtual void freezeNonZeroStructure() = 0;
 
+  /// @return the number of bytes allocated by this matrix on this rank
+  ///         (0 if it is not known)
+  virtual CFdouble getMemoryBytes() const {return 0.;}
+
+  /// Add the memory of this matrix to the registry
+  void reportMemory(MemoryRegistry& registry) const;
+
 private:
 
   /// Copy constructor
@@ -177,6 +189,9 @@ protected:
   
   /// set on GPU
   bool m_useGPU;
+
+  /// name under which the memory of this matrix is reported
+  std::string m_name;
   
 }; // end of class LSSMatrix
 
@@ -4,10 +4,13 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include "Common/BenchmarkTimers.hh"
+
 #include "Framework/LinearSystemSolver.hh"
 #include "Framework/PhysicalModel.hh"
 #include "Framework/NamespaceSwitcher.hh"
 #include "Framework/LSSData.hh"
+#include "Framework/LSSMatrix.hh"
 #include "Framework/SubSystemStatus.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -79,6 +82,9 @@ void LinearSystemSolver::setMethodImpl()
   if (getMethodData().isNotNull()) {
     m_lssData = getMethodData().d_castTo<LSSData>();
   }
+  
+  // the matrices of the different LSS are told apart in the memory report
+  getMatrix()->setName(getName() + "/LSSMatrix");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -135,6 +141,7 @@ void LinearSystemSolver::solveSys()
 
   pushNamespace();
 
+  Common::BenchmarkTimers::Scope timer("LinearSystemSolver");
   solveSysImpl();
 
   popNamespace();
@@ -251,7 +251,7 @@ std::string MapGeoEnt::identifyGeoEntTecplot(const CFuint nbNodes,
 
 //////////////////////////////////////////////////////////////////////////////
 
-void MapGeoEnt::writeTecplotGeoEntConn(ofstream& file,
+void MapGeoEnt::writeTecplotGeoEntConn(ostream& file,
                std::valarray<CFuint>& nodeIDs,
                const CFuint geoOrder,
                const CFuint dim)
@@ -51,7 +51,7 @@ public:
   /// Writes the element connectivity into Tecplot format.
   /// This is used to circunvent the fact that Tecplot
   /// only knows about Tetrahedra and Bricks (Hexahedra) in 3D
-  static void writeTecplotGeoEntConn(std::ofstream& file,
+  static void writeTecplotGeoEntConn(std::ostream& file,
     		     std::valarray<CFuint>& nodeIDs,
     		     const CFuint geoOrder,
     		     const CFuint dim);
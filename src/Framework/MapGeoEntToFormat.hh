@@ -58,7 +58,7 @@ public: // interface functions
   /// Useful to circunvent the fact that different formats
   /// have different element numberings.
   virtual
-  void writeGeoEntConn(std::ofstream& file,
+  void writeGeoEntConn(std::ostream& file,
     		               std::valarray<CFuint>& stateIDs,
     		               const GeoEntityInfo& geoinfo) = 0;
 
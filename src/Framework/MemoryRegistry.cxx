@@ -0,0 +1,235 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include "Common/BenchmarkTimers.hh"
+#include "Common/PE.hh"
+#include "Common/OSystem.hh"
+#include "Common/ProcessInfo.hh"
+
+#include "MathTools/ArrayAllocCounter.hh"
+
+#include "Environment/DirPaths.hh"
+#include "Environment/FileHandlerOutput.hh"
+#include "Environment/SingleBehaviorFactory.hh"
+
+#include "Framework/MemoryRegistry.hh"
+#include "Framework/PathAppender.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace COOLFluiD::Common;
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// @return the number of heap allocations of RealVector and RealMatrix
+static CFuint getNbArrayHeapAllocs()
+{
+  return MathTools::ArrayAllocCounter::getNbHeapAllocs();
+}
+
+/// @return true if the first entry is larger than the second one
+template <class ENTRY>
+static bool isLarger(const ENTRY& a, const ENTRY& b)
+{
+  return a.bytes > b.bytes;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryRegistry& MemoryRegistry::getInstance()
+{
+  static MemoryRegistry registry;
+  return registry;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryRegistry::MemoryRegistry() :
+  m_sources(),
+  m_entries(),
+  m_totals(NB_CATEGORIES, 0.)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+MemoryRegistry::~MemoryRegistry()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::registerSource(const MemorySource* source)
+{
+  cf_assert(source != CFNULL);
+  if (std::find(m_sources.begin(), m_sources.end(), source) == m_sources.end()) {
+    m_sources.push_back(source);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::unregisterSource(const MemorySource* source)
+{
+  std::vector<const MemorySource*>::iterator itr =
+    std::find(m_sources.begin(), m_sources.end(), source);
+  if (itr != m_sources.end()) {
+    m_sources.erase(itr);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::add(const Category category, const std::string& name,
+			 const CFdouble bytes)
+{
+  cf_assert(category < NB_CATEGORIES);
+  Entry entry;
+  entry.category = category;
+  entry.name = name;
+  entry.bytes = bytes;
+  m_entries.push_back(entry);
+  m_totals[category] += bytes;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::enablePhaseTracking()
+{
+  BenchmarkTimers::getInstance().enableMemoryTracking
+    (MathTools::ArrayAllocCounter::isEnabled() ? &getNbArrayHeapAllocs : CFNULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::string MemoryRegistry::getCategoryName(const CFuint category)
+{
+  switch (category) {
+  case DATA_SOCKET:    return "DataSocket";
+  case CONNECTIVITY:   return "ConnectivityTable";
+  case GEOENTITY_POOL: return "GeometricEntityPool";
+  case LSS_MATRIX:     return "LSSMatrix";
+  }
+  return "Total";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::report(const std::string& title, const std::string& nspName)
+{
+  m_entries.clear();
+  m_totals.assign(NB_CATEGORIES, 0.);
+  for (CFuint i = 0; i < m_sources.size(); ++i) {
+    m_sources[i]->reportMemory(*this);
+  }
+  std::stable_sort(m_entries.begin(), m_entries.end(), isLarger<Entry>);
+
+  writeRankReport(title);
+
+  // aggregate over the ranks: the categories, their sum, the process memory
+  // and the high-water mark (peak RSS) of the timed phases
+  const BenchmarkTimers& timers = BenchmarkTimers::getInstance();
+  const std::vector<CFdouble>& phaseMemory = timers.getMaxMemory();
+  
+  std::vector<CFdouble> local(NB_CATEGORIES + 3, 0.);
+  for (CFuint c = 0; c < NB_CATEGORIES; ++c) {
+    local[c] = m_totals[c];
+    local[NB_CATEGORIES] += m_totals[c];
+  }
+  local[NB_CATEGORIES+1] = OSystem::getInstance().getProcessInfo()->memoryUsageBytes();
+  for (CFuint p = 0; p < phaseMemory.size(); ++p) {
+    local[NB_CATEGORIES+2] = std::max(local[NB_CATEGORIES+2], phaseMemory[p]);
+  }
+  
+  std::vector<CFdouble> minValues = local;
+  std::vector<CFdouble> maxValues = local;
+  std::vector<CFdouble> sumValues = local;
+  CFuint nbRanks = 1;
+#ifdef CF_HAVE_MPI
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nspName);
+  const int count = local.size();
+  MPI_Allreduce(&local[0], &minValues[0], count, MPI_DOUBLE, MPI_MIN, comm);
+  MPI_Allreduce(&local[0], &maxValues[0], count, MPI_DOUBLE, MPI_MAX, comm);
+  MPI_Allreduce(&local[0], &sumValues[0], count, MPI_DOUBLE, MPI_SUM, comm);
+  nbRanks = PE::GetPE().GetProcessorCount(nspName);
+#endif
+  
+  const CFdouble MB = 1024.*1024.;
+  CFLog(INFO, "Memory report [" << title << "] over " << nbRanks << " rank(s), in MB\n");
+  CFLog(INFO, setw(22) << "" << setw(12) << "min" << setw(12) << "max" << setw(12) << "total" << "\n");
+  for (CFuint i = 0; i < local.size(); ++i) {
+    if (i == NB_CATEGORIES+2 && !timers.isMemoryTracked()) break;
+    const std::string name = (i <= NB_CATEGORIES) ? getCategoryName(i) :
+      ((i == NB_CATEGORIES+1) ? "Process" : "PhasesHighWaterMark");
+    CFLog(INFO, setw(22) << name << fixed << setprecision(1)
+	  << setw(12) << minValues[i]/MB << setw(12) << maxValues[i]/MB
+	  << setw(12) << sumValues[i]/MB << "\n");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MemoryRegistry::writeRankReport(const std::string& title) const
+{
+  using namespace boost::filesystem;
+  
+  static bool isFirstReport = true;
+  path fpath = Environment::DirPaths::getInstance().getResultsDir() /
+    PathAppender::getInstance().appendParallel("memory.txt");
+  
+  SelfRegistPtr<Environment::FileHandlerOutput>* fhandle = 
+    Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().createPtr();
+  ofstream& fout = (*fhandle)->open(fpath, isFirstReport ? ios_base::out : ios_base::app);
+  isFirstReport = false;
+  
+  const CFdouble MB = 1024.*1024.;
+  fout << "### Memory report [" << title << "] of rank "
+       << PE::GetPE().GetRank("Default") << ", in MB\n";
+  fout << fixed << setprecision(3);
+  for (CFuint c = 0; c < NB_CATEGORIES; ++c) {
+    fout << setw(22) << getCategoryName(c) << setw(14) << m_totals[c]/MB << "\n";
+  }
+  fout << setw(22) << "Process" << setw(14)
+       << OSystem::getInstance().getProcessInfo()->memoryUsageBytes()/MB << "\n";
+  
+  fout << "# objects\n";
+  for (CFuint i = 0; i < m_entries.size(); ++i) {
+    fout << setw(22) << getCategoryName(m_entries[i].category) << setw(14)
+	 << m_entries[i].bytes/MB << "  " << m_entries[i].name << "\n";
+  }
+  
+  const BenchmarkTimers& timers = BenchmarkTimers::getInstance();
+  if (timers.isMemoryTracked()) {
+    fout << "# phases: peak RSS at the end of the phase, heap allocations of RealVector/RealMatrix\n";
+    for (CFuint p = 0; p < timers.getNames().size(); ++p) {
+      fout << setw(22) << timers.getNames()[p] << setw(14) << timers.getMaxMemory()[p]/MB
+	   << setw(14) << timers.getNbPhaseAllocs()[p] << "\n";
+    }
+  }
+  fout << "\n";
+  
+  (*fhandle)->close();
+  delete fhandle;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
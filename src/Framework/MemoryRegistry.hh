@@ -0,0 +1,126 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_Framework_MemoryRegistry_hh
+#define COOLFluiD_Framework_MemoryRegistry_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "Common/NonCopyable.hh"
+#include "Framework/Framework.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace Framework {
+
+    class MemoryRegistry;
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class is the interface of the objects which report the memory they
+/// own to the MemoryRegistry
+class Framework_API MemorySource {
+public:
+
+  /// Destructor
+  virtual ~MemorySource() {}
+
+  /// Add the memory owned by this object to the registry
+  virtual void reportMemory(MemoryRegistry& registry) const = 0;
+
+}; // end of class MemorySource
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class collects the memory footprint of the main data structures
+/// (DataSocket storages, ConnectivityTable's, GeometricEntityPool's and
+/// LSSMatrix's) and writes reports of it:
+/// - per rank, in the file memory-P<rank>.txt of the results directory,
+///   listing every object;
+/// - aggregated over the ranks in the log, with the minimum, maximum and
+///   total of each category and of the process memory.
+/// The objects register themselves as MemorySource's and are only asked
+/// for their size when a report is made, so that the registry costs nothing
+/// in between.
+class Framework_API MemoryRegistry : public Common::NonCopyable<MemoryRegistry> {
+public:
+
+  /// categories of the reported memory
+  enum Category {DATA_SOCKET=0, CONNECTIVITY, GEOENTITY_POOL, LSS_MATRIX, NB_CATEGORIES};
+
+  /// @return the single instance of this class
+  static MemoryRegistry& getInstance();
+
+  /// Register an object owning memory
+  void registerSource(const MemorySource* source);
+
+  /// Unregister an object owning memory (does nothing if it was not registered)
+  void unregisterSource(const MemorySource* source);
+
+  /// Add an object to the report being made
+  /// @param category  category of the object
+  /// @param name      name of the object
+  /// @param bytes     number of bytes owned by the object
+  void add(const Category category, const std::string& name, const CFdouble bytes);
+
+  /// Collect the memory of all the sources and write the reports
+  /// @param title    title of the report (e.g. "setup", "iteration 100")
+  /// @param nspName  name of the namespace whose ranks take part in the report
+  void report(const std::string& title, const std::string& nspName);
+
+  /// Enable the tracking of the memory high-water mark and of the number of
+  /// RealVector/RealMatrix heap allocations of the timed phases, which are
+  /// then added to the reports
+  void enablePhaseTracking();
+
+private:
+
+  /// Constructor
+  MemoryRegistry();
+
+  /// Destructor
+  ~MemoryRegistry();
+
+  /// @return the name of the given category
+  static std::string getCategoryName(const CFuint category);
+
+  /// Write the report of this rank
+  void writeRankReport(const std::string& title) const;
+
+private:
+
+  /// entry of a report
+  struct Entry {
+    Category category;
+    std::string name;
+    CFdouble bytes;
+  };
+
+  /// registered objects
+  std::vector<const MemorySource*> m_sources;
+
+  /// entries of the report being made
+  std::vector<Entry> m_entries;
+
+  /// total of each category in the report being made
+  std::vector<CFdouble> m_totals;
+
+}; // end of class MemoryRegistry
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace Framework
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_Framework_MemoryRegistry_hh
@@ -4,6 +4,7 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include "Common/BenchmarkTimers.hh"
 #include "Common/ProcessInfo.hh"
 #include "Common/OSystem.hh"
 #include "Common/BadValueException.hh"
@@ -88,7 +89,10 @@ void MeshCreator::generateMeshData()
   CFLog(NOTICE,"MeshCreator [" << getName() << "] Generate or Read Mesh\n");
   CFLog(NOTICE,"\nMemory usage before building mesh: " << Common::OSystem::getInstance().getProcessInfo()->memoryUsage() << "\n\n");
 
-  generateMeshDataImpl();
+  {
+    Common::BenchmarkTimers::Scope timer("MeshReading");
+    generateMeshDataImpl();
+  }
 
   CFLog(NOTICE,"\nMemory usage after building mesh: " << Common::OSystem::getInstance().getProcessInfo()->memoryUsage() << "\n");
   CFLog(NOTICE,"-------------------------------------------------------------\n");
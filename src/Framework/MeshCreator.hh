@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "Common/CFMap.hh"
+#include "Common/NotImplementedException.hh"
 #include "Environment/ConcreteProvider.hh"
 #include "Framework/Method.hh"
 #include "Framework/MultiMethodHandle.hh"
@@ -74,6 +75,13 @@ public: // methods
 
   /// Modify the filename of the Mesh
   virtual void modifyFileName(const std::string filename) = 0;
+
+  /// Set a buffer in memory holding the CFmesh content to read instead of
+  /// the file, or CFNULL to read the file again
+  virtual void setMeshBuffer(Common::SafePtr<const std::string> buffer)
+  {
+    throw Common::NotImplementedException (FromHere(),"MeshCreator::setMeshBuffer()");
+  }
   
   /// Run the function defined by the function name
   /// @param func name of the function to run. It should be void function with nor parameters.
@@ -76,6 +76,8 @@ MeshData::MeshData(const std::string& name) :
 
   m_domainmodel_str = "Null";
   setParameter("DomainModel",&m_domainmodel_str);
+
+  MemoryRegistry::getInstance().registerSource(this);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -84,11 +86,29 @@ MeshData::~MeshData()
 {
   CFAUTOTRACE;
 
+  MemoryRegistry::getInstance().unregisterSource(this);
   deallocate();
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+void MeshData::reportMemory(MemoryRegistry& registry) const
+{
+  const std::string prefix = getName() + "/";
+  if (m_dataStorage != CFNULL) {
+    m_dataStorage->reportMemory(registry, prefix);
+  }
+
+  typedef Common::GeneralStorage<ConnTable>::const_iterator ConnIterator;
+  for (ConnIterator itr = m_connectivityStorage.begin();
+       itr != m_connectivityStorage.end(); ++itr) {
+    registry.add(MemoryRegistry::CONNECTIVITY, prefix + itr->first,
+                 itr->second->getMemoryBytes());
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void MeshData::configure ( Config::ConfigArgs& args )
 {
   CFAUTOTRACE;
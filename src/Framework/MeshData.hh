@@ -22,6 +22,7 @@
 #include "Framework/Storage.hh"
 #include "Framework/NamespaceGroup.hh"
 #include "Framework/NamespaceStack.hh"
+#include "Framework/MemoryRegistry.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -50,6 +51,7 @@ namespace COOLFluiD {
 class Framework_API MeshData :
     public NamespaceGroup,
     public Config::ConfigObject,
+    public MemorySource,
     public Common::NonCopyable<MeshData>
 {
 
@@ -294,6 +296,10 @@ public: // methods
   /// Default destructor
   ~MeshData();
 
+  /// Add the memory of the DataStorage and of the ConnectivityTable's
+  /// to the registry
+  void reportMemory(MemoryRegistry& registry) const;
+
 private: // methods
 
   /// Constructor
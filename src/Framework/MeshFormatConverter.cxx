@@ -4,6 +4,8 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <sstream>
+
 #include "Framework/MeshFormatConverter.hh"
 #include "Common/Stopwatch.hh"
 #include "Environment/FileHandlerInput.hh"
@@ -82,6 +84,41 @@ void MeshFormatConverter::convert(const boost::filesystem::path& fromFilepath,
     Environment::SingleBehaviorFactory<Environment::FileHandlerOutput>::getInstance().createPtr();
   ofstream& fout = (*fhandle)->open(filepath);
   
+  writeCFmesh(fout);
+
+  stp.stop();
+  (*fhandle)->close();
+
+  delete fhandle;
+  CFLog(INFO, "Conversion " << this->getName()<< " took: " << stp.read() << "s\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MeshFormatConverter::convertToBuffer(const boost::filesystem::path& fromFilepath,
+					  std::string& buffer)
+{
+  CFAUTOTRACE;
+
+  Stopwatch<WallTime> stp;
+  stp.start();
+
+  // only reads if not yet been read
+  readFiles(fromFilepath);
+  adjustToCFmeshNodeNumbering();
+
+  std::ostringstream out;
+  writeCFmesh(out);
+  buffer = out.str();
+
+  stp.stop();
+  CFLog(INFO, "Conversion " << this->getName()<< " in memory took: " << stp.read() << "s\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void MeshFormatConverter::writeCFmesh(std::ostream& fout)
+{
   // AL: Those info make the CFmesh file version-dependent, can create problems with regression testing 
   fout << "!COOLFLUID_VERSION "    << Environment::CFEnv::getInstance().getCFVersion() << "\n";
   // this can fail if there are problems with SVN
@@ -112,12 +149,6 @@ void MeshFormatConverter::convert(const boost::filesystem::path& fromFilepath,
     writeContinuousStates(fout);
   }
   fout << "!END" << "\n";
-
-  stp.stop();
-  (*fhandle)->close();
-
-  delete fhandle;
-  CFLog(INFO, "Conversion " << this->getName()<< " took: " << stp.read() << "s\n");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,13 @@ public: // functions
   virtual void convert(const boost::filesystem::path& fromFilepath,
                        const boost::filesystem::path& filepath);
 
+  /// Converts data from the file format to CFmesh, writing the result
+  /// in the given buffer in memory instead of in a file
+  /// @param fromFilepath name of the file to convert from
+  /// @param buffer string where to write the CFmesh content
+  virtual void convertToBuffer(const boost::filesystem::path& fromFilepath,
+                               std::string& buffer);
+
   /// Gets the target file extention.
   virtual std::string getTargetExtension() const
   {
@@ -132,29 +139,32 @@ protected: // functions
   virtual void adjustToCFmeshNodeNumbering() = 0;
 
   /// Write in the COOLFluiD format the element list for a FEM mesh
-  virtual void writeContinuousElements(std::ofstream& fout) {}
+  virtual void writeContinuousElements(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the state list for a FEM mesh
-  virtual void writeContinuousStates(std::ofstream& fout) {}
+  virtual void writeContinuousStates(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the Topological Region Set data
   /// considering to have FEM
-  virtual void writeContinuousTrsData(std::ofstream& fout) {}
+  virtual void writeContinuousTrsData(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the mesh data considering
   /// to have cell center FVM
-  virtual void writeDiscontinuousElements(std::ofstream& fout) {}
+  virtual void writeDiscontinuousElements(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the Topological Region Set data
   /// considering to have FVM
-  virtual void writeDiscontinuousTrsData(std::ofstream& fout) {}
+  virtual void writeDiscontinuousTrsData(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the state list for a
   /// cell centered FVM mesh
-  virtual void writeDiscontinuousStates(std::ofstream& fout) {}
+  virtual void writeDiscontinuousStates(std::ostream& fout) {}
 
   /// Write in the COOLFluiD format the node list
-  virtual void writeNodes(std::ofstream& fout) {}
+  virtual void writeNodes(std::ostream& fout) {}
+
+  /// Write the converted mesh in the COOLFluiD format
+  void writeCFmesh(std::ostream& fout);
 
 private: // data
 
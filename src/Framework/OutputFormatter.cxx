@@ -4,9 +4,21 @@
 // GNU Lesser General Public License version 3 (LGPLv3).
 // See doc/lgpl.txt and doc/gpl.txt for the license text.
 
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/convenience.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "Common/BenchmarkTimers.hh"
+#include "Common/PE.hh"
+#include "Common/StringOps.hh"
+#ifdef CF_HAVE_MPI
+#include "Common/MPI/MPIStructDef.hh"
+#endif
 
 #include "Framework/OutputFormatter.hh"
+#include "Framework/OutputFormatterData.hh"
 #include "Environment/DirPaths.hh"
 #include "Framework/SubSystemStatus.hh"
 #include "Framework/SimulationStatus.hh"
@@ -24,6 +36,117 @@ namespace COOLFluiD {
 
 //////////////////////////////////////////////////////////////////////////////
 
+/// Writes an output in background: the snapshot formatted in memory and the
+/// parts of the file written in memory by this processor, if any, are
+/// written to their files in the results directory, then the files of the
+/// output written in the staging directory, if any, are moved there.
+/// It runs in a separate thread and therefore does not log: the error, if
+/// any, is returned in the given string.
+class OutputTransfer {
+public:
+  
+  OutputTransfer(const std::string& snapshot,
+		 const boost::filesystem::path& snapshotPath,
+		 const SparseFileBuffer& sparse,
+		 const boost::filesystem::path& sparsePath,
+		 const std::streamoff sparseFileSize,
+		 const boost::filesystem::path& stagingPath,
+		 const boost::filesystem::path& resultsPath,
+		 const std::string& outputName,
+		 std::string& error) :
+    m_snapshot(snapshot),
+    m_snapshotPath(snapshotPath),
+    m_sparse(sparse),
+    m_sparsePath(sparsePath),
+    m_sparseFileSize(sparseFileSize),
+    m_stagingPath(stagingPath),
+    m_resultsPath(resultsPath),
+    m_outputName(outputName),
+    m_error(error)
+  {
+  }
+  
+  void operator() ()
+  {
+    using namespace boost::filesystem;
+    
+    try {
+      if (!m_snapshotPath.empty()) {
+	const path target = m_resultsPath / m_snapshotPath.leaf();
+	ofstream out(target.string().c_str(), ios::binary | ios::trunc);
+	out.write(m_snapshot.data(), m_snapshot.size());
+	if (!out) {
+	  m_error = "error while writing " + target.string();
+	  return;
+	}
+      }
+      
+      if (!m_sparsePath.empty()) {
+	// the other processors write their parts of the same file
+	const path target = m_resultsPath / m_sparsePath.leaf();
+	if (!m_sparse.writeTo(target.string())) {
+	  m_error = "error while writing " + target.string();
+	  return;
+	}
+	// a new file is cut to its size, in case it replaces a longer one
+	if (m_sparseFileSize >= 0) {
+	  resize_file(target, m_sparseFileSize);
+	}
+      }
+      
+      if (m_stagingPath.empty()) return;
+      
+      // the output file and the files derived from its name (e.g. the
+      // surface data) are moved, the staging directory being emptied
+      // after each output
+      vector<path> staged;
+      directory_iterator end;
+      for (directory_iterator itr(m_stagingPath); itr != end; ++itr) {
+	const std::string name = path(itr->path().leaf()).string();
+	if (!is_directory(itr->path()) && name.compare(0, m_outputName.size(), m_outputName) == 0) {
+	  staged.push_back(itr->path());
+	}
+      }
+      
+      for (CFuint i = 0; i < staged.size(); ++i) {
+	const path target = m_resultsPath / staged[i].leaf();
+	{
+	  ifstream in(staged[i].string().c_str(), ios::binary);
+	  ofstream out(target.string().c_str(), ios::binary | ios::trunc);
+	  if (!in || !out) {
+	    m_error = "cannot copy " + staged[i].string() + " to " + target.string();
+	    return;
+	  }
+	  // an empty file would set the failbit of the output stream
+	  if (in.peek() != ifstream::traits_type::eof()) {out << in.rdbuf();}
+	  if (!out) {
+	    m_error = "error while writing " + target.string();
+	    return;
+	  }
+	}
+	remove(staged[i]);
+      }
+    }
+    catch (std::exception& e) {
+      m_error = e.what();
+    }
+  }
+  
+private:
+  
+  const std::string& m_snapshot;
+  boost::filesystem::path m_snapshotPath;
+  const SparseFileBuffer& m_sparse;
+  boost::filesystem::path m_sparsePath;
+  std::streamoff m_sparseFileSize;
+  boost::filesystem::path m_stagingPath;
+  boost::filesystem::path m_resultsPath;
+  std::string m_outputName;
+  std::string& m_error;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
 void OutputFormatter::defineConfigOptions(Config::OptionList& options)
 {
   options.addConfigOption< std::string >("FileName","The name with extension of the file to write the output to.");
@@ -32,6 +155,8 @@ void OutputFormatter::defineConfigOptions(Config::OptionList& options)
   options.addConfigOption< bool >("AppendTime","Save each iteration to different file with suffix m_time#.");
   options.addConfigOption< bool >("AppendIter","Save each iteration to different file with suffix m_iter#.");
   options.addConfigOption< bool >("AppendRank","Append the processor rank to the file.");
+  options.addConfigOption< bool >("AsyncOutput","Format the output in memory and write it to the results directory in background (the writers using MPI-IO need AsyncStagingDir).");
+  options.addConfigOption< std::string >("AsyncStagingDir","Fast staging directory for AsyncOutput, for the writers that write the file themselves with MPI-IO, seen by all the processors writing the same file.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -56,7 +181,16 @@ void OutputFormatter::registActionListeners()
 
 //////////////////////////////////////////////////////////////////////////////
 
-OutputFormatter::OutputFormatter(const std::string& name) : Method(name)
+OutputFormatter::OutputFormatter(const std::string& name) :
+  Method(name),
+  m_stagingSlot(0),
+  m_stagingPath(),
+  m_isTransferRank(false),
+  m_isSyncWarned(false),
+  m_writeBuffer(),
+  m_sparseWriteBuffer(),
+  m_transfer(),
+  m_transferError()
 {
   // define which functions might be called dynamic
   build_dynamic_functions();
@@ -81,12 +215,26 @@ OutputFormatter::OutputFormatter(const std::string& name) : Method(name)
   
   m_appendRank = true;
   setParameter("AppendRank",&m_appendRank);
+  
+  m_asyncOutput = false;
+  setParameter("AsyncOutput",&m_asyncOutput);
+  
+  m_stagingDirStr = "";
+  setParameter("AsyncStagingDir",&m_stagingDirStr);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 OutputFormatter::~OutputFormatter()
 {
+  // the last output must reach the results directory
+  if (m_transfer.get() != CFNULL) {
+    m_transfer->join();
+    if (!m_transferError.empty()) {
+      CFLog(ERROR, "OutputFormatter::~OutputFormatter() => asynchronous output failed: "
+	    << m_transferError << "\n");
+    }
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -112,12 +260,25 @@ void OutputFormatter::setMethodImpl()
   m_filename = boost::filesystem::basename(boost::filesystem::path(m_filenameStr));
 
   SubSystemStatusStack::getActive()->setAppendToFile(m_appendIter,m_appendTime);
+  
+  OutputFormatterData *const data = getOutputFormatterData();
+  if (data != CFNULL) {data->setAsyncOutput(m_asyncOutput);}
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
 void OutputFormatter::unsetMethodImpl()
 {
+  // the last output must reach the results directory
+  waitForTransfer();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+OutputFormatterData* OutputFormatter::getOutputFormatterData() const
+{
+  SafePtr<MethodData> data = getMethodData();
+  return (data.isNotNull()) ? dynamic_cast<OutputFormatterData*>(&(*data)) : CFNULL;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -140,6 +301,149 @@ void OutputFormatter::computeFullOutputName()
   fpath = PathAppender::getInstance().appendAllInfo(fpath, m_appendIter,m_appendTime,m_appendRank);
   m_fullOutputName = boost::filesystem::change_extension(fpath, getFormatExtension());
 }
+
+//////////////////////////////////////////////////////////////////////////////
+
+boost::filesystem::path OutputFormatter::getWritePath()
+{
+  CFAUTOTRACE;
+  
+  using namespace boost::filesystem;
+  
+  if (!m_asyncOutput || m_stagingDirStr.empty()) return m_fullOutputName;
+  
+  // the previous output may still be copied from the other staging buffer
+  
+  // the processors writing the same file must share the staging directory
+  // and only one of them copies the file
+  bool isSharedFile = false;
+  std::string slotName = getName() + "-slot" + StringOps::to_str(m_stagingSlot);
+  
+#ifdef CF_HAVE_MPI
+  const std::string nsp = getNamespace();
+  MPI_Comm comm = PE::GetPE().GetCommunicator(nsp);
+  const std::string fullName = m_fullOutputName.string();
+  CFuint hash = 0;
+  for (CFuint i = 0; i < fullName.size(); ++i) {
+    hash = 31*hash + static_cast<unsigned char>(fullName[i]);
+  }
+  CFuint minHash = 0;
+  CFuint maxHash = 0;
+  MPI_Allreduce(&hash, &minHash, 1, MPIStructDef::getMPIType(&hash), MPI_MIN, comm);
+  MPI_Allreduce(&hash, &maxHash, 1, MPIStructDef::getMPIType(&hash), MPI_MAX, comm);
+  isSharedFile = (minHash == maxHash) && (PE::GetPE().GetProcessorCount(nsp) > 1);
+  
+  const CFuint rank = PE::GetPE().GetRank(nsp);
+  if (!isSharedFile) {
+    slotName += "-P" + StringOps::to_str(rank);
+  }
+  m_isTransferRank = (!isSharedFile || rank == 0);
+#else
+  m_isTransferRank = true;
+#endif
+  
+  m_stagingPath = path(m_stagingDirStr) / path(slotName);
+  
+  if (m_isTransferRank || !isSharedFile) {
+    if (!exists(m_stagingPath)) {
+      if (!create_directories(m_stagingPath)) {
+	throw Common::FilesystemException
+	  (FromHere(), "Could not create staging directory " + m_stagingPath.string());
+      }
+    }
+    else if (!is_directory(m_stagingPath)) {
+      throw Common::FilesystemException
+	(FromHere(), "Staging path is not a directory: " + m_stagingPath.string());
+    }
+  }
+  
+#ifdef CF_HAVE_MPI
+  // the shared staging directory must exist before anybody opens the file
+  if (isSharedFile) {MPI_Barrier(comm);}
+#endif
+  
+  return m_stagingPath / m_fullOutputName.leaf();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void OutputFormatter::startTransfer()
+{
+  CFAUTOTRACE;
+  
+  // the previous output must be written before its buffers are reused:
+  // the formatting of this output has overlapped with its writing
+  waitForTransfer();
+  
+  boost::filesystem::path snapshotPath;
+  boost::filesystem::path sparsePath;
+  bool isNewSparseFile = false;
+  OutputFormatterData *const data = getOutputFormatterData();
+  if (data != CFNULL) {
+    data->swapSnapshot(m_writeBuffer, snapshotPath);
+    data->swapSparseSnapshot(m_sparseWriteBuffer, sparsePath, isNewSparseFile);
+  }
+  
+  // end of the file written in parts and flag telling if the output was
+  // kept in memory, over all the processors
+  long long int info[2];
+  info[0] = (sparsePath.empty()) ? 0 : m_sparseWriteBuffer.getEnd();
+  info[1] = (snapshotPath.empty() && sparsePath.empty()) ? 0 : 1;
+#ifdef CF_HAVE_MPI
+  if (PE::GetPE().IsParallel()) {
+    // this also makes sure that the previous output has been written by all
+    // the processors before its file is written again, and that all the
+    // parts of a shared staged file are written before the copy
+    long long int localInfo[2] = {info[0], info[1]};
+    MPI_Allreduce(localInfo, info, 2, MPIStructDef::getMPIType(&info[0]), MPI_MAX,
+		  PE::GetPE().GetCommunicator(getNamespace()));
+  }
+#endif
+  const std::streamoff sparseFileSize = (isNewSparseFile) ? info[0] : -1;
+  
+  if (info[1] == 0 && m_stagingDirStr.empty() && !m_isSyncWarned) {
+    CFLog(WARN, "OutputFormatter::startTransfer() => AsyncOutput has no effect on "
+	  << getName() << ": its writer writes the file itself, set AsyncStagingDir\n");
+    m_isSyncWarned = true;
+  }
+  
+  boost::filesystem::path stagingPath;
+  if (!m_stagingPath.empty()) {
+    if (m_isTransferRank) {stagingPath = m_stagingPath;}
+    m_stagingSlot = 1 - m_stagingSlot;
+    m_stagingPath = boost::filesystem::path();
+  }
+  
+  if (snapshotPath.empty() && sparsePath.empty() && stagingPath.empty()) return;
+  
+  const boost::filesystem::path resultsPath = m_fullOutputName.branch_path();
+  m_transferError = "";
+  m_transfer.reset
+    (new boost::thread(OutputTransfer(m_writeBuffer, snapshotPath, m_sparseWriteBuffer,
+				      sparsePath, sparseFileSize, stagingPath, resultsPath,
+				      boost::filesystem::basename(m_fullOutputName),
+				      m_transferError)));
+  CFLog(VERBOSE, "OutputFormatter::startTransfer() => " << m_fullOutputName.leaf()
+	<< " being written to " << resultsPath.string() << " in background\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void OutputFormatter::waitForTransfer()
+{
+  CFAUTOTRACE;
+  
+  if (m_transfer.get() == CFNULL) return;
+  
+  Common::BenchmarkTimers::Scope timer("OutputWait");
+  m_transfer->join();
+  m_transfer.reset();
+  
+  if (!m_transferError.empty()) {
+    throw Common::FilesystemException
+      (FromHere(), "OutputFormatter: asynchronous output failed: " + m_transferError);
+  }
+}
     
 //////////////////////////////////////////////////////////////////////////////
 
@@ -168,7 +472,10 @@ void OutputFormatter::write()
 
   pushNamespace();
 
+  Common::BenchmarkTimers::Scope timer("Output");
   writeImpl();
+  
+  if (m_asyncOutput) {startTransfer();}
 
   popNamespace();
 }
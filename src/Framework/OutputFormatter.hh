@@ -9,8 +9,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <memory>
 #include <boost/filesystem/path.hpp>
 
+#include "Common/SparseFileBuffer.hh"
 #include "Framework/Method.hh"
 #include "Environment/ConcreteProvider.hh"
 #include "Framework/MeshDataInputSource.hh"
@@ -20,16 +22,30 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+namespace boost { class thread; }
+
 namespace COOLFluiD {
 
   namespace Framework {
 
     class SubSystemStatusStack;
+    class OutputFormatterData;
 
 //////////////////////////////////////////////////////////////////////////////
 
 /// This class represents a OutputFormatter.
 /// This is an abstract class.
+/// In asynchronous mode (AsyncOutput), the writers going through
+/// OutputFormatterData::writeOutput() format the output in a snapshot in
+/// memory, which a background thread writes to the results directory while
+/// the iterations go on. The parallel writers using std streams write
+/// their parts of the file in memory (OutputFormatterData::openSparseSnapshot()),
+/// which each processor writes in background at their positions in the file.
+/// The writers using MPI-IO can only write in a fast staging directory
+/// (AsyncStagingDir), from which the background thread moves the files:
+/// without it, they write synchronously and a warning is given. Two buffers
+/// are used alternately: the next output is formatted while the previous one
+/// is written, and waits for it only before being written in turn.
 /// @author Tiago Quintino
 class Framework_API OutputFormatter : public Method,
                     public Common::DynamicFunctionCaller<OutputFormatter> {
@@ -124,6 +140,22 @@ protected: // helper methods
   /// Computes the m_fullOutputName and sets it
   virtual void computeFullOutputName();
   
+  /// @return the path where the writer must write the output: the full
+  ///         output name or, with a staging directory, its staged copy
+  /// @pre computeFullOutputName() has been called
+  boost::filesystem::path getWritePath();
+  
+private: // helper methods
+  
+  /// @return the data of this OutputFormatter (CFNULL if none)
+  OutputFormatterData* getOutputFormatterData() const;
+  
+  /// Start writing the snapshot and the staged files of the output in background
+  void startTransfer();
+  
+  /// Wait for the end of the background writing of the previous output
+  void waitForTransfer();
+  
 protected: // member data
 
   /// Name of Solution File where to write
@@ -150,6 +182,39 @@ protected: // member data
   /// Append processor rank to file name
   bool  m_appendRank;
   
+  /// Write the output asynchronously through a staging directory
+  bool  m_asyncOutput;
+  
+  /// Staging directory for the asynchronous output
+  std::string m_stagingDirStr;
+  
+private: // data
+  
+  /// staging buffer (0 or 1) where the next output is written
+  CFuint m_stagingSlot;
+  
+  /// staging directory of the output being written
+  boost::filesystem::path m_stagingPath;
+  
+  /// flag telling if this rank copies the staged output
+  bool m_isTransferRank;
+  
+  /// flag telling if the warning about a synchronous output was given
+  bool m_isSyncWarned;
+  
+  /// snapshot of the previous output, being written in background
+  std::string m_writeBuffer;
+  
+  /// parts of the file of the previous output written by this processor,
+  /// being written in background
+  Common::SparseFileBuffer m_sparseWriteBuffer;
+  
+  /// thread writing the previous output
+  std::auto_ptr<boost::thread> m_transfer;
+  
+  /// error of the previous output (empty if it succeeded)
+  std::string m_transferError;
+  
 }; // class OutputFormatter
 
 //////////////////////////////////////////////////////////////////////////////
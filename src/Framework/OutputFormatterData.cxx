@@ -6,6 +6,7 @@
 
 #include "Framework/OutputFormatterData.hh"
 #include "Framework/DataHandleOutput.hh"
+#include "Framework/FileWriter.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -28,7 +29,14 @@ void OutputFormatterData::defineConfigOptions(Config::OptionList& options)
 //////////////////////////////////////////////////////////////////////////////
 
 OutputFormatterData::OutputFormatterData(Common::SafePtr<Method> owner)
- : MethodData(owner)
+ : MethodData(owner),
+   m_asyncOutput(false),
+   m_snapshot(),
+   m_snapshotPath(),
+   m_sparseSnapshot(),
+   m_sparseStream(&m_sparseSnapshot),
+   m_sparsePath(),
+   m_sparseIsNewFile(false)
 {
   addConfigOptionsTo(this);
 
@@ -51,6 +59,62 @@ Common::SafePtr<DataHandleOutput> OutputFormatterData::getDataHOutput()
 
 //////////////////////////////////////////////////////////////////////////////
 
+void OutputFormatterData::writeOutput(FileWriter& writer,
+                                      const boost::filesystem::path& filepath)
+{
+  CFAUTOTRACE;
+
+  // a second file of the same output is written directly
+  if (m_asyncOutput && m_snapshotPath.empty() && m_sparsePath.empty()) {
+    writer.writeToBuffer(m_snapshot);
+    m_snapshotPath = filepath;
+  }
+  else {
+    writer.writeToFile(filepath);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void OutputFormatterData::swapSnapshot(std::string& buffer,
+                                       boost::filesystem::path& filepath)
+{
+  m_snapshot.swap(buffer);
+  filepath = m_snapshotPath;
+  m_snapshotPath = boost::filesystem::path();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::ostream& OutputFormatterData::openSparseSnapshot
+(const boost::filesystem::path& filepath, const bool isNewFile)
+{
+  cf_assert(useSparseSnapshot());
+  
+  // the stream starts with the default format, as a newly opened file
+  const std::ios defaultFormat(CFNULL);
+  m_sparseStream.copyfmt(defaultFormat);
+  m_sparseStream.clear();
+  m_sparseSnapshot.clear();
+  m_sparsePath = filepath;
+  m_sparseIsNewFile = isNewFile;
+  return m_sparseStream;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void OutputFormatterData::swapSparseSnapshot(Common::SparseFileBuffer& buffer,
+                                             boost::filesystem::path& filepath,
+                                             bool& isNewFile)
+{
+  m_sparseSnapshot.swap(buffer);
+  filepath = m_sparsePath;
+  isNewFile = m_sparseIsNewFile;
+  m_sparsePath = boost::filesystem::path();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 void OutputFormatterData::configure ( Config::ConfigArgs& args )
 {
   CFAUTOTRACE;
@@ -9,6 +9,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 
+#include <ostream>
+#include <boost/filesystem/path.hpp>
+
+#include "Common/SparseFileBuffer.hh"
 #include "Framework/MethodData.hh"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -18,6 +22,7 @@ namespace COOLFluiD {
   namespace Framework {
 
     class DataHandleOutput;
+    class FileWriter;
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -50,10 +55,71 @@ public: // functions
   /// ???
   virtual Common::SafePtr<DataHandleOutput> getDataHOutput();
 
+  /// Writes the output file with the given writer.
+  /// In asynchronous mode, the first file of each output is formatted in a
+  /// snapshot in memory, which the OutputFormatter writes in background.
+  /// @param writer the writer formatting the file
+  /// @param filepath path of the file
+  void writeOutput(FileWriter& writer, const boost::filesystem::path& filepath);
+
+  /// Tells if the next file written by the processors themselves at given
+  /// positions (e.g. in parallel) must go to a sparse snapshot in memory
+  /// @see openSparseSnapshot()
+  bool useSparseSnapshot() const
+  {
+    return m_asyncOutput && m_snapshotPath.empty() && m_sparsePath.empty();
+  }
+
+  /// Gives the stream where this processor writes its parts of the file,
+  /// which the OutputFormatter writes in background
+  /// @param filepath path of the file
+  /// @param isNewFile the file is truncated after its parts are written
+  /// @pre useSparseSnapshot()
+  std::ostream& openSparseSnapshot(const boost::filesystem::path& filepath,
+				   const bool isNewFile);
+
+  /// Sets the asynchronous mode
+  void setAsyncOutput(const bool asyncOutput) { m_asyncOutput = asyncOutput; }
+
+  /// Takes the snapshot of the last output, leaving the given buffer to be
+  /// filled by the next one
+  /// @param buffer the buffer to swap with the snapshot
+  /// @param filepath the path of the file of the snapshot (empty if none)
+  void swapSnapshot(std::string& buffer, boost::filesystem::path& filepath);
+
+  /// Takes the sparse snapshot of the last output, leaving the given buffer
+  /// to be filled by the next one
+  /// @param buffer the buffer to swap with the sparse snapshot
+  /// @param filepath the path of the file of the snapshot (empty if none)
+  /// @param isNewFile the file must be truncated after being written
+  void swapSparseSnapshot(Common::SparseFileBuffer& buffer,
+			  boost::filesystem::path& filepath, bool& isNewFile);
+
 protected: // data
 
   DataHandleOutput * m_datah_out;
 
+  /// flag telling if the output is written asynchronously
+  bool m_asyncOutput;
+
+  /// snapshot of the output file formatted in memory
+  std::string m_snapshot;
+
+  /// path of the file of the snapshot (empty if none)
+  boost::filesystem::path m_snapshotPath;
+
+  /// parts of the output file written by this processor
+  Common::SparseFileBuffer m_sparseSnapshot;
+
+  /// stream writing in m_sparseSnapshot
+  std::ostream m_sparseStream;
+
+  /// path of the file of the sparse snapshot (empty if none)
+  boost::filesystem::path m_sparsePath;
+
+  /// flag telling if the file of the sparse snapshot is a new one
+  bool m_sparseIsNewFile;
+
 }; // end of class OutputFormatterData
 
 //////////////////////////////////////////////////////////////////////////////
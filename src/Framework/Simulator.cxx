@@ -104,6 +104,7 @@ Simulator::Simulator(const std::string& name) :
   m_subSystemTypes(),
   m_subSys(),
   m_sim_args(),
+  m_overridingArgs(),
   m_mapSS2Ranks()
 {
   CFAUTOTRACE;
@@ -164,6 +165,29 @@ void Simulator::processOptions ( Config::ConfigArgs& args )
   
   processConfigFile ( args );
   
+  for (ConfigArgs::const_iterator itr = m_overridingArgs.begin();
+       itr != m_overridingArgs.end(); ++itr) {
+    CFLog(INFO, "Overriding " << itr->first << " = " << itr->second << "\n");
+    
+    // if the overridden option selects an object (e.g. the StopCondition),
+    // drop the options of the object that is replaced, which would be unused
+    ConfigArgs::iterator old = args.find(itr->first);
+    if (old != args.end() && old->second != itr->second) {
+      const std::string::size_type dot = itr->first.rfind('.');
+      const std::string parent = (dot != std::string::npos) ? itr->first.substr(0, dot+1) : "";
+      const std::string oldObject = parent + old->second;
+      std::vector<ConfigKey> dropped;
+      for (ConfigArgs::const_iterator a = args.begin(); a != args.end(); ++a) {
+	if (a->first == oldObject || StringOps::startsWith(a->first, oldObject + ".")) {
+	  dropped.push_back(a->first);
+	}
+      }
+      args.consume(dropped);
+    }
+    
+    args[itr->first] = itr->second;
+  }
+  
   processParentArgs ( args );
   
   processEnvironmentVariables ( args );
@@ -93,6 +93,11 @@ public: // functions
   /// Sets a single CFcase file for simulation
   void openCaseFile (const std::string& sCFcaseFile);
 
+  /// Sets configuration arguments that replace the ones of the CFcase file
+  /// (e.g. the stop condition of a benchmark run)
+  /// @pre must be called before openCaseFile()
+  void setOverridingArgs (const Config::ConfigArgs& args) {m_overridingArgs = args;}
+
   /// Adds the ActionListener's of this EventListener to the EventHandler
   void registActionListeners();
 
@@ -147,6 +152,9 @@ protected: // functions
   Common::SelfRegistPtr<SubSystem> m_subSys;
   /// Simulation configuration arguments
   Config::ConfigArgs m_sim_args;
+
+  /// configuration arguments replacing the ones of the CFcase file
+  Config::ConfigArgs m_overridingArgs;
   
   /// map the subsystem names to the corresponding ranks
   std::map<std::string, std::string> m_mapSS2Ranks;
@@ -7,6 +7,7 @@
 #include "Common/NotImplementedException.hh"
 #include "Common/BadValueException.hh"
 #include "Common/EventHandler.hh"
+#include "Common/BenchmarkTimers.hh"
 
 #include "Environment/CFEnv.hh"
 
@@ -168,6 +169,7 @@ void SpaceMethod::computeSpaceResidual(CFreal factor)
 
   pushNamespace();
 
+  Common::BenchmarkTimers::Scope timer("SpaceResidual");
   computeSpaceResidualImpl(factor);
 
   popNamespace();
@@ -184,6 +186,7 @@ void SpaceMethod::computeTimeResidual(CFreal factor)
 
   pushNamespace();
 
+  Common::BenchmarkTimers::Scope timer("TimeResidual");
   computeTimeResidualImpl(factor);
 
   popNamespace();
@@ -223,6 +226,24 @@ void SpaceMethod::postProcessSolution()
 
 //////////////////////////////////////////////////////////////////////////////
 
+bool SpaceMethod::finalizeTimeStep()
+{
+  CFAUTOTRACE;
+
+  cf_assert(isConfigured());
+  cf_assert(isSetup());
+
+  pushNamespace();
+
+  const bool isModified = finalizeTimeStepImpl();
+
+  popNamespace();
+
+  return isModified;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 // void SpaceMethod::computeSpaceDiagBlockJacobContrib(CFreal factor)
 // {
 //   CFAUTOTRACE;
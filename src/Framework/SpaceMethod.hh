@@ -121,6 +121,14 @@ public: // methods
   /// @post pushs and pops the Namespace to which this Method belongs
   void postProcessSolution();
 
+  /// Finalize the physical time step, once all the stages or iterations
+  /// of the convergence method are done.
+  /// For instance for the integration of split source terms.
+  /// @return true if the states and the rhs have been modified, so that the
+  ///         residual has to be computed again
+  /// @post pushs and pops the Namespace to which this Method belongs
+  bool finalizeTimeStep();
+
   /// Compute the diagonal block jacobian contributions
   /// coming from the space discretization
   /// @param factor is used to multiply the residual and jacobians
@@ -235,6 +243,11 @@ protected: // abstract interface implementations
   /// @todo KVDA: it is not abstract here, as I do not have access to all the spacemethods and thus cannot put the function everywhere
   virtual void postProcessSolutionImpl() {}
 
+  /// Finalize the physical time step.
+  /// By default nothing is done.
+  /// @return true if the states and the rhs have been modified
+  virtual bool finalizeTimeStepImpl() {return false;}
+
   /// Compute the diagonal block jacobian contributions
   /// coming from the space discretization
   /// This function should be overwritten by the concrete method.
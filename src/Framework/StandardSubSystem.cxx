@@ -15,6 +15,8 @@
 #include "Common/EventHandler.hh"
 #include "Common/MemFunArg.hh"
 
+#include "MathTools/ArrayAllocCounter.hh"
+#include "MathTools/ScratchArena.hh"
 #include "Environment/FileHandlerOutput.hh"
 #include "Environment/DirPaths.hh"
 #include "Environment/ObjectProvider.hh"
@@ -44,6 +46,7 @@
 #include "Framework/Namespace.hh"
 #include "Framework/Framework.hh"
 #include "Framework/SimulationStatus.hh"
+#include "Framework/MemoryRegistry.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -94,6 +97,9 @@ void StandardSubSystem::defineConfigOptions(Config::OptionList& options)
    options.addConfigOption< CFuint >("InitialIter","Initial Iteration Number.");
    options.addConfigOption< CFreal >("InitialTime","Initial Physical Time of the SubSystem.");
    options.addConfigOption< int, Config::DynamicOption<> >("StopSimulation","Flag to force an immediate stop of the simulation.");
+   options.addConfigOption< bool >("MemoryReport","Report the memory footprint of the data structures at the end of the setup.");
+   options.addConfigOption< CFuint, Config::DynamicOption<> >("MemoryReportRate","Report the memory footprint every N iterations (0 for never, it can be changed interactively).");
+   options.addConfigOption< bool >("TrackPhaseMemory","Track the memory high-water mark and the number of allocations of the timed phases.");
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -158,6 +164,15 @@ StandardSubSystem::StandardSubSystem(const std::string& name)
 
   m_forcedStop = 0;
   setParameter("StopSimulation",&m_forcedStop);
+
+  m_memoryReport = false;
+  setParameter("MemoryReport",&m_memoryReport);
+
+  m_memoryReportRate = 0;
+  setParameter("MemoryReportRate",&m_memoryReportRate);
+
+  m_trackPhaseMemory = false;
+  setParameter("TrackPhaseMemory",&m_trackPhaseMemory);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -177,6 +192,10 @@ void StandardSubSystem::configure ( Config::ConfigArgs& args )
   
   SubSystem::configure(args);
   
+  if (m_trackPhaseMemory) {
+    MemoryRegistry::getInstance().enablePhaseTracking();
+  }
+  
   // set the physical model
   configurePhysicalModel(args);
   
@@ -575,6 +594,11 @@ void StandardSubSystem::setup()
   m_recvFlags.resize(nbRanks, 0);
 #endif
   
+  if (m_memoryReport) {
+    MemoryRegistry::getInstance().report
+      ("setup", SubSystemStatusStack::getCurrentName());
+  }
+  
   CFLog(NOTICE,"-------------------------------------------------------------\n");
 }
     
@@ -736,6 +760,21 @@ void StandardSubSystem::run()
     bool dontforce = false;
     writeSolution(dontforce);
     
+    // release the temporaries of this iteration
+    MathTools::ScratchArena::resetAll();
+    
+    if (m_memoryReportRate > 0 && currSSS->getNbIter() % m_memoryReportRate == 0) {
+      MemoryRegistry::getInstance().report
+	("iteration " + StringOps::to_str(currSSS->getNbIter()), ssGroupName);
+    }
+    
+    if (MathTools::ArrayAllocCounter::isEnabled()) {
+      CFLog(INFO, "RealVector/RealMatrix allocations [heap, inline] = ["
+	    << MathTools::ArrayAllocCounter::getNbHeapAllocs() << ", "
+	    << MathTools::ArrayAllocCounter::getNbInlineAllocs() << "]\n");
+      MathTools::ArrayAllocCounter::reset();
+    }
+    
     // unsetup();
     // buildMeshData();
     // setup(); 
@@ -207,6 +207,15 @@ protected: // functions
   ///flag to force stopping the run()
   int m_forcedStop;
 
+  /// flag telling to report the memory footprint at the end of the setup
+  bool m_memoryReport;
+
+  /// number of iterations between two memory reports (0 for none)
+  CFuint m_memoryReportRate;
+
+  /// flag telling to track the memory and allocations of the timed phases
+  bool m_trackPhaseMemory;
+
 }; // class StandardSubSystem
 
 //////////////////////////////////////////////////////////////////////////////
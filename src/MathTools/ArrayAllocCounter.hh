@@ -0,0 +1,103 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MathTools_ArrayAllocCounter_hh
+#define COOLFluiD_MathTools_ArrayAllocCounter_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include "Common/COOLFluiD.hh"
+#include "MathTools/MacrosET.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// Maximum number of entries of a dynamic CFVec stored inside the object
+/// itself instead of being allocated on the heap (0 disables the inline storage)
+#ifndef CF_SMALLVEC_SIZE
+#define CF_SMALLVEC_SIZE 0
+#endif
+
+/// Maximum number of entries of a dynamic CFMat stored inside the object
+/// itself instead of being allocated on the heap (0 disables the inline storage)
+#ifndef CF_SMALLMAT_SIZE
+#define CF_SMALLMAT_SIZE 0
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class counts the memory requests of the dynamic CFVec and CFMat,
+/// distinguishing those served by the heap from those served by the
+/// inline storage. The counters are only updated if the code is compiled
+/// with CF_ENABLE_ARRAY_ALLOC_COUNT, so that they cost nothing otherwise.
+class ArrayAllocCounter {
+public:
+
+  /// Count one heap allocation
+  HHOST_DEV static void addHeap()
+  {
+#if defined(CF_ENABLE_ARRAY_ALLOC_COUNT) && !defined(__CUDA_ARCH__)
+#ifdef CF_HAVE_OMP
+#pragma omp atomic
+#endif
+    nbHeap()++;
+#endif
+  }
+
+  /// Count one allocation served by the inline storage
+  HHOST_DEV static void addInline()
+  {
+#if defined(CF_ENABLE_ARRAY_ALLOC_COUNT) && !defined(__CUDA_ARCH__)
+#ifdef CF_HAVE_OMP
+#pragma omp atomic
+#endif
+    nbInline()++;
+#endif
+  }
+
+  /// @return the number of heap allocations since the last reset
+  static CFuint getNbHeapAllocs() {return nbHeap();}
+
+  /// @return the number of inline allocations since the last reset
+  static CFuint getNbInlineAllocs() {return nbInline();}
+
+  /// Reset the counters
+  static void reset() {nbHeap() = 0; nbInline() = 0;}
+
+  /// Tell if the counters are active in this build
+  static bool isEnabled()
+  {
+#ifdef CF_ENABLE_ARRAY_ALLOC_COUNT
+    return true;
+#else
+    return false;
+#endif
+  }
+
+private:
+
+  /// heap allocations counter
+  static CFuint& nbHeap() {static CFuint count = 0; return count;}
+
+  /// inline allocations counter
+  static CFuint& nbInline() {static CFuint count = 0; return count;}
+
+}; // end of class ArrayAllocCounter
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MathTools_ArrayAllocCounter_hh
@@ -0,0 +1,429 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+#include <cmath>
+
+#include "MathTools/BatchedBlockInverter.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// number of interleaved blocks
+const CFuint W = BatchedBlockInverter::BATCH_SIZE;
+
+/// pivots smaller than this fraction of the largest entry of the block,
+/// even after pivoting, make the block be treated by the fallback inverter
+const CFreal PIVOT_TOLERANCE = 1e-10;
+
+/// Partial pivoting of the column k of a group of interleaved blocks: in
+/// each block, the row with the largest entry of the column from the row k
+/// on is exchanged with the row k, and its index is stored in piv
+inline void exchangeRows(CFreal* a, const CFuint size, const CFuint k, CFuint* piv)
+{
+  for (CFuint l = 0; l < W; ++l) {
+    CFuint p = k;
+    CFreal maxEntry = std::abs(a[(k*size + k)*W + l]);
+    for (CFuint i = k+1; i < size; ++i) {
+      const CFreal entry = std::abs(a[(i*size + k)*W + l]);
+      if (entry > maxEntry) {
+	maxEntry = entry;
+	p = i;
+      }
+    }
+    piv[l] = p;
+    if (p != k) {
+      for (CFuint j = 0; j < size; ++j) {
+	std::swap(a[(k*size + j)*W + l], a[(p*size + j)*W + l]);
+      }
+    }
+  }
+}
+
+/// Compute the inverse of the pivots of the row k, flagging the blocks
+/// whose pivot is too small (their inverse pivot is set to 1 to keep
+/// the computation finite, the result being discarded anyway)
+inline void invertPivots(const CFreal* akk, const CFreal* scale,
+			 CFuint* bad, CFreal* inv)
+{
+  for (CFuint l = 0; l < W; ++l) {
+    const bool ok = std::abs(akk[l]) > PIVOT_TOLERANCE*scale[l];
+    bad[l] |= !ok;
+    inv[l] = ok ? 1./akk[l] : 1.;
+  }
+}
+
+/// Gauss-Jordan inversion in place of a group of interleaved blocks, with
+/// partial pivoting (piv holds size*W row indices).
+/// N is the size of the blocks if known at compile time, 0 otherwise.
+template <int N>
+void invertGroup(CFreal* a, const CFuint n, const CFreal* scale, CFuint* bad,
+		 CFuint* piv)
+{
+  const CFuint size = (N > 0) ? N : n;
+  CFreal inv[W];
+  CFreal f[W];
+
+  for (CFuint k = 0; k < size; ++k) {
+    exchangeRows(a, size, k, &piv[k*W]);
+    CFreal *const rowK = &a[k*size*W];
+    CFreal *const akk = &rowK[k*W];
+    invertPivots(akk, scale, bad, inv);
+    for (CFuint l = 0; l < W; ++l) {
+      akk[l] = 1.;
+    }
+
+    for (CFuint j = 0; j < size; ++j) {
+      CFreal *const akj = &rowK[j*W];
+      for (CFuint l = 0; l < W; ++l) {
+	akj[l] *= inv[l];
+      }
+    }
+
+    for (CFuint i = 0; i < size; ++i) {
+      if (i != k) {
+	CFreal *const rowI = &a[i*size*W];
+	CFreal *const aik = &rowI[k*W];
+	for (CFuint l = 0; l < W; ++l) {
+	  f[l] = aik[l];
+	  aik[l] = 0.;
+	}
+	for (CFuint j = 0; j < size; ++j) {
+	  CFreal *const aij = &rowI[j*W];
+	  const CFreal *const akj = &rowK[j*W];
+	  for (CFuint l = 0; l < W; ++l) {
+	    aij[l] -= f[l]*akj[l];
+	  }
+	}
+      }
+    }
+  }
+
+  // the exchanges of rows are undone on the columns of the inverse,
+  // in the reverse order
+  for (CFuint kk = size; kk > 0; --kk) {
+    const CFuint k = kk - 1;
+    for (CFuint l = 0; l < W; ++l) {
+      const CFuint p = piv[k*W + l];
+      if (p != k) {
+	for (CFuint i = 0; i < size; ++i) {
+	  std::swap(a[(i*size + k)*W + l], a[(i*size + p)*W + l]);
+	}
+      }
+    }
+  }
+}
+
+/// LU factorization in place of a group of interleaved blocks, with partial
+/// pivoting (piv holds size*W row indices): L has a unit diagonal and the
+/// diagonal of U is stored inverted
+template <int N>
+void factorGroup(CFreal* a, const CFuint n, const CFreal* scale, CFuint* bad,
+		 CFuint* piv)
+{
+  const CFuint size = (N > 0) ? N : n;
+  CFreal inv[W];
+  CFreal f[W];
+
+  for (CFuint k = 0; k < size; ++k) {
+    exchangeRows(a, size, k, &piv[k*W]);
+    const CFreal *const rowK = &a[k*size*W];
+    CFreal *const akk = &a[(k*size + k)*W];
+    invertPivots(akk, scale, bad, inv);
+    for (CFuint l = 0; l < W; ++l) {
+      akk[l] = inv[l];
+    }
+
+    for (CFuint i = k+1; i < size; ++i) {
+      CFreal *const rowI = &a[i*size*W];
+      CFreal *const aik = &rowI[k*W];
+      for (CFuint l = 0; l < W; ++l) {
+	f[l] = aik[l]*inv[l];
+	aik[l] = f[l];
+      }
+      for (CFuint j = k+1; j < size; ++j) {
+	CFreal *const aij = &rowI[j*W];
+	const CFreal *const akj = &rowK[j*W];
+	for (CFuint l = 0; l < W; ++l) {
+	  aij[l] -= f[l]*akj[l];
+	}
+      }
+    }
+  }
+}
+
+/// Forward and backward substitution for a group of interleaved blocks
+/// factored by factorGroup()
+template <int N>
+void solveGroup(const CFreal* a, const CFuint n, const CFuint* piv, CFreal* x)
+{
+  const CFuint size = (N > 0) ? N : n;
+
+  for (CFuint k = 0; k < size; ++k) {
+    for (CFuint l = 0; l < W; ++l) {
+      const CFuint p = piv[k*W + l];
+      if (p != k) {
+	std::swap(x[k*W + l], x[p*W + l]);
+      }
+    }
+  }
+
+  for (CFuint i = 1; i < size; ++i) {
+    CFreal *const xi = &x[i*W];
+    for (CFuint j = 0; j < i; ++j) {
+      const CFreal *const aij = &a[(i*size + j)*W];
+      const CFreal *const xj = &x[j*W];
+      for (CFuint l = 0; l < W; ++l) {
+	xi[l] -= aij[l]*xj[l];
+      }
+    }
+  }
+
+  for (CFuint ii = size; ii > 0; --ii) {
+    const CFuint i = ii - 1;
+    CFreal *const xi = &x[i*W];
+    for (CFuint j = i+1; j < size; ++j) {
+      const CFreal *const aij = &a[(i*size + j)*W];
+      const CFreal *const xj = &x[j*W];
+      for (CFuint l = 0; l < W; ++l) {
+	xi[l] -= aij[l]*xj[l];
+      }
+    }
+    const CFreal *const aii = &a[(i*size + i)*W];
+    for (CFuint l = 0; l < W; ++l) {
+      xi[l] *= aii[l];
+    }
+  }
+}
+
+/// Call the instantiation of the kernel for the given block size
+#define CF_BATCHED_BLOCK_DISPATCH(KERNEL, N, ARGS)	\
+  switch (N) {						\
+  case 2: KERNEL<2> ARGS; break;			\
+  case 3: KERNEL<3> ARGS; break;			\
+  case 4: KERNEL<4> ARGS; break;			\
+  case 5: KERNEL<5> ARGS; break;			\
+  case 6: KERNEL<6> ARGS; break;			\
+  case 7: KERNEL<7> ARGS; break;			\
+  case 8: KERNEL<8> ARGS; break;			\
+  case 9: KERNEL<9> ARGS; break;			\
+  default: KERNEL<0> ARGS; break;			\
+  }
+
+} // anonymous namespace
+
+//////////////////////////////////////////////////////////////////////////////
+
+BatchedBlockInverter::BatchedBlockInverter(const CFuint blockSize) :
+  m_n(blockSize),
+  m_packed(W*blockSize*blockSize),
+  m_scale(W),
+  m_badPivot(W),
+  m_pivots(W*blockSize),
+  m_factors(),
+  m_factorPivots(),
+  m_nbFactored(0),
+  m_fallbackIDs(),
+  m_fallbackInverses(),
+  m_nbFallback(0),
+  m_fallbackInverter(blockSize),
+  m_a(blockSize, blockSize),
+  m_x(blockSize, blockSize),
+  m_rhs(W*blockSize)
+{
+  cf_assert(blockSize > 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BatchedBlockInverter::~BatchedBlockInverter()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::invert(const CFreal* blocks, CFreal* inverses,
+				  const CFuint nbBlocks)
+{
+  const CFuint n2 = m_n*m_n;
+  CFreal *const packed = &m_packed[0];
+  m_nbFallback = 0;
+
+  for (CFuint start = 0; start < nbBlocks; start += W) {
+    const CFuint nb = std::min<CFuint>(W, nbBlocks - start);
+    pack(blocks, start, nb, packed);
+    CF_BATCHED_BLOCK_DISPATCH(invertGroup, m_n, (packed, m_n, &m_scale[0], &m_badPivot[0], &m_pivots[0]));
+
+    // the blocks are read again before being overwritten, in case
+    // blocks and inverses are the same array
+    for (CFuint b = 0; b < nb; ++b) {
+      if (m_badPivot[b]) {
+	invertWithFallback(&blocks[(start + b)*n2], &m_x[0]);
+	for (CFuint e = 0; e < n2; ++e) {
+	  packed[e*W + b] = m_x[e];
+	}
+	++m_nbFallback;
+      }
+    }
+
+    unpack(packed, start, nb, inverses);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::factor(const CFreal* blocks, const CFuint nbBlocks)
+{
+  const CFuint n2 = m_n*m_n;
+  const CFuint nbGroups = (nbBlocks + W - 1)/W;
+  m_factors.resize(nbGroups*W*n2);
+  m_factorPivots.resize(nbGroups*W*m_n);
+  m_nbFactored = nbBlocks;
+  m_fallbackIDs.clear();
+  m_fallbackInverses.clear();
+
+  for (CFuint g = 0; g < nbGroups; ++g) {
+    const CFuint start = g*W;
+    const CFuint nb = std::min<CFuint>(W, nbBlocks - start);
+    CFreal *const packed = &m_factors[g*W*n2];
+    CFuint *const piv = &m_factorPivots[g*W*m_n];
+    pack(blocks, start, nb, packed);
+    CF_BATCHED_BLOCK_DISPATCH(factorGroup, m_n, (packed, m_n, &m_scale[0], &m_badPivot[0], piv));
+
+    // the factors of the rejected blocks are replaced by the identity, so
+    // that solve() leaves their right hand side untouched for the inverse
+    for (CFuint b = 0; b < nb; ++b) {
+      if (m_badPivot[b]) {
+	invertWithFallback(&blocks[(start + b)*n2], &m_x[0]);
+	m_fallbackIDs.push_back(start + b);
+	m_fallbackInverses.insert(m_fallbackInverses.end(), &m_x[0], &m_x[0] + n2);
+	for (CFuint i = 0; i < m_n; ++i) {
+	  piv[i*W + b] = i;
+	  for (CFuint j = 0; j < m_n; ++j) {
+	    packed[(i*m_n + j)*W + b] = (i == j) ? 1. : 0.;
+	  }
+	}
+      }
+    }
+  }
+
+  m_nbFallback = m_fallbackIDs.size();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::solve(CFreal* rhs) const
+{
+  const CFuint n2 = m_n*m_n;
+  CFreal *const x = &m_rhs[0];
+
+  for (CFuint start = 0; start < m_nbFactored; start += W) {
+    const CFuint nb = std::min<CFuint>(W, m_nbFactored - start);
+    for (CFuint i = 0; i < m_n; ++i) {
+      for (CFuint b = 0; b < W; ++b) {
+	x[i*W + b] = (b < nb) ? rhs[(start + b)*m_n + i] : 0.;
+      }
+    }
+
+    CF_BATCHED_BLOCK_DISPATCH(solveGroup, m_n, (&m_factors[start*n2], m_n, &m_factorPivots[start*m_n], x));
+
+    for (CFuint b = 0; b < nb; ++b) {
+      for (CFuint i = 0; i < m_n; ++i) {
+	rhs[(start + b)*m_n + i] = x[i*W + b];
+      }
+    }
+  }
+
+  for (CFuint p = 0; p < m_fallbackIDs.size(); ++p) {
+    CFreal *const xp = &rhs[m_fallbackIDs[p]*m_n];
+    const CFreal *const inv = &m_fallbackInverses[p*n2];
+    for (CFuint i = 0; i < m_n; ++i) {
+      x[i] = 0.;
+      for (CFuint j = 0; j < m_n; ++j) {
+	x[i] += inv[i*m_n + j]*xp[j];
+      }
+    }
+    std::copy(x, x + m_n, xp);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::pack(const CFreal* blocks, const CFuint start,
+				const CFuint nb, CFreal* packed)
+{
+  const CFuint n2 = m_n*m_n;
+  for (CFuint b = 0; b < W; ++b) {
+    m_badPivot[b] = 0;
+    if (b < nb) {
+      const CFreal *const block = &blocks[(start + b)*n2];
+      CFreal scale = 0.;
+      for (CFuint e = 0; e < n2; ++e) {
+	packed[e*W + b] = block[e];
+	scale = std::max(scale, std::abs(block[e]));
+      }
+      m_scale[b] = scale;
+    }
+    else {
+      for (CFuint i = 0; i < m_n; ++i) {
+	for (CFuint j = 0; j < m_n; ++j) {
+	  packed[(i*m_n + j)*W + b] = (i == j) ? 1. : 0.;
+	}
+      }
+      m_scale[b] = 1.;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::unpack(const CFreal* packed, const CFuint start,
+				  const CFuint nb, CFreal* blocks) const
+{
+  const CFuint n2 = m_n*m_n;
+  for (CFuint b = 0; b < nb; ++b) {
+    CFreal *const block = &blocks[(start + b)*n2];
+    for (CFuint e = 0; e < n2; ++e) {
+      block[e] = packed[e*W + b];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void BatchedBlockInverter::invertWithFallback(const CFreal* block,
+					      CFreal* inverse)
+{
+  const CFuint n2 = m_n*m_n;
+  for (CFuint e = 0; e < n2; ++e) {
+    m_a[e] = block[e];
+  }
+  m_fallbackInverter.invert(m_a, m_x);
+  if (inverse != &m_x[0]) {
+    for (CFuint e = 0; e < n2; ++e) {
+      inverse[e] = m_x[e];
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#undef CF_BATCHED_BLOCK_DISPATCH
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
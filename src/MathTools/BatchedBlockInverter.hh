@@ -0,0 +1,158 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MathTools_BatchedBlockInverter_hh
+#define COOLFluiD_MathTools_BatchedBlockInverter_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "MathTools/LUInverter.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class inverts, or factors and solves, many small square blocks of
+/// the same size at once, as the diagonal blocks of the block-Jacobi,
+/// LU-SGS and DPLUR preconditioners.
+/// The blocks are given one after the other in a contiguous array, each one
+/// stored by rows. Internally they are processed by groups of BATCH_SIZE,
+/// interleaved so that the entry (i,j) of all the blocks of a group is
+/// contiguous: every operation of the elimination is then a loop over the
+/// blocks of the group, which the compiler turns into SIMD instructions.
+/// The most common block sizes (2 to 9) have dedicated instantiations with
+/// the size known at compile time.
+/// The elimination uses partial pivoting, each block of a group choosing
+/// its own pivot rows. A block with a pivot still smaller than 1e-10 times
+/// its largest entry (nearly singular) is treated again alone by a
+/// LUInverter.
+class MathTools_API BatchedBlockInverter {
+public:
+
+  /// number of blocks processed together
+  enum {BATCH_SIZE = 8};
+
+  /// Constructor
+  /// @param blockSize  number of rows of the blocks
+  BatchedBlockInverter(const CFuint blockSize);
+
+  /// Destructor
+  ~BatchedBlockInverter();
+
+  /// Invert in place the given blocks
+  /// @param blocks    blocks stored one after the other, each one by rows
+  /// @param nbBlocks  number of blocks
+  void invert(CFreal* blocks, const CFuint nbBlocks)
+  {
+    invert(blocks, blocks, nbBlocks);
+  }
+
+  /// Invert the given blocks and put the result in inverses
+  /// (inverses can be the same array as blocks)
+  void invert(const CFreal* blocks, CFreal* inverses, const CFuint nbBlocks);
+
+  /// Compute and keep the LU factorization of the given blocks, to be used
+  /// by the following calls to solve()
+  void factor(const CFreal* blocks, const CFuint nbBlocks);
+
+  /// Solve in place the systems of the blocks given to the last factor()
+  /// @param rhs  right hand sides stored one after the other, blockSize
+  ///             entries per block, overwritten with the solutions
+  void solve(CFreal* rhs) const;
+
+  /// @return the number of rows of the blocks
+  CFuint getBlockSize() const {return m_n;}
+
+  /// @return the number of nearly singular blocks that needed the fallback
+  ///         inverter in the last call to invert() or factor()
+  CFuint getNbFallbackBlocks() const {return m_nbFallback;}
+
+private:
+
+  /// Copy constructor (not implemented)
+  BatchedBlockInverter(const BatchedBlockInverter&);
+
+  /// Assignment operator (not implemented)
+  const BatchedBlockInverter& operator= (const BatchedBlockInverter&);
+
+  /// Interleave the blocks [start, start+nb) into packed, filling the
+  /// missing blocks of the group with the identity, and store the largest
+  /// entry of each block in m_scale
+  void pack(const CFreal* blocks, const CFuint start, const CFuint nb,
+	    CFreal* packed);
+
+  /// Copy the blocks [start, start+nb) from packed to blocks
+  void unpack(const CFreal* packed, const CFuint start, const CFuint nb,
+	      CFreal* blocks) const;
+
+  /// Invert one block with the fallback inverter
+  /// @param block    block to invert, stored by rows
+  /// @param inverse  where to put the inverse, stored by rows
+  void invertWithFallback(const CFreal* block, CFreal* inverse);
+
+private:
+
+  /// number of rows of the blocks
+  CFuint m_n;
+
+  /// one group of interleaved blocks
+  std::vector<CFreal> m_packed;
+
+  /// largest entry of each block of the current group
+  std::vector<CFreal> m_scale;
+
+  /// flag telling if a block of the current group has a too small pivot
+  std::vector<CFuint> m_badPivot;
+
+  /// interleaved pivot rows of the current group
+  std::vector<CFuint> m_pivots;
+
+  /// interleaved LU factors of all the blocks given to factor()
+  std::vector<CFreal> m_factors;
+
+  /// interleaved pivot rows of all the blocks given to factor()
+  std::vector<CFuint> m_factorPivots;
+
+  /// number of blocks given to factor()
+  CFuint m_nbFactored;
+
+  /// indices of the blocks which needed the fallback inverter in factor()
+  std::vector<CFuint> m_fallbackIDs;
+
+  /// inverses of the blocks which needed the fallback inverter in factor()
+  std::vector<CFreal> m_fallbackInverses;
+
+  /// number of blocks which needed the fallback inverter in the last
+  /// invert() or factor()
+  CFuint m_nbFallback;
+
+  /// inverter for the blocks that cannot be treated in a batch
+  LUInverter m_fallbackInverter;
+
+  /// work matrices for the fallback inverter
+  RealMatrix m_a;
+  RealMatrix m_x;
+
+  /// work vector for solve()
+  mutable std::vector<CFreal> m_rhs;
+
+}; // end of class BatchedBlockInverter
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MathTools_BatchedBlockInverter_hh
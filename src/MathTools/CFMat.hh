@@ -222,7 +222,9 @@ private:
 //////////////////////////////////////////////////////////////////////////////
 
 /// Definition of a class CFMat that implements an expression template technique
-/// with dynamical size
+/// with dynamical size. If CF_ENABLE_SMALL_ARRAYS is set, owned matrices with up
+/// to CF_SMALLMAT_SIZE entries are stored inside the object, bigger ones are
+/// allocated on the heap.
 /// @author Andrea Lani
 template <typename T>
 class CFMat<T,0,0> : public EETMAT(MatExprT,CFMat,T,0,0) {
@@ -471,10 +473,29 @@ MAT0_EASSIGN_OP_CONST(/=)
 private: // helper functions
   
   /// allocate the memory
-  HHOST_DEV void allocate() {if (size() > 0) {assert(m_owner); m_data = new T[size()];}}
+  HHOST_DEV void allocate() 
+  {
+    if (size() > 0) {
+      assert(m_owner); 
+#if CF_SMALLMAT_SIZE > 0
+      if (size() <= CF_SMALLMAT_SIZE) {m_data = m_buffer; ArrayAllocCounter::addInline(); return;}
+#endif
+      m_data = new T[size()]; ArrayAllocCounter::addHeap();
+    }
+  }
   
   /// free the memory
-  HHOST_DEV void free() {if (m_owner && size() > 0) {delete [] m_data; m_data = NULL; m_nrows = 0; m_ncols = 0;}}
+  HHOST_DEV void free() 
+  {
+    if (m_owner && size() > 0) {
+#if CF_SMALLMAT_SIZE > 0
+      if (m_data != m_buffer) {delete [] m_data;} 
+#else
+      delete [] m_data;
+#endif
+      m_data = NULL; m_nrows = 0; m_ncols = 0;
+    }
+  }
     
 private:
   
@@ -489,6 +510,11 @@ private:
     
   /// array data
   T* m_data;
+  
+#if CF_SMALLMAT_SIZE > 0
+  /// inline storage for small owned matrices
+  T m_buffer[CF_SMALLMAT_SIZE];
+#endif
 };
   
 //////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "MathTools/ArrayT.hh"
+#include "MathTools/ArrayAllocCounter.hh"
 #include "MathTools/CFVecSlice.hh"
 #include "MathTools/MathFunctions.hh"
 
@@ -206,7 +207,9 @@ private:
 //////////////////////////////////////////////////////////////////////////////
 
 /// Definition of a class CFVec that implements an expression template technique
-/// with dynamical size
+/// with dynamical size. If CF_ENABLE_SMALL_ARRAYS is set, owned arrays with up
+/// to CF_SMALLVEC_SIZE entries are stored inside the object, bigger ones are
+/// allocated on the heap.
 /// @author Andrea Lani
 template <typename T>
 class CFVec<T,0> : public EETVEC(ExprT,CFVec,T,0) {
@@ -401,10 +404,29 @@ VEC0_EASSIGN_OP_CONST(/=)
 private: // helper functions
   
   /// allocate the memory
-  HHOST_DEV void allocate() {if (size() > 0) {assert(m_owner); m_data = new T[m_size];}}
+  HHOST_DEV void allocate() 
+  {
+    if (size() > 0) {
+      assert(m_owner); 
+#if CF_SMALLVEC_SIZE > 0
+      if (m_size <= CF_SMALLVEC_SIZE) {m_data = m_buffer; ArrayAllocCounter::addInline(); return;}
+#endif
+      m_data = new T[m_size]; ArrayAllocCounter::addHeap();
+    }
+  }
   
   /// free the memory
-  HHOST_DEV void free() {if (m_owner && m_size > 0) {delete [] m_data; m_data = NULL; m_size = 0;}}
+  HHOST_DEV void free() 
+  {
+    if (m_owner && m_size > 0) {
+#if CF_SMALLVEC_SIZE > 0
+      if (m_data != m_buffer) {delete [] m_data;} 
+#else
+      delete [] m_data;
+#endif
+      m_data = NULL; m_size = 0;
+    }
+  }
     
 private:
   
@@ -416,6 +438,11 @@ private:
   
   /// array data
   T* m_data;
+  
+#if CF_SMALLVEC_SIZE > 0
+  /// inline storage for small owned arrays
+  T m_buffer[CF_SMALLVEC_SIZE];
+#endif
 };
   
 //////////////////////////////////////////////////////////////////////////////
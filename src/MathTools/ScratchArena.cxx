@@ -0,0 +1,144 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#include <algorithm>
+
+#ifdef CF_HAVE_OMP
+#include <omp.h>
+#endif
+
+#include "MathTools/ScratchArena.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// owner of the arenas of the threads, deleting them at exit
+class ScratchArenaList {
+public:
+  ~ScratchArenaList()
+  {
+    for (CFuint i = 0; i < arenas.size(); ++i) {
+      delete arenas[i];
+    }
+  }
+
+  std::vector<ScratchArena*> arenas;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArena::ScratchArena(const CFuint blockSize) :
+  m_current(CFNULL),
+  m_blockSize(blockSize),
+  m_used(0),
+  m_fullBlocks(),
+  m_usedInFullBlocks(0)
+{
+  cf_assert(blockSize > 0);
+  m_current = new CFreal[m_blockSize];
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArena::~ScratchArena()
+{
+  for (CFuint i = 0; i < m_fullBlocks.size(); ++i) {
+    delete [] m_fullBlocks[i];
+  }
+  delete [] m_current;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArena::addBlock(const CFuint size)
+{
+  m_fullBlocks.push_back(m_current);
+  m_usedInFullBlocks += m_used;
+
+  m_blockSize = std::max(2*m_blockSize, size);
+  m_current = new CFreal[m_blockSize];
+  m_used = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArena::reset()
+{
+  if (m_fullBlocks.size() > 0) {
+    // one block big enough for all the temporaries of the last iteration
+    const CFuint newSize = std::max(m_blockSize, m_usedInFullBlocks + m_used);
+    for (CFuint i = 0; i < m_fullBlocks.size(); ++i) {
+      delete [] m_fullBlocks[i];
+    }
+    m_fullBlocks.clear();
+    m_usedInFullBlocks = 0;
+
+    delete [] m_current;
+    m_blockSize = newSize;
+    m_current = new CFreal[m_blockSize];
+  }
+  m_used = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+std::vector<ScratchArena*>& ScratchArena::getArenas()
+{
+  static ScratchArenaList list;
+  return list.arenas;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+ScratchArena& ScratchArena::getThreadArena()
+{
+#ifdef CF_HAVE_OMP
+  const CFuint iThread = omp_get_thread_num();
+#else
+  const CFuint iThread = 0;
+#endif
+
+  ScratchArena* arena = CFNULL;
+#ifdef CF_HAVE_OMP
+#pragma omp critical (ScratchArena)
+#endif
+  {
+    std::vector<ScratchArena*>& arenas = getArenas();
+    if (iThread >= arenas.size()) {
+      arenas.resize(iThread + 1, CFNULL);
+    }
+    if (arenas[iThread] == CFNULL) {
+      arenas[iThread] = new ScratchArena();
+    }
+    arena = arenas[iThread];
+  }
+  return *arena;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void ScratchArena::resetAll()
+{
+  std::vector<ScratchArena*>& arenas = getArenas();
+  for (CFuint i = 0; i < arenas.size(); ++i) {
+    if (arenas[i] != CFNULL) {
+      arenas[i]->reset();
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,164 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+#ifndef COOLFluiD_MathTools_ScratchArena_hh
+#define COOLFluiD_MathTools_ScratchArena_hh
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "MathTools/RealVector.hh"
+#include "MathTools/RealMatrix.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace COOLFluiD {
+
+  namespace MathTools {
+
+//////////////////////////////////////////////////////////////////////////////
+
+/// This class provides memory for temporary RealVector's and RealMatrix's
+/// by advancing a pointer inside big blocks, so that the temporaries of
+/// an iteration do not go through the heap.
+/// All the memory handed out is released at once by reset(), which the
+/// SubSystem calls at the end of every iteration: the temporaries must
+/// not be used after that. After a reset the blocks used during the
+/// previous iteration are merged, so that in steady state each arena
+/// holds one single block.
+/// A function called many times per iteration (e.g. a flux splitter, once
+/// per face) opens a Scope, so that its temporaries are released at once
+/// on return and the entries are reused by the next call.
+/// Each thread has its own arena (see getThreadArena()).
+class MathTools_API ScratchArena {
+public:
+
+  /// This class releases at its destruction the memory handed out by the
+  /// arena since its construction. If the arena had to start a new block
+  /// in between, the memory is kept until the next reset().
+  class Scope {
+  public:
+
+    /// Constructor
+    Scope(ScratchArena& arena) :
+      m_arena(arena),
+      m_nbFullBlocks(arena.m_fullBlocks.size()),
+      m_used(arena.m_used)
+    {
+    }
+
+    /// Destructor
+    ~Scope()
+    {
+      if (m_arena.m_fullBlocks.size() == m_nbFullBlocks) {
+	m_arena.m_used = m_used;
+      }
+    }
+
+  private:
+
+    /// arena handing out the memory
+    ScratchArena& m_arena;
+
+    /// number of filled blocks of the arena at the construction
+    CFuint m_nbFullBlocks;
+
+    /// entries handed out from the current block at the construction
+    CFuint m_used;
+
+  }; // end of class Scope
+
+  friend class Scope;
+
+  /// Constructor
+  /// @param blockSize  number of entries of the first block
+  ScratchArena(const CFuint blockSize = 4096);
+
+  /// Destructor
+  ~ScratchArena();
+
+  /// Get uninitialized memory for the given number of entries
+  CFreal* allocate(const CFuint size)
+  {
+    if (m_used + size > m_blockSize) {
+      addBlock(size);
+    }
+    CFreal *const ptr = m_current + m_used;
+    m_used += size;
+    return ptr;
+  }
+
+  /// Make the given vector a temporary of the given size held by this arena
+  void getVector(RealVector& v, const CFuint size, const CFreal init = 0.)
+  {
+    v.wrap(size, allocate(size));
+    v = init;
+  }
+
+  /// Make the given matrix a temporary of the given size held by this arena
+  void getMatrix(RealMatrix& m, const CFuint nbRows, const CFuint nbCols,
+		 const CFreal init = 0.)
+  {
+    m.wrap(nbRows, nbCols, allocate(nbRows*nbCols));
+    m = init;
+  }
+
+  /// Release all the memory handed out since the last reset
+  void reset();
+
+  /// @return the number of entries handed out since the last reset
+  CFuint getNbUsedEntries() const {return m_usedInFullBlocks + m_used;}
+
+  /// @return the arena of the calling thread
+  static ScratchArena& getThreadArena();
+
+  /// Reset the arenas of all the threads
+  /// @pre to be called outside parallel regions
+  static void resetAll();
+
+private:
+
+  /// Copy constructor (not implemented)
+  ScratchArena(const ScratchArena&);
+
+  /// Assignment operator (not implemented)
+  const ScratchArena& operator= (const ScratchArena&);
+
+  /// Start a new block big enough for the given number of entries
+  void addBlock(const CFuint size);
+
+  /// @return the list of the arenas, one per thread
+  static std::vector<ScratchArena*>& getArenas();
+
+private:
+
+  /// block from which the memory is currently handed out
+  CFreal* m_current;
+
+  /// size of the current block
+  CFuint m_blockSize;
+
+  /// number of entries already handed out from the current block
+  CFuint m_used;
+
+  /// blocks filled since the last reset
+  std::vector<CFreal*> m_fullBlocks;
+
+  /// number of entries handed out from the filled blocks
+  CFuint m_usedInFullBlocks;
+
+}; // end of class ScratchArena
+
+//////////////////////////////////////////////////////////////////////////////
+
+  } // namespace MathTools
+
+} // namespace COOLFluiD
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // COOLFluiD_MathTools_ScratchArena_hh
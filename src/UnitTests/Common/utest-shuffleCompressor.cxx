@@ -0,0 +1,150 @@
+// Copyright (C) 2012 von Karman Institute for Fluid Dynamics, Belgium
+//
+// This software is distributed under the terms of the
+// GNU Lesser General Public License version 3 (LGPLv3).
+// See doc/lgpl.txt and doc/gpl.txt for the license text.
+
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "Test ShuffleCompressor"
+
+
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Common/ShuffleCompressor.hh"
+#include "Common/FileFormatException.hh"
+#include "Common/NotImplementedException.hh"
+
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace COOLFluiD;
+using namespace COOLFluiD::Common;
+
+using namespace boost::unit_test;
+
+//////////////////////////////////////////////////////////////////////////////
+
+struct ShuffleCompressor_Fixture
+{
+  /// common setup for each test case
+  ShuffleCompressor_Fixture()
+  {
+  }
+  /// common tear-down for each test case
+  ~ShuffleCompressor_Fixture()
+  {
+  }
+
+  /// compresses and decompresses the given values and checks that they
+  /// are recovered bit by bit
+  void checkRoundTrip(const std::vector<CFreal>& values, const CFuint level)
+  {
+    ShuffleCompressor compressor(level);
+    std::vector<char> bytes;
+    const CFreal* data = (values.size() > 0) ? &values[0] : CFNULL;
+    compressor.compress(data, values.size(), bytes);
+    BOOST_REQUIRE( bytes.size() > 0 );
+
+    // one more entry avoids taking the address of an empty vector
+    std::vector<CFreal> result(values.size() + 1, -1.);
+    compressor.decompress(&bytes[0], bytes.size(), &result[0], values.size());
+    if (values.size() > 0) {
+      BOOST_CHECK( std::memcmp(&values[0], &result[0], values.size()*sizeof(CFreal)) == 0 );
+    }
+    BOOST_CHECK( result[values.size()] == -1. );
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_FIXTURE_TEST_SUITE( ShuffleCompressor_TestSuite, ShuffleCompressor_Fixture )
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE( test_unavailable )
+{
+  if (ShuffleCompressor::isAvailable()) return;
+
+  ShuffleCompressor compressor;
+  std::vector<CFreal> values(10, 1.);
+  std::vector<char> bytes;
+  BOOST_CHECK_THROW( compressor.compress(&values[0], values.size(), bytes), NotImplementedException );
+}
+
+BOOST_AUTO_TEST_CASE( test_smooth_field )
+{
+  if (!ShuffleCompressor::isAvailable()) return;
+
+  // smooth field as the nodes or the states of a mesh
+  const CFuint n = 10000;
+  std::vector<CFreal> values(n);
+  for (CFuint i = 0; i < n; ++i) {
+    values[i] = 1.4 + 0.01*std::sin(1e-3*i);
+  }
+
+  checkRoundTrip(values, 1);
+  checkRoundTrip(values, 9);
+
+  ShuffleCompressor compressor(1);
+  std::vector<char> bytes;
+  compressor.compress(&values[0], n, bytes);
+  BOOST_CHECK( bytes.size() < n*sizeof(CFreal) );
+}
+
+BOOST_AUTO_TEST_CASE( test_special_values )
+{
+  if (!ShuffleCompressor::isAvailable()) return;
+
+  std::vector<CFreal> values;
+  values.push_back(0.);
+  values.push_back(-0.);
+  values.push_back(-1.);
+  values.push_back(std::numeric_limits<CFreal>::max());
+  values.push_back(std::numeric_limits<CFreal>::min());
+  values.push_back(std::numeric_limits<CFreal>::denorm_min());
+  values.push_back(std::numeric_limits<CFreal>::infinity());
+  values.push_back(std::numeric_limits<CFreal>::quiet_NaN());
+  checkRoundTrip(values, 1);
+
+  // single value and empty list
+  checkRoundTrip(std::vector<CFreal>(1, 3.), 1);
+  checkRoundTrip(std::vector<CFreal>(), 1);
+}
+
+BOOST_AUTO_TEST_CASE( test_corrupted_chunk )
+{
+  if (!ShuffleCompressor::isAvailable()) return;
+
+  const CFuint n = 100;
+  std::vector<CFreal> values(n);
+  for (CFuint i = 0; i < n; ++i) {
+    values[i] = 1. + i;
+  }
+
+  ShuffleCompressor compressor;
+  std::vector<char> bytes;
+  compressor.compress(&values[0], n, bytes);
+
+  // wrong number of values
+  std::vector<CFreal> result(2*n);
+  BOOST_CHECK_THROW( compressor.decompress(&bytes[0], bytes.size(), &result[0], n-1), FileFormatException );
+  BOOST_CHECK_THROW( compressor.decompress(&bytes[0], bytes.size(), &result[0], n+1), FileFormatException );
+
+  // truncated and garbled chunks
+  BOOST_CHECK_THROW( compressor.decompress(&bytes[0], bytes.size()/2, &result[0], n), FileFormatException );
+  std::vector<char> garbled(bytes.size(), 'x');
+  BOOST_CHECK_THROW( compressor.decompress(&garbled[0], garbled.size(), &result[0], n), FileFormatException );
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//////////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,11 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdlib>
+#include <vector>
+
 #include "MathTools/MatrixInverterT.hh"
+#include "MathTools/BatchedBlockInverter.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -47,6 +51,40 @@ struct MatrixInverter_Fixture
   {
   }
   /// possibly common functions used on the tests below
+
+  /// fill blocks with diagonally dominant random matrices
+  void fillBlocks(const CFuint n, const CFuint nbBlocks, std::vector<CFreal>& blocks)
+  {
+    blocks.resize(nbBlocks*n*n);
+    for (CFuint b = 0; b < nbBlocks; ++b) {
+      for (CFuint i = 0; i < n; ++i) {
+        for (CFuint j = 0; j < n; ++j) {
+          const CFreal r = std::rand()/static_cast<CFreal>(RAND_MAX) - 0.5;
+          blocks[(b*n + i)*n + j] = (i == j) ? n + r : r;
+        }
+      }
+    }
+  }
+
+  /// check that each block times its inverse is the identity
+  void checkInverses(const CFuint n, const CFuint nbBlocks,
+                     const std::vector<CFreal>& blocks, const std::vector<CFreal>& inverses)
+  {
+    for (CFuint b = 0; b < nbBlocks; ++b) {
+      const CFreal* a = &blocks[b*n*n];
+      const CFreal* x = &inverses[b*n*n];
+      for (CFuint i = 0; i < n; ++i) {
+        for (CFuint j = 0; j < n; ++j) {
+          CFreal sum = 0.;
+          for (CFuint k = 0; k < n; ++k) {
+            sum += a[i*n + k]*x[k*n + j];
+          }
+          BOOST_CHECK_SMALL( sum - ((i == j) ? 1. : 0.), 1E-12 );
+        }
+      }
+    }
+  }
+
   /// common values accessed by all tests goes here
 };
 
@@ -183,6 +221,95 @@ BOOST_AUTO_TEST_CASE( test_size5 )
   BOOST_CHECK_CLOSE( x(4,3), -0.10000, 1E-10 );
   BOOST_CHECK_CLOSE( x(4,4),  0.16666666666667, 1E-10 );
 }
+
+BOOST_AUTO_TEST_CASE( test_batched_invert )
+{
+  // fixed size instantiation and generic one, with incomplete last groups
+  const CFuint sizes[2] = {5, 12};
+  for (CFuint s = 0; s < 2; ++s) {
+    const CFuint n = sizes[s];
+    const CFuint nbBlocks = 3*BatchedBlockInverter::BATCH_SIZE + 3;
+    std::vector<CFreal> blocks;
+    fillBlocks(n, nbBlocks, blocks);
+
+    BatchedBlockInverter inverter(n);
+    std::vector<CFreal> inverses(blocks.size());
+    inverter.invert(&blocks[0], &inverses[0], nbBlocks);
+    BOOST_CHECK_EQUAL( inverter.getNbFallbackBlocks(), 0u );
+    checkInverses(n, nbBlocks, blocks, inverses);
+
+    // in place
+    std::vector<CFreal> inPlace(blocks);
+    inverter.invert(&inPlace[0], nbBlocks);
+    for (CFuint e = 0; e < blocks.size(); ++e) {
+      BOOST_CHECK_EQUAL( inPlace[e], inverses[e] );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( test_batched_pivoting )
+{
+  // the second block has only zero pivots and the third one a tiny first
+  // pivot, which would spoil the inverse without pivoting
+  const CFuint sizes[2] = {5, 11};
+  for (CFuint s = 0; s < 2; ++s) {
+    const CFuint n = sizes[s];
+    const CFuint nbBlocks = 3;
+    std::vector<CFreal> blocks;
+    fillBlocks(n, nbBlocks, blocks);
+    CFreal* a = &blocks[n*n];
+    for (CFuint e = 0; e < n*n; ++e) {
+      a[e] = 0.;
+    }
+    for (CFuint i = 0; i < n; ++i) {
+      a[i*n + (i+1)%n] = i + 1.;
+    }
+    CFreal* b = &blocks[2*n*n];
+    b[0] = 1e-8;
+    b[n] = 1.;
+
+    BatchedBlockInverter inverter(n);
+    std::vector<CFreal> inverses(blocks);
+    inverter.invert(&inverses[0], nbBlocks);
+    BOOST_CHECK_EQUAL( inverter.getNbFallbackBlocks(), 0u );
+    checkInverses(n, nbBlocks, blocks, inverses);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( test_batched_solve )
+{
+  const CFuint sizes[2] = {4, 15};
+  for (CFuint s = 0; s < 2; ++s) {
+    const CFuint n = sizes[s];
+    const CFuint nbBlocks = 2*BatchedBlockInverter::BATCH_SIZE + 5;
+    std::vector<CFreal> blocks;
+    fillBlocks(n, nbBlocks, blocks);
+    // one block that needs pivoting
+    blocks[3*n*n] = 0.;
+
+    std::vector<CFreal> rhs(nbBlocks*n);
+    for (CFuint e = 0; e < rhs.size(); ++e) {
+      rhs[e] = std::rand()/static_cast<CFreal>(RAND_MAX);
+    }
+
+    BatchedBlockInverter inverter(n);
+    inverter.factor(&blocks[0], nbBlocks);
+    BOOST_CHECK_EQUAL( inverter.getNbFallbackBlocks(), 0u );
+    std::vector<CFreal> x(rhs);
+    inverter.solve(&x[0]);
+
+    for (CFuint b = 0; b < nbBlocks; ++b) {
+      for (CFuint i = 0; i < n; ++i) {
+        CFreal sum = 0.;
+        for (CFuint j = 0; j < n; ++j) {
+          sum += blocks[(b*n + i)*n + j]*x[b*n + j];
+        }
+        BOOST_CHECK_SMALL( sum - rhs[b*n + i], 1E-12 );
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 BOOST_AUTO_TEST_SUITE_END()
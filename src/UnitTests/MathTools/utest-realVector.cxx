@@ -20,6 +20,8 @@
 #include <boost/test/unit_test.hpp>
 
 #include "MathTools/RealVector.hh"
+#include "MathTools/RealMatrix.hh"
+#include "MathTools/ScratchArena.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -98,6 +100,67 @@ BOOST_AUTO_TEST_CASE( test_equal_vec_mult_vec )
   for (size_t i = 0; i < size; ++i ) { BOOST_CHECK_CLOSE ( v3[i] , 3. + i + 3.*i + i*i , 1E-10 ); }
 }
 
+BOOST_AUTO_TEST_CASE( test_inline_storage )
+{
+  // copies do not share the storage (inline for small vectors, if enabled)
+  RealVector v1 (2.0, 2);
+  RealVector v2 (v1);
+  v2[0] = 5.;
+  BOOST_CHECK( v1[0] == 2. );
+  BOOST_CHECK( v2.ptr() != v1.ptr() );
+  
+  // growing beyond the inline storage and back
+  v1.resize(CF_SMALLVEC_SIZE + 10, 3.);
+  BOOST_CHECK( v1.size() == CF_SMALLVEC_SIZE + 10 );
+  BOOST_CHECK( v1[CF_SMALLVEC_SIZE + 9] == 3. );
+  v1.resize(1, 4.);
+  BOOST_CHECK( v1.size() == 1 );
+  BOOST_CHECK( v1[0] == 4. );
+  
+  std::vector<RealVector> list(10, RealVector(1.0, 3));
+  list.resize(100, RealVector(2.0, 3));
+  BOOST_CHECK( list[5][2] == 1. );
+  BOOST_CHECK( list[50][2] == 2. );
+  
+  RealMatrix m1 (2, 2, 1.);
+  RealMatrix m2 (m1);
+  m2(1,1) = 7.;
+  BOOST_CHECK( m1(1,1) == 1. );
+  BOOST_CHECK( m2(1,1) == 7. );
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_arena )
+{
+  ScratchArena arena(8);
+  RealVector v1;
+  RealVector v2;
+  arena.getVector(v1, 6, 1.);
+  arena.getVector(v2, 6, 2.); // does not fit in the first block
+  BOOST_CHECK( arena.getNbUsedEntries() == 12 );
+  BOOST_CHECK( v1[5] == 1. );
+  BOOST_CHECK( v2[5] == 2. );
+  BOOST_CHECK( !v1.isMemoryOwner() );
+  
+  RealMatrix m;
+  arena.getMatrix(m, 3, 4, 5.);
+  BOOST_CHECK( m(2,3) == 5. );
+  
+  // after the reset all the memory of the last use is in one block
+  arena.reset();
+  BOOST_CHECK( arena.getNbUsedEntries() == 0 );
+  CFreal *const first = arena.allocate(12);
+  CFreal *const second = arena.allocate(12);
+  BOOST_CHECK( second == first + 12 );
+  
+  // the entries handed out inside a scope are reused after it
+  {
+    ScratchArena::Scope scope(arena);
+    arena.getVector(v1, 4);
+  }
+  BOOST_CHECK( arena.getNbUsedEntries() == 24 );
+  BOOST_CHECK( arena.allocate(4) == second + 12 );
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 BOOST_AUTO_TEST_SUITE_END()
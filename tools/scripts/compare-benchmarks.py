@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+#
+# Compares the JSON files written by the benchmarks ("make benchmark") with the
+# ones of a baseline run, phase by phase, and exits with 1 if a phase got slower
+# by more than the tolerance.
+#
+# usage: compare-benchmarks.py <baseline dir> <current dir> [tolerance in %, default 10]
+
+import glob
+import json
+import os
+import sys
+
+def main():
+    if len(sys.argv) < 3:
+        print("usage: %s <baseline dir> <current dir> [tolerance %%]" % sys.argv[0])
+        return 2
+
+    baseDir, currDir = sys.argv[1], sys.argv[2]
+    tolerance = float(sys.argv[3]) if len(sys.argv) > 3 else 10.
+
+    nbRegressions = 0
+    for currFile in sorted(glob.glob(os.path.join(currDir, "*.json"))):
+        baseFile = os.path.join(baseDir, os.path.basename(currFile))
+        if not os.path.exists(baseFile):
+            print("%s: no baseline, skipped" % os.path.basename(currFile))
+            continue
+
+        with open(baseFile) as f:
+            base = json.load(f)
+        with open(currFile) as f:
+            curr = json.load(f)
+
+        print("%s:" % os.path.basename(currFile))
+        phases = dict(curr["phases"])
+        if "totalTime" in curr:
+            phases["Total"] = {"time": curr["totalTime"]}
+        basePhases = dict(base["phases"])
+        if "totalTime" in base:
+            basePhases["Total"] = {"time": base["totalTime"]}
+
+        for name in sorted(phases):
+            if name not in basePhases or basePhases[name]["time"] <= 0.:
+                continue
+            baseTime = basePhases[name]["time"]
+            currTime = phases[name]["time"]
+            change = (currTime - baseTime)*100./baseTime
+            status = ""
+            if change > tolerance:
+                status = "  <== REGRESSION"
+                nbRegressions += 1
+            print("  %-30s %12.5g %12.5g %+8.1f%%%s" % (name, baseTime, currTime, change, status))
+
+        if "peakMemoryBytes" in curr and "peakMemoryBytes" in base and base["peakMemoryBytes"] > 0:
+            change = (curr["peakMemoryBytes"] - base["peakMemoryBytes"])*100./base["peakMemoryBytes"]
+            print("  %-30s %12.5g %12.5g %+8.1f%%" % ("PeakMemory", base["peakMemoryBytes"], curr["peakMemoryBytes"], change))
+
+    if nbRegressions > 0:
+        print("%d phase(s) slower by more than %g%%" % (nbRegressions, tolerance))
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())